@@ -0,0 +1,127 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* Arduino.h																		*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino Due core header								*/
+/*		Only the part of the Arduino API used by the W-Link firmware is provided	*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __ARDUINO_H__
+#define __ARDUINO_H__
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <ctype.h>
+
+#include "binary.h"
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+
+#define HIGH				0x1
+#define LOW					0x0
+
+#define INPUT				0x0
+#define OUTPUT				0x1
+#define INPUT_PULLUP		0x2
+
+#define CHANGE				1
+#define FALLING				2
+#define RISING				3
+
+#define DEC					10
+#define HEX					16
+#define OCT					8
+#define BIN					2
+
+#define PROGMEM
+#define F(String_Str)		(String_Str)
+
+/* Arduino Due pinout */
+#define A0					54
+#define A1					55
+#define A2					56
+#define A3					57
+#define A4					58
+#define A5					59
+#define A6					60
+#define A7					61
+#define A8					62
+#define A9					63
+#define A10					64
+#define A11					65
+#define DAC0				66
+#define DAC1				67
+#define CANRX				68
+#define CANTX				69
+#define LED_BUILTIN			13
+#define SS					10
+
+#define HOST_HAL_PIN_NB		92		// Arduino Due digital + analog pins
+
+#define digitalPinToInterrupt(Pin)	(Pin)
+
+#define bitRead(Value, Bit)					(((Value) >> (Bit)) & 0x01)
+#define bitSet(Value, Bit)					((Value) |= (1UL << (Bit)))
+#define bitClear(Value, Bit)				((Value) &= ~(1UL << (Bit)))
+#define bitWrite(Value, Bit, BitValue)		((BitValue) ? bitSet(Value, Bit) : bitClear(Value, Bit))
+#define lowByte(Word)						((uint8_t)((Word) & 0xFF))
+#define highByte(Word)						((uint8_t)((Word) >> 8))
+#define constrain(Amt, Low, High)			((Amt) < (Low) ? (Low) : ((Amt) > (High) ? (High) : (Amt)))
+
+/* ******************************************************************************** */
+/* Types
+/* ******************************************************************************** */
+typedef bool boolean;
+typedef uint8_t byte;
+typedef unsigned int word;
+
+/* ******************************************************************************** */
+/* Functions Prototypes
+/* ******************************************************************************** */
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(unsigned long Ms_UL);
+void delayMicroseconds(unsigned int Us_UI);
+void yield(void);
+
+void pinMode(uint32_t Pin_UL, uint32_t Mode_UL);
+void digitalWrite(uint32_t Pin_UL, uint32_t Value_UL);
+int digitalRead(uint32_t Pin_UL);
+int analogRead(uint32_t Pin_UL);
+void analogWrite(uint32_t Pin_UL, uint32_t Value_UL);
+
+void attachInterrupt(uint32_t Pin_UL, void(*pFctCallback)(void), uint32_t Mode_UL);
+void detachInterrupt(uint32_t Pin_UL);
+void noInterrupts(void);
+void interrupts(void);
+
+long random(long Max_SL);
+long random(long Min_SL, long Max_SL);
+void randomSeed(unsigned long Seed_UL);
+
+#ifdef __cplusplus
+template<class T, class L> auto min(const T & a, const L & b) -> decltype((b < a) ? b : a) { return (b < a) ? b : a; }
+template<class T, class L> auto max(const T & a, const L & b) -> decltype((b < a) ? b : a) { return (a < b) ? b : a; }
+
+#include "WString.h"
+#include "Print.h"
+#include "Stream.h"
+#include "HardwareSerial.h"
+#include "IPAddress.h"
+#endif
+
+#endif // __ARDUINO_H__
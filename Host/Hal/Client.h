@@ -0,0 +1,40 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* Client.h																		*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino Client interface							*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __CLIENT_H__
+#define __CLIENT_H__
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include <Arduino.h>
+
+/* ******************************************************************************** */
+/* Class
+/* ******************************************************************************** */
+class Client : public Stream {
+public:
+	virtual int connect(IPAddress Ip_X, uint16_t Port_UW) = 0;
+	virtual int connect(const char * pHost_UB, uint16_t Port_UW) = 0;
+	virtual size_t write(uint8_t Data_UB) = 0;
+	virtual size_t write(const uint8_t * pBuffer_UB, size_t Size) = 0;
+	virtual int available() = 0;
+	virtual int read() = 0;
+	virtual int read(uint8_t * pBuffer_UB, size_t Size) = 0;
+	virtual int peek() = 0;
+	virtual void flush() = 0;
+	virtual void stop() = 0;
+	virtual uint8_t connected() = 0;
+	virtual operator bool() = 0;
+};
+
+#endif // __CLIENT_H__
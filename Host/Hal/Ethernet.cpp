@@ -0,0 +1,674 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* Ethernet.cpp																	*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino Ethernet library						*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "HostHal.h"
+#include "Ethernet.h"
+#include "EthernetUdp.h"
+#include "utility/w5100.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+#define HOST_ETHERNET_DEFAULT_PORT_OFFSET	10000		// Board ports are opened at <port> + offset on 127.0.0.1
+#define HOST_ETHERNET_LISTEN_BACKLOG		4
+#define HOST_ETHERNET_WRITE_TIMEOUT_MS		1000
+
+// W5100 socket status register values
+#define HOST_ETHERNET_SNSR_CLOSED			0x00
+#define HOST_ETHERNET_SNSR_LISTEN			0x14
+#define HOST_ETHERNET_SNSR_ESTABLISHED		0x17
+#define HOST_ETHERNET_SNSR_CLOSE_WAIT		0x1C
+#define HOST_ETHERNET_SNSR_UDP				0x22
+
+/* ******************************************************************************** */
+/* Structure & Enumeration
+/* ******************************************************************************** */
+
+// One W5100 hardware socket : the firmware sees the same exhaustion as on the board
+typedef struct {
+	uint8_t Status_UB;				// HOST_ETHERNET_SNSR_xxx
+	uint16_t Port_UW;				// Listening port for a server socket, local port for UDP
+	int Fd_SI;						// Host socket, -1 in LISTEN (see the listener table)
+} HOST_ETHERNET_SOCKET_STRUCT;
+
+// Host listening socket shared by the W5100 sockets listening on the same port
+typedef struct {
+	boolean IsUsed_B;
+	uint16_t Port_UW;
+	int Fd_SI;
+} HOST_ETHERNET_LISTENER_STRUCT;
+
+/* ******************************************************************************** */
+/* Local Variables
+/* ******************************************************************************** */
+EthernetClass Ethernet;
+W5100Class W5100;
+SPIClass SPI;
+
+static HOST_ETHERNET_SOCKET_STRUCT GL_pHostEthernetSocket_X[MAX_SOCK_NUM];
+static HOST_ETHERNET_LISTENER_STRUCT GL_pHostEthernetListener_X[MAX_SOCK_NUM];
+static unsigned int GL_HostEthernetPortOffset_UI = HOST_ETHERNET_DEFAULT_PORT_OFFSET;
+
+/* ******************************************************************************** */
+/* Prototypes for Internal Functions
+/* ******************************************************************************** */
+static uint8_t FindFreeSocket(void);
+static uint8_t AllocateSocket(uint8_t Status_UB, uint16_t Port_UW, int Fd_SI);
+static void ReleaseSocket(uint8_t Sock_UB);
+static uint8_t GetSocketStatus(uint8_t Sock_UB);
+static int OpenListener(uint16_t Port_UW);
+static void SetHostAddress(struct sockaddr_in * pAddr_X, uint16_t Port_UW);
+static uint16_t GetBoardPort(const struct sockaddr_in * pAddr_X);
+static void SetNonBlocking(int Fd_SI);
+
+/* ******************************************************************************** */
+/* Functions
+/* ******************************************************************************** */
+
+void HostHal_SetPortOffset(unsigned int Offset_UI) {
+	GL_HostEthernetPortOffset_UI = Offset_UI;
+}
+
+unsigned int HostHal_GetPortOffset(void) {
+	return GL_HostEthernetPortOffset_UI;
+}
+
+// Accepts the pending connections into the listening W5100 sockets (what the chip does in hardware)
+void HostHal_EthernetPoll(void) {
+	for (int i = 0; i < MAX_SOCK_NUM; i++) {
+		HOST_ETHERNET_LISTENER_STRUCT * pListener_X = &GL_pHostEthernetListener_X[i];
+		if (!pListener_X->IsUsed_B)
+			continue;
+
+		for (;;) {
+			int Fd_SI = accept(pListener_X->Fd_SI, NULL, NULL);
+			if (Fd_SI < 0)
+				break;
+
+			uint8_t Sock_UB = MAX_SOCK_NUM;
+			for (uint8_t j = 0; j < MAX_SOCK_NUM; j++) {
+				if ((GL_pHostEthernetSocket_X[j].Status_UB == HOST_ETHERNET_SNSR_LISTEN) && (GL_pHostEthernetSocket_X[j].Port_UW == pListener_X->Port_UW)) {
+					Sock_UB = j;
+					break;
+				}
+			}
+
+			// No socket listening : the W5100 resets the connection
+			if (Sock_UB == MAX_SOCK_NUM) {
+				close(Fd_SI);
+				continue;
+			}
+
+			SetNonBlocking(Fd_SI);
+			GL_pHostEthernetSocket_X[Sock_UB].Status_UB = HOST_ETHERNET_SNSR_ESTABLISHED;
+			GL_pHostEthernetSocket_X[Sock_UB].Fd_SI = Fd_SI;
+
+			// Keep listening on another socket if one is left
+			AllocateSocket(HOST_ETHERNET_SNSR_LISTEN, pListener_X->Port_UW, -1);
+		}
+	}
+}
+
+/* ******************************************************************************** */
+/* EthernetClass
+/* ******************************************************************************** */
+
+int EthernetClass::begin(uint8_t * pMac_UB) {
+	begin(pMac_UB, IPAddress(127, 0, 0, 1));
+	return 1;
+}
+
+void EthernetClass::begin(uint8_t * pMac_UB, IPAddress LocalIp_X) {
+	IPAddress DnsIp_X = LocalIp_X;
+	DnsIp_X[3] = 1;
+	begin(pMac_UB, LocalIp_X, DnsIp_X);
+}
+
+void EthernetClass::begin(uint8_t * pMac_UB, IPAddress LocalIp_X, IPAddress DnsIp_X) {
+	IPAddress GatewayIp_X = LocalIp_X;
+	GatewayIp_X[3] = 1;
+	begin(pMac_UB, LocalIp_X, DnsIp_X, GatewayIp_X);
+}
+
+void EthernetClass::begin(uint8_t * pMac_UB, IPAddress LocalIp_X, IPAddress DnsIp_X, IPAddress GatewayIp_X) {
+	begin(pMac_UB, LocalIp_X, DnsIp_X, GatewayIp_X, IPAddress(255, 255, 255, 0));
+}
+
+void EthernetClass::begin(uint8_t * pMac_UB, IPAddress LocalIp_X, IPAddress DnsIp_X, IPAddress GatewayIp_X, IPAddress SubnetMask_X) {
+	(void)pMac_UB;
+
+	// The chip is reset : all the sockets are closed
+	for (uint8_t i = 0; i < MAX_SOCK_NUM; i++)
+		ReleaseSocket(i);
+
+	this->LocalIp_X = LocalIp_X;
+	this->DnsIp_X = DnsIp_X;
+	this->GatewayIp_X = GatewayIp_X;
+	this->SubnetMask_X = SubnetMask_X;
+}
+
+int EthernetClass::maintain() {
+	return 0;
+}
+
+IPAddress EthernetClass::localIP()		{ return LocalIp_X; }
+IPAddress EthernetClass::subnetMask()	{ return SubnetMask_X; }
+IPAddress EthernetClass::gatewayIP()	{ return GatewayIp_X; }
+IPAddress EthernetClass::dnsServerIP()	{ return DnsIp_X; }
+
+EthernetLinkStatus EthernetClass::linkStatus() {
+	return LinkON;
+}
+
+EthernetHardwareStatus EthernetClass::hardwareStatus() {
+	return EthernetW5100;
+}
+
+/* ******************************************************************************** */
+/* W5100Class
+/* ******************************************************************************** */
+
+void W5100Class::setIPAddress(uint8_t * pAddr_UB)	{ Ethernet.setLocalIP(IPAddress(pAddr_UB[0], pAddr_UB[1], pAddr_UB[2], pAddr_UB[3])); }
+void W5100Class::setGatewayIp(uint8_t * pAddr_UB)	{ Ethernet.setGatewayIP(IPAddress(pAddr_UB[0], pAddr_UB[1], pAddr_UB[2], pAddr_UB[3])); }
+void W5100Class::setSubnetMask(uint8_t * pAddr_UB)	{ Ethernet.setSubnetMask(IPAddress(pAddr_UB[0], pAddr_UB[1], pAddr_UB[2], pAddr_UB[3])); }
+
+/* ******************************************************************************** */
+/* EthernetClient
+/* ******************************************************************************** */
+
+EthernetClient::EthernetClient() {
+	Sock_UB = MAX_SOCK_NUM;
+}
+
+EthernetClient::EthernetClient(uint8_t Sock_UB) {
+	this->Sock_UB = Sock_UB;
+}
+
+uint8_t EthernetClient::status() {
+	return GetSocketStatus(Sock_UB);
+}
+
+// Every destination is the loopback interface : the remote end is a local test tool
+int EthernetClient::connect(IPAddress Ip_X, uint16_t Port_UW) {
+	struct sockaddr_in Addr_X;
+	(void)Ip_X;
+
+	if ((Sock_UB != MAX_SOCK_NUM) || (FindFreeSocket() == MAX_SOCK_NUM))
+		return 0;
+
+	int Fd_SI = socket(AF_INET, SOCK_STREAM, 0);
+	if (Fd_SI < 0)
+		return 0;
+
+	SetHostAddress(&Addr_X, Port_UW);
+	if (::connect(Fd_SI, (struct sockaddr *)&Addr_X, sizeof(Addr_X)) < 0) {
+		close(Fd_SI);
+		return 0;
+	}
+
+	SetNonBlocking(Fd_SI);
+	Sock_UB = AllocateSocket(HOST_ETHERNET_SNSR_ESTABLISHED, 0, Fd_SI);
+	return 1;
+}
+
+int EthernetClient::connect(const char * pHost_UB, uint16_t Port_UW) {
+	(void)pHost_UB;
+	return connect(IPAddress(127, 0, 0, 1), Port_UW);
+}
+
+size_t EthernetClient::write(uint8_t Data_UB) {
+	return write(&Data_UB, 1);
+}
+
+// Blocking like the W5100 library : returns once the data is in the socket buffer
+size_t EthernetClient::write(const uint8_t * pBuffer_UB, size_t Size) {
+	size_t Sent = 0;
+
+	if (status() != HOST_ETHERNET_SNSR_ESTABLISHED)
+		return 0;
+
+	int Fd_SI = GL_pHostEthernetSocket_X[Sock_UB].Fd_SI;
+	while (Sent < Size) {
+		ssize_t Nb = send(Fd_SI, pBuffer_UB + Sent, Size - Sent, MSG_DONTWAIT | MSG_NOSIGNAL);
+		if (Nb > 0) {
+			Sent += (size_t)Nb;
+		}
+		else if ((Nb < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK))) {
+			struct pollfd Poll_X = { Fd_SI, POLLOUT, 0 };
+			if (poll(&Poll_X, 1, HOST_ETHERNET_WRITE_TIMEOUT_MS) <= 0)
+				break;
+		}
+		else {
+			break;
+		}
+	}
+
+	return Sent;
+}
+
+int EthernetClient::available() {
+	int Nb_SI = 0;
+	uint8_t Status_UB = status();
+
+	if ((Status_UB != HOST_ETHERNET_SNSR_ESTABLISHED) && (Status_UB != HOST_ETHERNET_SNSR_CLOSE_WAIT))
+		return 0;
+
+	if (ioctl(GL_pHostEthernetSocket_X[Sock_UB].Fd_SI, FIONREAD, &Nb_SI) < 0)
+		return 0;
+
+	return Nb_SI;
+}
+
+int EthernetClient::availableForWrite() {
+	return (status() == HOST_ETHERNET_SNSR_ESTABLISHED) ? ETHERNET_UDP_TX_PACKET_MAX_SIZE : 0;
+}
+
+int EthernetClient::read() {
+	uint8_t Data_UB;
+	return (read(&Data_UB, 1) == 1) ? Data_UB : -1;
+}
+
+int EthernetClient::read(uint8_t * pBuffer_UB, size_t Size) {
+	if (available() == 0)
+		return -1;
+
+	ssize_t Nb = recv(GL_pHostEthernetSocket_X[Sock_UB].Fd_SI, pBuffer_UB, Size, MSG_DONTWAIT);
+	return (Nb > 0) ? (int)Nb : -1;
+}
+
+int EthernetClient::peek() {
+	uint8_t Data_UB;
+
+	if (available() == 0)
+		return -1;
+
+	return (recv(GL_pHostEthernetSocket_X[Sock_UB].Fd_SI, &Data_UB, 1, MSG_DONTWAIT | MSG_PEEK) == 1) ? Data_UB : -1;
+}
+
+void EthernetClient::flush() {
+}
+
+void EthernetClient::stop() {
+	if (Sock_UB == MAX_SOCK_NUM)
+		return;
+
+	ReleaseSocket(Sock_UB);
+	Sock_UB = MAX_SOCK_NUM;
+}
+
+uint8_t EthernetClient::connected() {
+	uint8_t Status_UB = status();
+	return ((Status_UB == HOST_ETHERNET_SNSR_ESTABLISHED) || ((Status_UB == HOST_ETHERNET_SNSR_CLOSE_WAIT) && (available() > 0))) ? 1 : 0;
+}
+
+EthernetClient::operator bool() {
+	return (Sock_UB != MAX_SOCK_NUM);
+}
+
+bool EthernetClient::operator==(const EthernetClient & Client_H) {
+	return ((Sock_UB == Client_H.Sock_UB) && (Sock_UB != MAX_SOCK_NUM));
+}
+
+uint8_t EthernetClient::getSocketNumber() {
+	return Sock_UB;
+}
+
+IPAddress EthernetClient::remoteIP() {
+	return (Sock_UB != MAX_SOCK_NUM) ? IPAddress(127, 0, 0, 1) : IPAddress(0, 0, 0, 0);
+}
+
+uint16_t EthernetClient::remotePort() {
+	struct sockaddr_in Addr_X;
+	socklen_t Size = sizeof(Addr_X);
+
+	if ((Sock_UB >= MAX_SOCK_NUM) || (GL_pHostEthernetSocket_X[Sock_UB].Status_UB == HOST_ETHERNET_SNSR_CLOSED) || (GL_pHostEthernetSocket_X[Sock_UB].Fd_SI < 0))
+		return 0;
+
+	if (getpeername(GL_pHostEthernetSocket_X[Sock_UB].Fd_SI, (struct sockaddr *)&Addr_X, &Size) < 0)
+		return 0;
+
+	return ntohs(Addr_X.sin_port);
+}
+
+/* ******************************************************************************** */
+/* EthernetServer
+/* ******************************************************************************** */
+
+EthernetServer::EthernetServer(uint16_t Port_UW) {
+	this->Port_UW = Port_UW;
+}
+
+void EthernetServer::begin() {
+	if (OpenListener(Port_UW) < 0)
+		return;
+
+	for (uint8_t i = 0; i < MAX_SOCK_NUM; i++) {
+		if ((GL_pHostEthernetSocket_X[i].Status_UB == HOST_ETHERNET_SNSR_LISTEN) && (GL_pHostEthernetSocket_X[i].Port_UW == Port_UW))
+			return;
+	}
+
+	AllocateSocket(HOST_ETHERNET_SNSR_LISTEN, Port_UW, -1);
+}
+
+// Same policy as the W5100 library : first client with data, closed clients are released
+EthernetClient EthernetServer::available() {
+	boolean IsListening_B = false;
+	uint8_t Sock_UB = MAX_SOCK_NUM;
+
+	HostHal_EthernetPoll();
+
+	for (uint8_t i = 0; i < MAX_SOCK_NUM; i++) {
+		if (GL_pHostEthernetSocket_X[i].Port_UW != Port_UW)
+			continue;
+
+		EthernetClient Client_H(i);
+		uint8_t Status_UB = Client_H.status();
+
+		if (Status_UB == HOST_ETHERNET_SNSR_LISTEN) {
+			IsListening_B = true;
+		}
+		else if ((Status_UB == HOST_ETHERNET_SNSR_ESTABLISHED) || (Status_UB == HOST_ETHERNET_SNSR_CLOSE_WAIT)) {
+			if (Client_H.available() > 0) {
+				if (Sock_UB == MAX_SOCK_NUM)
+					Sock_UB = i;
+			}
+			else if (Status_UB == HOST_ETHERNET_SNSR_CLOSE_WAIT) {
+				Client_H.stop();
+			}
+		}
+	}
+
+	if (!IsListening_B)
+		begin();
+
+	return EthernetClient(Sock_UB);
+}
+
+size_t EthernetServer::write(uint8_t Data_UB) {
+	return write(&Data_UB, 1);
+}
+
+size_t EthernetServer::write(const uint8_t * pBuffer_UB, size_t Size) {
+	for (uint8_t i = 0; i < MAX_SOCK_NUM; i++) {
+		EthernetClient Client_H(i);
+		if ((GL_pHostEthernetSocket_X[i].Port_UW == Port_UW) && (Client_H.status() == HOST_ETHERNET_SNSR_ESTABLISHED))
+			Client_H.write(pBuffer_UB, Size);
+	}
+
+	return Size;
+}
+
+/* ******************************************************************************** */
+/* EthernetUDP
+/* ******************************************************************************** */
+
+EthernetUDP::EthernetUDP() {
+	Sock_UB = MAX_SOCK_NUM;
+	TxPort_UW = 0;
+	TxSize = 0;
+	RxPort_UW = 0;
+	RxSize = 0;
+	RxIdx = 0;
+}
+
+uint8_t EthernetUDP::begin(uint16_t Port_UW) {
+	struct sockaddr_in Addr_X;
+	int Option_SI = 1;
+
+	if (Sock_UB != MAX_SOCK_NUM)
+		stop();
+
+	int Fd_SI = socket(AF_INET, SOCK_DGRAM, 0);
+	if (Fd_SI < 0)
+		return 0;
+
+	setsockopt(Fd_SI, SOL_SOCKET, SO_REUSEADDR, &Option_SI, sizeof(Option_SI));
+	SetHostAddress(&Addr_X, Port_UW);
+	if (bind(Fd_SI, (struct sockaddr *)&Addr_X, sizeof(Addr_X)) < 0) {
+		close(Fd_SI);
+		return 0;
+	}
+
+	SetNonBlocking(Fd_SI);
+	Sock_UB = AllocateSocket(HOST_ETHERNET_SNSR_UDP, Port_UW, Fd_SI);
+	if (Sock_UB == MAX_SOCK_NUM) {
+		close(Fd_SI);
+		return 0;
+	}
+
+	TxSize = 0;
+	RxSize = 0;
+	RxIdx = 0;
+	return 1;
+}
+
+void EthernetUDP::stop() {
+	if (Sock_UB == MAX_SOCK_NUM)
+		return;
+
+	ReleaseSocket(Sock_UB);
+	Sock_UB = MAX_SOCK_NUM;
+}
+
+int EthernetUDP::beginPacket(IPAddress Ip_X, uint16_t Port_UW) {
+	if (Sock_UB == MAX_SOCK_NUM)
+		return 0;
+
+	TxIp_X = Ip_X;
+	TxPort_UW = Port_UW;
+	TxSize = 0;
+	return 1;
+}
+
+int EthernetUDP::beginPacket(const char * pHost_UB, uint16_t Port_UW) {
+	(void)pHost_UB;
+	return beginPacket(IPAddress(127, 0, 0, 1), Port_UW);
+}
+
+// Every destination (broadcast included) is the loopback interface
+int EthernetUDP::endPacket() {
+	struct sockaddr_in Addr_X;
+
+	if (Sock_UB == MAX_SOCK_NUM)
+		return 0;
+
+	SetHostAddress(&Addr_X, TxPort_UW);
+	ssize_t Nb = sendto(GL_pHostEthernetSocket_X[Sock_UB].Fd_SI, pTxBuffer_UB, TxSize, 0, (struct sockaddr *)&Addr_X, sizeof(Addr_X));
+	TxSize = 0;
+
+	return (Nb >= 0) ? 1 : 0;
+}
+
+size_t EthernetUDP::write(uint8_t Data_UB) {
+	return write(&Data_UB, 1);
+}
+
+size_t EthernetUDP::write(const uint8_t * pBuffer_UB, size_t Size) {
+	if (Size > sizeof(pTxBuffer_UB) - TxSize)
+		Size = sizeof(pTxBuffer_UB) - TxSize;
+
+	memcpy(pTxBuffer_UB + TxSize, pBuffer_UB, Size);
+	TxSize += Size;
+	return Size;
+}
+
+int EthernetUDP::parsePacket() {
+	struct sockaddr_in Addr_X;
+	socklen_t Size = sizeof(Addr_X);
+
+	RxSize = 0;
+	RxIdx = 0;
+
+	if (Sock_UB == MAX_SOCK_NUM)
+		return 0;
+
+	ssize_t Nb = recvfrom(GL_pHostEthernetSocket_X[Sock_UB].Fd_SI, pRxBuffer_UB, sizeof(pRxBuffer_UB), MSG_DONTWAIT, (struct sockaddr *)&Addr_X, &Size);
+	if (Nb <= 0)
+		return 0;
+
+	RxSize = (size_t)Nb;
+	RxIp_X = IPAddress(127, 0, 0, 1);
+	RxPort_UW = GetBoardPort(&Addr_X);
+	return (int)RxSize;
+}
+
+int EthernetUDP::available() {
+	return (int)(RxSize - RxIdx);
+}
+
+int EthernetUDP::read() {
+	return (RxIdx < RxSize) ? pRxBuffer_UB[RxIdx++] : -1;
+}
+
+int EthernetUDP::read(unsigned char * pBuffer_UB, size_t Size) {
+	if (RxIdx >= RxSize)
+		return -1;
+
+	if (Size > RxSize - RxIdx)
+		Size = RxSize - RxIdx;
+
+	memcpy(pBuffer_UB, pRxBuffer_UB + RxIdx, Size);
+	RxIdx += Size;
+	return (int)Size;
+}
+
+int EthernetUDP::peek() {
+	return (RxIdx < RxSize) ? pRxBuffer_UB[RxIdx] : -1;
+}
+
+void EthernetUDP::flush() {
+	RxIdx = RxSize;
+}
+
+IPAddress EthernetUDP::remoteIP() {
+	return RxIp_X;
+}
+
+uint16_t EthernetUDP::remotePort() {
+	return RxPort_UW;
+}
+
+/* ******************************************************************************** */
+/* Internal Functions
+/* ******************************************************************************** */
+
+uint8_t FindFreeSocket(void) {
+	for (uint8_t i = 0; i < MAX_SOCK_NUM; i++) {
+		if (GL_pHostEthernetSocket_X[i].Status_UB == HOST_ETHERNET_SNSR_CLOSED)
+			return i;
+	}
+
+	return MAX_SOCK_NUM;
+}
+
+uint8_t AllocateSocket(uint8_t Status_UB, uint16_t Port_UW, int Fd_SI) {
+	uint8_t Sock_UB = FindFreeSocket();
+
+	if (Sock_UB != MAX_SOCK_NUM) {
+		GL_pHostEthernetSocket_X[Sock_UB].Status_UB = Status_UB;
+		GL_pHostEthernetSocket_X[Sock_UB].Port_UW = Port_UW;
+		GL_pHostEthernetSocket_X[Sock_UB].Fd_SI = Fd_SI;
+	}
+
+	return Sock_UB;
+}
+
+// The host socket only exists while the W5100 socket is not closed
+void ReleaseSocket(uint8_t Sock_UB) {
+	HOST_ETHERNET_SOCKET_STRUCT * pSocket_X = &GL_pHostEthernetSocket_X[Sock_UB];
+
+	if ((pSocket_X->Status_UB != HOST_ETHERNET_SNSR_CLOSED) && (pSocket_X->Fd_SI >= 0))
+		close(pSocket_X->Fd_SI);
+
+	pSocket_X->Status_UB = HOST_ETHERNET_SNSR_CLOSED;
+	pSocket_X->Port_UW = 0;
+	pSocket_X->Fd_SI = -1;
+}
+
+// Detects the remote close lazily, as the W5100 reports it in its status register
+uint8_t GetSocketStatus(uint8_t Sock_UB) {
+	uint8_t Data_UB;
+
+	if (Sock_UB >= MAX_SOCK_NUM)
+		return HOST_ETHERNET_SNSR_CLOSED;
+
+	HOST_ETHERNET_SOCKET_STRUCT * pSocket_X = &GL_pHostEthernetSocket_X[Sock_UB];
+	if (pSocket_X->Status_UB == HOST_ETHERNET_SNSR_ESTABLISHED) {
+		ssize_t Nb = recv(pSocket_X->Fd_SI, &Data_UB, 1, MSG_DONTWAIT | MSG_PEEK);
+		if ((Nb == 0) || ((Nb < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK)))
+			pSocket_X->Status_UB = HOST_ETHERNET_SNSR_CLOSE_WAIT;
+	}
+
+	return pSocket_X->Status_UB;
+}
+
+int OpenListener(uint16_t Port_UW) {
+	struct sockaddr_in Addr_X;
+	int Option_SI = 1;
+	int Free_SI = -1;
+
+	for (int i = 0; i < MAX_SOCK_NUM; i++) {
+		if (!GL_pHostEthernetListener_X[i].IsUsed_B)
+			Free_SI = (Free_SI < 0) ? i : Free_SI;
+		else if (GL_pHostEthernetListener_X[i].Port_UW == Port_UW)
+			return GL_pHostEthernetListener_X[i].Fd_SI;
+	}
+
+	if (Free_SI < 0)
+		return -1;
+
+	int Fd_SI = socket(AF_INET, SOCK_STREAM, 0);
+	if (Fd_SI < 0)
+		return -1;
+
+	setsockopt(Fd_SI, SOL_SOCKET, SO_REUSEADDR, &Option_SI, sizeof(Option_SI));
+	SetHostAddress(&Addr_X, Port_UW);
+	if ((bind(Fd_SI, (struct sockaddr *)&Addr_X, sizeof(Addr_X)) < 0) || (listen(Fd_SI, HOST_ETHERNET_LISTEN_BACKLOG) < 0)) {
+		fprintf(stderr, "HostHal : cannot listen on port %u\n", (unsigned int)(Port_UW + GL_HostEthernetPortOffset_UI));
+		close(Fd_SI);
+		return -1;
+	}
+
+	SetNonBlocking(Fd_SI);
+	GL_pHostEthernetListener_X[Free_SI].IsUsed_B = true;
+	GL_pHostEthernetListener_X[Free_SI].Port_UW = Port_UW;
+	GL_pHostEthernetListener_X[Free_SI].Fd_SI = Fd_SI;
+	return Fd_SI;
+}
+
+void SetHostAddress(struct sockaddr_in * pAddr_X, uint16_t Port_UW) {
+	memset(pAddr_X, 0, sizeof(struct sockaddr_in));
+	pAddr_X->sin_family = AF_INET;
+	pAddr_X->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	pAddr_X->sin_port = htons((uint16_t)(Port_UW + GL_HostEthernetPortOffset_UI));
+}
+
+uint16_t GetBoardPort(const struct sockaddr_in * pAddr_X) {
+	unsigned int Port_UI = ntohs(pAddr_X->sin_port);
+	return (uint16_t)((Port_UI >= GL_HostEthernetPortOffset_UI) ? (Port_UI - GL_HostEthernetPortOffset_UI) : Port_UI);
+}
+
+void SetNonBlocking(int Fd_SI) {
+	fcntl(Fd_SI, F_SETFL, fcntl(Fd_SI, F_GETFL, 0) | O_NONBLOCK);
+}
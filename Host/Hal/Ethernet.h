@@ -0,0 +1,117 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* Ethernet.h																	*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino Ethernet library (W5100)				*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __ETHERNET_H__
+#define __ETHERNET_H__
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include <Arduino.h>
+#include "Client.h"
+#include "Server.h"
+#include "Udp.h"
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+#define MAX_SOCK_NUM			4			// W5100 hardware sockets
+#define ETHERNET_UDP_TX_PACKET_MAX_SIZE	2048		// W5100 socket buffer
+
+/* ******************************************************************************** */
+/* Structure & Enumeration
+/* ******************************************************************************** */
+enum EthernetLinkStatus { Unknown, LinkON, LinkOFF };
+enum EthernetHardwareStatus { EthernetNoHardware, EthernetW5100, EthernetW5200, EthernetW5500 };
+
+/* ******************************************************************************** */
+/* Class
+/* ******************************************************************************** */
+class EthernetClass {
+public:
+	int begin(uint8_t * pMac_UB);
+	void begin(uint8_t * pMac_UB, IPAddress LocalIp_X);
+	void begin(uint8_t * pMac_UB, IPAddress LocalIp_X, IPAddress DnsIp_X);
+	void begin(uint8_t * pMac_UB, IPAddress LocalIp_X, IPAddress DnsIp_X, IPAddress GatewayIp_X);
+	void begin(uint8_t * pMac_UB, IPAddress LocalIp_X, IPAddress DnsIp_X, IPAddress GatewayIp_X, IPAddress SubnetMask_X);
+	int maintain();
+
+	IPAddress localIP();
+	IPAddress subnetMask();
+	IPAddress gatewayIP();
+	IPAddress dnsServerIP();
+	EthernetLinkStatus linkStatus();
+	EthernetHardwareStatus hardwareStatus();
+
+	void setLocalIP(const IPAddress & Ip_X)		{ LocalIp_X = Ip_X; }
+	void setSubnetMask(const IPAddress & Ip_X)	{ SubnetMask_X = Ip_X; }
+	void setGatewayIP(const IPAddress & Ip_X)	{ GatewayIp_X = Ip_X; }
+
+private:
+	IPAddress LocalIp_X;
+	IPAddress SubnetMask_X;
+	IPAddress GatewayIp_X;
+	IPAddress DnsIp_X;
+};
+
+extern EthernetClass Ethernet;
+
+class EthernetClient : public Client {
+public:
+	EthernetClient();
+	EthernetClient(uint8_t Sock_UB);
+
+	uint8_t status();
+	virtual int connect(IPAddress Ip_X, uint16_t Port_UW);
+	virtual int connect(const char * pHost_UB, uint16_t Port_UW);
+	virtual size_t write(uint8_t Data_UB);
+	virtual size_t write(const uint8_t * pBuffer_UB, size_t Size);
+	virtual int available();
+	virtual int availableForWrite();
+	virtual int read();
+	virtual int read(uint8_t * pBuffer_UB, size_t Size);
+	virtual int peek();
+	virtual void flush();
+	virtual void stop();
+	virtual uint8_t connected();
+	virtual operator bool();
+	virtual bool operator==(const bool Value_B)				{ return bool() == Value_B; }
+	virtual bool operator!=(const bool Value_B)				{ return bool() != Value_B; }
+	virtual bool operator==(const EthernetClient & Client_H);
+	virtual bool operator!=(const EthernetClient & Client_H)	{ return !this->operator==(Client_H); }
+
+	uint8_t getSocketNumber();
+	IPAddress remoteIP();
+	uint16_t remotePort();
+
+	using Print::write;
+
+private:
+	uint8_t Sock_UB;
+};
+
+class EthernetServer : public Server {
+public:
+	EthernetServer(uint16_t Port_UW);
+
+	EthernetClient available();
+	virtual void begin();
+	virtual size_t write(uint8_t Data_UB);
+	virtual size_t write(const uint8_t * pBuffer_UB, size_t Size);
+
+	using Print::write;
+
+private:
+	uint16_t Port_UW;
+};
+
+#endif // __ETHERNET_H__
@@ -0,0 +1,17 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* EthernetClient.h																*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino Ethernet library						*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __ETHERNET_CLIENT_H__
+#define __ETHERNET_CLIENT_H__
+
+#include "Ethernet.h"
+
+#endif // __ETHERNET_CLIENT_H__
@@ -0,0 +1,17 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* EthernetServer.h																*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino Ethernet library						*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __ETHERNET_SERVER_H__
+#define __ETHERNET_SERVER_H__
+
+#include "Ethernet.h"
+
+#endif // __ETHERNET_SERVER_H__
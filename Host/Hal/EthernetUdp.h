@@ -0,0 +1,60 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* EthernetUdp.h																*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino EthernetUDP class						*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __ETHERNET_UDP_H__
+#define __ETHERNET_UDP_H__
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "Ethernet.h"
+
+/* ******************************************************************************** */
+/* Class
+/* ******************************************************************************** */
+class EthernetUDP : public UDP {
+public:
+	EthernetUDP();
+
+	virtual uint8_t begin(uint16_t Port_UW);
+	virtual void stop();
+	virtual int beginPacket(IPAddress Ip_X, uint16_t Port_UW);
+	virtual int beginPacket(const char * pHost_UB, uint16_t Port_UW);
+	virtual int endPacket();
+	virtual size_t write(uint8_t Data_UB);
+	virtual size_t write(const uint8_t * pBuffer_UB, size_t Size);
+	virtual int parsePacket();
+	virtual int available();
+	virtual int read();
+	virtual int read(unsigned char * pBuffer_UB, size_t Size);
+	virtual int read(char * pBuffer_UB, size_t Size)	{ return read((unsigned char *)pBuffer_UB, Size); }
+	virtual int peek();
+	virtual void flush();
+	virtual IPAddress remoteIP();
+	virtual uint16_t remotePort();
+
+	using Print::write;
+
+private:
+	uint8_t Sock_UB;
+	IPAddress TxIp_X;
+	uint16_t TxPort_UW;
+	size_t TxSize;
+	uint8_t pTxBuffer_UB[ETHERNET_UDP_TX_PACKET_MAX_SIZE];
+	IPAddress RxIp_X;
+	uint16_t RxPort_UW;
+	size_t RxSize;
+	size_t RxIdx;
+	uint8_t pRxBuffer_UB[ETHERNET_UDP_TX_PACKET_MAX_SIZE];
+};
+
+#endif // __ETHERNET_UDP_H__
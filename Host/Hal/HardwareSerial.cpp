@@ -0,0 +1,322 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* HardwareSerial.cpp																*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino Due UART/USART classes						*/
+/*		Received bytes go through a ring of the size of the SAM core one. The		*/
+/*		bytes which do not fit are left in the backend (kernel buffer) or refused	*/
+/*		(device model). Sent bytes are never blocking : they are dropped when the	*/
+/*		backend is full, as on a wire nobody listens to								*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "HostHal.h"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+/* ******************************************************************************** */
+/* Structure & Enumeration
+/* ******************************************************************************** */
+typedef struct {
+	HOST_HAL_SERIAL_BACKEND_ENUM Backend_E;
+	int InFd_SI;
+	int OutFd_SI;
+	int SlaveFd_SI;									// PTY : slave kept open so that the master never sees a hang-up
+	char pPath_UB[256];
+	HOST_HAL_SERIAL_DEVICE_STRUCT Device_X;
+
+	uint8_t pRxBuffer_UB[HOST_HAL_SERIAL_BUFFER_SIZE];
+	unsigned int RxHead_UI;							// Free-running indexes
+	unsigned int RxTail_UI;
+} HOST_HAL_SERIAL_STRUCT;
+
+/* ******************************************************************************** */
+/* Local Variables
+/* ******************************************************************************** */
+static HOST_HAL_SERIAL_STRUCT GL_pHostHalSerial_X[HOST_HAL_COM_PORT_NB] = {
+	{ HOST_HAL_SERIAL_NONE, -1, -1, -1, "none" },
+	{ HOST_HAL_SERIAL_NONE, -1, -1, -1, "none" },
+	{ HOST_HAL_SERIAL_NONE, -1, -1, -1, "none" },
+	{ HOST_HAL_SERIAL_NONE, -1, -1, -1, "none" }
+};
+
+HardwareSerial Serial(0);
+HardwareSerial Serial1(1);
+HardwareSerial Serial2(2);
+HardwareSerial Serial3(3);
+
+// Defined by the sketch when needed
+extern void serialEvent(void) __attribute__((weak));
+extern void serialEvent1(void) __attribute__((weak));
+extern void serialEvent2(void) __attribute__((weak));
+extern void serialEvent3(void) __attribute__((weak));
+
+/* ******************************************************************************** */
+/* Prototypes for Internal Functions
+/* ******************************************************************************** */
+static void CloseBackend(HOST_HAL_SERIAL_STRUCT * pSerial_X);
+static boolean OpenPty(HOST_HAL_SERIAL_STRUCT * pSerial_X);
+static void PollPort(HOST_HAL_SERIAL_STRUCT * pSerial_X);
+static unsigned int GetRxFree(HOST_HAL_SERIAL_STRUCT * pSerial_X);
+
+/* ******************************************************************************** */
+/* Functions
+/* ******************************************************************************** */
+boolean HostHal_SetSerialBackend(unsigned char Port_UB, HOST_HAL_SERIAL_BACKEND_ENUM Backend_E, const char * pPath_UB) {
+	HOST_HAL_SERIAL_STRUCT * pSerial_X;
+	int Fd_SI;
+
+	if (Port_UB >= HOST_HAL_COM_PORT_NB)
+		return false;
+
+	pSerial_X = &GL_pHostHalSerial_X[Port_UB];
+	CloseBackend(pSerial_X);
+
+	switch (Backend_E) {
+	case HOST_HAL_SERIAL_NONE:
+		snprintf(pSerial_X->pPath_UB, sizeof(pSerial_X->pPath_UB), "none");
+		break;
+
+	case HOST_HAL_SERIAL_STDIO:
+		pSerial_X->InFd_SI = STDIN_FILENO;
+		pSerial_X->OutFd_SI = STDOUT_FILENO;
+		snprintf(pSerial_X->pPath_UB, sizeof(pSerial_X->pPath_UB), "stdio");
+		break;
+
+	case HOST_HAL_SERIAL_PTY:
+		if (!OpenPty(pSerial_X))
+			return false;
+		break;
+
+	case HOST_HAL_SERIAL_FILE:
+		if ((pPath_UB == NULL) || ((Fd_SI = open(pPath_UB, O_RDWR | O_NOCTTY | O_NONBLOCK)) < 0)) {
+			perror("HostHal : COM port");
+			return false;
+		}
+		pSerial_X->InFd_SI = Fd_SI;
+		pSerial_X->OutFd_SI = Fd_SI;
+		snprintf(pSerial_X->pPath_UB, sizeof(pSerial_X->pPath_UB), "%s", pPath_UB);
+		break;
+
+	case HOST_HAL_SERIAL_DEVICE:
+		snprintf(pSerial_X->pPath_UB, sizeof(pSerial_X->pPath_UB), "device");
+		break;
+	}
+
+	pSerial_X->Backend_E = Backend_E;
+	return true;
+}
+
+void HostHal_AttachSerialDevice(unsigned char Port_UB, const HOST_HAL_SERIAL_DEVICE_STRUCT * pDevice_X) {
+	if ((Port_UB >= HOST_HAL_COM_PORT_NB) || (pDevice_X == NULL))
+		return;
+
+	HostHal_SetSerialBackend(Port_UB, HOST_HAL_SERIAL_DEVICE, NULL);
+	GL_pHostHalSerial_X[Port_UB].Device_X = *pDevice_X;
+}
+
+// Returns the number of bytes accepted - the others are lost (overrun)
+size_t HostHal_SerialInject(unsigned char Port_UB, const uint8_t * pData_UB, size_t Size) {
+	HOST_HAL_SERIAL_STRUCT * pSerial_X;
+	size_t Nb = 0;
+
+	if (Port_UB >= HOST_HAL_COM_PORT_NB)
+		return 0;
+
+	pSerial_X = &GL_pHostHalSerial_X[Port_UB];
+	while ((Nb < Size) && (GetRxFree(pSerial_X) > 0)) {
+		pSerial_X->pRxBuffer_UB[pSerial_X->RxHead_UI % HOST_HAL_SERIAL_BUFFER_SIZE] = pData_UB[Nb++];
+		pSerial_X->RxHead_UI++;
+	}
+
+	return Nb;
+}
+
+const char * HostHal_GetSerialPath(unsigned char Port_UB) {
+	return (Port_UB < HOST_HAL_COM_PORT_NB) ? GL_pHostHalSerial_X[Port_UB].pPath_UB : "";
+}
+
+void HostHal_SerialPoll(void) {
+	for (int i = 0; i < HOST_HAL_COM_PORT_NB; i++) {
+		PollPort(&GL_pHostHalSerial_X[i]);
+
+		if ((GL_pHostHalSerial_X[i].Backend_E == HOST_HAL_SERIAL_DEVICE) && (GL_pHostHalSerial_X[i].Device_X.pFctStep != NULL))
+			GL_pHostHalSerial_X[i].Device_X.pFctStep(GL_pHostHalSerial_X[i].Device_X.pContext);
+	}
+}
+
+// Mimics the SAM core : serialEventX() called after loop() when data are available
+void serialEventRun(void) {
+	if ((serialEvent != NULL) && (Serial.available() > 0)) serialEvent();
+	if ((serialEvent1 != NULL) && (Serial1.available() > 0)) serialEvent1();
+	if ((serialEvent2 != NULL) && (Serial2.available() > 0)) serialEvent2();
+	if ((serialEvent3 != NULL) && (Serial3.available() > 0)) serialEvent3();
+}
+
+
+/* ******************************************************************************** */
+/* HardwareSerial
+/* ******************************************************************************** */
+HardwareSerial::HardwareSerial(unsigned char Port_UB) {
+	this->Port_UB = Port_UB;
+}
+
+// Baudrate and framing have no meaning on the host
+void HardwareSerial::begin(unsigned long Baudrate_UL) {}
+void HardwareSerial::begin(unsigned long Baudrate_UL, uint32_t Config_UL) {}
+
+void HardwareSerial::end(void) {
+	GL_pHostHalSerial_X[Port_UB].RxTail_UI = GL_pHostHalSerial_X[Port_UB].RxHead_UI;
+}
+
+int HardwareSerial::available(void) {
+	HOST_HAL_SERIAL_STRUCT * pSerial_X = &GL_pHostHalSerial_X[Port_UB];
+
+	if (pSerial_X->RxHead_UI == pSerial_X->RxTail_UI)
+		PollPort(pSerial_X);
+
+	return (int)(pSerial_X->RxHead_UI - pSerial_X->RxTail_UI);
+}
+
+int HardwareSerial::availableForWrite(void) {
+	return HOST_HAL_SERIAL_BUFFER_SIZE;		// Sent at once
+}
+
+int HardwareSerial::peek(void) {
+	HOST_HAL_SERIAL_STRUCT * pSerial_X = &GL_pHostHalSerial_X[Port_UB];
+
+	if (available() <= 0)
+		return -1;
+
+	return pSerial_X->pRxBuffer_UB[pSerial_X->RxTail_UI % HOST_HAL_SERIAL_BUFFER_SIZE];
+}
+
+int HardwareSerial::read(void) {
+	HOST_HAL_SERIAL_STRUCT * pSerial_X = &GL_pHostHalSerial_X[Port_UB];
+	int Data_SI;
+
+	if ((Data_SI = peek()) >= 0)
+		pSerial_X->RxTail_UI++;
+
+	return Data_SI;
+}
+
+void HardwareSerial::flush(void) {}
+
+size_t HardwareSerial::write(uint8_t Data_UB) {
+	return write(&Data_UB, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t * pBuffer_UB, size_t Size) {
+	HOST_HAL_SERIAL_STRUCT * pSerial_X = &GL_pHostHalSerial_X[Port_UB];
+	struct pollfd Poll_X;
+
+	switch (pSerial_X->Backend_E) {
+	case HOST_HAL_SERIAL_DEVICE:
+		if (pSerial_X->Device_X.pFctReceive != NULL)
+			pSerial_X->Device_X.pFctReceive(pSerial_X->Device_X.pContext, pBuffer_UB, Size);
+		break;
+
+	case HOST_HAL_SERIAL_STDIO:
+	case HOST_HAL_SERIAL_PTY:
+	case HOST_HAL_SERIAL_FILE:
+		Poll_X.fd = pSerial_X->OutFd_SI;
+		Poll_X.events = POLLOUT;
+		if ((poll(&Poll_X, 1, 0) == 1) && (Poll_X.revents & POLLOUT)) {
+			if (::write(pSerial_X->OutFd_SI, pBuffer_UB, Size) < 0) {
+				// Dropped
+			}
+		}
+		break;
+
+	default:
+		break;
+	}
+
+	return Size;
+}
+
+
+/* ******************************************************************************** */
+/* Internal Functions
+/* ******************************************************************************** */
+void CloseBackend(HOST_HAL_SERIAL_STRUCT * pSerial_X) {
+	if ((pSerial_X->Backend_E == HOST_HAL_SERIAL_PTY) || (pSerial_X->Backend_E == HOST_HAL_SERIAL_FILE)) {
+		close(pSerial_X->InFd_SI);
+		if (pSerial_X->SlaveFd_SI >= 0)
+			close(pSerial_X->SlaveFd_SI);
+	}
+
+	pSerial_X->Backend_E = HOST_HAL_SERIAL_NONE;
+	pSerial_X->InFd_SI = -1;
+	pSerial_X->OutFd_SI = -1;
+	pSerial_X->SlaveFd_SI = -1;
+	memset(&(pSerial_X->Device_X), 0, sizeof(pSerial_X->Device_X));
+	pSerial_X->RxHead_UI = 0;
+	pSerial_X->RxTail_UI = 0;
+}
+
+// Raw pseudo-terminal - its slave path is given to the tool playing the remote device
+boolean OpenPty(HOST_HAL_SERIAL_STRUCT * pSerial_X) {
+	struct termios Termios_X;
+	int Fd_SI = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+
+	if ((Fd_SI < 0) || (grantpt(Fd_SI) != 0) || (unlockpt(Fd_SI) != 0) || (ptsname(Fd_SI) == NULL)) {
+		perror("HostHal : pseudo-terminal");
+		if (Fd_SI >= 0)
+			close(Fd_SI);
+		return false;
+	}
+
+	snprintf(pSerial_X->pPath_UB, sizeof(pSerial_X->pPath_UB), "%s", ptsname(Fd_SI));
+	pSerial_X->SlaveFd_SI = open(pSerial_X->pPath_UB, O_RDWR | O_NOCTTY | O_NONBLOCK);
+	if ((pSerial_X->SlaveFd_SI >= 0) && (tcgetattr(pSerial_X->SlaveFd_SI, &Termios_X) == 0)) {
+		cfmakeraw(&Termios_X);
+		tcsetattr(pSerial_X->SlaveFd_SI, TCSANOW, &Termios_X);
+	}
+
+	pSerial_X->InFd_SI = Fd_SI;
+	pSerial_X->OutFd_SI = Fd_SI;
+	return true;
+}
+
+// Moves the bytes waiting in the backend to the RX ring
+void PollPort(HOST_HAL_SERIAL_STRUCT * pSerial_X) {
+	struct pollfd Poll_X;
+	uint8_t pBuffer_UB[HOST_HAL_SERIAL_BUFFER_SIZE];
+	unsigned int Free_UI = GetRxFree(pSerial_X);
+	ssize_t Nb;
+
+	if ((pSerial_X->InFd_SI < 0) || (Free_UI == 0))
+		return;
+
+	Poll_X.fd = pSerial_X->InFd_SI;
+	Poll_X.events = POLLIN;
+	if ((poll(&Poll_X, 1, 0) != 1) || !(Poll_X.revents & (POLLIN | POLLHUP)))
+		return;
+
+	Nb = ::read(pSerial_X->InFd_SI, pBuffer_UB, Free_UI);
+	if ((Nb == 0) && (pSerial_X->Backend_E == HOST_HAL_SERIAL_STDIO)) {
+		pSerial_X->InFd_SI = -1;	// End of input
+		return;
+	}
+
+	for (ssize_t i = 0; i < Nb; i++) {
+		pSerial_X->pRxBuffer_UB[pSerial_X->RxHead_UI % HOST_HAL_SERIAL_BUFFER_SIZE] = pBuffer_UB[i];
+		pSerial_X->RxHead_UI++;
+	}
+}
+
+unsigned int GetRxFree(HOST_HAL_SERIAL_STRUCT * pSerial_X) {
+	return HOST_HAL_SERIAL_BUFFER_SIZE - (pSerial_X->RxHead_UI - pSerial_X->RxTail_UI);
+}
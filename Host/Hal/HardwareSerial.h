@@ -0,0 +1,70 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* HardwareSerial.h																	*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino Due UART/USART classes						*/
+/*		Each COM port is backed by the console, a pseudo-terminal, a file or an		*/
+/*		in-process device model (see HostHal.h)										*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __HARDWARE_SERIAL_H__
+#define __HARDWARE_SERIAL_H__
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+#define SERIAL_8N1			0x00
+#define SERIAL_8E1			0x01
+#define SERIAL_8O1			0x02
+#define SERIAL_8N2			0x03
+#define SERIAL_7E1			0x04
+#define SERIAL_7O1			0x05
+#define SERIAL_7N1			0x06
+#define SERIAL_7E2			0x07
+#define SERIAL_8E2			0x08
+
+/* ******************************************************************************** */
+/* Class
+/* ******************************************************************************** */
+class HardwareSerial : public Stream {
+public:
+	// Constructor
+	HardwareSerial(unsigned char Port_UB);
+
+	// Functions
+	void begin(unsigned long Baudrate_UL);
+	void begin(unsigned long Baudrate_UL, uint32_t Config_UL);
+	void end(void);
+
+	virtual int available(void);
+	virtual int availableForWrite(void);
+	virtual int peek(void);
+	virtual int read(void);
+	virtual void flush(void);
+	virtual size_t write(uint8_t Data_UB);
+	virtual size_t write(const uint8_t * pBuffer_UB, size_t Size);
+	using Print::write;
+
+	operator bool() { return true; }
+
+	unsigned char getPort(void) { return Port_UB; }
+
+private:
+	unsigned char Port_UB;
+};
+
+#define UARTClass			HardwareSerial
+#define USARTClass			HardwareSerial
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+extern HardwareSerial Serial2;
+extern HardwareSerial Serial3;
+
+void serialEventRun(void);
+
+#endif // __HARDWARE_SERIAL_H__
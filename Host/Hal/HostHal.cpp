@@ -0,0 +1,295 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* HostHal.cpp																		*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Describes the simulated W-Link board : command line options, clock and		*/
+/*		pins. The peripherals are modelled in their Arduino class replacement		*/
+/*		(HardwareSerial, Wire, Ethernet, SD, LiquidCrystal)							*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "HostHal.h"
+#include "Hardware.h"
+
+#include <time.h>
+#include <unistd.h>
+
+/* ******************************************************************************** */
+/* Local Variables
+/* ******************************************************************************** */
+static boolean GL_HostHalClockSimulated_B = false;
+static unsigned long long GL_HostHalSimTime_ULL = 0;		// [us] - simulated clock
+static unsigned long GL_HostHalSimStep_UL = 0;				// [us] - added by each HostHal_Step()
+static struct timespec GL_HostHalStartTime_X;
+
+static int GL_pHostHalPinLevel_SI[HOST_HAL_PIN_NB];
+static int GL_pHostHalAnalog_SI[HOST_HAL_PIN_NB];
+
+/* ******************************************************************************** */
+/* Prototypes for Internal Functions
+/* ******************************************************************************** */
+static unsigned long long GetTimeUs(void);
+static boolean ParsePinValue(const char * pArg_UB, uint32_t * pPin_UL, int * pValue_SI);
+static boolean ParseSerial(const char * pArg_UB);
+
+/* ******************************************************************************** */
+/* Functions
+/* ******************************************************************************** */
+
+// Options are described in HostHal_PrintUsage() - a bare number gives the number of loops
+unsigned long HostHal_Init(int argc, char * argv[]) {
+	unsigned long LoopNb_UL = 0;
+	uint32_t Pin_UL;
+	int Value_SI;
+
+	clock_gettime(CLOCK_MONOTONIC, &GL_HostHalStartTime_X);
+	srandom((unsigned int)(GL_HostHalStartTime_X.tv_nsec));
+
+	// Inputs pulled-up, Ethernet cable plugged (active low), forcing input released
+	for (int i = 0; i < HOST_HAL_PIN_NB; i++) {
+		GL_pHostHalPinLevel_SI[i] = HIGH;
+		GL_pHostHalAnalog_SI[i] = 1023;
+	}
+	GL_pHostHalPinLevel_SI[PIN_ETH_LINKED] = LOW;
+
+	// COM0 is the Debug port -> console, the others are pseudo-terminals
+	HostHal_SetSerialBackend(PORT_COM0, HOST_HAL_SERIAL_STDIO, NULL);
+	for (unsigned char i = PORT_COM1; i < HOST_HAL_COM_PORT_NB; i++)
+		HostHal_SetSerialBackend(i, HOST_HAL_SERIAL_PTY, NULL);
+
+	for (int i = 1; i < argc; i++) {
+		const char * pArg_UB = argv[i];
+		const char * pValue_UB = (i + 1 < argc) ? argv[i + 1] : NULL;
+		boolean ValueUsed_B = true;
+		boolean Ok_B = true;
+
+		if ((strcmp(pArg_UB, "-h") == 0) || (strcmp(pArg_UB, "--help") == 0)) {
+			HostHal_PrintUsage();
+			exit(0);
+		}
+		else if ((pArg_UB[0] >= '0') && (pArg_UB[0] <= '9')) {
+			LoopNb_UL = strtoul(pArg_UB, NULL, 10);
+			ValueUsed_B = false;
+		}
+		else if (pValue_UB == NULL) {
+			Ok_B = false;
+		}
+		else if (strcmp(pArg_UB, "--clock") == 0) {
+			if (strcmp(pValue_UB, "real") == 0)
+				GL_HostHalClockSimulated_B = false;
+			else if (strncmp(pValue_UB, "sim:", 4) == 0)
+				HostHal_UseSimulatedClock(strtoul(pValue_UB + 4, NULL, 10));
+			else
+				Ok_B = false;
+		}
+		else if (strcmp(pArg_UB, "--com") == 0) {
+			Ok_B = ParseSerial(pValue_UB);
+		}
+		else if (strcmp(pArg_UB, "--eeprom") == 0) {
+			Ok_B = HostHal_LoadEeprom(pValue_UB);
+		}
+		else if (strcmp(pArg_UB, "--sd") == 0) {
+			HostHal_SetSdRoot(pValue_UB);
+		}
+		else if (strcmp(pArg_UB, "--port-offset") == 0) {
+			HostHal_SetPortOffset((unsigned int)strtoul(pValue_UB, NULL, 10));
+		}
+		else if (strcmp(pArg_UB, "--pin") == 0) {
+			if ((Ok_B = ParsePinValue(pValue_UB, &Pin_UL, &Value_SI)))
+				HostHal_SetPin(Pin_UL, Value_SI);
+		}
+		else if (strcmp(pArg_UB, "--analog") == 0) {
+			if ((Ok_B = ParsePinValue(pValue_UB, &Pin_UL, &Value_SI)))
+				HostHal_SetAnalog(Pin_UL, Value_SI);
+		}
+		else if (strcmp(pArg_UB, "--lcd") == 0) {
+			HostHal_EnableLcdTrace(strcmp(pValue_UB, "on") == 0);
+		}
+		else {
+			Ok_B = false;
+		}
+
+		if (!Ok_B) {
+			fprintf(stderr, "HostHal : bad option '%s'\n", pArg_UB);
+			HostHal_PrintUsage();
+			exit(2);
+		}
+
+		if (ValueUsed_B)
+			i++;
+	}
+
+	for (unsigned char i = 0; i < HOST_HAL_COM_PORT_NB; i++)
+		fprintf(stderr, "HostHal : COM%d = %s\n", i, HostHal_GetSerialPath(i));
+
+	return LoopNb_UL;
+}
+
+void HostHal_PrintUsage(void) {
+	fprintf(stderr,
+		"Usage : WLink [Options] [LoopNb]  - LoopNb = 0 (default) runs forever\n"
+		"  --clock real|sim:<us>        Real time (default) or simulated clock advanced by <us> each loop\n"
+		"  --com <n>:none|stdio|pty|<path>  Backend of COM<n> (default COM0 = stdio, others = pty)\n"
+		"  --eeprom <file>              EEPROM image loaded at start-up and written through (default erased)\n"
+		"  --sd <dir>                   Directory used as SD card (default no card)\n"
+		"  --port-offset <n>            Added to every TCP/UDP port on the loopback (default 0)\n"
+		"  --pin <pin>=<level>          Level of a digital input (default HIGH, Ethernet linked)\n"
+		"  --analog <pin>=<value>       Value of an analog input (default 1023)\n"
+		"  --lcd on|off                 Print the LCD content on stderr when it changes\n");
+}
+
+// Called after each loop() : clock, COM ports and sockets
+void HostHal_Step(void) {
+	if (GL_HostHalClockSimulated_B)
+		GL_HostHalSimTime_ULL += GL_HostHalSimStep_UL;
+
+	HostHal_SerialPoll();
+	HostHal_EthernetPoll();
+	HostHal_LcdTrace();
+}
+
+void HostHal_UseSimulatedClock(unsigned long StepUs_UL) {
+	GL_HostHalClockSimulated_B = true;
+	GL_HostHalSimStep_UL = StepUs_UL;
+}
+
+void HostHal_AdvanceClock(unsigned long Us_UL) {
+	if (GL_HostHalClockSimulated_B)
+		GL_HostHalSimTime_ULL += Us_UL;
+	else
+		usleep(Us_UL);
+}
+
+boolean HostHal_IsClockSimulated(void) {
+	return GL_HostHalClockSimulated_B;
+}
+
+void HostHal_SetPin(uint32_t Pin_UL, int Level_SI) {
+	if (Pin_UL < HOST_HAL_PIN_NB)
+		GL_pHostHalPinLevel_SI[Pin_UL] = (Level_SI != LOW) ? HIGH : LOW;
+}
+
+int HostHal_GetPin(uint32_t Pin_UL) {
+	return (Pin_UL < HOST_HAL_PIN_NB) ? GL_pHostHalPinLevel_SI[Pin_UL] : LOW;
+}
+
+void HostHal_SetAnalog(uint32_t Pin_UL, int Value_SI) {
+	if (Pin_UL < HOST_HAL_PIN_NB)
+		GL_pHostHalAnalog_SI[Pin_UL] = Value_SI;
+}
+
+
+/* ******************************************************************************** */
+/* Arduino API
+/* ******************************************************************************** */
+unsigned long millis(void) {
+	return (unsigned long)(uint32_t)(GetTimeUs() / 1000);
+}
+
+unsigned long micros(void) {
+	return (unsigned long)(uint32_t)(GetTimeUs());
+}
+
+void delay(unsigned long Ms_UL) {
+	HostHal_AdvanceClock(Ms_UL * 1000);
+}
+
+void delayMicroseconds(unsigned int Us_UI) {
+	HostHal_AdvanceClock(Us_UI);
+}
+
+void yield(void) {
+	HostHal_SerialPoll();
+	HostHal_EthernetPoll();
+}
+
+void pinMode(uint32_t Pin_UL, uint32_t Mode_UL) {
+	// Outputs keep the last written level, inputs the level given by the board
+}
+
+void digitalWrite(uint32_t Pin_UL, uint32_t Value_UL) {
+	HostHal_SetPin(Pin_UL, (int)Value_UL);
+}
+
+int digitalRead(uint32_t Pin_UL) {
+	return HostHal_GetPin(Pin_UL);
+}
+
+int analogRead(uint32_t Pin_UL) {
+	return (Pin_UL < HOST_HAL_PIN_NB) ? GL_pHostHalAnalog_SI[Pin_UL] : 0;
+}
+
+void analogWrite(uint32_t Pin_UL, uint32_t Value_UL) {
+	HostHal_SetAnalog(Pin_UL, (int)Value_UL);
+}
+
+void attachInterrupt(uint32_t Pin_UL, void(*pFctCallback)(void), uint32_t Mode_UL) {}
+void detachInterrupt(uint32_t Pin_UL) {}
+void noInterrupts(void) {}
+void interrupts(void) {}
+
+long random(long Max_SL) {
+	return (Max_SL <= 0) ? 0 : (random() % Max_SL);
+}
+
+long random(long Min_SL, long Max_SL) {
+	return (Min_SL >= Max_SL) ? Min_SL : (Min_SL + random(Max_SL - Min_SL));
+}
+
+void randomSeed(unsigned long Seed_UL) {
+	if (Seed_UL != 0)
+		srandom((unsigned int)Seed_UL);
+}
+
+
+/* ******************************************************************************** */
+/* Internal Functions
+/* ******************************************************************************** */
+unsigned long long GetTimeUs(void) {
+	struct timespec Now_X;
+
+	if (GL_HostHalClockSimulated_B) {
+		GL_HostHalSimTime_ULL += HOST_HAL_SIM_READ_US;
+		return GL_HostHalSimTime_ULL;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &Now_X);
+	return ((unsigned long long)(Now_X.tv_sec - GL_HostHalStartTime_X.tv_sec) * 1000000ULL) + (Now_X.tv_nsec / 1000) - (GL_HostHalStartTime_X.tv_nsec / 1000);
+}
+
+// "<pin>=<value>"
+boolean ParsePinValue(const char * pArg_UB, uint32_t * pPin_UL, int * pValue_SI) {
+	char * pEnd_UB;
+
+	*pPin_UL = (uint32_t)strtoul(pArg_UB, &pEnd_UB, 10);
+	if ((*pEnd_UB != '=') || (*pPin_UL >= HOST_HAL_PIN_NB))
+		return false;
+
+	*pValue_SI = (int)strtol(pEnd_UB + 1, NULL, 10);
+	return true;
+}
+
+// "<n>:none|stdio|pty|<path>"
+boolean ParseSerial(const char * pArg_UB) {
+	unsigned char Port_UB = (unsigned char)(pArg_UB[0] - '0');
+	const char * pBackend_UB = pArg_UB + 2;
+
+	if ((Port_UB >= HOST_HAL_COM_PORT_NB) || (pArg_UB[1] != ':'))
+		return false;
+
+	if (strcmp(pBackend_UB, "none") == 0)
+		return HostHal_SetSerialBackend(Port_UB, HOST_HAL_SERIAL_NONE, NULL);
+	if (strcmp(pBackend_UB, "stdio") == 0)
+		return HostHal_SetSerialBackend(Port_UB, HOST_HAL_SERIAL_STDIO, NULL);
+	if (strcmp(pBackend_UB, "pty") == 0)
+		return HostHal_SetSerialBackend(Port_UB, HOST_HAL_SERIAL_PTY, NULL);
+
+	return HostHal_SetSerialBackend(Port_UB, HOST_HAL_SERIAL_FILE, pBackend_UB);
+}
@@ -0,0 +1,107 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* HostHal.h																		*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Header file for HostHal.cpp													*/
+/*		Simulated W-Link board used to run the firmware on a Linux host :			*/
+/*		clock, pins, COM ports, EEPROM, RTC, Ethernet, SD card and LCD				*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __HOST_HAL_H__
+#define __HOST_HAL_H__
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include <Arduino.h>
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+#define HOST_HAL_COM_PORT_NB			4
+#define HOST_HAL_SERIAL_BUFFER_SIZE		128			// Same as the SAM core (RX ring)
+
+#define HOST_HAL_EEPROM_ADDR			0x50		// 24LC256 on Wire1
+#define HOST_HAL_EEPROM_SIZE			32768
+#define HOST_HAL_EEPROM_PAGE_SIZE		64
+#define HOST_HAL_EEPROM_WRITE_TIME_US	5000		// Write cycle : device does not acknowledge meanwhile
+
+#define HOST_HAL_RTC_ADDR				0x68		// DS1339 on Wire
+#define HOST_HAL_RTC_REGISTER_NB		0x11
+
+#define HOST_HAL_LCD_MAX_COLUMN_NB		40
+#define HOST_HAL_LCD_MAX_LINE_NB		4
+
+#define HOST_HAL_SIM_READ_US			1			// Simulated clock : each read advances the time (busy-wait loops end)
+
+/* ******************************************************************************** */
+/* Structure & Enumeration
+/* ******************************************************************************** */
+typedef enum {
+	HOST_HAL_SERIAL_NONE = 0,						// Output discarded, no input
+	HOST_HAL_SERIAL_STDIO,							// stdout / stdin
+	HOST_HAL_SERIAL_PTY,							// Pseudo-terminal created at start-up
+	HOST_HAL_SERIAL_FILE,							// Existing device, pty or fifo
+	HOST_HAL_SERIAL_DEVICE							// In-process model (see HostHal_AttachSerialDevice)
+} HOST_HAL_SERIAL_BACKEND_ENUM;
+
+// Model of a device wired to a COM port - answers with HostHal_SerialInject()
+typedef struct {
+	void * pContext;
+	void (*pFctReceive)(void * pContext, const uint8_t * pData_UB, size_t Size);	// Bytes sent by the firmware
+	void (*pFctStep)(void * pContext);												// Called by HostHal_Step() - may be NULL
+} HOST_HAL_SERIAL_DEVICE_STRUCT;
+
+/* ******************************************************************************** */
+/* Functions Prototypes
+/* ******************************************************************************** */
+
+/* Board */
+unsigned long HostHal_Init(int argc, char * argv[]);		// Returns the number of loops to run (0 = forever)
+void HostHal_Step(void);
+void HostHal_PrintUsage(void);
+
+/* Clock */
+void HostHal_UseSimulatedClock(unsigned long StepUs_UL);
+void HostHal_AdvanceClock(unsigned long Us_UL);
+boolean HostHal_IsClockSimulated(void);
+
+/* Pins */
+void HostHal_SetPin(uint32_t Pin_UL, int Level_SI);
+int HostHal_GetPin(uint32_t Pin_UL);
+void HostHal_SetAnalog(uint32_t Pin_UL, int Value_SI);
+
+/* COM Ports */
+boolean HostHal_SetSerialBackend(unsigned char Port_UB, HOST_HAL_SERIAL_BACKEND_ENUM Backend_E, const char * pPath_UB);
+void HostHal_AttachSerialDevice(unsigned char Port_UB, const HOST_HAL_SERIAL_DEVICE_STRUCT * pDevice_X);
+size_t HostHal_SerialInject(unsigned char Port_UB, const uint8_t * pData_UB, size_t Size);
+const char * HostHal_GetSerialPath(unsigned char Port_UB);
+
+/* EEPROM */
+uint8_t * HostHal_GetEeprom(void);
+boolean HostHal_LoadEeprom(const char * pPath_UB);
+void HostHal_SaveEeprom(void);
+
+/* Network */
+void HostHal_SetPortOffset(unsigned int Offset_UI);
+unsigned int HostHal_GetPortOffset(void);
+
+/* SD Card */
+void HostHal_SetSdRoot(const char * pPath_UB);
+const char * HostHal_GetSdRoot(void);
+
+/* LCD */
+const char * HostHal_GetLcdLine(unsigned char Line_UB);
+void HostHal_EnableLcdTrace(boolean Enable_B);
+
+/* Internal to the HAL - polled from HostHal_Step() */
+void HostHal_SerialPoll(void);
+void HostHal_EthernetPoll(void);
+void HostHal_LcdTrace(void);
+
+#endif // __HOST_HAL_H__
@@ -0,0 +1,97 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* IPAddress.cpp																	*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino IPAddress class								*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "Arduino.h"
+
+/* ******************************************************************************** */
+/* Functions
+/* ******************************************************************************** */
+IPAddress::IPAddress() {
+	memset(pAddress_UB, 0, sizeof(pAddress_UB));
+}
+
+IPAddress::IPAddress(uint8_t Byte0_UB, uint8_t Byte1_UB, uint8_t Byte2_UB, uint8_t Byte3_UB) {
+	pAddress_UB[0] = Byte0_UB;
+	pAddress_UB[1] = Byte1_UB;
+	pAddress_UB[2] = Byte2_UB;
+	pAddress_UB[3] = Byte3_UB;
+}
+
+IPAddress::IPAddress(uint32_t Address_UL) {
+	*this = Address_UL;
+}
+
+IPAddress::IPAddress(const uint8_t * pAddress_UB) {
+	*this = pAddress_UB;
+}
+
+IPAddress::operator uint32_t() const {
+	uint32_t Address_UL;
+
+	memcpy(&Address_UL, pAddress_UB, sizeof(Address_UL));
+	return Address_UL;
+}
+
+bool IPAddress::operator == (const IPAddress & Addr) const {
+	return (memcmp(pAddress_UB, Addr.pAddress_UB, sizeof(pAddress_UB)) == 0);
+}
+
+bool IPAddress::operator == (const uint8_t * pAddr_UB) const {
+	return (memcmp(pAddress_UB, pAddr_UB, sizeof(pAddress_UB)) == 0);
+}
+
+uint8_t IPAddress::operator [] (int Index_SI) const {
+	return pAddress_UB[Index_SI & 0x03];
+}
+
+uint8_t & IPAddress::operator [] (int Index_SI) {
+	return pAddress_UB[Index_SI & 0x03];
+}
+
+IPAddress & IPAddress::operator = (const uint8_t * pAddress_UB) {
+	memcpy(this->pAddress_UB, pAddress_UB, sizeof(this->pAddress_UB));
+	return (*this);
+}
+
+IPAddress & IPAddress::operator = (uint32_t Address_UL) {
+	memcpy(pAddress_UB, &Address_UL, sizeof(pAddress_UB));
+	return (*this);
+}
+
+bool IPAddress::fromString(const char * pAddress_UB) {
+	unsigned int pByte_UI[4];
+	char Extra_UB;
+
+	if ((sscanf(pAddress_UB, "%u.%u.%u.%u%c", &pByte_UI[0], &pByte_UI[1], &pByte_UI[2], &pByte_UI[3], &Extra_UB) != 4) ||
+		(pByte_UI[0] > 255) || (pByte_UI[1] > 255) || (pByte_UI[2] > 255) || (pByte_UI[3] > 255))
+		return false;
+
+	for (int i = 0; i < 4; i++)
+		this->pAddress_UB[i] = (uint8_t)(pByte_UI[i]);
+
+	return true;
+}
+
+size_t IPAddress::printTo(Print & Printer_H) const {
+	size_t Nb = 0;
+
+	for (int i = 0; i < 4; i++) {
+		if (i > 0)
+			Nb += Printer_H.print('.');
+		Nb += Printer_H.print(pAddress_UB[i], DEC);
+	}
+
+	return Nb;
+}
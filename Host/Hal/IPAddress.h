@@ -0,0 +1,45 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* IPAddress.h																		*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino IPAddress class								*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __IP_ADDRESS_H__
+#define __IP_ADDRESS_H__
+
+/* ******************************************************************************** */
+/* Class
+/* ******************************************************************************** */
+class IPAddress : public Printable {
+public:
+	// Constructors
+	IPAddress();
+	IPAddress(uint8_t Byte0_UB, uint8_t Byte1_UB, uint8_t Byte2_UB, uint8_t Byte3_UB);
+	IPAddress(uint32_t Address_UL);
+	IPAddress(const uint8_t * pAddress_UB);
+
+	// Network order (first byte in the LSB), as the Arduino core
+	operator uint32_t() const;
+	bool operator == (const IPAddress & Addr) const;
+	bool operator == (const uint8_t * pAddr_UB) const;
+	bool operator != (const IPAddress & Addr) const { return !(*this == Addr); }
+	uint8_t operator [] (int Index_SI) const;
+	uint8_t & operator [] (int Index_SI);
+	IPAddress & operator = (const uint8_t * pAddress_UB);
+	IPAddress & operator = (uint32_t Address_UL);
+
+	bool fromString(const char * pAddress_UB);
+	virtual size_t printTo(Print & Printer_H) const;
+
+private:
+	uint8_t pAddress_UB[4];
+};
+
+const IPAddress INADDR_NONE(0, 0, 0, 0);
+
+#endif // __IP_ADDRESS_H__
@@ -0,0 +1,129 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* LiquidCrystal.cpp															*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino LiquidCrystal library					*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "HostHal.h"
+#include "LiquidCrystal.h"
+
+/* ******************************************************************************** */
+/* Structure & Enumeration
+/* ******************************************************************************** */
+typedef struct {
+	uint8_t ColumnNb_UB;
+	uint8_t LineNb_UB;
+	uint8_t Column_UB;
+	uint8_t Line_UB;
+	boolean IsDirty_B;
+	boolean IsTraceEnabled_B;
+	char ppText_UB[HOST_HAL_LCD_MAX_LINE_NB][HOST_HAL_LCD_MAX_COLUMN_NB + 1];
+} HOST_LCD_STRUCT;
+
+/* ******************************************************************************** */
+/* Local Variables
+/* ******************************************************************************** */
+static HOST_LCD_STRUCT GL_HostLcd_X = { HOST_HAL_LCD_MAX_COLUMN_NB, HOST_HAL_LCD_MAX_LINE_NB, 0, 0, false, false, { { 0 } } };
+
+/* ******************************************************************************** */
+/* Functions
+/* ******************************************************************************** */
+
+const char * HostHal_GetLcdLine(unsigned char Line_UB) {
+	return (Line_UB < HOST_HAL_LCD_MAX_LINE_NB) ? GL_HostLcd_X.ppText_UB[Line_UB] : "";
+}
+
+void HostHal_EnableLcdTrace(boolean Enable_B) {
+	GL_HostLcd_X.IsTraceEnabled_B = Enable_B;
+}
+
+// Dumps the display on stderr when it changed since the last step
+void HostHal_LcdTrace(void) {
+	if (!(GL_HostLcd_X.IsTraceEnabled_B) || !(GL_HostLcd_X.IsDirty_B))
+		return;
+
+	for (uint8_t i = 0; i < GL_HostLcd_X.LineNb_UB; i++)
+		fprintf(stderr, "LCD %u |%s|\n", (unsigned int)i, GL_HostLcd_X.ppText_UB[i]);
+
+	GL_HostLcd_X.IsDirty_B = false;
+}
+
+/* ******************************************************************************** */
+/* LiquidCrystal
+/* ******************************************************************************** */
+
+LiquidCrystal::LiquidCrystal(uint8_t Rs_UB, uint8_t Enable_UB, uint8_t D0_UB, uint8_t D1_UB, uint8_t D2_UB, uint8_t D3_UB) {
+	(void)Rs_UB; (void)Enable_UB; (void)D0_UB; (void)D1_UB; (void)D2_UB; (void)D3_UB;
+}
+
+LiquidCrystal::LiquidCrystal(uint8_t Rs_UB, uint8_t Rw_UB, uint8_t Enable_UB, uint8_t D0_UB, uint8_t D1_UB, uint8_t D2_UB, uint8_t D3_UB) {
+	(void)Rs_UB; (void)Rw_UB; (void)Enable_UB; (void)D0_UB; (void)D1_UB; (void)D2_UB; (void)D3_UB;
+}
+
+LiquidCrystal::LiquidCrystal(uint8_t Rs_UB, uint8_t Enable_UB, uint8_t D0_UB, uint8_t D1_UB, uint8_t D2_UB, uint8_t D3_UB, uint8_t D4_UB, uint8_t D5_UB, uint8_t D6_UB, uint8_t D7_UB) {
+	(void)Rs_UB; (void)Enable_UB; (void)D0_UB; (void)D1_UB; (void)D2_UB; (void)D3_UB; (void)D4_UB; (void)D5_UB; (void)D6_UB; (void)D7_UB;
+}
+
+void LiquidCrystal::begin(uint8_t ColumnNb_UB, uint8_t LineNb_UB, uint8_t CharSize_UB) {
+	(void)CharSize_UB;
+
+	GL_HostLcd_X.ColumnNb_UB = (ColumnNb_UB < HOST_HAL_LCD_MAX_COLUMN_NB) ? ColumnNb_UB : HOST_HAL_LCD_MAX_COLUMN_NB;
+	GL_HostLcd_X.LineNb_UB = (LineNb_UB < HOST_HAL_LCD_MAX_LINE_NB) ? LineNb_UB : HOST_HAL_LCD_MAX_LINE_NB;
+	clear();
+}
+
+void LiquidCrystal::clear() {
+	for (uint8_t i = 0; i < HOST_HAL_LCD_MAX_LINE_NB; i++) {
+		memset(GL_HostLcd_X.ppText_UB[i], ' ', GL_HostLcd_X.ColumnNb_UB);
+		GL_HostLcd_X.ppText_UB[i][GL_HostLcd_X.ColumnNb_UB] = '\0';
+	}
+	GL_HostLcd_X.IsDirty_B = true;
+	home();
+}
+
+void LiquidCrystal::home() {
+	setCursor(0, 0);
+}
+
+void LiquidCrystal::noDisplay()				{}
+void LiquidCrystal::display()				{}
+void LiquidCrystal::noBlink()				{}
+void LiquidCrystal::blink()					{}
+void LiquidCrystal::noCursor()				{}
+void LiquidCrystal::cursor()				{}
+void LiquidCrystal::scrollDisplayLeft()		{}
+void LiquidCrystal::scrollDisplayRight()	{}
+void LiquidCrystal::leftToRight()			{}
+void LiquidCrystal::rightToLeft()			{}
+void LiquidCrystal::autoscroll()			{}
+void LiquidCrystal::noAutoscroll()			{}
+void LiquidCrystal::command(uint8_t Command_UB)	{ (void)Command_UB; }
+
+void LiquidCrystal::createChar(uint8_t Location_UB, uint8_t pCharMap_UB[]) {
+	(void)Location_UB;
+	(void)pCharMap_UB;
+}
+
+void LiquidCrystal::setCursor(uint8_t Column_UB, uint8_t Line_UB) {
+	GL_HostLcd_X.Column_UB = Column_UB;
+	GL_HostLcd_X.Line_UB = (Line_UB < GL_HostLcd_X.LineNb_UB) ? Line_UB : (uint8_t)(GL_HostLcd_X.LineNb_UB - 1);
+}
+
+// Custom characters (0..7) are shown as '#'
+size_t LiquidCrystal::write(uint8_t Data_UB) {
+	if (GL_HostLcd_X.Column_UB >= GL_HostLcd_X.ColumnNb_UB)
+		return 1;
+
+	GL_HostLcd_X.ppText_UB[GL_HostLcd_X.Line_UB][GL_HostLcd_X.Column_UB++] = (Data_UB < 8) ? '#' : ((Data_UB < 0x80) && isprint(Data_UB)) ? (char)Data_UB : '?';
+	GL_HostLcd_X.IsDirty_B = true;
+	return 1;
+}
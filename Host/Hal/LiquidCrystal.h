@@ -0,0 +1,55 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* LiquidCrystal.h																*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino LiquidCrystal library					*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __LIQUID_CRYSTAL_H__
+#define __LIQUID_CRYSTAL_H__
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include <Arduino.h>
+
+/* ******************************************************************************** */
+/* Class
+/* ******************************************************************************** */
+
+// The display is a text frame buffer - see HostHal_GetLcdLine() and --lcd on
+class LiquidCrystal : public Print {
+public:
+	LiquidCrystal(uint8_t Rs_UB, uint8_t Enable_UB, uint8_t D0_UB, uint8_t D1_UB, uint8_t D2_UB, uint8_t D3_UB);
+	LiquidCrystal(uint8_t Rs_UB, uint8_t Rw_UB, uint8_t Enable_UB, uint8_t D0_UB, uint8_t D1_UB, uint8_t D2_UB, uint8_t D3_UB);
+	LiquidCrystal(uint8_t Rs_UB, uint8_t Enable_UB, uint8_t D0_UB, uint8_t D1_UB, uint8_t D2_UB, uint8_t D3_UB, uint8_t D4_UB, uint8_t D5_UB, uint8_t D6_UB, uint8_t D7_UB);
+
+	void begin(uint8_t ColumnNb_UB, uint8_t LineNb_UB, uint8_t CharSize_UB = 0);
+	void clear();
+	void home();
+	void noDisplay();
+	void display();
+	void noBlink();
+	void blink();
+	void noCursor();
+	void cursor();
+	void scrollDisplayLeft();
+	void scrollDisplayRight();
+	void leftToRight();
+	void rightToLeft();
+	void autoscroll();
+	void noAutoscroll();
+	void createChar(uint8_t Location_UB, uint8_t pCharMap_UB[]);
+	void setCursor(uint8_t Column_UB, uint8_t Line_UB);
+	virtual size_t write(uint8_t Data_UB);
+	void command(uint8_t Command_UB);
+
+	using Print::write;
+};
+
+#endif // __LIQUID_CRYSTAL_H__
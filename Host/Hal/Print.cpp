@@ -0,0 +1,81 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* Print.cpp																		*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino Print class									*/
+/*		Numbers are formatted through String so that both outputs match			*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "Arduino.h"
+
+/* ******************************************************************************** */
+/* Functions
+/* ******************************************************************************** */
+size_t Print::write(const uint8_t * pBuffer_UB, size_t Size) {
+	size_t Nb = 0;
+
+	while ((Size-- > 0) && (write(*pBuffer_UB++) == 1))
+		Nb++;
+
+	return Nb;
+}
+
+size_t Print::write(const char * pStr_UB) {
+	return (pStr_UB == NULL) ? 0 : write((const uint8_t *)pStr_UB, strlen(pStr_UB));
+}
+
+size_t Print::print(const String & Str)						{ return write(Str.c_str()); }
+size_t Print::print(const char pStr_UB[])					{ return write(pStr_UB); }
+size_t Print::print(char c)									{ return write((uint8_t)c); }
+size_t Print::print(unsigned char Value_UB, int Base_SI)	{ return print((unsigned long)Value_UB, Base_SI); }
+size_t Print::print(int Value_SI, int Base_SI)				{ return print((long)Value_SI, Base_SI); }
+size_t Print::print(unsigned int Value_UI, int Base_SI)		{ return print((unsigned long)Value_UI, Base_SI); }
+
+size_t Print::print(long Value_SL, int Base_SI) {
+	// Base 0 sends the raw byte (Arduino behaviour)
+	if (Base_SI == 0)
+		return write((uint8_t)Value_SL);
+
+	if (Base_SI != DEC)
+		return print((unsigned long)Value_SL, Base_SI);
+
+	return print(String(Value_SL));
+}
+
+size_t Print::print(unsigned long Value_UL, int Base_SI) {
+	if (Base_SI == 0)
+		return write((uint8_t)Value_UL);
+
+	String Number_Str(Value_UL, (unsigned char)Base_SI);
+
+	Number_Str.toUpperCase();	// Print uses upper case digits, String lower case
+	return print(Number_Str);
+}
+
+size_t Print::print(double Value_D, int Digits_SI) {
+	if (isnan(Value_D))
+		return print("nan");
+	if (isinf(Value_D))
+		return print("inf");
+
+	return print(String(Value_D, (unsigned char)Digits_SI));
+}
+
+size_t Print::println(void)									{ return write("\r\n"); }
+size_t Print::println(const String & Str)					{ return print(Str) + println(); }
+size_t Print::println(const char pStr_UB[])					{ return print(pStr_UB) + println(); }
+size_t Print::println(char c)								{ return print(c) + println(); }
+size_t Print::println(unsigned char Value_UB, int Base_SI)	{ return print(Value_UB, Base_SI) + println(); }
+size_t Print::println(int Value_SI, int Base_SI)			{ return print(Value_SI, Base_SI) + println(); }
+size_t Print::println(unsigned int Value_UI, int Base_SI)	{ return print(Value_UI, Base_SI) + println(); }
+size_t Print::println(long Value_SL, int Base_SI)			{ return print(Value_SL, Base_SI) + println(); }
+size_t Print::println(unsigned long Value_UL, int Base_SI)	{ return print(Value_UL, Base_SI) + println(); }
+size_t Print::println(double Value_D, int Digits_SI)		{ return print(Value_D, Digits_SI) + println(); }
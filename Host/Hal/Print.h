@@ -0,0 +1,60 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* Print.h																			*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino Print class									*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __PRINT_H__
+#define __PRINT_H__
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "Printable.h"
+
+/* ******************************************************************************** */
+/* Class
+/* ******************************************************************************** */
+class Print {
+public:
+	virtual ~Print() {}
+
+	virtual size_t write(uint8_t Data_UB) = 0;
+	virtual size_t write(const uint8_t * pBuffer_UB, size_t Size);
+	size_t write(const char * pStr_UB);
+	size_t write(const char * pBuffer_UB, size_t Size) { return write((const uint8_t *)pBuffer_UB, Size); }
+
+	virtual int availableForWrite() { return 0; }
+	virtual void flush() {}
+
+	size_t print(const String & Str);
+	size_t print(const char pStr_UB[]);
+	size_t print(char c);
+	size_t print(unsigned char Value_UB, int Base_SI = DEC);
+	size_t print(int Value_SI, int Base_SI = DEC);
+	size_t print(unsigned int Value_UI, int Base_SI = DEC);
+	size_t print(long Value_SL, int Base_SI = DEC);
+	size_t print(unsigned long Value_UL, int Base_SI = DEC);
+	size_t print(double Value_D, int Digits_SI = 2);
+	size_t print(const Printable & Data_X)		{ return Data_X.printTo(*this); }
+
+	size_t println(const String & Str);
+	size_t println(const char pStr_UB[]);
+	size_t println(char c);
+	size_t println(unsigned char Value_UB, int Base_SI = DEC);
+	size_t println(int Value_SI, int Base_SI = DEC);
+	size_t println(unsigned int Value_UI, int Base_SI = DEC);
+	size_t println(long Value_SL, int Base_SI = DEC);
+	size_t println(unsigned long Value_UL, int Base_SI = DEC);
+	size_t println(double Value_D, int Digits_SI = 2);
+	size_t println(const Printable & Data_X)	{ return print(Data_X) + println(); }
+	size_t println(void);
+};
+
+#endif // __PRINT_H__
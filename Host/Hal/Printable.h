@@ -0,0 +1,26 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* Printable.h																		*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino Printable interface							*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __PRINTABLE_H__
+#define __PRINTABLE_H__
+
+/* ******************************************************************************** */
+/* Class
+/* ******************************************************************************** */
+class Print;
+
+class Printable {
+public:
+	virtual ~Printable() {}
+	virtual size_t printTo(Print & Printer_H) const = 0;
+};
+
+#endif // __PRINTABLE_H__
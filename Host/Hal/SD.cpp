@@ -0,0 +1,278 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* SD.cpp																		*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino SD library : files live under --sd <dir>*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "HostHal.h"
+#include "SD.h"
+
+#include <unistd.h>
+#include <sys/stat.h>
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+#define HOST_SD_MAX_PATH_SIZE		256
+
+/* ******************************************************************************** */
+/* Structure & Enumeration
+/* ******************************************************************************** */
+typedef struct {
+	FILE * pFile_X;
+	boolean IsAppend_B;						// O_APPEND : every write goes to the end of the file
+	char pName_UB[HOST_SD_MAX_PATH_SIZE];
+} HOST_SD_FILE_STRUCT;
+
+/* ******************************************************************************** */
+/* Local Variables
+/* ******************************************************************************** */
+namespace SDLib {
+	SDClass SD;
+}
+
+static const char * GL_pHostSdRoot_UB = NULL;			// No card when NULL
+static HOST_SD_FILE_STRUCT GL_pHostSdFile_X[HOST_HAL_SD_MAX_FILE_NB];
+
+/* ******************************************************************************** */
+/* Prototypes for Internal Functions
+/* ******************************************************************************** */
+static boolean GetHostPath(const char * pFilePath_UB, char * pHostPath_UB);
+static FILE * GetFile(int Handle_SI);
+
+/* ******************************************************************************** */
+/* Functions
+/* ******************************************************************************** */
+
+void HostHal_SetSdRoot(const char * pPath_UB) {
+	GL_pHostSdRoot_UB = pPath_UB;
+}
+
+const char * HostHal_GetSdRoot(void) {
+	return GL_pHostSdRoot_UB;
+}
+
+/* ******************************************************************************** */
+/* SDClass
+/* ******************************************************************************** */
+
+boolean SDClass::begin(uint8_t CsPin_UB) {
+	struct stat Stat_X;
+	(void)CsPin_UB;
+
+	return ((GL_pHostSdRoot_UB != NULL) && (stat(GL_pHostSdRoot_UB, &Stat_X) == 0) && S_ISDIR(Stat_X.st_mode));
+}
+
+File SDClass::open(const char * pFileName_UB, uint8_t Mode_UB) {
+	char pHostPath_UB[HOST_SD_MAX_PATH_SIZE];
+	const char * pMode_UB;
+	int Handle_SI;
+
+	if (!GetHostPath(pFileName_UB, pHostPath_UB))
+		return File();
+
+	for (Handle_SI = 0; Handle_SI < HOST_HAL_SD_MAX_FILE_NB; Handle_SI++) {
+		if (GL_pHostSdFile_X[Handle_SI].pFile_X == NULL)
+			break;
+	}
+	if (Handle_SI == HOST_HAL_SD_MAX_FILE_NB)
+		return File();
+
+	if (!(Mode_UB & O_WRITE))
+		pMode_UB = "rb";
+	else if ((Mode_UB & O_TRUNC) || ((Mode_UB & O_CREAT) && (access(pHostPath_UB, F_OK) != 0)))
+		pMode_UB = "w+b";
+	else
+		pMode_UB = "r+b";
+
+	FILE * pFile_X = fopen(pHostPath_UB, pMode_UB);
+	if (pFile_X == NULL)
+		return File();
+
+	GL_pHostSdFile_X[Handle_SI].pFile_X = pFile_X;
+	GL_pHostSdFile_X[Handle_SI].IsAppend_B = ((Mode_UB & O_APPEND) != 0);
+	strncpy(GL_pHostSdFile_X[Handle_SI].pName_UB, pFileName_UB, HOST_SD_MAX_PATH_SIZE - 1);
+	GL_pHostSdFile_X[Handle_SI].pName_UB[HOST_SD_MAX_PATH_SIZE - 1] = '\0';
+
+	if (GL_pHostSdFile_X[Handle_SI].IsAppend_B)
+		fseek(pFile_X, 0, SEEK_END);
+
+	return File(Handle_SI);
+}
+
+boolean SDClass::exists(const char * pFilePath_UB) {
+	char pHostPath_UB[HOST_SD_MAX_PATH_SIZE];
+	return (GetHostPath(pFilePath_UB, pHostPath_UB) && (access(pHostPath_UB, F_OK) == 0));
+}
+
+boolean SDClass::mkdir(const char * pFilePath_UB) {
+	char pHostPath_UB[HOST_SD_MAX_PATH_SIZE];
+	return (GetHostPath(pFilePath_UB, pHostPath_UB) && (::mkdir(pHostPath_UB, 0755) == 0));
+}
+
+boolean SDClass::remove(const char * pFilePath_UB) {
+	char pHostPath_UB[HOST_SD_MAX_PATH_SIZE];
+	return (GetHostPath(pFilePath_UB, pHostPath_UB) && (::remove(pHostPath_UB) == 0));
+}
+
+boolean SDClass::rmdir(const char * pFilePath_UB) {
+	char pHostPath_UB[HOST_SD_MAX_PATH_SIZE];
+	return (GetHostPath(pFilePath_UB, pHostPath_UB) && (::rmdir(pHostPath_UB) == 0));
+}
+
+/* ******************************************************************************** */
+/* File
+/* ******************************************************************************** */
+
+File::File(void) {
+	Handle_SI = -1;
+}
+
+File::File(int Handle_SI) {
+	this->Handle_SI = Handle_SI;
+}
+
+size_t File::write(uint8_t Data_UB) {
+	return write(&Data_UB, 1);
+}
+
+size_t File::write(const uint8_t * pBuffer_UB, size_t Size) {
+	FILE * pFile_X = GetFile(Handle_SI);
+
+	if (pFile_X == NULL)
+		return 0;
+
+	// A seek is required between a read and a write on the same stream
+	if (GL_pHostSdFile_X[Handle_SI].IsAppend_B)
+		fseek(pFile_X, 0, SEEK_END);
+	else
+		fseek(pFile_X, 0, SEEK_CUR);
+
+	return fwrite(pBuffer_UB, 1, Size, pFile_X);
+}
+
+int File::read() {
+	uint8_t Data_UB;
+	return (read(&Data_UB, 1) == 1) ? Data_UB : -1;
+}
+
+int File::peek() {
+	FILE * pFile_X = GetFile(Handle_SI);
+
+	if (pFile_X == NULL)
+		return -1;
+
+	fseek(pFile_X, 0, SEEK_CUR);
+	int Data_SI = fgetc(pFile_X);
+	if (Data_SI != EOF)
+		ungetc(Data_SI, pFile_X);
+
+	return (Data_SI == EOF) ? -1 : Data_SI;
+}
+
+int File::available() {
+	uint32_t Size_UL = size();
+	uint32_t Position_UL = position();
+
+	return (Size_UL > Position_UL) ? (int)(Size_UL - Position_UL) : 0;
+}
+
+void File::flush() {
+	FILE * pFile_X = GetFile(Handle_SI);
+
+	if (pFile_X != NULL)
+		fflush(pFile_X);
+}
+
+int File::read(void * pBuffer_UB, uint16_t Size_UW) {
+	FILE * pFile_X = GetFile(Handle_SI);
+
+	if (pFile_X == NULL)
+		return -1;
+
+	fseek(pFile_X, 0, SEEK_CUR);
+	return (int)fread(pBuffer_UB, 1, Size_UW, pFile_X);
+}
+
+// Same as the SD library : no seek past the end of the file
+boolean File::seek(uint32_t Position_UL) {
+	FILE * pFile_X = GetFile(Handle_SI);
+
+	if ((pFile_X == NULL) || (Position_UL > size()))
+		return false;
+
+	return (fseek(pFile_X, (long)Position_UL, SEEK_SET) == 0);
+}
+
+uint32_t File::position() {
+	FILE * pFile_X = GetFile(Handle_SI);
+	return (pFile_X != NULL) ? (uint32_t)ftell(pFile_X) : 0;
+}
+
+uint32_t File::size() {
+	struct stat Stat_X;
+	FILE * pFile_X = GetFile(Handle_SI);
+
+	if (pFile_X == NULL)
+		return 0;
+
+	fflush(pFile_X);
+	return (fstat(fileno(pFile_X), &Stat_X) == 0) ? (uint32_t)Stat_X.st_size : 0;
+}
+
+void File::close() {
+	FILE * pFile_X = GetFile(Handle_SI);
+
+	if (pFile_X != NULL) {
+		fclose(pFile_X);
+		GL_pHostSdFile_X[Handle_SI].pFile_X = NULL;
+	}
+	Handle_SI = -1;
+}
+
+File::operator bool() {
+	return (GetFile(Handle_SI) != NULL);
+}
+
+char * File::name() {
+	return (GetFile(Handle_SI) != NULL) ? GL_pHostSdFile_X[Handle_SI].pName_UB : NULL;
+}
+
+boolean File::isDirectory(void) {
+	return false;
+}
+
+File File::openNextFile(uint8_t Mode_UB) {
+	(void)Mode_UB;
+	return File();
+}
+
+void File::rewindDirectory(void) {
+}
+
+/* ******************************************************************************** */
+/* Internal Functions
+/* ******************************************************************************** */
+
+boolean GetHostPath(const char * pFilePath_UB, char * pHostPath_UB) {
+	if (GL_pHostSdRoot_UB == NULL)
+		return false;
+
+	while (*pFilePath_UB == '/')
+		pFilePath_UB++;
+
+	return (snprintf(pHostPath_UB, HOST_SD_MAX_PATH_SIZE, "%s/%s", GL_pHostSdRoot_UB, pFilePath_UB) < HOST_SD_MAX_PATH_SIZE);
+}
+
+FILE * GetFile(int Handle_SI) {
+	return ((Handle_SI >= 0) && (Handle_SI < HOST_HAL_SD_MAX_FILE_NB)) ? GL_pHostSdFile_X[Handle_SI].pFile_X : NULL;
+}
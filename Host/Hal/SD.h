@@ -0,0 +1,95 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* SD.h																			*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino SD library								*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __SD_H__
+#define __SD_H__
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include <Arduino.h>
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+#define O_READ			0x01
+#define O_RDONLY		O_READ
+#define O_WRITE			0x02
+#define O_WRONLY		O_WRITE
+#define O_RDWR			(O_READ | O_WRITE)
+#define O_APPEND		0x04
+#define O_SYNC			0x08
+#define O_CREAT			0x10
+#define O_EXCL			0x20
+#define O_TRUNC			0x40
+
+#define FILE_READ		O_READ
+#define FILE_WRITE		(O_READ | O_WRITE | O_CREAT | O_APPEND)
+
+#define HOST_HAL_SD_MAX_FILE_NB		4		// Open files at the same time
+
+/* ******************************************************************************** */
+/* Class
+/* ******************************************************************************** */
+namespace SDLib {
+
+// Copies of a File share the same open file, as on the board
+class File : public Stream {
+public:
+	File(void);
+	File(int Handle_SI);
+
+	virtual size_t write(uint8_t Data_UB);
+	virtual size_t write(const uint8_t * pBuffer_UB, size_t Size);
+	virtual int read();
+	virtual int peek();
+	virtual int available();
+	virtual void flush();
+	int read(void * pBuffer_UB, uint16_t Size_UW);
+	boolean seek(uint32_t Position_UL);
+	uint32_t position();
+	uint32_t size();
+	void close();
+	operator bool();
+	char * name();
+	boolean isDirectory(void);
+	File openNextFile(uint8_t Mode_UB = O_RDONLY);
+	void rewindDirectory(void);
+
+	using Print::write;
+
+private:
+	int Handle_SI;
+};
+
+class SDClass {
+public:
+	boolean begin(uint8_t CsPin_UB = SS);
+	File open(const char * pFileName_UB, uint8_t Mode_UB = FILE_READ);
+	File open(const String & FileName_Str, uint8_t Mode_UB = FILE_READ)	{ return open(FileName_Str.c_str(), Mode_UB); }
+	boolean exists(const char * pFilePath_UB);
+	boolean mkdir(const char * pFilePath_UB);
+	boolean remove(const char * pFilePath_UB);
+	boolean rmdir(const char * pFilePath_UB);
+};
+
+extern SDClass SD;
+
+}
+
+using namespace SDLib;
+
+typedef SDLib::File		SDFile;
+typedef SDLib::SDClass	SDFileSystemClass;
+#define SDFileSystem	SDLib::SD
+
+#endif // __SD_H__
@@ -0,0 +1,52 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* SPI.h																		*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino SPI library (no bus)					*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __SPI_H__
+#define __SPI_H__
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include <Arduino.h>
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+#define LSBFIRST		0
+#define MSBFIRST		1
+
+#define SPI_MODE0		0x00
+#define SPI_MODE1		0x01
+#define SPI_MODE2		0x02
+#define SPI_MODE3		0x03
+
+/* ******************************************************************************** */
+/* Class
+/* ******************************************************************************** */
+class SPISettings {
+public:
+	SPISettings(uint32_t Clock_UL, uint8_t BitOrder_UB, uint8_t DataMode_UB) { (void)Clock_UL; (void)BitOrder_UB; (void)DataMode_UB; }
+	SPISettings() {}
+};
+
+class SPIClass {
+public:
+	void begin() {}
+	void end() {}
+	void beginTransaction(SPISettings Settings_X) { (void)Settings_X; }
+	void endTransaction() {}
+	uint8_t transfer(uint8_t Data_UB) { (void)Data_UB; return 0xFF; }
+};
+
+extern SPIClass SPI;
+
+#endif // __SPI_H__
@@ -0,0 +1,23 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* Server.h																		*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino Server interface							*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __SERVER_H__
+#define __SERVER_H__
+
+/* ******************************************************************************** */
+/* Class
+/* ******************************************************************************** */
+class Server : public Print {
+public:
+	virtual void begin() = 0;
+};
+
+#endif // __SERVER_H__
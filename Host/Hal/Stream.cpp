@@ -0,0 +1,56 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* Stream.cpp																		*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino Stream class								*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "Arduino.h"
+
+/* ******************************************************************************** */
+/* Functions
+/* ******************************************************************************** */
+void Stream::setTimeout(unsigned long Timeout_UL) {
+	this->Timeout_UL = Timeout_UL;
+}
+
+size_t Stream::readBytes(char * pBuffer_UB, size_t Length) {
+	size_t Nb = 0;
+	int Data_SI;
+
+	while ((Nb < Length) && ((Data_SI = timedRead()) >= 0))
+		pBuffer_UB[Nb++] = (char)Data_SI;
+
+	return Nb;
+}
+
+size_t Stream::readBytesUntil(char Terminator, char * pBuffer_UB, size_t Length) {
+	size_t Nb = 0;
+	int Data_SI;
+
+	while ((Nb < Length) && ((Data_SI = timedRead()) >= 0) && (Data_SI != Terminator))
+		pBuffer_UB[Nb++] = (char)Data_SI;
+
+	return Nb;
+}
+
+int Stream::timedRead(void) {
+	unsigned long StartTime_UL = millis();
+	int Data_SI;
+
+	do {
+		if ((Data_SI = read()) >= 0)
+			return Data_SI;
+		yield();
+	} while ((millis() - StartTime_UL) < Timeout_UL);
+
+	return -1;
+}
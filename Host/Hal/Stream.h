@@ -0,0 +1,37 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* Stream.h																			*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino Stream class								*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __STREAM_H__
+#define __STREAM_H__
+
+/* ******************************************************************************** */
+/* Class
+/* ******************************************************************************** */
+class Stream : public Print {
+public:
+	Stream() : Timeout_UL(1000) {}
+
+	virtual int available() = 0;
+	virtual int read() = 0;
+	virtual int peek() = 0;
+
+	void setTimeout(unsigned long Timeout_UL);
+	size_t readBytes(char * pBuffer_UB, size_t Length);
+	size_t readBytes(uint8_t * pBuffer_UB, size_t Length) { return readBytes((char *)pBuffer_UB, Length); }
+	size_t readBytesUntil(char Terminator, char * pBuffer_UB, size_t Length);
+
+protected:
+	int timedRead(void);
+
+	unsigned long Timeout_UL;						// [ms]
+};
+
+#endif // __STREAM_H__
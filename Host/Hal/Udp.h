@@ -0,0 +1,44 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* Udp.h																			*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino UDP interface								*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __UDP_H__
+#define __UDP_H__
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include <Arduino.h>
+
+/* ******************************************************************************** */
+/* Class
+/* ******************************************************************************** */
+class UDP : public Stream {
+public:
+	virtual uint8_t begin(uint16_t Port_UW) = 0;
+	virtual void stop() = 0;
+	virtual int beginPacket(IPAddress Ip_X, uint16_t Port_UW) = 0;
+	virtual int beginPacket(const char * pHost_UB, uint16_t Port_UW) = 0;
+	virtual int endPacket() = 0;
+	virtual size_t write(uint8_t Data_UB) = 0;
+	virtual size_t write(const uint8_t * pBuffer_UB, size_t Size) = 0;
+	virtual int parsePacket() = 0;
+	virtual int available() = 0;
+	virtual int read() = 0;
+	virtual int read(unsigned char * pBuffer_UB, size_t Size) = 0;
+	virtual int read(char * pBuffer_UB, size_t Size) = 0;
+	virtual int peek() = 0;
+	virtual void flush() = 0;
+	virtual IPAddress remoteIP() = 0;
+	virtual uint16_t remotePort() = 0;
+};
+
+#endif // __UDP_H__
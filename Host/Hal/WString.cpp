@@ -0,0 +1,295 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* WString.cpp																		*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino String class								*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "Arduino.h"
+
+/* ******************************************************************************** */
+/* Prototypes for Internal Functions
+/* ******************************************************************************** */
+static std::string FormatUnsigned(unsigned long Value_UL, unsigned char Base_UB);
+static std::string FormatSigned(long Value_SL, unsigned char Base_UB);
+static std::string FormatFloat(double Value_D, unsigned char DecimalPlaces_UB);
+
+/* ******************************************************************************** */
+/* Functions
+/* ******************************************************************************** */
+String::String(const char * pStr_UB) : Buffer_Str((pStr_UB != NULL) ? pStr_UB : "") {}
+String::String(const String & Str) : Buffer_Str(Str.Buffer_Str) {}
+String::String(char c) : Buffer_Str(1, c) {}
+String::String(unsigned char Value_UB, unsigned char Base_UB) : Buffer_Str(FormatUnsigned(Value_UB, Base_UB)) {}
+String::String(int Value_SI, unsigned char Base_UB) : Buffer_Str(FormatSigned(Value_SI, Base_UB)) {}
+String::String(unsigned int Value_UI, unsigned char Base_UB) : Buffer_Str(FormatUnsigned(Value_UI, Base_UB)) {}
+String::String(long Value_SL, unsigned char Base_UB) : Buffer_Str(FormatSigned(Value_SL, Base_UB)) {}
+String::String(unsigned long Value_UL, unsigned char Base_UB) : Buffer_Str(FormatUnsigned(Value_UL, Base_UB)) {}
+String::String(float Value_F, unsigned char DecimalPlaces_UB) : Buffer_Str(FormatFloat(Value_F, DecimalPlaces_UB)) {}
+String::String(double Value_D, unsigned char DecimalPlaces_UB) : Buffer_Str(FormatFloat(Value_D, DecimalPlaces_UB)) {}
+String::~String() {}
+
+String & String::operator = (const String & Rhs) {
+	Buffer_Str = Rhs.Buffer_Str;
+	return (*this);
+}
+
+String & String::operator = (const char * pStr_UB) {
+	Buffer_Str = (pStr_UB != NULL) ? pStr_UB : "";
+	return (*this);
+}
+
+unsigned char String::reserve(unsigned int Size_UI) {
+	Buffer_Str.reserve(Size_UI);
+	return 1;
+}
+
+unsigned int String::length(void) const {
+	return (unsigned int)(Buffer_Str.length());
+}
+
+unsigned char String::concat(const String & Str)		{ Buffer_Str += Str.Buffer_Str; return 1; }
+unsigned char String::concat(const char * pStr_UB)		{ if (pStr_UB == NULL) return 0; Buffer_Str += pStr_UB; return 1; }
+unsigned char String::concat(char c)					{ Buffer_Str += c; return 1; }
+unsigned char String::concat(unsigned char Value_UB)	{ Buffer_Str += FormatUnsigned(Value_UB, 10); return 1; }
+unsigned char String::concat(int Value_SI)				{ Buffer_Str += FormatSigned(Value_SI, 10); return 1; }
+unsigned char String::concat(unsigned int Value_UI)		{ Buffer_Str += FormatUnsigned(Value_UI, 10); return 1; }
+unsigned char String::concat(long Value_SL)				{ Buffer_Str += FormatSigned(Value_SL, 10); return 1; }
+unsigned char String::concat(unsigned long Value_UL)	{ Buffer_Str += FormatUnsigned(Value_UL, 10); return 1; }
+unsigned char String::concat(float Value_F)				{ Buffer_Str += FormatFloat(Value_F, 2); return 1; }
+unsigned char String::concat(double Value_D)			{ Buffer_Str += FormatFloat(Value_D, 2); return 1; }
+
+String operator + (const String & Lhs, const String & Rhs)			{ String Str(Lhs); Str.concat(Rhs); return Str; }
+String operator + (const String & Lhs, const char * pStr_UB)		{ String Str(Lhs); Str.concat(pStr_UB); return Str; }
+String operator + (const char * pStr_UB, const String & Rhs)		{ String Str(pStr_UB); Str.concat(Rhs); return Str; }
+String operator + (const String & Lhs, char c)						{ String Str(Lhs); Str.concat(c); return Str; }
+String operator + (const String & Lhs, unsigned char Value_UB)		{ String Str(Lhs); Str.concat(Value_UB); return Str; }
+String operator + (const String & Lhs, int Value_SI)				{ String Str(Lhs); Str.concat(Value_SI); return Str; }
+String operator + (const String & Lhs, unsigned int Value_UI)		{ String Str(Lhs); Str.concat(Value_UI); return Str; }
+String operator + (const String & Lhs, long Value_SL)				{ String Str(Lhs); Str.concat(Value_SL); return Str; }
+String operator + (const String & Lhs, unsigned long Value_UL)		{ String Str(Lhs); Str.concat(Value_UL); return Str; }
+String operator + (const String & Lhs, float Value_F)				{ String Str(Lhs); Str.concat(Value_F); return Str; }
+String operator + (const String & Lhs, double Value_D)				{ String Str(Lhs); Str.concat(Value_D); return Str; }
+
+int String::compareTo(const String & Str) const {
+	return Buffer_Str.compare(Str.Buffer_Str);
+}
+
+unsigned char String::equals(const String & Str) const {
+	return (Buffer_Str == Str.Buffer_Str);
+}
+
+unsigned char String::equals(const char * pStr_UB) const {
+	return (pStr_UB != NULL) && (Buffer_Str == pStr_UB);
+}
+
+unsigned char String::equalsIgnoreCase(const String & Str) const {
+	if (Buffer_Str.length() != Str.Buffer_Str.length())
+		return 0;
+
+	for (size_t i = 0; i < Buffer_Str.length(); i++) {
+		if (tolower((unsigned char)(Buffer_Str[i])) != tolower((unsigned char)(Str.Buffer_Str[i])))
+			return 0;
+	}
+	return 1;
+}
+
+unsigned char String::startsWith(const String & Prefix) const {
+	return (Buffer_Str.compare(0, Prefix.Buffer_Str.length(), Prefix.Buffer_Str) == 0);
+}
+
+unsigned char String::endsWith(const String & Suffix) const {
+	return (Buffer_Str.length() >= Suffix.Buffer_Str.length()) &&
+		   (Buffer_Str.compare(Buffer_Str.length() - Suffix.Buffer_Str.length(), Suffix.Buffer_Str.length(), Suffix.Buffer_Str) == 0);
+}
+
+char String::charAt(unsigned int Index_UI) const {
+	return (Index_UI < Buffer_Str.length()) ? Buffer_Str[Index_UI] : 0;
+}
+
+void String::setCharAt(unsigned int Index_UI, char c) {
+	if (Index_UI < Buffer_Str.length())
+		Buffer_Str[Index_UI] = c;
+}
+
+char String::operator [] (unsigned int Index_UI) const {
+	return charAt(Index_UI);
+}
+
+char & String::operator [] (unsigned int Index_UI) {
+	static char Dummy_UB;
+
+	if (Index_UI >= Buffer_Str.length()) {
+		Dummy_UB = 0;
+		return Dummy_UB;
+	}
+	return Buffer_Str[Index_UI];
+}
+
+void String::getBytes(unsigned char * pBuffer_UB, unsigned int BufferSize_UI, unsigned int Index_UI) const {
+	unsigned int Nb_UI;
+
+	if ((pBuffer_UB == NULL) || (BufferSize_UI == 0))
+		return;
+
+	if (Index_UI >= Buffer_Str.length()) {
+		pBuffer_UB[0] = 0;
+		return;
+	}
+
+	Nb_UI = min((unsigned int)(Buffer_Str.length()) - Index_UI, BufferSize_UI - 1);
+	memcpy(pBuffer_UB, Buffer_Str.data() + Index_UI, Nb_UI);
+	pBuffer_UB[Nb_UI] = 0;
+}
+
+void String::toCharArray(char * pBuffer_UB, unsigned int BufferSize_UI, unsigned int Index_UI) const {
+	getBytes((unsigned char *)pBuffer_UB, BufferSize_UI, Index_UI);
+}
+
+const char * String::c_str() const {
+	return Buffer_Str.c_str();
+}
+
+int String::indexOf(char c) const {
+	return indexOf(c, 0);
+}
+
+int String::indexOf(char c, unsigned int FromIndex_UI) const {
+	size_t Pos = Buffer_Str.find(c, FromIndex_UI);
+	return (Pos == std::string::npos) ? -1 : (int)Pos;
+}
+
+int String::indexOf(const String & Str) const {
+	return indexOf(Str, 0);
+}
+
+int String::indexOf(const String & Str, unsigned int FromIndex_UI) const {
+	size_t Pos = Buffer_Str.find(Str.Buffer_Str, FromIndex_UI);
+	return (Pos == std::string::npos) ? -1 : (int)Pos;
+}
+
+int String::lastIndexOf(char c) const {
+	size_t Pos = Buffer_Str.rfind(c);
+	return (Pos == std::string::npos) ? -1 : (int)Pos;
+}
+
+String String::substring(unsigned int BeginIndex_UI) const {
+	return substring(BeginIndex_UI, length());
+}
+
+String String::substring(unsigned int BeginIndex_UI, unsigned int EndIndex_UI) const {
+	String Str;
+
+	if (BeginIndex_UI > EndIndex_UI) {
+		unsigned int Tmp_UI = BeginIndex_UI;
+		BeginIndex_UI = EndIndex_UI;
+		EndIndex_UI = Tmp_UI;
+	}
+	if (BeginIndex_UI >= length())
+		return Str;
+
+	EndIndex_UI = min(EndIndex_UI, length());
+	Str.Buffer_Str = Buffer_Str.substr(BeginIndex_UI, EndIndex_UI - BeginIndex_UI);
+	return Str;
+}
+
+void String::replace(char Find, char Replace) {
+	for (size_t i = 0; i < Buffer_Str.length(); i++) {
+		if (Buffer_Str[i] == Find)
+			Buffer_Str[i] = Replace;
+	}
+}
+
+void String::replace(const String & Find, const String & Replace) {
+	size_t Pos = 0;
+
+	if (Find.Buffer_Str.empty())
+		return;
+
+	while ((Pos = Buffer_Str.find(Find.Buffer_Str, Pos)) != std::string::npos) {
+		Buffer_Str.replace(Pos, Find.Buffer_Str.length(), Replace.Buffer_Str);
+		Pos += Replace.Buffer_Str.length();
+	}
+}
+
+void String::remove(unsigned int Index_UI) {
+	remove(Index_UI, (unsigned int)-1);
+}
+
+void String::remove(unsigned int Index_UI, unsigned int Count_UI) {
+	if (Index_UI >= Buffer_Str.length())
+		return;
+
+	Buffer_Str.erase(Index_UI, min(Count_UI, (unsigned int)(Buffer_Str.length()) - Index_UI));
+}
+
+void String::toLowerCase(void) {
+	for (size_t i = 0; i < Buffer_Str.length(); i++)
+		Buffer_Str[i] = (char)tolower((unsigned char)(Buffer_Str[i]));
+}
+
+void String::toUpperCase(void) {
+	for (size_t i = 0; i < Buffer_Str.length(); i++)
+		Buffer_Str[i] = (char)toupper((unsigned char)(Buffer_Str[i]));
+}
+
+void String::trim(void) {
+	size_t Begin = Buffer_Str.find_first_not_of(" \t\r\n\v\f");
+	size_t End = Buffer_Str.find_last_not_of(" \t\r\n\v\f");
+
+	if (Begin == std::string::npos)
+		Buffer_Str.clear();
+	else
+		Buffer_Str = Buffer_Str.substr(Begin, End - Begin + 1);
+}
+
+long String::toInt(void) const {
+	return atol(Buffer_Str.c_str());
+}
+
+float String::toFloat(void) const {
+	return (float)(atof(Buffer_Str.c_str()));
+}
+
+
+/* ******************************************************************************** */
+/* Internal Functions
+/* ******************************************************************************** */
+std::string FormatUnsigned(unsigned long Value_UL, unsigned char Base_UB) {
+	char pDigit_UB[8 * sizeof(unsigned long) + 1];
+	int Idx_SI = sizeof(pDigit_UB) - 1;
+
+	if (Base_UB < 2)
+		Base_UB = 10;
+
+	pDigit_UB[Idx_SI] = 0;
+	do {
+		unsigned long Digit_UL = Value_UL % Base_UB;
+		pDigit_UB[--Idx_SI] = (char)((Digit_UL < 10) ? ('0' + Digit_UL) : ('a' + Digit_UL - 10));
+		Value_UL /= Base_UB;
+	} while (Value_UL != 0);
+
+	return std::string(&pDigit_UB[Idx_SI]);
+}
+
+std::string FormatSigned(long Value_SL, unsigned char Base_UB) {
+	if ((Base_UB == 10) && (Value_SL < 0))
+		return "-" + FormatUnsigned(0UL - (unsigned long)Value_SL, 10);
+
+	return FormatUnsigned((unsigned long)Value_SL, Base_UB);
+}
+
+std::string FormatFloat(double Value_D, unsigned char DecimalPlaces_UB) {
+	char pBuffer_UB[64];
+
+	snprintf(pBuffer_UB, sizeof(pBuffer_UB), "%.*f", (int)DecimalPlaces_UB, Value_D);
+	return std::string(pBuffer_UB);
+}
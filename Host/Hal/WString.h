@@ -0,0 +1,121 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* WString.h																		*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino String class								*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __WSTRING_H__
+#define __WSTRING_H__
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include <string>
+
+/* ******************************************************************************** */
+/* Class
+/* ******************************************************************************** */
+class String {
+public:
+	// Constructors
+	String(const char * pStr_UB = "");
+	String(const String & Str);
+	explicit String(char c);
+	explicit String(unsigned char Value_UB, unsigned char Base_UB = 10);
+	explicit String(int Value_SI, unsigned char Base_UB = 10);
+	explicit String(unsigned int Value_UI, unsigned char Base_UB = 10);
+	explicit String(long Value_SL, unsigned char Base_UB = 10);
+	explicit String(unsigned long Value_UL, unsigned char Base_UB = 10);
+	explicit String(float Value_F, unsigned char DecimalPlaces_UB = 2);
+	explicit String(double Value_D, unsigned char DecimalPlaces_UB = 2);
+	~String();
+
+	String & operator = (const String & Rhs);
+	String & operator = (const char * pStr_UB);
+
+	unsigned char reserve(unsigned int Size_UI);
+	unsigned int length(void) const;
+
+	unsigned char concat(const String & Str);
+	unsigned char concat(const char * pStr_UB);
+	unsigned char concat(char c);
+	unsigned char concat(unsigned char Value_UB);
+	unsigned char concat(int Value_SI);
+	unsigned char concat(unsigned int Value_UI);
+	unsigned char concat(long Value_SL);
+	unsigned char concat(unsigned long Value_UL);
+	unsigned char concat(float Value_F);
+	unsigned char concat(double Value_D);
+
+	String & operator += (const String & Rhs)		{ concat(Rhs); return (*this); }
+	String & operator += (const char * pStr_UB)		{ concat(pStr_UB); return (*this); }
+	String & operator += (char c)					{ concat(c); return (*this); }
+	String & operator += (unsigned char Value_UB)	{ concat(Value_UB); return (*this); }
+	String & operator += (int Value_SI)				{ concat(Value_SI); return (*this); }
+	String & operator += (unsigned int Value_UI)	{ concat(Value_UI); return (*this); }
+	String & operator += (long Value_SL)			{ concat(Value_SL); return (*this); }
+	String & operator += (unsigned long Value_UL)	{ concat(Value_UL); return (*this); }
+	String & operator += (float Value_F)			{ concat(Value_F); return (*this); }
+	String & operator += (double Value_D)			{ concat(Value_D); return (*this); }
+
+	friend String operator + (const String & Lhs, const String & Rhs);
+	friend String operator + (const String & Lhs, const char * pStr_UB);
+	friend String operator + (const char * pStr_UB, const String & Rhs);
+	friend String operator + (const String & Lhs, char c);
+	friend String operator + (const String & Lhs, unsigned char Value_UB);
+	friend String operator + (const String & Lhs, int Value_SI);
+	friend String operator + (const String & Lhs, unsigned int Value_UI);
+	friend String operator + (const String & Lhs, long Value_SL);
+	friend String operator + (const String & Lhs, unsigned long Value_UL);
+	friend String operator + (const String & Lhs, float Value_F);
+	friend String operator + (const String & Lhs, double Value_D);
+
+	int compareTo(const String & Str) const;
+	unsigned char equals(const String & Str) const;
+	unsigned char equals(const char * pStr_UB) const;
+	unsigned char operator == (const String & Rhs) const	{ return equals(Rhs); }
+	unsigned char operator == (const char * pStr_UB) const	{ return equals(pStr_UB); }
+	unsigned char operator != (const String & Rhs) const	{ return !equals(Rhs); }
+	unsigned char operator != (const char * pStr_UB) const	{ return !equals(pStr_UB); }
+	unsigned char equalsIgnoreCase(const String & Str) const;
+	unsigned char startsWith(const String & Prefix) const;
+	unsigned char endsWith(const String & Suffix) const;
+
+	char charAt(unsigned int Index_UI) const;
+	void setCharAt(unsigned int Index_UI, char c);
+	char operator [] (unsigned int Index_UI) const;
+	char & operator [] (unsigned int Index_UI);
+	void getBytes(unsigned char * pBuffer_UB, unsigned int BufferSize_UI, unsigned int Index_UI = 0) const;
+	void toCharArray(char * pBuffer_UB, unsigned int BufferSize_UI, unsigned int Index_UI = 0) const;
+	const char * c_str() const;
+
+	int indexOf(char c) const;
+	int indexOf(char c, unsigned int FromIndex_UI) const;
+	int indexOf(const String & Str) const;
+	int indexOf(const String & Str, unsigned int FromIndex_UI) const;
+	int lastIndexOf(char c) const;
+	String substring(unsigned int BeginIndex_UI) const;
+	String substring(unsigned int BeginIndex_UI, unsigned int EndIndex_UI) const;
+
+	void replace(char Find, char Replace);
+	void replace(const String & Find, const String & Replace);
+	void remove(unsigned int Index_UI);
+	void remove(unsigned int Index_UI, unsigned int Count_UI);
+	void toLowerCase(void);
+	void toUpperCase(void);
+	void trim(void);
+
+	long toInt(void) const;
+	float toFloat(void) const;
+
+private:
+	std::string Buffer_Str;
+};
+
+#endif // __WSTRING_H__
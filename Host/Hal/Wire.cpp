@@ -0,0 +1,331 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* Wire.cpp																			*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino Due TwoWire class and models of the			*/
+/*		devices of the W-Link board :												*/
+/*		- 24LC256 EEPROM (Wire1) : 64-byte pages, 5 ms write cycle without ACK,		*/
+/*		  content written through to the image given by --eeprom					*/
+/*		- DS1339 RTC (Wire) : BCD registers running from the host local time		*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "HostHal.h"
+#include <Wire.h>
+
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+#define WIRE_STS_OK				0
+#define WIRE_STS_NACK_ADDR		2
+#define WIRE_STS_NACK_DATA		3
+
+#define RTC_REG_YEAR			0x06		// Last time keeping register
+
+/* ******************************************************************************** */
+/* Local Variables
+/* ******************************************************************************** */
+static uint8_t GL_pHostHalEeprom_UB[HOST_HAL_EEPROM_SIZE];
+static boolean GL_HostHalEepromErased_B = false;
+static unsigned int GL_HostHalEepromPointer_UI = 0;
+static unsigned long GL_HostHalEepromBusyTime_UL = 0;		// micros() at the start of the write cycle
+static boolean GL_HostHalEepromBusy_B = false;
+static int GL_HostHalEepromFd_SI = -1;
+
+static uint8_t GL_pHostHalRtcRegister_UB[HOST_HAL_RTC_REGISTER_NB];
+static uint8_t GL_HostHalRtcPointer_UB = 0;
+static time_t GL_HostHalRtcBaseTime_T = 0;					// RTC time at GL_HostHalRtcBaseMs_UL
+static unsigned long GL_HostHalRtcBaseMs_UL = 0;
+
+TwoWire Wire(0);
+TwoWire Wire1(1);
+
+/* ******************************************************************************** */
+/* Prototypes for Internal Functions
+/* ******************************************************************************** */
+static void EraseEeprom(void);
+static boolean IsEepromBusy(void);
+static uint8_t EepromWrite(const uint8_t * pData_UB, uint8_t Size_UB);
+static uint8_t EepromRead(uint8_t * pData_UB, uint8_t Size_UB);
+
+static void RtcUpdateRegisters(void);
+static uint8_t RtcWrite(const uint8_t * pData_UB, uint8_t Size_UB);
+static uint8_t RtcRead(uint8_t * pData_UB, uint8_t Size_UB);
+static uint8_t DecToBcd(int Value_SI);
+static int BcdToDec(uint8_t Value_UB);
+
+/* ******************************************************************************** */
+/* Functions
+/* ******************************************************************************** */
+uint8_t * HostHal_GetEeprom(void) {
+	EraseEeprom();
+	return GL_pHostHalEeprom_UB;
+}
+
+// Missing bytes of a short image stay erased - the image is then written through
+boolean HostHal_LoadEeprom(const char * pPath_UB) {
+	ssize_t Nb;
+
+	EraseEeprom();
+	if (GL_HostHalEepromFd_SI >= 0)
+		close(GL_HostHalEepromFd_SI);
+
+	if ((GL_HostHalEepromFd_SI = open(pPath_UB, O_RDWR | O_CREAT, 0644)) < 0) {
+		perror("HostHal : EEPROM image");
+		return false;
+	}
+
+	Nb = pread(GL_HostHalEepromFd_SI, GL_pHostHalEeprom_UB, HOST_HAL_EEPROM_SIZE, 0);
+	if (Nb < HOST_HAL_EEPROM_SIZE)
+		HostHal_SaveEeprom();
+
+	return true;
+}
+
+void HostHal_SaveEeprom(void) {
+	if ((GL_HostHalEepromFd_SI >= 0) && (pwrite(GL_HostHalEepromFd_SI, GL_pHostHalEeprom_UB, HOST_HAL_EEPROM_SIZE, 0) != HOST_HAL_EEPROM_SIZE))
+		perror("HostHal : EEPROM image");
+}
+
+
+/* ******************************************************************************** */
+/* TwoWire
+/* ******************************************************************************** */
+TwoWire::TwoWire(unsigned char Bus_UB) {
+	this->Bus_UB = Bus_UB;
+	TxAddr_UB = 0;
+	TxNb_UB = 0;
+	IsTransmitting_B = false;
+	RxIdx_UB = 0;
+	RxNb_UB = 0;
+}
+
+void TwoWire::begin(void) {
+	EraseEeprom();
+}
+
+void TwoWire::begin(uint8_t Addr_UB) {
+	begin();
+}
+
+void TwoWire::setClock(uint32_t Frequency_UL) {}
+
+void TwoWire::beginTransmission(uint8_t Addr_UB) {
+	TxAddr_UB = Addr_UB;
+	TxNb_UB = 0;
+	IsTransmitting_B = true;
+}
+
+uint8_t TwoWire::endTransmission(void) {
+	return endTransmission(1);
+}
+
+uint8_t TwoWire::endTransmission(uint8_t SendStop_UB) {
+	IsTransmitting_B = false;
+
+	if ((Bus_UB == 1) && (TxAddr_UB == HOST_HAL_EEPROM_ADDR))
+		return EepromWrite(pTxBuffer_UB, TxNb_UB);
+	if ((Bus_UB == 0) && (TxAddr_UB == HOST_HAL_RTC_ADDR))
+		return RtcWrite(pTxBuffer_UB, TxNb_UB);
+
+	return WIRE_STS_NACK_ADDR;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t Addr_UB, uint8_t Quantity_UB) {
+	return requestFrom(Addr_UB, Quantity_UB, (uint8_t)1);
+}
+
+uint8_t TwoWire::requestFrom(uint8_t Addr_UB, uint8_t Quantity_UB, uint8_t SendStop_UB) {
+	(void)SendStop_UB;
+
+	RxIdx_UB = 0;
+	RxNb_UB = 0;
+	Quantity_UB = min(Quantity_UB, (uint8_t)BUFFER_LENGTH);
+
+	if ((Bus_UB == 1) && (Addr_UB == HOST_HAL_EEPROM_ADDR))
+		RxNb_UB = EepromRead(pRxBuffer_UB, Quantity_UB);
+	else if ((Bus_UB == 0) && (Addr_UB == HOST_HAL_RTC_ADDR))
+		RxNb_UB = RtcRead(pRxBuffer_UB, Quantity_UB);
+
+	return RxNb_UB;
+}
+
+size_t TwoWire::write(uint8_t Data_UB) {
+	if (!IsTransmitting_B || (TxNb_UB >= BUFFER_LENGTH))
+		return 0;
+
+	pTxBuffer_UB[TxNb_UB++] = Data_UB;
+	return 1;
+}
+
+size_t TwoWire::write(const uint8_t * pData_UB, size_t Size) {
+	size_t Nb = 0;
+
+	while ((Nb < Size) && (write(pData_UB[Nb]) == 1))
+		Nb++;
+
+	return Nb;
+}
+
+int TwoWire::available(void) {
+	return RxNb_UB - RxIdx_UB;
+}
+
+int TwoWire::read(void) {
+	return (RxIdx_UB < RxNb_UB) ? pRxBuffer_UB[RxIdx_UB++] : -1;
+}
+
+int TwoWire::peek(void) {
+	return (RxIdx_UB < RxNb_UB) ? pRxBuffer_UB[RxIdx_UB] : -1;
+}
+
+
+/* ******************************************************************************** */
+/* Internal Functions
+/* ******************************************************************************** */
+
+// A new part is delivered erased
+void EraseEeprom(void) {
+	if (GL_HostHalEepromErased_B)
+		return;
+
+	memset(GL_pHostHalEeprom_UB, 0xFF, sizeof(GL_pHostHalEeprom_UB));
+	GL_HostHalEepromErased_B = true;
+}
+
+boolean IsEepromBusy(void) {
+	if (GL_HostHalEepromBusy_B && ((micros() - GL_HostHalEepromBusyTime_UL) >= HOST_HAL_EEPROM_WRITE_TIME_US))
+		GL_HostHalEepromBusy_B = false;
+
+	return GL_HostHalEepromBusy_B;
+}
+
+// Address MSB - Address LSB - Data... : the data wrap around inside the page
+uint8_t EepromWrite(const uint8_t * pData_UB, uint8_t Size_UB) {
+	unsigned int PageAddr_UI;
+
+	if (IsEepromBusy())
+		return WIRE_STS_NACK_ADDR;	// Write cycle in progress -> ACK polling
+
+	if (Size_UB < 2)
+		return (Size_UB == 0) ? WIRE_STS_OK : WIRE_STS_NACK_DATA;
+
+	GL_HostHalEepromPointer_UI = (((unsigned int)(pData_UB[0]) << 8) | pData_UB[1]) % HOST_HAL_EEPROM_SIZE;
+	if (Size_UB == 2)
+		return WIRE_STS_OK;		// Address set for a random read
+
+	PageAddr_UI = GL_HostHalEepromPointer_UI - (GL_HostHalEepromPointer_UI % HOST_HAL_EEPROM_PAGE_SIZE);
+	for (uint8_t i = 2; i < Size_UB; i++) {
+		GL_pHostHalEeprom_UB[GL_HostHalEepromPointer_UI] = pData_UB[i];
+		GL_HostHalEepromPointer_UI = PageAddr_UI + ((GL_HostHalEepromPointer_UI + 1) % HOST_HAL_EEPROM_PAGE_SIZE);
+	}
+
+	if ((GL_HostHalEepromFd_SI >= 0) &&
+		(pwrite(GL_HostHalEepromFd_SI, &GL_pHostHalEeprom_UB[PageAddr_UI], HOST_HAL_EEPROM_PAGE_SIZE, PageAddr_UI) != HOST_HAL_EEPROM_PAGE_SIZE))
+		perror("HostHal : EEPROM image");
+
+	GL_HostHalEepromBusy_B = true;
+	GL_HostHalEepromBusyTime_UL = micros();
+	return WIRE_STS_OK;
+}
+
+// Sequential read from the current address, wrapping at the end of the memory
+uint8_t EepromRead(uint8_t * pData_UB, uint8_t Size_UB) {
+	if (IsEepromBusy())
+		return 0;
+
+	for (uint8_t i = 0; i < Size_UB; i++) {
+		pData_UB[i] = GL_pHostHalEeprom_UB[GL_HostHalEepromPointer_UI];
+		GL_HostHalEepromPointer_UI = (GL_HostHalEepromPointer_UI + 1) % HOST_HAL_EEPROM_SIZE;
+	}
+
+	return Size_UB;
+}
+
+// Time keeping registers refreshed from the running clock
+void RtcUpdateRegisters(void) {
+	struct tm Time_X;
+	time_t Now_T;
+
+	if (GL_HostHalRtcBaseTime_T == 0) {
+		// Local time of the host at the first access
+		Now_T = time(NULL);
+		localtime_r(&Now_T, &Time_X);
+		GL_HostHalRtcBaseTime_T = Now_T + Time_X.tm_gmtoff;
+		GL_HostHalRtcBaseMs_UL = millis();
+	}
+
+	Now_T = GL_HostHalRtcBaseTime_T + (time_t)((millis() - GL_HostHalRtcBaseMs_UL) / 1000);
+	gmtime_r(&Now_T, &Time_X);
+
+	GL_pHostHalRtcRegister_UB[0] = DecToBcd(Time_X.tm_sec);
+	GL_pHostHalRtcRegister_UB[1] = DecToBcd(Time_X.tm_min);
+	GL_pHostHalRtcRegister_UB[2] = DecToBcd(Time_X.tm_hour);		// 24-hour mode
+	GL_pHostHalRtcRegister_UB[3] = DecToBcd(Time_X.tm_wday + 1);
+	GL_pHostHalRtcRegister_UB[4] = DecToBcd(Time_X.tm_mday);
+	GL_pHostHalRtcRegister_UB[5] = DecToBcd(Time_X.tm_mon + 1);
+	GL_pHostHalRtcRegister_UB[6] = DecToBcd(Time_X.tm_year % 100);
+}
+
+// Register address - Data... : a write in the time keeping registers restarts the clock from them
+uint8_t RtcWrite(const uint8_t * pData_UB, uint8_t Size_UB) {
+	boolean TimeWritten_B = false;
+	struct tm Time_X;
+
+	if (Size_UB == 0)
+		return WIRE_STS_OK;
+
+	RtcUpdateRegisters();
+	GL_HostHalRtcPointer_UB = pData_UB[0] % HOST_HAL_RTC_REGISTER_NB;
+
+	for (uint8_t i = 1; i < Size_UB; i++) {
+		GL_pHostHalRtcRegister_UB[GL_HostHalRtcPointer_UB] = pData_UB[i];
+		if (GL_HostHalRtcPointer_UB <= RTC_REG_YEAR)
+			TimeWritten_B = true;
+		GL_HostHalRtcPointer_UB = (GL_HostHalRtcPointer_UB + 1) % HOST_HAL_RTC_REGISTER_NB;
+	}
+
+	if (TimeWritten_B) {
+		memset(&Time_X, 0, sizeof(Time_X));
+		Time_X.tm_sec = BcdToDec(GL_pHostHalRtcRegister_UB[0] & 0x7F);
+		Time_X.tm_min = BcdToDec(GL_pHostHalRtcRegister_UB[1] & 0x7F);
+		Time_X.tm_hour = BcdToDec(GL_pHostHalRtcRegister_UB[2] & 0x3F);
+		Time_X.tm_mday = BcdToDec(GL_pHostHalRtcRegister_UB[4] & 0x3F);
+		Time_X.tm_mon = BcdToDec(GL_pHostHalRtcRegister_UB[5] & 0x1F) - 1;
+		Time_X.tm_year = BcdToDec(GL_pHostHalRtcRegister_UB[6]) + 100;
+		GL_HostHalRtcBaseTime_T = timegm(&Time_X);
+		GL_HostHalRtcBaseMs_UL = millis();
+	}
+
+	return WIRE_STS_OK;
+}
+
+uint8_t RtcRead(uint8_t * pData_UB, uint8_t Size_UB) {
+	RtcUpdateRegisters();
+
+	for (uint8_t i = 0; i < Size_UB; i++) {
+		pData_UB[i] = GL_pHostHalRtcRegister_UB[GL_HostHalRtcPointer_UB];
+		GL_HostHalRtcPointer_UB = (GL_HostHalRtcPointer_UB + 1) % HOST_HAL_RTC_REGISTER_NB;
+	}
+
+	return Size_UB;
+}
+
+uint8_t DecToBcd(int Value_SI) {
+	return (uint8_t)(((Value_SI / 10) << 4) | (Value_SI % 10));
+}
+
+int BcdToDec(uint8_t Value_UB) {
+	return ((Value_UB >> 4) * 10) + (Value_UB & 0x0F);
+}
@@ -0,0 +1,77 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* Wire.h																			*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the Arduino Due TwoWire class							*/
+/*		Wire carries the DS1339 RTC model, Wire1 the 24LC256 EEPROM model			*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __WIRE_H__
+#define __WIRE_H__
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include <Arduino.h>
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+#define BUFFER_LENGTH		32
+
+/* ******************************************************************************** */
+/* Class
+/* ******************************************************************************** */
+class TwoWire : public Stream {
+public:
+	// Constructor
+	TwoWire(unsigned char Bus_UB);
+
+	// Functions
+	void begin(void);
+	void begin(uint8_t Addr_UB);
+	void setClock(uint32_t Frequency_UL);
+
+	void beginTransmission(uint8_t Addr_UB);
+	void beginTransmission(int Addr_SI) { beginTransmission((uint8_t)Addr_SI); }
+	uint8_t endTransmission(void);
+	uint8_t endTransmission(uint8_t SendStop_UB);
+
+	uint8_t requestFrom(uint8_t Addr_UB, uint8_t Quantity_UB);
+	uint8_t requestFrom(uint8_t Addr_UB, uint8_t Quantity_UB, uint8_t SendStop_UB);
+	uint8_t requestFrom(int Addr_SI, int Quantity_SI) { return requestFrom((uint8_t)Addr_SI, (uint8_t)Quantity_SI); }
+	uint8_t requestFrom(int Addr_SI, int Quantity_SI, int SendStop_SI) { return requestFrom((uint8_t)Addr_SI, (uint8_t)Quantity_SI, (uint8_t)SendStop_SI); }
+
+	virtual size_t write(uint8_t Data_UB);
+	virtual size_t write(const uint8_t * pData_UB, size_t Size);
+	virtual int available(void);
+	virtual int read(void);
+	virtual int peek(void);
+	virtual void flush(void) {}
+
+	inline size_t write(unsigned long Data_UL) { return write((uint8_t)Data_UL); }
+	inline size_t write(long Data_SL) { return write((uint8_t)Data_SL); }
+	inline size_t write(unsigned int Data_UI) { return write((uint8_t)Data_UI); }
+	inline size_t write(int Data_SI) { return write((uint8_t)Data_SI); }
+	using Print::write;
+
+private:
+	unsigned char Bus_UB;
+	uint8_t TxAddr_UB;
+	uint8_t pTxBuffer_UB[BUFFER_LENGTH];
+	uint8_t TxNb_UB;
+	boolean IsTransmitting_B;
+	uint8_t pRxBuffer_UB[BUFFER_LENGTH];
+	uint8_t RxIdx_UB;
+	uint8_t RxNb_UB;
+};
+
+extern TwoWire Wire;
+extern TwoWire Wire1;
+
+#endif // __WIRE_H__
@@ -0,0 +1,38 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* w5100.h																		*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host replacement of the W5100 register access							*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __W5100_H__
+#define __W5100_H__
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include <SPI.h>
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+#define SPI_ETHERNET_SETTINGS SPISettings(14000000, MSBFIRST, SPI_MODE0)
+
+/* ******************************************************************************** */
+/* Class
+/* ******************************************************************************** */
+class W5100Class {
+public:
+	void setIPAddress(uint8_t * pAddr_UB);
+	void setGatewayIp(uint8_t * pAddr_UB);
+	void setSubnetMask(uint8_t * pAddr_UB);
+};
+
+extern W5100Class W5100;
+
+#endif // __W5100_H__
@@ -0,0 +1,458 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* FonaModuleTest.cpp																*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host test of the asynchronous AT engine (FonaModule), of the FONA Module	*/
+/*		Manager polling and of the GSM connection of KipControlMedium, against a	*/
+/*		fake modem wired to COM1 on the simulated clock								*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "HostHal.h"
+#include "WLink.h"
+#include "KipControlMedium.h"
+
+#include "Debug.h"
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+#define FAKE_MODEM_PORT					PORT_COM1
+#define FAKE_MODEM_LINE_SIZE			128
+#define FAKE_MODEM_ANSWER_SIZE			512
+#define FAKE_MODEM_HTTP_ACTION_DELAY_MS	5000		// +HTTPACTION: comes long after the OK
+#define FAKE_MODEM_HTTP_BODY			"line\r\n\r\nOK\r\n!"	// Read by AT+HTTPREAD
+
+#define TEST_CHECK(Condition)	do { if (!(Condition)) { fprintf(stderr, "FAILED line %d : %s\n", __LINE__, #Condition); GL_TestFailureNb_UL++; } } while (0)
+
+/* ******************************************************************************** */
+/* Structure & Enumeration
+/* ******************************************************************************** */
+
+// Answers as a SIM800 with a registered SIM card and a working HTTP service
+typedef struct {
+	char pLine_UB[FAKE_MODEM_LINE_SIZE];
+	unsigned int LineLength_UI;
+	uint8_t LastByte_UB;
+	char pAnswer_UB[FAKE_MODEM_ANSWER_SIZE];		// Sent by FakeModem_Step() as the RX buffer allows it
+	unsigned int AnswerLength_UI;
+	unsigned int AnswerIndex_UI;
+	unsigned long HttpActionTime_UL;				// [ms] - pending +HTTPACTION: (0 = none)
+	boolean HttpSession_B;
+	boolean SilentHttpTerm_B;						// No answer to AT+HTTPTERM
+	boolean FailHttpData_B;							// ERROR to AT+HTTPDATA
+	unsigned long HttpInitNb_UL;
+	unsigned long HttpActionNb_UL;
+	unsigned long DataExpected_UL;					// Bytes announced by AT+HTTPDATA and not received yet
+	unsigned long DataReceived_UL;					// Bytes received since the last AT+HTTPDATA
+	boolean DataEnded_B;							// Next byte must start a command
+	unsigned long StrayByteNb_UL;					// Bytes received between the data and the next command
+} FAKE_MODEM_STRUCT;
+
+/* ******************************************************************************** */
+/* Global Variables
+/* ******************************************************************************** */
+
+// Defined by the sketch for the application
+GLOBAL_PARAM_STRUCT GL_GlobalData_X;
+GLOBAL_CONFIG_STRUCT GL_GlobalConfig_X;
+
+/* ******************************************************************************** */
+/* Local Variables
+/* ******************************************************************************** */
+static FAKE_MODEM_STRUCT GL_FakeModem_X;
+static FonaModule GL_Fona_H;
+static unsigned long GL_TestFailureNb_UL = 0;
+
+static boolean GL_ActionCompleted_B = false;
+static boolean GL_BusyOnActionCompletion_B = false;
+static char GL_pHttpBody_UB[FONA_MODULE_AT_RESPONSE_SIZE];
+static int GL_HttpBodyLength_SI = -1;
+
+/* ******************************************************************************** */
+/* Prototypes for Internal Functions
+/* ******************************************************************************** */
+static void FakeModem_Receive(void * pContext, const uint8_t * pData_UB, size_t Size);
+static void FakeModem_Step(void * pContext);
+static void FakeModem_Answer(FAKE_MODEM_STRUCT * pModem_X, const char * pAnswer_UB);
+static void FakeModem_ProcessCommand(FAKE_MODEM_STRUCT * pModem_X);
+
+static void RunEngine(unsigned long DurationMs_UL);
+static void RunManager(unsigned long DurationMs_UL);
+static void OnHttpAction(FONA_MODULE_AT_STS_ENUM Status_E, const char * pResponse_UB);
+static void OnHttpRead(FONA_MODULE_AT_STS_ENUM Status_E, const char * pResponse_UB);
+
+static void TestChainedRequests(void);
+static void TestPollingWhileBusy(void);
+static void TestHttpTermination(void);
+static void TestPostTransaction(void);
+static void TestHttpRead(void);
+
+/* ******************************************************************************** */
+/* Main
+/* ******************************************************************************** */
+int main(int argc, char * argv[]) {
+	char * pArgument_UB[] = { argv[0], (char *)"--clock", (char *)"sim:1000", (char *)"--com", (char *)"1:none", (char *)"--com", (char *)"2:none", (char *)"--com", (char *)"3:none" };
+	HOST_HAL_SERIAL_DEVICE_STRUCT Device_X = { &GL_FakeModem_X, FakeModem_Receive, FakeModem_Step };
+
+	HostHal_Init(sizeof(pArgument_UB) / sizeof(char *), pArgument_UB);
+	HostHal_AttachSerialDevice(FAKE_MODEM_PORT, &Device_X);
+	Debug_Init(&Serial);
+
+	// Power pin is pulled-up by the HAL -> module seen as powered
+	GL_Fona_H.init(&Serial1, FONA_MODULE_DEFAULT_BAUDRATE, true, PIN_GPIO_OUTPUT0, PIN_GPIO_OUTPUT1, PIN_GPIO_INPUT0, (char *)"0000");
+
+	TestChainedRequests();
+	TestPollingWhileBusy();
+	TestHttpTermination();
+	TestPostTransaction();
+	TestHttpRead();
+
+	Debug_Flush();
+	fprintf(stderr, "%s\n", (GL_TestFailureNb_UL == 0) ? "FonaModuleTest PASSED" : "FonaModuleTest FAILED");
+	return ((GL_TestFailureNb_UL == 0) ? 0 : 1);
+}
+
+
+/* ******************************************************************************** */
+/* Tests
+/* ******************************************************************************** */
+
+// A chained request depends on the request queued just before it, whatever completed last
+void TestChainedRequests(void) {
+	unsigned long pTicket_UL[5];
+
+	fprintf(stderr, "Test : chained requests\n");
+
+	pTicket_UL[0] = GL_Fona_H.requestAt("AT+FAIL");
+	pTicket_UL[1] = GL_Fona_H.requestAt("AT", FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, NULL, "OK", NULL, true);
+	pTicket_UL[2] = GL_Fona_H.requestAt("AT", FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, NULL, "OK", NULL, true);
+	pTicket_UL[3] = GL_Fona_H.requestAt("AT");
+	pTicket_UL[4] = GL_Fona_H.requestAt("AT", FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, NULL, "OK", NULL, true);
+	RunEngine(1000);
+
+	TEST_CHECK(!GL_Fona_H.isAtBusy());
+	TEST_CHECK(GL_Fona_H.getAtStatus(pTicket_UL[0]) == FONA_MODULE_AT_STS_ERROR);
+	TEST_CHECK(GL_Fona_H.getAtStatus(pTicket_UL[1]) == FONA_MODULE_AT_STS_ABORTED);
+	TEST_CHECK(GL_Fona_H.getAtStatus(pTicket_UL[2]) == FONA_MODULE_AT_STS_ABORTED);
+	TEST_CHECK(GL_Fona_H.getAtStatus(pTicket_UL[3]) == FONA_MODULE_AT_STS_OK);
+	TEST_CHECK(GL_Fona_H.getAtStatus(pTicket_UL[4]) == FONA_MODULE_AT_STS_OK);
+
+	// Previous request already completed when the chained one is queued
+	pTicket_UL[0] = GL_Fona_H.requestAt("AT+FAIL");
+	RunEngine(100);
+	pTicket_UL[1] = GL_Fona_H.requestAt("AT", FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, NULL, "OK", NULL, true);
+	RunEngine(100);
+	TEST_CHECK(GL_Fona_H.getAtStatus(pTicket_UL[1]) == FONA_MODULE_AT_STS_ABORTED);
+
+	pTicket_UL[0] = GL_Fona_H.requestAt("AT");
+	RunEngine(100);
+	pTicket_UL[1] = GL_Fona_H.requestAt("AT", FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, NULL, "OK", NULL, true);
+	RunEngine(100);
+	TEST_CHECK(GL_Fona_H.getAtStatus(pTicket_UL[1]) == FONA_MODULE_AT_STS_OK);
+
+	// Nothing discarded by the abort -> chain not broken
+	pTicket_UL[0] = GL_Fona_H.requestAt("AT");
+	RunEngine(100);
+	GL_Fona_H.abortAtRequests();
+	pTicket_UL[1] = GL_Fona_H.requestAt("AT", FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, NULL, "OK", NULL, true);
+	RunEngine(100);
+	TEST_CHECK(GL_Fona_H.getAtStatus(pTicket_UL[1]) == FONA_MODULE_AT_STS_OK);
+
+	// Pending request discarded by the abort -> chain broken
+	pTicket_UL[0] = GL_Fona_H.requestAt("AT");
+	GL_Fona_H.abortAtRequests();
+	pTicket_UL[1] = GL_Fona_H.requestAt("AT", FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, NULL, "OK", NULL, true);
+	RunEngine(100);
+	TEST_CHECK(GL_Fona_H.getAtStatus(pTicket_UL[0]) == FONA_MODULE_AT_STS_ABORTED);
+	TEST_CHECK(GL_Fona_H.getAtStatus(pTicket_UL[1]) == FONA_MODULE_AT_STS_ABORTED);
+
+	// Timeout breaks the chain too
+	GL_FakeModem_X.SilentHttpTerm_B = true;
+	pTicket_UL[0] = GL_Fona_H.requestAt("AT+HTTPTERM");
+	pTicket_UL[1] = GL_Fona_H.requestAt("AT+HTTPINIT", FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, NULL, "OK", NULL, true);
+	RunEngine(2000);
+	GL_FakeModem_X.SilentHttpTerm_B = false;
+	TEST_CHECK(GL_Fona_H.getAtStatus(pTicket_UL[0]) == FONA_MODULE_AT_STS_TIMEOUT);
+	TEST_CHECK(GL_Fona_H.getAtStatus(pTicket_UL[1]) == FONA_MODULE_AT_STS_ABORTED);
+	TEST_CHECK(GL_FakeModem_X.HttpInitNb_UL == 0);
+}
+
+// Status polling must not be queued behind a long request (e.g. an HTTP transaction)
+void TestPollingWhileBusy(void) {
+	unsigned long Ticket_UL;
+
+	fprintf(stderr, "Test : status polling while busy\n");
+
+	FonaModuleManager_Init(&GL_Fona_H, true);
+	FonaModuleManager_Enable();
+	for (int i = 0; (i < 120) && !FonaModuleManager_IsRunning(); i++)
+		RunManager(500);
+	TEST_CHECK(FonaModuleManager_IsRunning());
+	RunManager(5000);
+	TEST_CHECK(FonaModuleManager_GetCurrentGprsState());
+
+	Ticket_UL = GL_Fona_H.requestHttpAction(FONA_MODULE_HTTP_ACTION_METHOD_POST, OnHttpAction, false);
+	TEST_CHECK(Ticket_UL != 0);
+	RunManager(FAKE_MODEM_HTTP_ACTION_DELAY_MS + 2000);
+
+	TEST_CHECK(GL_ActionCompleted_B);
+	TEST_CHECK(GL_Fona_H.getAtStatus(Ticket_UL) == FONA_MODULE_AT_STS_OK);
+	TEST_CHECK(!GL_BusyOnActionCompletion_B);
+	TEST_CHECK(FonaModuleManager_IsRunning());
+}
+
+// HTTPTERM fails with ERROR when no session is open, the module has to answer before HTTPINIT
+void TestHttpTermination(void) {
+
+	fprintf(stderr, "Test : HTTP termination before initialization\n");
+
+	KipControlMedium_Init(KC_MEDIUM_GSM, &GL_Fona_H);
+	KipControlMedium_SetServerParam("www.example.com");
+
+	GL_FakeModem_X.HttpSession_B = false;
+	GL_FakeModem_X.HttpInitNb_UL = 0;
+	TEST_CHECK(KipControlMedium_Connect());
+	for (int i = 0; (i < 100) && KipControlMedium_IsBusy(); i++)
+		RunManager(100);
+	TEST_CHECK(!KipControlMedium_IsBusy());
+	TEST_CHECK(KipControlMedium_IsConnected());
+	TEST_CHECK(GL_FakeModem_X.HttpInitNb_UL == 1);
+
+	GL_FakeModem_X.SilentHttpTerm_B = true;
+	GL_FakeModem_X.HttpInitNb_UL = 0;
+	TEST_CHECK(KipControlMedium_Connect());
+	for (int i = 0; (i < 100) && KipControlMedium_IsBusy(); i++)
+		RunManager(100);
+	GL_FakeModem_X.SilentHttpTerm_B = false;
+	TEST_CHECK(!KipControlMedium_IsBusy());
+	TEST_CHECK(!KipControlMedium_IsConnected());
+	TEST_CHECK(GL_FakeModem_X.HttpInitNb_UL == 0);
+}
+
+
+// Every step is requested on completion of the previous one, the HTTP data is sent without CR LF
+void TestPostTransaction(void) {
+	char pRecord_UB[] = "data[0][weight]=1200";
+
+	fprintf(stderr, "Test : POST transaction\n");
+
+	TEST_CHECK(KipControlMedium_Connect());
+	for (int i = 0; (i < 100) && KipControlMedium_IsBusy(); i++)
+		RunManager(100);
+	TEST_CHECK(KipControlMedium_IsConnected());
+
+	GL_FakeModem_X.HttpActionNb_UL = 0;
+	GL_FakeModem_X.StrayByteNb_UL = 0;
+	KipControlMedium_BeginPostTransaction("/import.php");
+	KipControlMedium_Print(pRecord_UB);
+	KipControlMedium_EndTransaction();
+	for (int i = 0; (i < 200) && KipControlMedium_IsBusy(); i++)
+		RunManager(100);
+	TEST_CHECK(!KipControlMedium_IsBusy());
+	TEST_CHECK(KipControlMedium_IsTransactionOk());
+	TEST_CHECK(KipControlMedium_GetServerResponse() == 200);
+	TEST_CHECK(GL_FakeModem_X.HttpActionNb_UL == 1);
+	TEST_CHECK(GL_FakeModem_X.DataReceived_UL == strlen(pRecord_UB) + strlen("&submitted=1&action=validate"));
+	TEST_CHECK(GL_FakeModem_X.StrayByteNb_UL == 0);
+
+	// Data not accepted by the module -> no action
+	GL_FakeModem_X.FailHttpData_B = true;
+	GL_FakeModem_X.HttpActionNb_UL = 0;
+	KipControlMedium_BeginPostTransaction("/import.php");
+	KipControlMedium_Print(pRecord_UB);
+	KipControlMedium_EndTransaction();
+	for (int i = 0; (i < 200) && KipControlMedium_IsBusy(); i++)
+		RunManager(100);
+	GL_FakeModem_X.FailHttpData_B = false;
+	TEST_CHECK(!KipControlMedium_IsBusy());
+	TEST_CHECK(!KipControlMedium_IsTransactionOk());
+	TEST_CHECK(GL_FakeModem_X.HttpActionNb_UL == 0);
+}
+
+// The body announced by +HTTPREAD: <length> is taken as raw bytes, not as lines
+void TestHttpRead(void) {
+	unsigned long Ticket_UL;
+
+	fprintf(stderr, "Test : HTTP read\n");
+
+	Ticket_UL = GL_Fona_H.requestHttpRead(OnHttpRead);
+	RunEngine(1000);
+	TEST_CHECK(GL_Fona_H.getAtStatus(Ticket_UL) == FONA_MODULE_AT_STS_OK);
+	TEST_CHECK(GL_HttpBodyLength_SI == (int)strlen(FAKE_MODEM_HTTP_BODY));
+	TEST_CHECK(strcmp(GL_pHttpBody_UB, FAKE_MODEM_HTTP_BODY) == 0);
+
+	// Request completed by the OK after the body only
+	Ticket_UL = GL_Fona_H.requestAt("AT");
+	RunEngine(1000);
+	TEST_CHECK(GL_Fona_H.getAtStatus(Ticket_UL) == FONA_MODULE_AT_STS_OK);
+}
+
+
+/* ******************************************************************************** */
+/* Internal Functions
+/* ******************************************************************************** */
+
+void RunEngine(unsigned long DurationMs_UL) {
+	unsigned long StartTime_UL = millis();
+
+	while ((millis() - StartTime_UL) < DurationMs_UL) {
+		GL_Fona_H.process();
+		Debug_Process();
+		HostHal_Step();
+	}
+}
+
+void RunManager(unsigned long DurationMs_UL) {
+	unsigned long StartTime_UL = millis();
+
+	while ((millis() - StartTime_UL) < DurationMs_UL) {
+		FonaModuleManager_Process();
+		Debug_Process();
+		HostHal_Step();
+	}
+}
+
+void OnHttpAction(FONA_MODULE_AT_STS_ENUM Status_E, const char * pResponse_UB) {
+	GL_ActionCompleted_B = true;
+	GL_BusyOnActionCompletion_B = GL_Fona_H.isAtBusy();		// Requests queued behind the action
+}
+
+void OnHttpRead(FONA_MODULE_AT_STS_ENUM Status_E, const char * pResponse_UB) {
+	if (Status_E != FONA_MODULE_AT_STS_OK)
+		return;
+
+	GL_HttpBodyLength_SI = GL_Fona_H.parseHttpRead(pResponse_UB, GL_pHttpBody_UB);
+	GL_pHttpBody_UB[GL_HttpBodyLength_SI] = 0;
+}
+
+
+void FakeModem_Receive(void * pContext, const uint8_t * pData_UB, size_t Size) {
+	FAKE_MODEM_STRUCT * pModem_X = (FAKE_MODEM_STRUCT *)pContext;
+
+	for (size_t i = 0; i < Size; i++) {
+		uint8_t LastByte_UB = pModem_X->LastByte_UB;
+		pModem_X->LastByte_UB = pData_UB[i];
+
+		// End of the command line (CR LF) - data starts after it
+		if ((pData_UB[i] == 0x0A) && (LastByte_UB == 0x0D) && (pModem_X->DataReceived_UL == 0))
+			continue;
+
+		// HTTP data : exactly the announced number of bytes, then OK
+		if (pModem_X->DataExpected_UL > 0) {
+			pModem_X->DataReceived_UL++;
+			if (--(pModem_X->DataExpected_UL) == 0) {
+				pModem_X->DataEnded_B = true;
+				FakeModem_Answer(pModem_X, "\r\nOK\r\n");
+			}
+			continue;
+		}
+
+		if (pModem_X->DataEnded_B && (pData_UB[i] != 'A'))
+			pModem_X->StrayByteNb_UL++;
+		pModem_X->DataEnded_B = false;
+
+		if (pData_UB[i] == 0x0D) {
+			pModem_X->pLine_UB[pModem_X->LineLength_UI] = 0;
+			if (pModem_X->LineLength_UI > 0)
+				FakeModem_ProcessCommand(pModem_X);
+			pModem_X->LineLength_UI = 0;
+		}
+		else if ((pData_UB[i] != 0x0A) && (pModem_X->LineLength_UI < (FAKE_MODEM_LINE_SIZE - 1))) {
+			pModem_X->pLine_UB[pModem_X->LineLength_UI++] = pData_UB[i];
+		}
+	}
+}
+
+void FakeModem_Step(void * pContext) {
+	FAKE_MODEM_STRUCT * pModem_X = (FAKE_MODEM_STRUCT *)pContext;
+
+	if ((pModem_X->HttpActionTime_UL != 0) && ((millis() - pModem_X->HttpActionTime_UL) >= FAKE_MODEM_HTTP_ACTION_DELAY_MS)) {
+		pModem_X->HttpActionTime_UL = 0;
+		FakeModem_Answer(pModem_X, "\r\n+HTTPACTION: 1,200,0\r\n");
+	}
+
+	if (pModem_X->AnswerIndex_UI < pModem_X->AnswerLength_UI)
+		pModem_X->AnswerIndex_UI += HostHal_SerialInject(FAKE_MODEM_PORT, (const uint8_t *)&(pModem_X->pAnswer_UB[pModem_X->AnswerIndex_UI]), pModem_X->AnswerLength_UI - pModem_X->AnswerIndex_UI);
+}
+
+void FakeModem_Answer(FAKE_MODEM_STRUCT * pModem_X, const char * pAnswer_UB) {
+	unsigned int Length_UI = strlen(pAnswer_UB);
+
+	// Answer already sent -> room again at the start of the buffer
+	if (pModem_X->AnswerIndex_UI >= pModem_X->AnswerLength_UI) {
+		pModem_X->AnswerIndex_UI = 0;
+		pModem_X->AnswerLength_UI = 0;
+	}
+
+	if ((pModem_X->AnswerLength_UI + Length_UI) > FAKE_MODEM_ANSWER_SIZE)
+		return;
+
+	memcpy(&(pModem_X->pAnswer_UB[pModem_X->AnswerLength_UI]), pAnswer_UB, Length_UI);
+	pModem_X->AnswerLength_UI += Length_UI;
+}
+
+void FakeModem_ProcessCommand(FAKE_MODEM_STRUCT * pModem_X) {
+	const char * pCommand_UB = pModem_X->pLine_UB;
+
+	if (strcmp(pCommand_UB, "AT+FAIL") == 0) {
+		FakeModem_Answer(pModem_X, "\r\nERROR\r\n");
+	}
+	else if (strcmp(pCommand_UB, "AT+CPIN?") == 0) {
+		FakeModem_Answer(pModem_X, "\r\n+CPIN: READY\r\n\r\nOK\r\n");
+	}
+	else if (strcmp(pCommand_UB, "AT+CREG?") == 0) {
+		FakeModem_Answer(pModem_X, "\r\n+CREG: 0,1\r\n\r\nOK\r\n");
+	}
+	else if (strcmp(pCommand_UB, "AT+CBC") == 0) {
+		FakeModem_Answer(pModem_X, "\r\n+CBC: 0,80,4000\r\n\r\nOK\r\n");
+	}
+	else if (strcmp(pCommand_UB, "AT+CSQ") == 0) {
+		FakeModem_Answer(pModem_X, "\r\n+CSQ: 20,0\r\n\r\nOK\r\n");
+	}
+	else if (strcmp(pCommand_UB, "AT+CGATT?") == 0) {
+		FakeModem_Answer(pModem_X, "\r\n+CGATT: 1\r\n\r\nOK\r\n");
+	}
+	else if (strcmp(pCommand_UB, "AT+CIPSHUT") == 0) {
+		FakeModem_Answer(pModem_X, "\r\nSHUT OK\r\n");
+	}
+	else if (strcmp(pCommand_UB, "AT+HTTPTERM") == 0) {
+		if (!pModem_X->SilentHttpTerm_B) {
+			FakeModem_Answer(pModem_X, pModem_X->HttpSession_B ? "\r\nOK\r\n" : "\r\nERROR\r\n");
+			pModem_X->HttpSession_B = false;
+		}
+	}
+	else if (strcmp(pCommand_UB, "AT+HTTPINIT") == 0) {
+		pModem_X->HttpInitNb_UL++;
+		FakeModem_Answer(pModem_X, pModem_X->HttpSession_B ? "\r\nERROR\r\n" : "\r\nOK\r\n");
+		pModem_X->HttpSession_B = true;
+	}
+	else if (strncmp(pCommand_UB, "AT+HTTPDATA=", 12) == 0) {
+		if (pModem_X->FailHttpData_B) {
+			FakeModem_Answer(pModem_X, "\r\nERROR\r\n");
+		}
+		else {
+			pModem_X->DataExpected_UL = strtoul(pCommand_UB + 12, NULL, 10);
+			pModem_X->DataReceived_UL = 0;
+			FakeModem_Answer(pModem_X, "\r\nDOWNLOAD\r\n");
+		}
+	}
+	else if (strcmp(pCommand_UB, "AT+HTTPREAD") == 0) {
+		FakeModem_Answer(pModem_X, "\r\n+HTTPREAD: 13\r\n" FAKE_MODEM_HTTP_BODY "\r\nOK\r\n");
+	}
+	else if (strncmp(pCommand_UB, "AT+HTTPACTION=", 14) == 0) {
+		pModem_X->HttpActionNb_UL++;
+		FakeModem_Answer(pModem_X, "\r\nOK\r\n");
+		pModem_X->HttpActionTime_UL = millis();
+	}
+	else {
+		FakeModem_Answer(pModem_X, "\r\nOK\r\n");
+	}
+}
@@ -0,0 +1,242 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* KipControlMediumTest.cpp															*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host test of the Ethernet transactions of KipControlMedium (response		*/
+/*		status, Content-Length and body) against a fake portal listening on the	*/
+/*		loopback interface															*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "HostHal.h"
+#include "WLink.h"
+#include "KipControlMedium.h"
+
+#include "Debug.h"
+
+// After the Arduino headers : netinet/in.h defines INADDR_NONE as a macro
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <unistd.h>
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+#define FAKE_PORTAL_REQUEST_SIZE		2048
+#define FAKE_PORTAL_WAIT_MS				1000		// Transaction given this time to complete
+
+#define TEST_CHECK(Condition)	do { if (!(Condition)) { fprintf(stderr, "FAILED line %d : %s\n", __LINE__, #Condition); GL_TestFailureNb_UL++; } } while (0)
+
+/* ******************************************************************************** */
+/* Global Variables
+/* ******************************************************************************** */
+
+// Defined by the sketch for the application
+GLOBAL_PARAM_STRUCT GL_GlobalData_X;
+GLOBAL_CONFIG_STRUCT GL_GlobalConfig_X;
+
+/* ******************************************************************************** */
+/* Local Variables
+/* ******************************************************************************** */
+static int GL_FakePortalListenFd_SI = -1;
+static int GL_FakePortalFd_SI = -1;				// Connection of the board (-1 = none)
+static EthernetClient GL_Client_H;
+static unsigned long GL_TestFailureNb_UL = 0;
+
+/* ******************************************************************************** */
+/* Prototypes for Internal Functions
+/* ******************************************************************************** */
+static unsigned int FakePortal_Open(void);
+static void FakePortal_Accept(void);
+static void FakePortal_Answer(const char * pAnswer_UB, boolean Close_B);
+static void FakePortal_Close(void);
+
+static void SendPost(const char * pBody_UB);
+static boolean WaitTransaction(void);
+
+static void TestContentLength(void);
+static void TestBodyUntilClose(void);
+static void TestNoResponse(void);
+static void TestBodyOverflow(void);
+
+/* ******************************************************************************** */
+/* Main
+/* ******************************************************************************** */
+int main(int argc, char * argv[]) {
+	char * pArgument_UB[] = { argv[0], (char *)"--clock", (char *)"sim:1000", (char *)"--com", (char *)"1:none", (char *)"--com", (char *)"2:none", (char *)"--com", (char *)"3:none" };
+
+	HostHal_Init(sizeof(pArgument_UB) / sizeof(char *), pArgument_UB);
+	Debug_Init(&Serial);
+	HostHal_SetPortOffset(0);		// Portal port taken as is on 127.0.0.1
+
+	KipControlMedium_Init(KC_MEDIUM_ETHERNET, &GL_Client_H);
+	KipControlMedium_SetServerParam("portal.test", FakePortal_Open());
+
+	TestContentLength();
+	TestBodyUntilClose();
+	TestNoResponse();
+	TestBodyOverflow();
+
+	FakePortal_Close();
+	close(GL_FakePortalListenFd_SI);
+
+	Debug_Flush();
+	fprintf(stderr, "%s\n", (GL_TestFailureNb_UL == 0) ? "KipControlMediumTest PASSED" : "KipControlMediumTest FAILED");
+	return ((GL_TestFailureNb_UL == 0) ? 0 : 1);
+}
+
+
+/* ******************************************************************************** */
+/* Tests
+/* ******************************************************************************** */
+
+// Body read up to Content-Length - CRLF, blank lines and "OK" lines are part of it
+void TestContentLength(void) {
+	char pData_UB[KC_MEDIUM_RESPONSE_DATA_SIZE];
+
+	fprintf(stderr, "Test : response with Content-Length\n");
+
+	SendPost("data[0][weight]=1200");
+	TEST_CHECK(KipControlMedium_IsBusy());		// Nothing received yet
+
+	FakePortal_Answer("HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\nContent-Length: 13\r\n\r\n", false);
+	TEST_CHECK(KipControlMedium_IsBusy());		// Headers only
+
+	FakePortal_Answer("line\r\n\r\nOK\r\n", false);
+	TEST_CHECK(KipControlMedium_IsBusy());		// One byte missing
+
+	FakePortal_Answer("!", false);
+	TEST_CHECK(WaitTransaction());
+	TEST_CHECK(KipControlMedium_IsTransactionOk());
+	TEST_CHECK(KipControlMedium_GetServerResponse() == 200);
+	TEST_CHECK(KipControlMedium_GetDataSize() == 13);
+
+	KipControlMedium_Read(pData_UB);
+	TEST_CHECK(strcmp(pData_UB, "line\r\n\r\nOK\r\n!") == 0);
+
+	FakePortal_Close();
+}
+
+// Without Content-Length the body ends with the connection - the next transaction opens a new one
+void TestBodyUntilClose(void) {
+	char pData_UB[KC_MEDIUM_RESPONSE_DATA_SIZE];
+
+	fprintf(stderr, "Test : response ended by the connection\n");
+
+	SendPost("data[0][weight]=1300");
+	FakePortal_Answer("HTTP/1.0 500 Internal Server Error\r\n\r\nfailed", true);
+	TEST_CHECK(WaitTransaction());
+	TEST_CHECK(KipControlMedium_IsTransactionOk());
+	TEST_CHECK(KipControlMedium_GetServerResponse() == 500);
+	TEST_CHECK(KipControlMedium_GetDataSize() == 6);
+
+	KipControlMedium_Read(pData_UB);
+	TEST_CHECK(strcmp(pData_UB, "failed") == 0);
+}
+
+// Connection closed before the status line : transaction failed
+void TestNoResponse(void) {
+	fprintf(stderr, "Test : no response\n");
+
+	SendPost("data[0][weight]=1400");
+	FakePortal_Answer("", true);
+	TEST_CHECK(WaitTransaction());
+	TEST_CHECK(!KipControlMedium_IsTransactionOk());
+	TEST_CHECK(KipControlMedium_GetServerResponse() == 0);
+}
+
+// POST body larger than KC_MEDIUM_POST_BODY_SIZE : nothing sent and transaction failed
+void TestBodyOverflow(void) {
+	char pRequest_UB[FAKE_PORTAL_REQUEST_SIZE];
+
+	fprintf(stderr, "Test : POST body too long\n");
+
+	KipControlMedium_BeginPostTransaction("/kipcontrol/import");
+	for (unsigned int i = 0; i <= KC_MEDIUM_POST_BODY_SIZE; i++)
+		KipControlMedium_Print("w");
+	KipControlMedium_EndTransaction();
+
+	TEST_CHECK(!KipControlMedium_IsBusy());
+	TEST_CHECK(!KipControlMedium_IsTransactionOk());
+	TEST_CHECK(KipControlMedium_GetServerResponse() == 0);
+
+	GL_FakePortalFd_SI = accept(GL_FakePortalListenFd_SI, NULL, NULL);
+	usleep(10000);
+	TEST_CHECK(recv(GL_FakePortalFd_SI, pRequest_UB, sizeof(pRequest_UB), MSG_DONTWAIT) == 0);	// Closed without a request
+	FakePortal_Close();
+}
+
+
+/* ******************************************************************************** */
+/* Internal Functions
+/* ******************************************************************************** */
+
+// Listens on an ephemeral port of the loopback - returns the port
+unsigned int FakePortal_Open(void) {
+	struct sockaddr_in Addr_X;
+	socklen_t Size = sizeof(Addr_X);
+
+	GL_FakePortalListenFd_SI = socket(AF_INET, SOCK_STREAM, 0);
+	memset(&Addr_X, 0, sizeof(Addr_X));
+	Addr_X.sin_family = AF_INET;
+	Addr_X.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	Addr_X.sin_port = 0;
+	bind(GL_FakePortalListenFd_SI, (struct sockaddr *)&Addr_X, sizeof(Addr_X));
+	listen(GL_FakePortalListenFd_SI, 1);
+	getsockname(GL_FakePortalListenFd_SI, (struct sockaddr *)&Addr_X, &Size);
+
+	return ntohs(Addr_X.sin_port);
+}
+
+// Connection of the board taken and its request read (the client writes it in one go)
+void FakePortal_Accept(void) {
+	char pRequest_UB[FAKE_PORTAL_REQUEST_SIZE];
+
+	if (GL_FakePortalFd_SI < 0)
+		GL_FakePortalFd_SI = accept(GL_FakePortalListenFd_SI, NULL, NULL);
+
+	recv(GL_FakePortalFd_SI, pRequest_UB, sizeof(pRequest_UB), MSG_DONTWAIT);
+}
+
+void FakePortal_Answer(const char * pAnswer_UB, boolean Close_B) {
+	if (strlen(pAnswer_UB) > 0)
+		send(GL_FakePortalFd_SI, pAnswer_UB, strlen(pAnswer_UB), MSG_NOSIGNAL);
+
+	if (Close_B)
+		FakePortal_Close();
+
+	usleep(10000);		// Delivered by the loopback before the next check
+}
+
+void FakePortal_Close(void) {
+	if (GL_FakePortalFd_SI >= 0)
+		close(GL_FakePortalFd_SI);
+	GL_FakePortalFd_SI = -1;
+}
+
+void SendPost(const char * pBody_UB) {
+	KipControlMedium_BeginPostTransaction("/kipcontrol/import");
+	KipControlMedium_Print(pBody_UB);
+	KipControlMedium_EndTransaction();
+	FakePortal_Accept();
+}
+
+// Returns false if the transaction is still in progress after FAKE_PORTAL_WAIT_MS
+boolean WaitTransaction(void) {
+	unsigned long StartTime_UL = millis();
+
+	while (KipControlMedium_IsBusy()) {
+		if ((millis() - StartTime_UL) >= FAKE_PORTAL_WAIT_MS)
+			return false;
+		HostHal_Step();
+	}
+
+	return true;
+}
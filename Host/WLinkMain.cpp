@@ -0,0 +1,14 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* WLinkMain.cpp																	*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Host build of the sketch : the Arduino builder adds Arduino.h in front of	*/
+/*		the .ino and compiles it as C++, main() is under WLINK_HOST_BUILD			*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#include <Arduino.h>
+#include "WLink.ino"
@@ -6,6 +6,7 @@
 /*		Describes the state machine to manage the Badge Reader object				*/
 /*                                                                                  */
 /* History :  	11/06/2015  (RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Publish new badges on the Event Bus				*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
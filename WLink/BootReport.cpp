@@ -0,0 +1,80 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* BootReport.cpp																	*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Describes the functions to record the start-up stages						*/
+/*		Only the first time a stage is reached is kept (link, GPRS, ...)			*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#define MODULE_NAME		"BootReport"
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "BootReport.h"
+
+#include "Debug.h"
+
+/* ******************************************************************************** */
+/* Local Variables
+/* ******************************************************************************** */
+static unsigned long GL_pBootReportTime_UL[BOOT_REPORT_STAGE_NB];
+
+static const char * GL_pBootReportName_Str[BOOT_REPORT_STAGE_NB] = {
+	"Setup", "EEPROM", "RTC", "CheckPin", "LoadImage", "GenConfig", "ComConfig", "IndicatorConfig",
+	"EthConfig", "FonaConfig", "ConfigDone", "FirstWeight", "LinkUp", "AddressBound", "GprsAttached"
+};
+
+/* ******************************************************************************** */
+/* Functions
+/* ******************************************************************************** */
+void BootReport_Init(void) {
+	for (int i = 0; i < BOOT_REPORT_STAGE_NB; i++)
+		GL_pBootReportTime_UL[i] = BOOT_REPORT_NOT_REACHED;
+
+	BootReport_Mark(BOOT_REPORT_STAGE_SETUP);
+}
+
+void BootReport_Mark(BOOT_REPORT_STAGE_ENUM Stage_E) {
+	if ((Stage_E >= BOOT_REPORT_STAGE_NB) || (GL_pBootReportTime_UL[Stage_E] != BOOT_REPORT_NOT_REACHED))
+		return;
+
+	GL_pBootReportTime_UL[Stage_E] = millis();
+}
+
+void BootReport_OnEvent(const EVENT_BUS_EVENT_STRUCT * pEvent_X) {
+	switch (pEvent_X->Id_E) {
+	case EVENT_BUS_ID_NEW_WEIGHT:		BootReport_Mark(BOOT_REPORT_STAGE_FIRST_WEIGHT);		break;
+	case EVENT_BUS_ID_LINK_UP:			BootReport_Mark(BOOT_REPORT_STAGE_LINK_UP);				break;
+	case EVENT_BUS_ID_ADDRESS_BOUND:	BootReport_Mark(BOOT_REPORT_STAGE_ADDRESS_BOUND);		break;
+	case EVENT_BUS_ID_GPRS_STATE:		if (pEvent_X->Data_UL == 1) BootReport_Mark(BOOT_REPORT_STAGE_GPRS_ATTACHED);	break;
+	default:																					break;
+	}
+}
+
+// [ms] since reset - BOOT_REPORT_NOT_REACHED otherwise
+unsigned long BootReport_GetTime(BOOT_REPORT_STAGE_ENUM Stage_E) {
+	if (Stage_E >= BOOT_REPORT_STAGE_NB)
+		return BOOT_REPORT_NOT_REACHED;
+
+	return GL_pBootReportTime_UL[Stage_E];
+}
+
+void BootReport_Print(void) {
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Boot Report [ms] :");
+	for (int i = 0; i < BOOT_REPORT_STAGE_NB; i++) {
+		if (GL_pBootReportTime_UL[i] == BOOT_REPORT_NOT_REACHED)
+			continue;
+
+		DBG_PRINT(DEBUG_SEVERITY_INFO, "- ");
+		DBG_PRINTDATA(GL_pBootReportName_Str[i]);
+		DBG_PRINTDATA(" = ");
+		DBG_PRINTDATA(GL_pBootReportTime_UL[i]);
+		DBG_ENDSTR();
+	}
+}
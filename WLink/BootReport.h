@@ -0,0 +1,60 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* BootReport.h																		*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Header file for BootReport.cpp												*/
+/*		Records when each stage of the start-up is reached (ms since reset)			*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __BOOT_REPORT_H__
+#define __BOOT_REPORT_H__
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include <Arduino.h>
+#include "EventBus.h"
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+#define BOOT_REPORT_NOT_REACHED				0xFFFFFFFF
+
+/* ******************************************************************************** */
+/* Structure & Enumeration
+/* ******************************************************************************** */
+typedef enum {
+	BOOT_REPORT_STAGE_SETUP = 0,			// setup() entered
+	BOOT_REPORT_STAGE_EEPROM,
+	BOOT_REPORT_STAGE_RTC,
+	BOOT_REPORT_STAGE_CHECK_PIN,
+	BOOT_REPORT_STAGE_LOAD_IMAGE,
+	BOOT_REPORT_STAGE_GEN_CONFIG,			// LCD, Flat-Panel and Memory Card initialized
+	BOOT_REPORT_STAGE_COM_CONFIG,
+	BOOT_REPORT_STAGE_INDICATOR_CONFIG,		// Indicators served from here
+	BOOT_REPORT_STAGE_ETH_CONFIG,
+	BOOT_REPORT_STAGE_FONA_CONFIG,
+	BOOT_REPORT_STAGE_CONFIG_DONE,
+	BOOT_REPORT_STAGE_FIRST_WEIGHT,
+	BOOT_REPORT_STAGE_LINK_UP,
+	BOOT_REPORT_STAGE_ADDRESS_BOUND,
+	BOOT_REPORT_STAGE_GPRS_ATTACHED,
+	BOOT_REPORT_STAGE_NB
+} BOOT_REPORT_STAGE_ENUM;
+
+/* ******************************************************************************** */
+/* Functions Prototypes
+/* ******************************************************************************** */
+void BootReport_Init(void);
+void BootReport_Mark(BOOT_REPORT_STAGE_ENUM Stage_E);
+void BootReport_OnEvent(const EVENT_BUS_EVENT_STRUCT * pEvent_X);
+
+unsigned long BootReport_GetTime(BOOT_REPORT_STAGE_ENUM Stage_E);
+void BootReport_Print(void);
+
+#endif // __BOOT_REPORT_H__
@@ -6,6 +6,7 @@
 /*		Gathers CommEvent functions to be mapped to SerialEvent interrupt.			*/
 /*                                                                                  */
 /* History :	11/06/2016	(RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Feed the frame assembler of the Indicators		*/
 /*                                                                                  */
 /* ******************************************************************************** */
 #ifndef __COMM_EVENT_H__
@@ -35,8 +36,23 @@ static void CommEvent_BadgeReader(void) {
 	return (GL_GlobalData_X.BadgeReader_H.commEvent());
 }
 
-static void CommEvent_Indicator(void) {
-    GL_GlobalData_X.Indicator_H.setIrq();
+static void CommEvent_Indicator0(void) {
+    GL_GlobalData_X.pIndicator_H[0].commEvent();
 }
 
+static void CommEvent_Indicator1(void) {
+    GL_GlobalData_X.pIndicator_H[1].commEvent();
+}
+
+static void CommEvent_Indicator2(void) {
+    GL_GlobalData_X.pIndicator_H[2].commEvent();
+}
+
+static void CommEvent_Indicator3(void) {
+    GL_GlobalData_X.pIndicator_H[3].commEvent();
+}
+
+// Event to assign on the COM Port of each Indicator
+static void(*const GL_pCommEventIndicator[4])(void) = { CommEvent_Indicator0, CommEvent_Indicator1, CommEvent_Indicator2, CommEvent_Indicator3 };
+
 #endif // __COMM_EVENT_H__
@@ -7,6 +7,7 @@
 /*                                                                                  */
 /* History :  	31/05/2015  (RW)	Creation of this file                           */
 /*				16/07/2016	(RW)	Add flush for Serial in 'init' and 'print'		*/
+/*				18/10/2026	(RW)	Buffer messages in a ring and defer formatting	*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -16,41 +17,195 @@
 
 #include "Debug.h"
 
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+
+// A line header is stored in binary form and formatted when sent :
+// [MARKER][SEVERITY][LINE (LSB first)][MODULE NAME ptr][FUNCTION NAME ptr]
+#define DEBUG_RING_HEADER_MARKER	0x00
+#define DEBUG_RING_HEADER_SIZE		(1 + 1 + 2 + sizeof(const char *) + sizeof(const char *))
+#define DEBUG_HEADER_STR_SIZE		128
+
+/* ******************************************************************************** */
+/* Local Structures
+/* ******************************************************************************** */
+class DebugRing : public Print {
+public:
+	virtual size_t write(uint8_t Data_UB);
+};
+
 /* ******************************************************************************** */
 /* Local Variables
 /* ******************************************************************************** */
 HardwareSerial * GL_pSerial_H;
+boolean GL_DebugLineEnabled_B = false;
 
-static const String pSeverityLut_str[] = {"[ ] INFO", "[!] WARNING", "[#] ERROR"};
+static const char * pSeverityLut_str[] = {"[ ] INFO", "[!] WARNING", "[#] ERROR"};
+
+static DebugRing GL_DebugRing_H;
+static unsigned char GL_pDebugRing_UB[DEBUG_RING_SIZE];
+static unsigned long GL_DebugRingPushIndex_UL = 0;
+static unsigned long GL_DebugRingPopIndex_UL = 0;
+static unsigned long GL_DebugLostNb_UL = 0;
+
+static char GL_pDebugHeader_UB[DEBUG_HEADER_STR_SIZE];		// Header being sent
+static unsigned long GL_DebugHeaderIndex_UL = 0;
+static unsigned long GL_DebugHeaderSize_UL = 0;
+static unsigned char GL_DebugLastSent_UB = '\n';
+
+/* ******************************************************************************** */
+/* Prototypes for Internal Functions
+/* ******************************************************************************** */
+static unsigned long GetRingCount(void);
+static void PushRing(const unsigned char * pData_UB, unsigned long Size_UL);
+static void PopRing(unsigned char * pData_UB, unsigned long Size_UL);
+static void FormatHeader(void);
 
 /* ******************************************************************************** */
 /* Functions
 /* ******************************************************************************** */
 void Debug_Init(HardwareSerial * pSerial_H) {
-	GL_pSerial_H = pSerial_H;
-	GL_pSerial_H->begin(DEBUG_DEFAULT_BAUDRATE);
-	GL_pSerial_H->flush();
+	Debug_Init(pSerial_H, DEBUG_DEFAULT_BAUDRATE);
 }
 
 void Debug_Init(HardwareSerial * pSerial_H, unsigned long Baudrate_UL) {
+	if (GL_pSerial_H != NULL)
+		Debug_Flush();	// Send pending messages on previous port
+
 	GL_pSerial_H = pSerial_H;
 	GL_pSerial_H->begin(Baudrate_UL);
 	GL_pSerial_H->flush();
 }
 
-HardwareSerial * Debug_GetHandle(void) {
-	return GL_pSerial_H;
+Print * Debug_GetHandle(void) {
+	return &GL_DebugRing_H;
+}
+
+Print * Debug_Print(DEBUG_SEVERITY_ENUM Severity_E, const char * pModuleName_UB, unsigned long LineNb_UL, const char * pFunctionName_UB) {
+	unsigned char pHeader_UB[DEBUG_RING_HEADER_SIZE];
+
+	// Make room for warnings and errors, drop information
+	if (((DEBUG_RING_SIZE - GetRingCount()) <= DEBUG_RING_HEADER_SIZE) && (Severity_E >= DEBUG_SEVERITY_WARNING))
+		Debug_Flush();
+
+	if ((DEBUG_RING_SIZE - GetRingCount()) <= DEBUG_RING_HEADER_SIZE) {
+		GL_DebugLostNb_UL++;
+		GL_DebugLineEnabled_B = false;
+		return &GL_DebugRing_H;
+	}
+
+	pHeader_UB[0] = DEBUG_RING_HEADER_MARKER;
+	pHeader_UB[1] = (unsigned char)(Severity_E);
+	pHeader_UB[2] = (unsigned char)(LineNb_UL);
+	pHeader_UB[3] = (unsigned char)(LineNb_UL >> 8);
+	memcpy(&pHeader_UB[4], &pModuleName_UB, sizeof(const char *));
+	memcpy(&pHeader_UB[4 + sizeof(const char *)], &pFunctionName_UB, sizeof(const char *));
+
+	PushRing(pHeader_UB, DEBUG_RING_HEADER_SIZE);
+	GL_DebugLineEnabled_B = true;
+
+	return &GL_DebugRing_H;
+}
+
+void Debug_Process(void) {
+	unsigned char Data_UB = 0;
+
+	if (GL_pSerial_H == NULL)
+		return;
+
+	while (GL_pSerial_H->availableForWrite() > 0) {
+
+		// Header being sent
+		if (GL_DebugHeaderIndex_UL < GL_DebugHeaderSize_UL) {
+			GL_DebugLastSent_UB = GL_pDebugHeader_UB[GL_DebugHeaderIndex_UL++];
+			GL_pSerial_H->write(GL_DebugLastSent_UB);
+			continue;
+		}
+
+		if (GetRingCount() == 0)
+			break;
+
+		PopRing(&Data_UB, 1);
+		if (Data_UB == DEBUG_RING_HEADER_MARKER) {
+			FormatHeader();
+		}
+		else {
+			GL_pSerial_H->write(Data_UB);
+			GL_DebugLastSent_UB = Data_UB;
+		}
+	}
 }
 
-HardwareSerial * Debug_Print(DEBUG_SEVERITY_ENUM Severity_E, const String pModuleName_cstr, unsigned long LineNb_UL, const String pFunctionName_cstr) {
-	GL_pSerial_H->print(pSeverityLut_str[Severity_E]);
-	GL_pSerial_H->print(" > ");
-	GL_pSerial_H->print(pModuleName_cstr);
-	GL_pSerial_H->print(":");
-	GL_pSerial_H->print(pFunctionName_cstr);
-	GL_pSerial_H->print(":");
-	GL_pSerial_H->print(LineNb_UL);
-	GL_pSerial_H->print(" > ");
+void Debug_Flush(void) {
+	if (GL_pSerial_H == NULL)
+		return;
+
+	while ((GetRingCount() != 0) || (GL_DebugHeaderIndex_UL < GL_DebugHeaderSize_UL))
+		Debug_Process();
+
 	GL_pSerial_H->flush();	// Wait for end of transmission..
-	return GL_pSerial_H;
+}
+
+size_t DebugRing::write(uint8_t Data_UB) {
+	if (!GL_DebugLineEnabled_B)
+		return 0;
+
+	if (Data_UB == DEBUG_RING_HEADER_MARKER)
+		return 1;	// Reserved for header - never printed anyway
+
+	// Ring full -> drop the end of the line
+	if (GetRingCount() >= DEBUG_RING_SIZE) {
+		GL_DebugLostNb_UL++;
+		GL_DebugLineEnabled_B = false;
+		return 0;
+	}
+
+	PushRing(&Data_UB, 1);
+	return 1;
+}
+
+
+/* ******************************************************************************** */
+/* Internal Functions
+/* ******************************************************************************** */
+unsigned long GetRingCount(void) {
+	return (GL_DebugRingPushIndex_UL - GL_DebugRingPopIndex_UL);
+}
+
+void PushRing(const unsigned char * pData_UB, unsigned long Size_UL) {
+	for (unsigned long i = 0; i < Size_UL; i++)
+		GL_pDebugRing_UB[(GL_DebugRingPushIndex_UL++) % DEBUG_RING_SIZE] = pData_UB[i];
+}
+
+void PopRing(unsigned char * pData_UB, unsigned long Size_UL) {
+	for (unsigned long i = 0; i < Size_UL; i++)
+		pData_UB[i] = GL_pDebugRing_UB[(GL_DebugRingPopIndex_UL++) % DEBUG_RING_SIZE];
+}
+
+void FormatHeader(void) {
+	unsigned char pHeader_UB[DEBUG_RING_HEADER_SIZE - 1];
+	const char * pModuleName_UB = NULL;
+	const char * pFunctionName_UB = NULL;
+	int Size_SI = 0;
+
+	PopRing(pHeader_UB, DEBUG_RING_HEADER_SIZE - 1);	// Marker already removed
+	memcpy(&pModuleName_UB, &pHeader_UB[3], sizeof(const char *));
+	memcpy(&pFunctionName_UB, &pHeader_UB[3 + sizeof(const char *)], sizeof(const char *));
+
+	// Terminate a line truncated because the ring was full
+	if (GL_DebugLastSent_UB != '\n')
+		Size_SI = snprintf(GL_pDebugHeader_UB, DEBUG_HEADER_STR_SIZE, "\r\n");
+
+	// Report messages dropped because the ring was full
+	if (GL_DebugLostNb_UL != 0) {
+		Size_SI += snprintf(&GL_pDebugHeader_UB[Size_SI], DEBUG_HEADER_STR_SIZE - Size_SI, "[!] WARNING > Debug > %lu message(s) lost\r\n", GL_DebugLostNb_UL);
+		GL_DebugLostNb_UL = 0;
+	}
+
+	Size_SI += snprintf(&GL_pDebugHeader_UB[Size_SI], DEBUG_HEADER_STR_SIZE - Size_SI, "%s > %s:%s:%u > ",
+		pSeverityLut_str[pHeader_UB[0]], pModuleName_UB, pFunctionName_UB, (unsigned int)(pHeader_UB[1] | (pHeader_UB[2] << 8)));
+
+	GL_DebugHeaderIndex_UL = 0;
+	GL_DebugHeaderSize_UL = (Size_SI < DEBUG_HEADER_STR_SIZE) ? Size_SI : (DEBUG_HEADER_STR_SIZE - 1);
 }
@@ -7,6 +7,7 @@
 /*		Gathers the several functions to output debug information					*/
 /*                                                                                  */
 /* History :	31/05/2016	(RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Add compile-time levels and deferred output		*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -28,15 +29,25 @@
 
 #define DEBUG_DEFAULT_BAUDRATE	115200
 
+// Messages below this severity are removed at compile time
+// A module can override it by defining DEBUG_MODULE_LEVEL before its includes (next to MODULE_NAME)
+#define DEBUG_DEFAULT_LEVEL		DEBUG_SEVERITY_INFO		// Set to DEBUG_SEVERITY_WARNING for production
+
+#ifndef DEBUG_MODULE_LEVEL
+#define DEBUG_MODULE_LEVEL		DEBUG_DEFAULT_LEVEL
+#endif
+
+#define DEBUG_RING_SIZE			4096	// Messages are buffered then sent by Debug_Process() when the UART has room
+
 /* ******************************************************************************** */
 /* Macro Mapping
 /* ******************************************************************************** */
 #ifdef APP_USE_DEBUG
-#define DBG_PRINT(Severity, Message)	(Debug_Print(Severity,MODULE_NAME,__LINE__,__FUNCTION__))->print(Message)
-#define DBG_PRINTDATA(Data) 			(Debug_GetHandle())->print(Data)
-#define DBG_PRINTDATABASE(Data, Base) 	(Debug_GetHandle())->print(Data, Base)
-#define DBG_ENDSTR()					(Debug_GetHandle())->println()
-#define DBG_PRINTLN(Severity, Message)	(Debug_Print(Severity,MODULE_NAME,__LINE__,__FUNCTION__))->println(Message)
+#define DBG_PRINT(Severity, Message)	do { if ((Severity) >= DEBUG_MODULE_LEVEL) (Debug_Print(Severity,MODULE_NAME,__LINE__,__FUNCTION__))->print(Message); else GL_DebugLineEnabled_B = false; } while (0)
+#define DBG_PRINTDATA(Data) 			do { if (GL_DebugLineEnabled_B) (Debug_GetHandle())->print(Data); } while (0)
+#define DBG_PRINTDATABASE(Data, Base) 	do { if (GL_DebugLineEnabled_B) (Debug_GetHandle())->print(Data, Base); } while (0)
+#define DBG_ENDSTR()					do { if (GL_DebugLineEnabled_B) (Debug_GetHandle())->println(); } while (0)
+#define DBG_PRINTLN(Severity, Message)	do { if ((Severity) >= DEBUG_MODULE_LEVEL) (Debug_Print(Severity,MODULE_NAME,__LINE__,__FUNCTION__))->println(Message); else GL_DebugLineEnabled_B = false; } while (0)
 #else
 #define DBG_PRINT(Severity, Message)	/* Do Nothing */
 #define DBG_PRINTDATA(Data)				/* Do Nothing */
@@ -51,16 +62,25 @@
 typedef enum {
 	DEBUG_SEVERITY_INFO,
 	DEBUG_SEVERITY_WARNING,
-	DEBUG_SEVERITY_ERROR
+	DEBUG_SEVERITY_ERROR,
+	DEBUG_SEVERITY_NONE		// Only used as level to remove all messages of a module
 } DEBUG_SEVERITY_ENUM;
 
+/* ******************************************************************************** */
+/* External Variables
+/* ******************************************************************************** */
+extern boolean GL_DebugLineEnabled_B;	// false when the header of the current line has been filtered out
+
 /* ******************************************************************************** */
 /* Functions Prototypes
 /* ******************************************************************************** */
 void Debug_Init(HardwareSerial * pSerial_H);
 void Debug_Init(HardwareSerial * pSerial_H, unsigned long Baudrate_UL);
 
-HardwareSerial * Debug_GetHandle(void);
-HardwareSerial * Debug_Print(DEBUG_SEVERITY_ENUM Severity_E, String pModuleName_cstr, unsigned long LineNb_UL, const String pFunctionName_cstr);
+Print * Debug_GetHandle(void);
+Print * Debug_Print(DEBUG_SEVERITY_ENUM Severity_E, const char * pModuleName_UB, unsigned long LineNb_UL, const char * pFunctionName_UB);
+
+void Debug_Process(void);
+void Debug_Flush(void);
 
 #endif // __DEBUG_H__
\ No newline at end of file
@@ -0,0 +1,432 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* DhcpClient.cpp																	*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Defines the functions of the DHCP client (RFC 2131)							*/
+/*		Each call to process() handles at most one message : the main loop never	*/
+/*		waits for the DHCP server													*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#define MODULE_NAME		"DhcpClient"
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "DhcpClient.h"
+
+#include "Debug.h"
+
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+#define DHCP_BOOT_REQUEST				1
+#define DHCP_BOOT_REPLY					2
+#define DHCP_HTYPE_ETHERNET				1
+#define DHCP_FLAG_BROADCAST				0x8000
+#define DHCP_HEADER_SIZE				44		// op .. chaddr
+#define DHCP_SNAME_FILE_SIZE			192		// sname + file (unused)
+
+#define DHCP_MSG_DISCOVER				1
+#define DHCP_MSG_OFFER					2
+#define DHCP_MSG_REQUEST				3
+#define DHCP_MSG_ACK					5
+#define DHCP_MSG_NAK					6
+
+#define DHCP_OPT_PAD					0
+#define DHCP_OPT_SUBNET_MASK			1
+#define DHCP_OPT_ROUTER					3
+#define DHCP_OPT_DNS					6
+#define DHCP_OPT_REQUESTED_IP			50
+#define DHCP_OPT_LEASE_TIME				51
+#define DHCP_OPT_MSG_TYPE				53
+#define DHCP_OPT_SERVER_ID				54
+#define DHCP_OPT_PARAM_REQUEST			55
+#define DHCP_OPT_RENEW_TIME				58
+#define DHCP_OPT_REBIND_TIME			59
+#define DHCP_OPT_CLIENT_ID				61
+#define DHCP_OPT_END					255
+
+/* ******************************************************************************** */
+/* Local Structures
+/* ******************************************************************************** */
+typedef struct {
+	unsigned char Type_UB;
+	IPAddress YourIpAddr_X;
+	IPAddress ServerIpAddr_X;
+	IPAddress SubnetMaskAddr_X;
+	IPAddress GatewayAddr_X;
+	IPAddress DnsIpAddr_X;
+	unsigned long LeaseTime_UL;
+	unsigned long RenewTime_UL;
+	unsigned long RebindTime_UL;
+} DHCP_CLIENT_MESSAGE_STRUCT;
+
+/* ******************************************************************************** */
+/* Local Variables
+/* ******************************************************************************** */
+static const unsigned char GL_pDhcpMagicCookie_UB[4] = { 0x63, 0x82, 0x53, 0x63 };
+static const unsigned char GL_pDhcpParamRequest_UB[6] = { DHCP_OPT_SUBNET_MASK, DHCP_OPT_ROUTER, DHCP_OPT_DNS, DHCP_OPT_LEASE_TIME, DHCP_OPT_RENEW_TIME, DHCP_OPT_REBIND_TIME };
+
+/* ******************************************************************************** */
+/* Prototypes for Internal Functions
+/* ******************************************************************************** */
+static void OpenUdp(DHCP_CLIENT_PARAM * pParam_X);
+static void CloseUdp(DHCP_CLIENT_PARAM * pParam_X);
+static void SendDiscover(DHCP_CLIENT_PARAM * pParam_X);
+static void SendRequest(DHCP_CLIENT_PARAM * pParam_X);
+static void SendMessage(DHCP_CLIENT_PARAM * pParam_X, unsigned char Type_UB);
+static boolean ReceiveMessage(DHCP_CLIENT_PARAM * pParam_X, DHCP_CLIENT_MESSAGE_STRUCT * pMsg_X);
+static void StartLease(DHCP_CLIENT_PARAM * pParam_X, const DHCP_CLIENT_MESSAGE_STRUCT * pMsg_X);
+static void RestartDiscover(DHCP_CLIENT_PARAM * pParam_X);
+static unsigned long GetLongBE(const unsigned char * pData_UB);
+
+/* ******************************************************************************** */
+/* Constructor
+/* ******************************************************************************** */
+DhcpClient::DhcpClient() {
+	GL_DhcpClientParam_X.State_E = DHCP_CLIENT_STATE_IDLE;
+	GL_DhcpClientParam_X.IsUdpOpen_B = false;
+}
+
+
+/* ******************************************************************************** */
+/* Functions
+/* ******************************************************************************** */
+void DhcpClient::begin(unsigned char pMacAddr_UB[6]) {
+	for (int i = 0; i < 6; i++)
+		GL_DhcpClientParam_X.pMacAddr_UB[i] = pMacAddr_UB[i];
+
+	GL_DhcpClientParam_X.LocalIpAddr_X = IPAddress(0, 0, 0, 0);
+	OpenUdp(&GL_DhcpClientParam_X);
+	SendDiscover(&GL_DhcpClientParam_X);
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "DHCP Client Started");
+}
+
+void DhcpClient::end(void) {
+	CloseUdp(&GL_DhcpClientParam_X);
+	GL_DhcpClientParam_X.State_E = DHCP_CLIENT_STATE_IDLE;
+}
+
+DHCP_CLIENT_STS DhcpClient::process(void) {
+	DHCP_CLIENT_PARAM * pParam_X = &GL_DhcpClientParam_X;
+	DHCP_CLIENT_MESSAGE_STRUCT Msg_X;
+	unsigned long Elapsed_UL;
+
+	switch (pParam_X->State_E) {
+	case DHCP_CLIENT_STATE_IDLE:
+		return DHCP_CLIENT_STS_IDLE;
+
+	case DHCP_CLIENT_STATE_SELECTING:
+		if (ReceiveMessage(pParam_X, &Msg_X) && (Msg_X.Type_UB == DHCP_MSG_OFFER)) {
+			pParam_X->OfferedIpAddr_X = Msg_X.YourIpAddr_X;
+			pParam_X->ServerIpAddr_X = Msg_X.ServerIpAddr_X;
+			pParam_X->State_E = DHCP_CLIENT_STATE_REQUESTING;
+			SendRequest(pParam_X);
+		}
+		else if ((millis() - pParam_X->RequestTime_UL) >= DHCP_CLIENT_RESPONSE_TIMEOUT_MS) {
+			SendDiscover(pParam_X);
+		}
+		return DHCP_CLIENT_STS_BUSY;
+
+	case DHCP_CLIENT_STATE_REQUESTING:
+		if (ReceiveMessage(pParam_X, &Msg_X) && (Msg_X.Type_UB == DHCP_MSG_ACK)) {
+			StartLease(pParam_X, &Msg_X);
+			return DHCP_CLIENT_STS_BOUND;
+		}
+		else if ((Msg_X.Type_UB == DHCP_MSG_NAK) || ((millis() - pParam_X->RequestTime_UL) >= DHCP_CLIENT_RESPONSE_TIMEOUT_MS)) {
+			SendDiscover(pParam_X);
+		}
+		return DHCP_CLIENT_STS_BUSY;
+
+	case DHCP_CLIENT_STATE_BOUND:
+		if (((millis() - pParam_X->LeaseStartTime_UL) / 1000) >= pParam_X->RenewTime_UL) {
+			DBG_PRINTLN(DEBUG_SEVERITY_INFO, "DHCP lease renewal");
+			OpenUdp(pParam_X);
+			pParam_X->State_E = DHCP_CLIENT_STATE_RENEWING;
+			pParam_X->StartTime_UL = millis();
+			SendRequest(pParam_X);
+		}
+		return DHCP_CLIENT_STS_BOUND;
+
+	case DHCP_CLIENT_STATE_RENEWING:
+	case DHCP_CLIENT_STATE_REBINDING:
+		Elapsed_UL = (millis() - pParam_X->LeaseStartTime_UL) / 1000;
+
+		if (ReceiveMessage(pParam_X, &Msg_X) && (Msg_X.Type_UB == DHCP_MSG_ACK)) {
+			StartLease(pParam_X, &Msg_X);
+		}
+		else if ((Msg_X.Type_UB == DHCP_MSG_NAK) || (Elapsed_UL >= pParam_X->LeaseTime_UL)) {
+			DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "DHCP lease lost");
+			RestartDiscover(pParam_X);
+			return DHCP_CLIENT_STS_BUSY;
+		}
+		else if ((pParam_X->State_E == DHCP_CLIENT_STATE_RENEWING) && (Elapsed_UL >= pParam_X->RebindTime_UL)) {
+			pParam_X->State_E = DHCP_CLIENT_STATE_REBINDING;
+			SendRequest(pParam_X);
+		}
+		else if ((millis() - pParam_X->RequestTime_UL) >= DHCP_CLIENT_RENEW_RETRY_MS) {
+			SendRequest(pParam_X);
+		}
+		return DHCP_CLIENT_STS_BOUND;
+	}
+
+	return DHCP_CLIENT_STS_IDLE;
+}
+
+boolean DhcpClient::isBound(void) {
+	return ((GL_DhcpClientParam_X.State_E >= DHCP_CLIENT_STATE_BOUND) ? true : false);
+}
+
+
+IPAddress DhcpClient::getLocalIpAddr(void) {
+	return GL_DhcpClientParam_X.LocalIpAddr_X;
+}
+
+IPAddress DhcpClient::getSubnetMaskAddr(void) {
+	return GL_DhcpClientParam_X.SubnetMaskAddr_X;
+}
+
+IPAddress DhcpClient::getGatewayAddr(void) {
+	return GL_DhcpClientParam_X.GatewayAddr_X;
+}
+
+IPAddress DhcpClient::getDnsIpAddr(void) {
+	return GL_DhcpClientParam_X.DnsIpAddr_X;
+}
+
+unsigned long DhcpClient::getLeaseTime(void) {
+	return GL_DhcpClientParam_X.LeaseTime_UL;
+}
+
+
+/* ******************************************************************************** */
+/* Internal Functions
+/* ******************************************************************************** */
+void OpenUdp(DHCP_CLIENT_PARAM * pParam_X) {
+	if (!(pParam_X->IsUdpOpen_B)) {
+		pParam_X->Udp_H.begin(DHCP_CLIENT_CLIENT_PORT);
+		pParam_X->IsUdpOpen_B = true;
+	}
+}
+
+// The socket is only kept while a message is expected
+void CloseUdp(DHCP_CLIENT_PARAM * pParam_X) {
+	if (pParam_X->IsUdpOpen_B) {
+		pParam_X->Udp_H.stop();
+		pParam_X->IsUdpOpen_B = false;
+	}
+}
+
+void SendDiscover(DHCP_CLIENT_PARAM * pParam_X) {
+	pParam_X->TransactionId_UL = micros() ^ ((unsigned long)(pParam_X->pMacAddr_UB[3]) << 16) ^ ((unsigned long)(pParam_X->pMacAddr_UB[4]) << 8) ^ pParam_X->pMacAddr_UB[5];
+	pParam_X->StartTime_UL = millis();
+	pParam_X->State_E = DHCP_CLIENT_STATE_SELECTING;
+	SendMessage(pParam_X, DHCP_MSG_DISCOVER);
+}
+
+void SendRequest(DHCP_CLIENT_PARAM * pParam_X) {
+	SendMessage(pParam_X, DHCP_MSG_REQUEST);
+}
+
+void SendMessage(DHCP_CLIENT_PARAM * pParam_X, unsigned char Type_UB) {
+	static const unsigned char pZero_UB[16] = { 0 };
+	unsigned char pHeader_UB[DHCP_HEADER_SIZE];
+	unsigned char pOption_UB[32];
+	unsigned char Nb_UB = 0;
+	boolean IsRenew_B = ((pParam_X->State_E == DHCP_CLIENT_STATE_RENEWING) || (pParam_X->State_E == DHCP_CLIENT_STATE_REBINDING)) ? true : false;
+	unsigned int Secs_UI = (unsigned int)((millis() - pParam_X->StartTime_UL) / 1000);
+
+	// Fixed part
+	memset(pHeader_UB, 0x00, sizeof(pHeader_UB));
+	pHeader_UB[0] = DHCP_BOOT_REQUEST;
+	pHeader_UB[1] = DHCP_HTYPE_ETHERNET;
+	pHeader_UB[2] = 6;
+	for (int i = 0; i < 4; i++)
+		pHeader_UB[4 + i] = (unsigned char)(pParam_X->TransactionId_UL >> (24 - (i * 8)));
+	pHeader_UB[8] = (unsigned char)(Secs_UI >> 8);
+	pHeader_UB[9] = (unsigned char)(Secs_UI);
+	if (IsRenew_B) {
+		for (int i = 0; i < 4; i++)
+			pHeader_UB[12 + i] = pParam_X->LocalIpAddr_X[i];		// ciaddr
+	}
+	else {
+		pHeader_UB[10] = (unsigned char)(DHCP_FLAG_BROADCAST >> 8);	// No address yet : answer must be broadcast
+	}
+	for (int i = 0; i < 6; i++)
+		pHeader_UB[28 + i] = pParam_X->pMacAddr_UB[i];				// chaddr
+
+	// Options
+	pOption_UB[Nb_UB++] = DHCP_OPT_MSG_TYPE;
+	pOption_UB[Nb_UB++] = 1;
+	pOption_UB[Nb_UB++] = Type_UB;
+
+	pOption_UB[Nb_UB++] = DHCP_OPT_CLIENT_ID;
+	pOption_UB[Nb_UB++] = 7;
+	pOption_UB[Nb_UB++] = DHCP_HTYPE_ETHERNET;
+	for (int i = 0; i < 6; i++)
+		pOption_UB[Nb_UB++] = pParam_X->pMacAddr_UB[i];
+
+	if ((Type_UB == DHCP_MSG_REQUEST) && !IsRenew_B) {
+		pOption_UB[Nb_UB++] = DHCP_OPT_REQUESTED_IP;
+		pOption_UB[Nb_UB++] = 4;
+		for (int i = 0; i < 4; i++)
+			pOption_UB[Nb_UB++] = pParam_X->OfferedIpAddr_X[i];
+
+		pOption_UB[Nb_UB++] = DHCP_OPT_SERVER_ID;
+		pOption_UB[Nb_UB++] = 4;
+		for (int i = 0; i < 4; i++)
+			pOption_UB[Nb_UB++] = pParam_X->ServerIpAddr_X[i];
+	}
+
+	pOption_UB[Nb_UB++] = DHCP_OPT_PARAM_REQUEST;
+	pOption_UB[Nb_UB++] = sizeof(GL_pDhcpParamRequest_UB);
+	for (unsigned int i = 0; i < sizeof(GL_pDhcpParamRequest_UB); i++)
+		pOption_UB[Nb_UB++] = GL_pDhcpParamRequest_UB[i];
+
+	pOption_UB[Nb_UB++] = DHCP_OPT_END;
+
+	// Renewing is unicast to the server of the lease, everything else is broadcast
+	if (pParam_X->State_E == DHCP_CLIENT_STATE_RENEWING)
+		pParam_X->Udp_H.beginPacket(pParam_X->ServerIpAddr_X, DHCP_CLIENT_SERVER_PORT);
+	else
+		pParam_X->Udp_H.beginPacket(IPAddress(255, 255, 255, 255), DHCP_CLIENT_SERVER_PORT);
+
+	pParam_X->Udp_H.write(pHeader_UB, sizeof(pHeader_UB));
+	for (unsigned int i = 0; i < (DHCP_SNAME_FILE_SIZE / sizeof(pZero_UB)); i++)
+		pParam_X->Udp_H.write(pZero_UB, sizeof(pZero_UB));
+	pParam_X->Udp_H.write(GL_pDhcpMagicCookie_UB, sizeof(GL_pDhcpMagicCookie_UB));
+	pParam_X->Udp_H.write(pOption_UB, Nb_UB);
+	pParam_X->Udp_H.endPacket();
+
+	pParam_X->RequestTime_UL = millis();
+}
+
+// Return true if a reply to our transaction has been read - pMsg_X->Type_UB = 0 otherwise
+boolean ReceiveMessage(DHCP_CLIENT_PARAM * pParam_X, DHCP_CLIENT_MESSAGE_STRUCT * pMsg_X) {
+	unsigned char pHeader_UB[DHCP_HEADER_SIZE];
+	unsigned char pOption_UB[16];
+	unsigned char Code_UB;
+	unsigned char Length_UB;
+	int Size_SI;
+
+	pMsg_X->Type_UB = 0;
+	pMsg_X->LeaseTime_UL = 0;
+	pMsg_X->RenewTime_UL = 0;
+	pMsg_X->RebindTime_UL = 0;
+	pMsg_X->ServerIpAddr_X = pParam_X->ServerIpAddr_X;
+	pMsg_X->SubnetMaskAddr_X = IPAddress(255, 255, 255, 0);
+	pMsg_X->GatewayAddr_X = IPAddress(0, 0, 0, 0);
+	pMsg_X->DnsIpAddr_X = IPAddress(0, 0, 0, 0);
+
+	Size_SI = pParam_X->Udp_H.parsePacket();
+	if (Size_SI <= 0)
+		return false;
+
+	if ((Size_SI < (DHCP_HEADER_SIZE + DHCP_SNAME_FILE_SIZE + 4)) || (pParam_X->Udp_H.read(pHeader_UB, DHCP_HEADER_SIZE) != DHCP_HEADER_SIZE)) {
+		pParam_X->Udp_H.flush();
+		return false;
+	}
+
+	// Not for us
+	if ((pHeader_UB[0] != DHCP_BOOT_REPLY) || (GetLongBE(&pHeader_UB[4]) != pParam_X->TransactionId_UL) || (memcmp(&pHeader_UB[28], pParam_X->pMacAddr_UB, 6) != 0)) {
+		pParam_X->Udp_H.flush();
+		return false;
+	}
+	pMsg_X->YourIpAddr_X = IPAddress(pHeader_UB[16], pHeader_UB[17], pHeader_UB[18], pHeader_UB[19]);
+
+	// Skip sname and file
+	for (unsigned int i = 0; i < (DHCP_SNAME_FILE_SIZE / sizeof(pOption_UB)); i++)
+		pParam_X->Udp_H.read(pOption_UB, sizeof(pOption_UB));
+
+	if ((pParam_X->Udp_H.read(pOption_UB, 4) != 4) || (memcmp(pOption_UB, GL_pDhcpMagicCookie_UB, 4) != 0)) {
+		pParam_X->Udp_H.flush();
+		return false;
+	}
+
+	// Options
+	while (pParam_X->Udp_H.available() > 0) {
+		Code_UB = (unsigned char)pParam_X->Udp_H.read();
+		if (Code_UB == DHCP_OPT_PAD)
+			continue;
+		if (Code_UB == DHCP_OPT_END)
+			break;
+
+		Length_UB = (unsigned char)pParam_X->Udp_H.read();
+		for (unsigned int i = 0; i < Length_UB; i++) {
+			int Data_SI = pParam_X->Udp_H.read();
+			if (i < sizeof(pOption_UB))
+				pOption_UB[i] = (unsigned char)Data_SI;
+		}
+		if (Length_UB > sizeof(pOption_UB))
+			Length_UB = sizeof(pOption_UB);
+
+		switch (Code_UB) {
+		case DHCP_OPT_MSG_TYPE:
+			if (Length_UB >= 1) pMsg_X->Type_UB = pOption_UB[0];
+			break;
+		case DHCP_OPT_SUBNET_MASK:
+			if (Length_UB >= 4) pMsg_X->SubnetMaskAddr_X = IPAddress(pOption_UB[0], pOption_UB[1], pOption_UB[2], pOption_UB[3]);
+			break;
+		case DHCP_OPT_ROUTER:
+			if (Length_UB >= 4) pMsg_X->GatewayAddr_X = IPAddress(pOption_UB[0], pOption_UB[1], pOption_UB[2], pOption_UB[3]);
+			break;
+		case DHCP_OPT_DNS:
+			if (Length_UB >= 4) pMsg_X->DnsIpAddr_X = IPAddress(pOption_UB[0], pOption_UB[1], pOption_UB[2], pOption_UB[3]);
+			break;
+		case DHCP_OPT_SERVER_ID:
+			if (Length_UB >= 4) pMsg_X->ServerIpAddr_X = IPAddress(pOption_UB[0], pOption_UB[1], pOption_UB[2], pOption_UB[3]);
+			break;
+		case DHCP_OPT_LEASE_TIME:
+			if (Length_UB >= 4) pMsg_X->LeaseTime_UL = GetLongBE(pOption_UB);
+			break;
+		case DHCP_OPT_RENEW_TIME:
+			if (Length_UB >= 4) pMsg_X->RenewTime_UL = GetLongBE(pOption_UB);
+			break;
+		case DHCP_OPT_REBIND_TIME:
+			if (Length_UB >= 4) pMsg_X->RebindTime_UL = GetLongBE(pOption_UB);
+			break;
+		}
+	}
+
+	pParam_X->Udp_H.flush();
+	return ((pMsg_X->Type_UB != 0) ? true : false);
+}
+
+void StartLease(DHCP_CLIENT_PARAM * pParam_X, const DHCP_CLIENT_MESSAGE_STRUCT * pMsg_X) {
+	pParam_X->LeaseStartTime_UL = pParam_X->RequestTime_UL;		// Lease starts when the request was sent (RFC 2131 4.4.1)
+	pParam_X->LocalIpAddr_X = pMsg_X->YourIpAddr_X;
+	pParam_X->ServerIpAddr_X = pMsg_X->ServerIpAddr_X;
+	pParam_X->SubnetMaskAddr_X = pMsg_X->SubnetMaskAddr_X;
+	pParam_X->GatewayAddr_X = pMsg_X->GatewayAddr_X;
+	pParam_X->DnsIpAddr_X = pMsg_X->DnsIpAddr_X;
+
+	pParam_X->LeaseTime_UL = ((pMsg_X->LeaseTime_UL == 0) || (pMsg_X->LeaseTime_UL > DHCP_CLIENT_MAX_LEASE_S)) ? DHCP_CLIENT_MAX_LEASE_S : pMsg_X->LeaseTime_UL;
+	pParam_X->RenewTime_UL = ((pMsg_X->RenewTime_UL == 0) || (pMsg_X->RenewTime_UL >= pParam_X->LeaseTime_UL)) ? (pParam_X->LeaseTime_UL / 2) : pMsg_X->RenewTime_UL;
+	pParam_X->RebindTime_UL = ((pMsg_X->RebindTime_UL == 0) || (pMsg_X->RebindTime_UL >= pParam_X->LeaseTime_UL)) ? ((pParam_X->LeaseTime_UL / 8) * 7) : pMsg_X->RebindTime_UL;
+
+	CloseUdp(pParam_X);
+	pParam_X->State_E = DHCP_CLIENT_STATE_BOUND;
+
+	DBG_PRINT(DEBUG_SEVERITY_INFO, "DHCP lease ");
+	DBG_PRINTDATA(pParam_X->LocalIpAddr_X);
+	DBG_PRINTDATA(" for ");
+	DBG_PRINTDATA(pParam_X->LeaseTime_UL);
+	DBG_PRINTDATA(" s");
+	DBG_ENDSTR();
+}
+
+void RestartDiscover(DHCP_CLIENT_PARAM * pParam_X) {
+	pParam_X->LocalIpAddr_X = IPAddress(0, 0, 0, 0);
+	OpenUdp(pParam_X);
+	SendDiscover(pParam_X);
+}
+
+unsigned long GetLongBE(const unsigned char * pData_UB) {
+	return (((unsigned long)pData_UB[0] << 24) | ((unsigned long)pData_UB[1] << 16) | ((unsigned long)pData_UB[2] << 8) | (unsigned long)pData_UB[3]);
+}
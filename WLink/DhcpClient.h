@@ -0,0 +1,96 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* DhcpClient.h																		*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Header file for DhcpClient.cpp												*/
+/*		This class gets and keeps a DHCP lease without blocking the main loop		*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __DHCP_CLIENT_H__
+#define __DHCP_CLIENT_H__
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include <Arduino.h>
+#include "Ethernet.h"
+#include "EthernetUdp.h"
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+#define DHCP_CLIENT_SERVER_PORT				67
+#define DHCP_CLIENT_CLIENT_PORT				68
+
+#define DHCP_CLIENT_RESPONSE_TIMEOUT_MS		4000		// DISCOVER/REQUEST sent again after this time
+#define DHCP_CLIENT_RENEW_RETRY_MS			60000		// REQUEST period while renewing/rebinding (RFC 2131 : 60 s at least)
+#define DHCP_CLIENT_MAX_LEASE_S				2000000		// Keeps the lease arithmetic within millis() range
+
+/* ******************************************************************************** */
+/* Structure & Enumeration
+/* ******************************************************************************** */
+typedef enum {
+	DHCP_CLIENT_STS_IDLE = 0,		// Not started
+	DHCP_CLIENT_STS_BUSY,			// No lease yet
+	DHCP_CLIENT_STS_BOUND			// Lease valid (also while it is being renewed)
+} DHCP_CLIENT_STS;
+
+typedef enum {
+	DHCP_CLIENT_STATE_IDLE = 0,
+	DHCP_CLIENT_STATE_SELECTING,	// DISCOVER sent, waiting for an OFFER
+	DHCP_CLIENT_STATE_REQUESTING,	// REQUEST sent, waiting for the ACK
+	DHCP_CLIENT_STATE_BOUND,
+	DHCP_CLIENT_STATE_RENEWING,		// After T1 : REQUEST sent to the server of the lease
+	DHCP_CLIENT_STATE_REBINDING		// After T2 : REQUEST broadcast
+} DHCP_CLIENT_STATE_ENUM;
+
+typedef struct {
+	DHCP_CLIENT_STATE_ENUM State_E;
+	unsigned char pMacAddr_UB[6];
+	EthernetUDP Udp_H;
+	boolean IsUdpOpen_B;
+	unsigned long TransactionId_UL;
+	unsigned long StartTime_UL;				// Start of the current exchange
+	unsigned long RequestTime_UL;			// Last message sent
+	unsigned long LeaseStartTime_UL;		// ACK received
+	unsigned long LeaseTime_UL;				// [s]
+	unsigned long RenewTime_UL;				// [s] T1
+	unsigned long RebindTime_UL;			// [s] T2
+	IPAddress OfferedIpAddr_X;
+	IPAddress ServerIpAddr_X;
+	IPAddress LocalIpAddr_X;
+	IPAddress SubnetMaskAddr_X;
+	IPAddress GatewayAddr_X;
+	IPAddress DnsIpAddr_X;
+} DHCP_CLIENT_PARAM;
+
+/* ******************************************************************************** */
+/* Class
+/* ******************************************************************************** */
+class DhcpClient {
+public:
+	// Constructor
+	DhcpClient();
+
+	// Functions
+	void begin(unsigned char pMacAddr_UB[6]);
+	void end(void);
+	DHCP_CLIENT_STS process(void);
+	boolean isBound(void);
+
+	IPAddress getLocalIpAddr(void);
+	IPAddress getSubnetMaskAddr(void);
+	IPAddress getGatewayAddr(void);
+	IPAddress getDnsIpAddr(void);
+	unsigned long getLeaseTime(void);
+
+	DHCP_CLIENT_PARAM GL_DhcpClientParam_X;
+};
+
+#endif // __DHCP_CLIENT_H__
+
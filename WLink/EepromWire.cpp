@@ -6,6 +6,7 @@
 /*		Describes the EEPROM utilities functions over I2C communication.			*/
 /*                                                                                  */
 /* History :  	17/10/2016  (RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Queued page writes with ACK polling				*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -25,11 +26,35 @@
 static TwoWire * GL_pEepromWire_H;
 static unsigned char GL_EepromDeviceAddr_UB = 0x00;
 
+// Indexes are free-running (masked on access) - filled and emptied from the main loop only
+static EEPROM_WIRE_REQUEST_STRUCT GL_pEepromRequest_X[EEPROM_WIRE_QUEUE_REQUEST_NB];
+static unsigned int GL_EepromRequestHead_UI = 0;
+static unsigned int GL_EepromRequestTail_UI = 0;
+static unsigned char GL_pEepromData_UB[EEPROM_WIRE_QUEUE_DATA_SIZE];
+static unsigned int GL_EepromDataHead_UI = 0;
+static unsigned int GL_EepromDataTail_UI = 0;
+
+/* ******************************************************************************** */
+/* Prototypes for Internal Functions
+/* ******************************************************************************** */
+static boolean IsDeviceReady(void);
+static unsigned long NewTicket(EEPROM_WIRE_PARAM * pParam_X);
+static unsigned char WriteChunk(EEPROM_WIRE_PARAM * pParam_X, unsigned int * pChunkSize_UI);
+static void ReleaseChunk(EEPROM_WIRE_PARAM * pParam_X, unsigned int ChunkSize_UI);
+
 /* ******************************************************************************** */
 /* Constructor
 /* ******************************************************************************** */
 EepromWire::EepromWire() {
 	GL_EepromWireParam_X.IsInitialized_B = false;
+	GL_EepromWireParam_X.IsWriting_B = false;
+	GL_EepromWireParam_X.RequestDone_UI = 0;
+	GL_EepromWireParam_X.RetryNb_UB = 0;
+	GL_EepromWireParam_X.NextTicket_UL = 0;
+	GL_EepromWireParam_X.SentTicket_UL = 0;
+	GL_EepromWireParam_X.DoneTicket_UL = 0;
+	GL_EepromWireParam_X.ErrorTicket_UL = 0;
+	GL_EepromWireParam_X.WriteErrorNb_UL = 0;
 }
 
 /* ******************************************************************************** */
@@ -47,69 +72,29 @@ boolean EepromWire::isInitialized(void) {
 	return GL_EepromWireParam_X.IsInitialized_B;
 }
 
-void EepromWire::write(unsigned int Addr_UW, unsigned char * pData_UB, unsigned long Size_UL) {
-
-	// 1 Page = 64 Bytes --> manage pages crossing
-	// Use of 16 Bytes Write du to Small Buffer in Wire Library
-
-	// Space Available in First Page
-	unsigned long PageSpace_UL = (unsigned long)((((Addr_UW / 64) + 1) * 64) - Addr_UW);
-
-	// First Write Size
-	unsigned long FirstWriteSize_UL = 0;
-	if (PageSpace_UL > 16) {
-		FirstWriteSize_UL = PageSpace_UL - ((PageSpace_UL / 16) * 16);
-		if (FirstWriteSize_UL == 0)
-			FirstWriteSize_UL = 16;
-	}
-	else {
-		FirstWriteSize_UL = PageSpace_UL;
+// Blocking write : queued then waited for - returns false if a part of the data could not be written
+boolean EepromWire::write(unsigned int Addr_UW, unsigned char * pData_UB, unsigned long Size_UL) {
+	unsigned long WriteSize_UL;
+	unsigned long Ticket_UL;
+	unsigned long FirstTicket_UL = 0;
+
+	if (!(GL_EepromWireParam_X.IsInitialized_B))
+		return false;
+
+	while (Size_UL > 0) {
+		WriteSize_UL = (Size_UL < EEPROM_WIRE_QUEUE_DATA_SIZE) ? Size_UL : EEPROM_WIRE_QUEUE_DATA_SIZE;
+		while ((Ticket_UL = writeAsync(Addr_UW, pData_UB, WriteSize_UL)) == 0)
+			process();	// Wait for room in the queue
+		if (FirstTicket_UL == 0)
+			FirstTicket_UL = Ticket_UL;
+
+		Addr_UW += WriteSize_UL;
+		pData_UB += WriteSize_UL;
+		Size_UL -= WriteSize_UL;
 	}
 
-	// Last Write Size
-	unsigned long LastWriteSize_UL = 0;
-	if (Size_UL > FirstWriteSize_UL)
-		LastWriteSize_UL = (Size_UL - FirstWriteSize_UL) % 16;
-
-	// Write Number
-	unsigned long WriteNbr_UL = 0;
-	if (Size_UL > FirstWriteSize_UL)
-		WriteNbr_UL = ((Size_UL - FirstWriteSize_UL) / 16) + 2;
-	else
-		WriteNbr_UL = 1;
-
-	// Address
-	unsigned int LoopAddr_UW = Addr_UW;
-
-	unsigned long TotalSize_UL = 0;
-	unsigned long WriteSize_UL = 0;
-
-	// Loop for each transfer
-	for (unsigned long WriteCnt_UL = 0; WriteCnt_UL < WriteNbr_UL; WriteCnt_UL++) {
-
-		// Write Size for each Transfer
-		if (WriteCnt_UL == 0)
-			WriteSize_UL = (Size_UL < FirstWriteSize_UL) ? Size_UL : FirstWriteSize_UL;
-		else if (WriteCnt_UL == (WriteNbr_UL - 1))
-			WriteSize_UL = LastWriteSize_UL;
-		else
-			WriteSize_UL = 16;
-
-		if (WriteSize_UL) {
-			GL_pEepromWire_H->beginTransmission((int)GL_EepromDeviceAddr_UB);
-			GL_pEepromWire_H->write((int)(LoopAddr_UW >> 8));   // Address MSB
-			GL_pEepromWire_H->write((int)(LoopAddr_UW & 0xFF)); // Address LSB
-
-			for (int i = 0; i < WriteSize_UL; i++)
-				GL_pEepromWire_H->write(pData_UB[TotalSize_UL++]);
-			GL_pEepromWire_H->endTransmission();
-
-			LoopAddr_UW += WriteSize_UL;
-
-			delay(5); // 5[ms] for Page Write   
-		}
-
-	}
+	flush();
+	return ((FirstTicket_UL == 0) || !isWriteFailed(FirstTicket_UL));
 }
 
 unsigned long EepromWire::read(unsigned int Addr_UW, unsigned char * pData_UB, unsigned long Size_UL) {
@@ -118,6 +103,8 @@ unsigned long EepromWire::read(unsigned int Addr_UW, unsigned char * pData_UB, u
 	unsigned long LoopSize_UL = 0;
 	unsigned int LoopAddr_UW = 0;
 
+	flush();	// Queued writes done before reading
+
 	unsigned long LoopNbr_UL = (Size_UL - Size_UL % 16) / 16; // Use of small buffer in Wire Library.
 	if ((Size_UL >= 16) && ((Size_UL % 16) == 0))
 		LoopNbr_UL--; // Manage boundaries
@@ -141,7 +128,7 @@ unsigned long EepromWire::read(unsigned int Addr_UW, unsigned char * pData_UB, u
 
 		GL_pEepromWire_H->requestFrom(GL_EepromDeviceAddr_UB, LoopSize_UL);
 
-		int i = 0;
+		unsigned long i = 0;
 		while (GL_pEepromWire_H->available() || i < LoopSize_UL) {
 			pData_UB[TotalSize_UL++] = GL_pEepromWire_H->read();
 			i++;
@@ -152,3 +139,152 @@ unsigned long EepromWire::read(unsigned int Addr_UW, unsigned char * pData_UB, u
 	return ((unsigned long)TotalSize_UL);
 }
 
+// Data copied into the queue - returns 0 if there is no room left (ticket otherwise)
+unsigned long EepromWire::writeAsync(unsigned int Addr_UW, const unsigned char * pData_UB, unsigned long Size_UL) {
+	EEPROM_WIRE_REQUEST_STRUCT * pRequest_X;
+
+	// Nothing to write : done with the requests already queued
+	if (Size_UL == 0) {
+		if (isWriteQueueEmpty()) {
+			GL_EepromWireParam_X.SentTicket_UL = NewTicket(&GL_EepromWireParam_X);
+			GL_EepromWireParam_X.DoneTicket_UL = GL_EepromWireParam_X.SentTicket_UL;
+		}
+		return GL_EepromWireParam_X.NextTicket_UL;
+	}
+
+	if (((GL_EepromRequestHead_UI - GL_EepromRequestTail_UI) >= EEPROM_WIRE_QUEUE_REQUEST_NB) ||
+		(Size_UL > (EEPROM_WIRE_QUEUE_DATA_SIZE - (GL_EepromDataHead_UI - GL_EepromDataTail_UI))))
+		return 0;
+
+	for (unsigned long i = 0; i < Size_UL; i++)
+		GL_pEepromData_UB[(GL_EepromDataHead_UI + i) & (EEPROM_WIRE_QUEUE_DATA_SIZE - 1)] = pData_UB[i];
+	GL_EepromDataHead_UI += Size_UL;
+
+	pRequest_X = &GL_pEepromRequest_X[GL_EepromRequestHead_UI & (EEPROM_WIRE_QUEUE_REQUEST_NB - 1)];
+	pRequest_X->Addr_UW = Addr_UW;
+	pRequest_X->Size_UI = (unsigned int)(Size_UL);
+	pRequest_X->Ticket_UL = NewTicket(&GL_EepromWireParam_X);
+	GL_EepromRequestHead_UI++;
+
+	return pRequest_X->Ticket_UL;
+}
+
+// Tickets are completed in order
+boolean EepromWire::isWritePending(unsigned long Ticket_UL) {
+	return (((signed long)(Ticket_UL - GL_EepromWireParam_X.DoneTicket_UL)) > 0);
+}
+
+// To be checked once the ticket is done - true if a chunk of this request or of a later one has been lost
+boolean EepromWire::isWriteFailed(unsigned long Ticket_UL) {
+	return ((GL_EepromWireParam_X.ErrorTicket_UL != 0) && (((signed long)(GL_EepromWireParam_X.ErrorTicket_UL - Ticket_UL)) >= 0));
+}
+
+boolean EepromWire::isWriteQueueEmpty(void) {
+	return ((GL_EepromRequestHead_UI == GL_EepromRequestTail_UI) && !(GL_EepromWireParam_X.IsWriting_B));
+}
+
+// One chunk per call at most - the write cycle is detected by ACK polling
+void EepromWire::process(void) {
+	unsigned int ChunkSize_UI;
+
+	if (!(GL_EepromWireParam_X.IsInitialized_B))
+		return;
+
+	if (GL_EepromWireParam_X.IsWriting_B) {
+		if (IsDeviceReady()) {
+			GL_EepromWireParam_X.IsWriting_B = false;
+		}
+		else if ((millis() - GL_EepromWireParam_X.WriteTime_UL) >= EEPROM_WIRE_WRITE_TIMEOUT_MS) {
+			DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "Write Cycle Timeout");
+			GL_EepromWireParam_X.WriteErrorNb_UL++;
+			GL_EepromWireParam_X.IsWriting_B = false;
+		}
+		else {
+			return;
+		}
+		GL_EepromWireParam_X.DoneTicket_UL = GL_EepromWireParam_X.SentTicket_UL;
+	}
+
+	if (GL_EepromRequestHead_UI == GL_EepromRequestTail_UI)
+		return;
+
+	if (WriteChunk(&GL_EepromWireParam_X, &ChunkSize_UI) == 0) {
+		ReleaseChunk(&GL_EepromWireParam_X, ChunkSize_UI);
+		GL_EepromWireParam_X.IsWriting_B = true;
+		GL_EepromWireParam_X.WriteTime_UL = millis();
+	}
+	else if (++(GL_EepromWireParam_X.RetryNb_UB) < EEPROM_WIRE_WRITE_RETRY_NB) {
+		// Not acknowledged (device still busy) : sent again once it answers the ACK polling
+		GL_EepromWireParam_X.IsWriting_B = true;
+		GL_EepromWireParam_X.WriteTime_UL = millis();
+	}
+	else {
+		DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "Chunk Not Acknowledged");
+		GL_EepromWireParam_X.WriteErrorNb_UL++;
+		GL_EepromWireParam_X.ErrorTicket_UL = GL_pEepromRequest_X[GL_EepromRequestTail_UI & (EEPROM_WIRE_QUEUE_REQUEST_NB - 1)].Ticket_UL;
+		ReleaseChunk(&GL_EepromWireParam_X, ChunkSize_UI);
+		GL_EepromWireParam_X.DoneTicket_UL = GL_EepromWireParam_X.SentTicket_UL;
+	}
+}
+
+void EepromWire::flush(void) {
+	if (!(GL_EepromWireParam_X.IsInitialized_B))
+		return;
+
+	while (!isWriteQueueEmpty())
+		process();
+}
+
+
+/* ******************************************************************************** */
+/* Internal Functions
+/* ******************************************************************************** */
+boolean IsDeviceReady(void) {
+	GL_pEepromWire_H->beginTransmission((int)GL_EepromDeviceAddr_UB);
+	return (GL_pEepromWire_H->endTransmission() == 0);
+}
+
+unsigned long NewTicket(EEPROM_WIRE_PARAM * pParam_X) {
+	if (++(pParam_X->NextTicket_UL) == 0)
+		pParam_X->NextTicket_UL = 1;		// 0 = no room
+
+	return pParam_X->NextTicket_UL;
+}
+
+// Chunk of the oldest request limited by the page boundary and the Wire buffer - returns the status of endTransmission()
+unsigned char WriteChunk(EEPROM_WIRE_PARAM * pParam_X, unsigned int * pChunkSize_UI) {
+	EEPROM_WIRE_REQUEST_STRUCT * pRequest_X = &GL_pEepromRequest_X[GL_EepromRequestTail_UI & (EEPROM_WIRE_QUEUE_REQUEST_NB - 1)];
+	unsigned int Addr_UW = pRequest_X->Addr_UW + pParam_X->RequestDone_UI;
+	unsigned int ChunkSize_UI = pRequest_X->Size_UI - pParam_X->RequestDone_UI;
+	unsigned int PageSpace_UI = EEPROM_WIRE_PAGE_SIZE - (Addr_UW % EEPROM_WIRE_PAGE_SIZE);
+	unsigned char Status_UB;
+
+	if (ChunkSize_UI > PageSpace_UI)
+		ChunkSize_UI = PageSpace_UI;
+	if (ChunkSize_UI > EEPROM_WIRE_CHUNK_SIZE)
+		ChunkSize_UI = EEPROM_WIRE_CHUNK_SIZE;
+
+	GL_pEepromWire_H->beginTransmission((int)GL_EepromDeviceAddr_UB);
+	GL_pEepromWire_H->write((int)(Addr_UW >> 8));   // Address MSB
+	GL_pEepromWire_H->write((int)(Addr_UW & 0xFF)); // Address LSB
+	for (unsigned int i = 0; i < ChunkSize_UI; i++)
+		GL_pEepromWire_H->write(GL_pEepromData_UB[(GL_EepromDataTail_UI + i) & (EEPROM_WIRE_QUEUE_DATA_SIZE - 1)]);
+	Status_UB = GL_pEepromWire_H->endTransmission();
+
+	*pChunkSize_UI = ChunkSize_UI;
+	return Status_UB;
+}
+
+// Chunk removed from the queue (written or given up)
+void ReleaseChunk(EEPROM_WIRE_PARAM * pParam_X, unsigned int ChunkSize_UI) {
+	EEPROM_WIRE_REQUEST_STRUCT * pRequest_X = &GL_pEepromRequest_X[GL_EepromRequestTail_UI & (EEPROM_WIRE_QUEUE_REQUEST_NB - 1)];
+
+	pParam_X->RetryNb_UB = 0;
+	GL_EepromDataTail_UI += ChunkSize_UI;
+	pParam_X->RequestDone_UI += ChunkSize_UI;
+	if (pParam_X->RequestDone_UI >= pRequest_X->Size_UI) {
+		pParam_X->SentTicket_UL = pRequest_X->Ticket_UL;
+		pParam_X->RequestDone_UI = 0;
+		GL_EepromRequestTail_UI++;
+	}
+}
@@ -6,6 +6,7 @@
 /*		Header file for Eeprom.cpp													*/
 /*                                                                                  */
 /* History :  	17/10/2016  (RW)	Creation of this file							*/
+/*				18/10/2026	(RW)	Queued page writes with ACK polling				*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -21,12 +22,33 @@
 /* ******************************************************************************** */
 /* Define
 /* ******************************************************************************** */
+#define EEPROM_WIRE_PAGE_SIZE				64
+#define EEPROM_WIRE_CHUNK_SIZE				30		// Wire buffer (32 bytes) minus the 2 address bytes
+#define EEPROM_WIRE_QUEUE_DATA_SIZE			512		// Must be a power of 2
+#define EEPROM_WIRE_QUEUE_REQUEST_NB		16		// Must be a power of 2
+#define EEPROM_WIRE_WRITE_TIMEOUT_MS		20		// Write cycle is 5 ms max -> device considered lost after this delay
+#define EEPROM_WIRE_WRITE_RETRY_NB			3		// Sending of a chunk not acknowledged by the device
 
 /* ******************************************************************************** */
 /* Structure & Enumeration
 /* ******************************************************************************** */
+typedef struct {
+	unsigned int Addr_UW;
+	unsigned int Size_UI;
+	unsigned long Ticket_UL;
+} EEPROM_WIRE_REQUEST_STRUCT;
+
 typedef struct {
 	boolean IsInitialized_B;
+	boolean IsWriting_B;						// Write cycle of the last chunk in progress (ACK polling)
+	unsigned long WriteTime_UL;					// millis() when the last chunk was sent
+	unsigned int RequestDone_UI;				// Bytes of the oldest request already sent
+	unsigned char RetryNb_UB;					// Sendings of the current chunk not acknowledged
+	unsigned long NextTicket_UL;
+	unsigned long SentTicket_UL;				// Ticket of the last request fully sent
+	unsigned long DoneTicket_UL;				// Ticket of the last request written (write cycle over)
+	unsigned long ErrorTicket_UL;				// Ticket of the last request with a lost chunk (0 = none)
+	unsigned long WriteErrorNb_UL;				// Chunks not acknowledged by the device
 } EEPROM_WIRE_PARAM;
 
 /* ******************************************************************************** */
@@ -41,9 +63,16 @@ public:
 	void init(TwoWire * pWire_H, unsigned char EepromAddr_UB);
 	boolean isInitialized(void);
 
-	void write(unsigned int Addr_UW, unsigned char * pData_UB, unsigned long Size_UL);
+	boolean write(unsigned int Addr_UW, unsigned char * pData_UB, unsigned long Size_UL);
 	unsigned long read(unsigned int Addr_UW, unsigned char * pData_UB, unsigned long Size_UL);
 
+	unsigned long writeAsync(unsigned int Addr_UW, const unsigned char * pData_UB, unsigned long Size_UL);
+	boolean isWritePending(unsigned long Ticket_UL);
+	boolean isWriteFailed(unsigned long Ticket_UL);
+	boolean isWriteQueueEmpty(void);
+	void process(void);
+	void flush(void);
+
 	EEPROM_WIRE_PARAM GL_EepromWireParam_X;
 };
 
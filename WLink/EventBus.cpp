@@ -0,0 +1,126 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* EventBus.cpp																		*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Describes the functions to publish events and dispatch them to the			*/
+/*		subscribed managers from the main loop										*/
+/*		Events without subscriber are not queued									*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#define MODULE_NAME		"EventBus"
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "EventBus.h"
+
+#include "Debug.h"
+
+static_assert(EVENT_BUS_RESERVED_NB < EVENT_BUS_QUEUE_SIZE, "Event bus : no slot left for the other events");
+
+/* ******************************************************************************** */
+/* Local Variables
+/* ******************************************************************************** */
+static const EVENT_BUS_SUBSCRIBER_STRUCT * GL_pEventBusSubscriber_X = NULL;
+static unsigned long GL_pEventBusSubscriberMask_UL[EVENT_BUS_ID_NB];		// Bit i set = subscriber i wants the event
+
+// Indexes are free-running (masked on access) - published and dispatched from the main loop only
+static EVENT_BUS_EVENT_STRUCT GL_pEventBusQueue_X[EVENT_BUS_QUEUE_SIZE];
+static unsigned int GL_EventBusHead_UI = 0;
+static unsigned int GL_EventBusTail_UI = 0;
+static unsigned long GL_EventBusDropNb_UL = 0;
+
+/* ******************************************************************************** */
+/* Prototypes for Internal Functions
+/* ******************************************************************************** */
+static boolean IsReserved(EVENT_BUS_ID_ENUM Id_E);
+static void Dispatch(const EVENT_BUS_EVENT_STRUCT * pEvent_X);
+
+/* ******************************************************************************** */
+/* Functions
+/* ******************************************************************************** */
+void EventBus_Init(const EVENT_BUS_SUBSCRIBER_STRUCT * pSubscriber_X, unsigned long SubscriberNb_UL) {
+	GL_pEventBusSubscriber_X = pSubscriber_X;
+	GL_EventBusHead_UI = 0;
+	GL_EventBusTail_UI = 0;
+	GL_EventBusDropNb_UL = 0;
+
+	for (int i = 0; i < EVENT_BUS_ID_NB; i++)
+		GL_pEventBusSubscriberMask_UL[i] = 0;
+
+	for (unsigned long i = 0; (i < SubscriberNb_UL) && (i < EVENT_BUS_MAX_SUBSCRIBER_NB); i++) {
+		if (pSubscriber_X[i].Id_E < EVENT_BUS_ID_NB)
+			GL_pEventBusSubscriberMask_UL[pSubscriber_X[i].Id_E] |= (1UL << i);
+	}
+
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Event Bus Initialized");
+}
+
+// Returns false if the queue is full : the event is lost
+boolean EventBus_Publish(EVENT_BUS_ID_ENUM Id_E, unsigned char Source_UB, unsigned long Data_UL) {
+	EVENT_BUS_EVENT_STRUCT * pEvent_X;
+	unsigned int RoomNb_UI;
+
+	if ((Id_E >= EVENT_BUS_ID_NB) || (GL_pEventBusSubscriberMask_UL[Id_E] == 0))
+		return true;	// Nobody listening
+
+	RoomNb_UI = EVENT_BUS_QUEUE_SIZE - (GL_EventBusHead_UI - GL_EventBusTail_UI);
+	if ((RoomNb_UI == 0) || ((RoomNb_UI <= EVENT_BUS_RESERVED_NB) && !IsReserved(Id_E))) {
+		GL_EventBusDropNb_UL++;
+		DBG_PRINT(DEBUG_SEVERITY_WARNING, "Queue Full - Event Dropped : ");
+		DBG_PRINTDATA(Id_E);
+		DBG_ENDSTR();
+		return false;
+	}
+
+	pEvent_X = &GL_pEventBusQueue_X[GL_EventBusHead_UI & (EVENT_BUS_QUEUE_SIZE - 1)];
+	pEvent_X->Id_E = Id_E;
+	pEvent_X->Source_UB = Source_UB;
+	pEvent_X->Data_UL = Data_UL;
+	GL_EventBusHead_UI++;
+
+	return true;
+}
+
+// Events published by the handlers are dispatched on the next call
+void EventBus_Process(void) {
+	EVENT_BUS_EVENT_STRUCT Event_X;
+	unsigned int EventNb_UI = GL_EventBusHead_UI - GL_EventBusTail_UI;
+
+	while (EventNb_UI > 0) {
+		Event_X = GL_pEventBusQueue_X[GL_EventBusTail_UI & (EVENT_BUS_QUEUE_SIZE - 1)];
+		GL_EventBusTail_UI++;
+		EventNb_UI--;
+
+		Dispatch(&Event_X);
+	}
+}
+
+unsigned long EventBus_GetDropNumber(void) {
+	return GL_EventBusDropNb_UL;
+}
+
+
+/* ******************************************************************************** */
+/* Internal Functions
+/* ******************************************************************************** */
+// The servers rely on these events to release their sockets : they must never be lost
+boolean IsReserved(EVENT_BUS_ID_ENUM Id_E) {
+	return (((Id_E == EVENT_BUS_ID_LINK_DOWN) || (Id_E == EVENT_BUS_ID_ADDRESS_LOST)) ? true : false);
+}
+
+void Dispatch(const EVENT_BUS_EVENT_STRUCT * pEvent_X) {
+	unsigned long Mask_UL = GL_pEventBusSubscriberMask_UL[pEvent_X->Id_E];
+	unsigned char Idx_UB;
+
+	while (Mask_UL != 0) {
+		Idx_UB = (unsigned char)(__builtin_ctzl(Mask_UL));	// Subscribers called in table order
+		Mask_UL &= (Mask_UL - 1);
+		GL_pEventBusSubscriber_X[Idx_UB].FctHandler(pEvent_X);
+	}
+}
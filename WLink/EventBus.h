@@ -0,0 +1,73 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* EventBus.h																		*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Header file for EventBus.cpp												*/
+/*		Fixed-capacity publish/subscribe queue between the managers					*/
+/*		Subscribers are given by a static table (see WLink.ino)						*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __EVENT_BUS_H__
+#define __EVENT_BUS_H__
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include <Arduino.h>
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+#define EVENT_BUS_QUEUE_SIZE			16		// Must be a power of 2
+#define EVENT_BUS_RESERVED_NB			4		// Last slots of the queue kept for the link and address losses
+#define EVENT_BUS_MAX_SUBSCRIBER_NB		32		// One bit per subscriber in the dispatch masks
+
+/* ******************************************************************************** */
+/* Structure & Enumeration
+/* ******************************************************************************** */
+typedef enum {
+	EVENT_BUS_ID_NEW_WEIGHT = 0,		// Source = Indicator index - Data = weight (signed)
+	EVENT_BUS_ID_LINK_UP,				// Ethernet cable plugged
+	EVENT_BUS_ID_LINK_DOWN,				// Ethernet cable unplugged or Network Adapter disabled (reserved slots)
+	EVENT_BUS_ID_ADDRESS_BOUND,			// IP address available (static, DHCP lease or fallback)
+	EVENT_BUS_ID_ADDRESS_LOST,			// DHCP lease lost while linked (reserved slots)
+	EVENT_BUS_ID_GPRS_STATE,			// Data = 1 if GPRS attached, 0 otherwise
+	EVENT_BUS_ID_NB
+} EVENT_BUS_ID_ENUM;
+
+typedef struct {
+	EVENT_BUS_ID_ENUM Id_E;
+	unsigned char Source_UB;
+	unsigned long Data_UL;
+} EVENT_BUS_EVENT_STRUCT;
+
+typedef void(*EVENT_BUS_HANDLER)(const EVENT_BUS_EVENT_STRUCT * pEvent_X);
+
+typedef struct {
+	EVENT_BUS_ID_ENUM Id_E;
+	EVENT_BUS_HANDLER FctHandler;
+} EVENT_BUS_SUBSCRIBER_STRUCT;
+
+
+// True if every subscriber has a known ID and a handler, and the table fits the dispatch masks
+constexpr bool EventBusSubscriber_IsValid(const EVENT_BUS_SUBSCRIBER_STRUCT * pSubscriber_X, unsigned long SubscriberNb_UL) {
+	return (SubscriberNb_UL > EVENT_BUS_MAX_SUBSCRIBER_NB) ? false :
+		   (SubscriberNb_UL == 0) ? true : ((pSubscriber_X[0].Id_E < EVENT_BUS_ID_NB) && (pSubscriber_X[0].FctHandler != NULL) &&
+										   EventBusSubscriber_IsValid(pSubscriber_X + 1, SubscriberNb_UL - 1));
+}
+
+/* ******************************************************************************** */
+/* Functions Prototypes
+/* ******************************************************************************** */
+void EventBus_Init(const EVENT_BUS_SUBSCRIBER_STRUCT * pSubscriber_X, unsigned long SubscriberNb_UL);
+boolean EventBus_Publish(EVENT_BUS_ID_ENUM Id_E, unsigned char Source_UB, unsigned long Data_UL);
+void EventBus_Process(void);
+
+unsigned long EventBus_GetDropNumber(void);
+
+#endif // __EVENT_BUS_H__
@@ -6,6 +6,7 @@
 /*		Describes the Flat Panel utilities functions								*/
 /*                                                                                  */
 /* History :  	21/06/2016  (RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Publish the key presses on the Event Bus		*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
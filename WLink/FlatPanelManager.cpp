@@ -18,6 +18,7 @@
 #include "FlatPanelManager.h"
 
 #include "Debug.h"
+#include "LoopProfiler.h"
 
 
 /* ******************************************************************************** */
@@ -77,6 +78,7 @@ void FlatPanelManager_Process() {
         TransitionToIdle();
 
     /* State Machine */
+    LOOP_PROFILER_SET_STATE(LOOP_PROFILER_ID_FLAT_PANEL, GL_FlatPanelManager_CurrentState_E);
 	switch (GL_FlatPanelManager_CurrentState_E) {
 	case FLAT_PANEL_MANAGER_IDLE:
 		ProcessIdle();
@@ -6,6 +6,7 @@
 /*		Describes the FONA module utilities functions   			                */
 /*                                                                                  */
 /* History :  	25/05/2017  (RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Add URC hook and payload requests ('>' prompt)	*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -23,6 +24,9 @@
 /* Define
 /* ******************************************************************************** */
 
+#define FONA_MODULE_HTTP_ACTION_TIMEOUT_MS      40000   // 'OK' and '+HTTPACTION:' (up to 10[s] + 30[s])
+#define FONA_MODULE_HTTP_DATA_TIMEOUT_MS        10000   // Time allowed to download the HTTP data (body)
+
 /* ******************************************************************************** */
 /* Local Variables
 /* ******************************************************************************** */
@@ -30,6 +34,33 @@
 static HardwareSerial * GL_pFonaSerial_H;
 static char GL_pReceiveBuffer_UB[256];
 
+// Asynchronous AT engine
+static FONA_MODULE_AT_REQUEST_STRUCT GL_pAtQueue_X[FONA_MODULE_AT_QUEUE_SIZE];
+static unsigned long GL_AtHeadTicket_UL = 1;    // Ticket of the oldest request not completed
+static unsigned long GL_AtNextTicket_UL = 1;    // Ticket given to the next queued request
+static unsigned long GL_AtLastCompletionTime_UL = 0;
+
+static char GL_pAtLineBuffer_UB[FONA_MODULE_AT_LINE_SIZE];
+static unsigned int GL_AtLineLength_UI = 0;
+static boolean GL_AtSkipPromptSpace_B = false;  // '>' prompt is followed by a space
+static unsigned int GL_AtRawDataNb_UI = 0;      // Bytes of raw data still expected (announced by +HTTPREAD: <length>)
+static FONA_MODULE_URC_CALLBACK GL_pFctAtUrcCallback = NULL;
+
+static char GL_pAtStagingBuffer_UB[FONA_MODULE_AT_STAGING_SIZE];
+static unsigned int GL_AtStagingLength_UI = 0;
+static boolean GL_AtStagingOverflow_B = false;
+static unsigned long GL_AtStagingTicket_UL = 0;
+
+
+/* ******************************************************************************** */
+/* Prototypes for Internal Functions
+/* ******************************************************************************** */
+static FONA_MODULE_AT_REQUEST_STRUCT * GetAtRequest(unsigned long Ticket_UL);
+static void ProcessAtLine(void);
+static void CollectAtRawData(char Data_UB);
+static void CompleteAtRequest(FONA_MODULE_AT_REQUEST_STRUCT * pRequest_X, FONA_MODULE_AT_STS_ENUM Status_E);
+static void AppendStaging(const char * pData_UB);
+
 /* ******************************************************************************** */
 /* Constructor
 /* ******************************************************************************** */
@@ -340,9 +371,9 @@ boolean FonaModule::checkAtResponse(String Data_Str) {
 }
 
 
-boolean FonaModule::parseResponse(char * pBuffer_UB, char * pPrefix_UB, int * pValue_SI, char Token_UB, unsigned int Index_UI) {
+boolean FonaModule::parseResponse(const char * pBuffer_UB, const char * pPrefix_UB, int * pValue_SI, char Token_UB, unsigned int Index_UI) {
 
-    char * p = strstr(pBuffer_UB, pPrefix_UB);  // Get pointer to the Prefix
+    const char * p = strstr(pBuffer_UB, pPrefix_UB);  // Get pointer to the Prefix
 
     if (p == 0)
         return false;
@@ -363,7 +394,7 @@ boolean FonaModule::parseResponse(char * pBuffer_UB, char * pPrefix_UB, int * pV
     return true;
 }
 
-boolean FonaModule::parseResponse(char * pBuffer_UB, String Prefix_Str, int * pValue_SI, char Token_UB, unsigned int Index_UI) {
+boolean FonaModule::parseResponse(const char * pBuffer_UB, String Prefix_Str, int * pValue_SI, char Token_UB, unsigned int Index_UI) {
     return parseResponse(pBuffer_UB, Prefix_Str.c_str(), pValue_SI, Token_UB, Index_UI);
 }
 
@@ -566,72 +597,22 @@ boolean FonaModule::enterPinCode(void) {
 
 signed int FonaModule::getSignalStrength(void) {
 
-    char pCharValue_UB[4] = { 0 };
-    int RawValue_SI = 0;
-    int DbmValue_SI = 0;
-
     //DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Get Received Signal Strength Indication (RSSI)");
     //DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Value from -155[dBm] to -52[dBm]");
     sendAtCommand("AT+CSQ");
     readLine();
 
-    // Response should be : +CSQ: rssi,ber
-    //              index = 0123456789
-    for (int i = 0; i < 4; i++) {
-        if (GL_pReceiveBuffer_UB[6 + i] == ',') {
-            // End of RSSI value
-            pCharValue_UB[i] = 0;   // NULL termination
-            break;
-        }
-        else {
-            pCharValue_UB[i] = GL_pReceiveBuffer_UB[6 + i];
-        }    
-    }
-
-    RawValue_SI = atoi(pCharValue_UB);
-    //DBG_PRINT(DEBUG_SEVERITY_INFO, "Raw value given by FONA module : ");
-    //DBG_PRINTDATA(RawValue_SI);
-    //DBG_ENDSTR();
-
-    if (RawValue_SI == 0) {
-        DbmValue_SI = -115;
-    }
-    else if (RawValue_SI == 1) {
-        DbmValue_SI = -111;
-    }
-    else if ((RawValue_SI >= 2) && (RawValue_SI <= 30)) {
-        DbmValue_SI = (RawValue_SI << 1) - 114;
-    }
-    else if (RawValue_SI == 31) {
-        DbmValue_SI = -52;
-    }
-    else {
-        DbmValue_SI = 0;    // Error
-    }
-
-    //DBG_PRINT(DEBUG_SEVERITY_INFO, "RSSI Value : ");
-    //DBG_PRINTDATA(DbmValue_SI);
-    //DBG_PRINTDATA("[dBm]");
-    //DBG_ENDSTR();
-
-    return DbmValue_SI;
+    return parseSignalStrength(GL_pReceiveBuffer_UB);
 }
 
 
 unsigned int FonaModule::getBatteryLevel(void) {
 
-    int Level_SI = 0;
-
     //DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Get Battery remaining Capacity");
     sendAtCommand("AT+CBC");
     readLine();
 
-    // Response should be : +CBC: 0,64,3916
-
-    if (!parseResponse(GL_pReceiveBuffer_UB, "+CBC: ", &Level_SI, ',', 1))
-        return 0;
-
-    return Level_SI;
+    return parseBatteryLevel(GL_pReceiveBuffer_UB);
 }
 
 
@@ -741,13 +722,7 @@ boolean FonaModule::isGprsEnabled(void) {
     sendAtCommand("AT+CGATT?");
     readLine();
 
-    // Response should be : +CGATT: state
-    //              index = 012345678
-
-    if (GL_pReceiveBuffer_UB[8] == '1')
-        return true;
-    else
-        return false;
+    return parseGprsState(GL_pReceiveBuffer_UB);
 }
 
 boolean FonaModule::getNetworkStatus(int * pStatus_SI) {
@@ -756,7 +731,7 @@ boolean FonaModule::getNetworkStatus(int * pStatus_SI) {
     sendAtCommand("AT+CREG?");
     readLine();
 
-    if (!parseResponse(GL_pReceiveBuffer_UB, "+CREG: ", pStatus_SI, ',', 1))
+    if (!parseNetworkStatus(GL_pReceiveBuffer_UB, pStatus_SI))
         return false;
 
     DBG_PRINT(DEBUG_SEVERITY_INFO, "Network Status = ");
@@ -881,9 +856,7 @@ boolean FonaModule::httpAction(FONA_MODULE_HTTP_ACTION_ENUM Action_E, int * pSer
 
 
     readLine(true, 30000); // Should reply +HTTPACTION: 0,302,14
-    if (!parseResponse(GL_pReceiveBuffer_UB, "+HTTPACTION: ", pServerResponse_SI, ',', 1))
-        return false;
-    if (!parseResponse(GL_pReceiveBuffer_UB, "+HTTPACTION: ", pDataSize_SI, ',', 2))
+    if (!parseHttpAction(GL_pReceiveBuffer_UB, pServerResponse_SI, pDataSize_SI))
         return false;
 
     DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Print out Server information : ");
@@ -942,3 +915,634 @@ boolean FonaModule::httpRead(char * pData_UB, unsigned long StartAddr_UL, unsign
 
     return checkAtResponse("OK");
 }
+
+
+/* ******************************************************************************** */
+/* Asynchronous AT Engine
+/* ******************************************************************************** */
+
+// Notes :
+//      > Requests are queued and handled one at a time by process(), which has to be called from the main loop.
+//      > A call to process() never blocks : the command is written only if there is room in the TX buffer and
+//        at most FONA_MODULE_AT_MAX_RX_PER_PROCESS bytes are read from the module.
+//      > Each request is identified by a ticket (0 = invalid) used to poll its status and get its response.
+//      > Lines received between the command and its final response are collected in the response of the request.
+//      > Lines received while no request is waiting are considered as unsolicited and discarded.
+//      > Each line is first offered to the URC callback (if any) which can consume it, whatever the current request.
+//      > The payload of a request is sent once the module has answered the '>' prompt (e.g. AT+CIPSEND).
+//      > A chained request is aborted if the request queued just before it did not complete with OK : the status
+//        is carried by the request itself, not by the last completed request of the whole queue.
+
+void FonaModule::process(void) {
+
+    FONA_MODULE_AT_REQUEST_STRUCT * pRequest_X = NULL;
+    const char * pCommand_UB;
+    unsigned int Length_UI = 0;
+    unsigned int EndLength_UI = 0;
+    int Space_SI = 0;
+    char c;
+
+    if (!GL_FonaModuleParam_X.IsInitialized_B)
+        return;
+
+    // Get current request
+    if (GL_AtHeadTicket_UL != GL_AtNextTicket_UL)
+        pRequest_X = &GL_pAtQueue_X[GL_AtHeadTicket_UL & (FONA_MODULE_AT_QUEUE_SIZE - 1)];
+
+    // Start request (respect guard time between two commands)
+    if ((pRequest_X != NULL) && (pRequest_X->Status_E == FONA_MODULE_AT_STS_QUEUED)) {
+        if (pRequest_X->Chained_B && pRequest_X->ChainBroken_B) {
+            CompleteAtRequest(pRequest_X, FONA_MODULE_AT_STS_ABORTED);
+            return;
+        }
+
+        if ((millis() - GL_AtLastCompletionTime_UL) >= FONA_MODULE_AT_GUARD_TIME_MS) {
+            pRequest_X->Status_E = FONA_MODULE_AT_STS_SENDING;
+            pRequest_X->StartTime_UL = millis();
+        }
+    }
+
+    // Send command as far as the TX buffer allows it (command + CR LF, unless raw data)
+    if ((pRequest_X != NULL) && (pRequest_X->Status_E == FONA_MODULE_AT_STS_SENDING)) {
+        pCommand_UB = (pRequest_X->FromStaging_B) ? GL_pAtStagingBuffer_UB : pRequest_X->pCommand_UB;
+        Length_UI = (pRequest_X->FromStaging_B) ? GL_AtStagingLength_UI : strlen(pRequest_X->pCommand_UB);
+        EndLength_UI = (pRequest_X->RawData_B) ? Length_UI : (Length_UI + 2);
+        Space_SI = GL_pFonaSerial_H->availableForWrite();
+
+        while ((Space_SI > 0) && (pRequest_X->TxIndex_UI < EndLength_UI)) {
+            if (pRequest_X->TxIndex_UI < Length_UI)
+                GL_pFonaSerial_H->write(pCommand_UB[pRequest_X->TxIndex_UI]);
+            else if (pRequest_X->TxIndex_UI == Length_UI)
+                GL_pFonaSerial_H->write(0x0D);
+            else
+                GL_pFonaSerial_H->write(0x0A);
+
+            pRequest_X->TxIndex_UI++;
+            Space_SI--;
+        }
+
+        if (pRequest_X->TxIndex_UI >= EndLength_UI) {
+            pRequest_X->Status_E = FONA_MODULE_AT_STS_WAITING;
+            pRequest_X->StartTime_UL = millis();    // Timeout starts once the whole command is sent
+        }
+    }
+
+    // Send payload as far as the TX buffer allows it (once the prompt is received)
+    if ((pRequest_X != NULL) && (pRequest_X->Status_E == FONA_MODULE_AT_STS_WAITING) && pRequest_X->PromptReceived_B && (pRequest_X->PayloadIndex_UI < pRequest_X->PayloadLength_UI)) {
+        Space_SI = GL_pFonaSerial_H->availableForWrite();
+
+        while ((Space_SI > 0) && (pRequest_X->PayloadIndex_UI < pRequest_X->PayloadLength_UI)) {
+            GL_pFonaSerial_H->write(pRequest_X->pPayload_UB[pRequest_X->PayloadIndex_UI++]);
+            Space_SI--;
+        }
+
+        if (pRequest_X->PayloadIndex_UI >= pRequest_X->PayloadLength_UI)
+            pRequest_X->StartTime_UL = millis();    // Timeout restarts once the whole payload is sent
+    }
+
+    // Assemble lines from received bytes
+    for (int i = 0; (i < FONA_MODULE_AT_MAX_RX_PER_PROCESS) && (GL_pFonaSerial_H->available() > 0); i++) {
+
+        c = GL_pFonaSerial_H->read();
+
+        // Raw data taken as is : CR, LF, empty lines and "OK" are part of it
+        if (GL_AtRawDataNb_UI > 0) {
+            GL_AtRawDataNb_UI--;
+            CollectAtRawData(c);
+            continue;
+        }
+
+        if (c == 0x0D)
+            continue;
+
+        if (GL_AtSkipPromptSpace_B) {
+            GL_AtSkipPromptSpace_B = false;
+            if (c == ' ')
+                continue;
+        }
+
+        // Prompt for the payload (not terminated by an end of line)
+        if ((c == '>') && (GL_AtLineLength_UI == 0) && (pRequest_X != NULL) && (pRequest_X->Status_E == FONA_MODULE_AT_STS_WAITING) &&
+            (pRequest_X->pPayload_UB != NULL) && !(pRequest_X->PromptReceived_B)) {
+            pRequest_X->PromptReceived_B = true;
+            GL_AtSkipPromptSpace_B = true;
+            continue;
+        }
+
+        if (c == 0x0A) {
+            if (GL_AtLineLength_UI > 0) {
+                GL_pAtLineBuffer_UB[GL_AtLineLength_UI] = 0;    // NULL termination
+                ProcessAtLine();
+                GL_AtLineLength_UI = 0;
+            }
+            continue;
+        }
+
+        if (GL_AtLineLength_UI < (FONA_MODULE_AT_LINE_SIZE - 1))
+            GL_pAtLineBuffer_UB[GL_AtLineLength_UI++] = c;
+    }
+
+    // Check timeout of current request (could have been completed by a received line)
+    if (GL_AtHeadTicket_UL != GL_AtNextTicket_UL) {
+        pRequest_X = &GL_pAtQueue_X[GL_AtHeadTicket_UL & (FONA_MODULE_AT_QUEUE_SIZE - 1)];
+
+        if (((pRequest_X->Status_E == FONA_MODULE_AT_STS_SENDING) || (pRequest_X->Status_E == FONA_MODULE_AT_STS_WAITING)) &&
+            ((millis() - pRequest_X->StartTime_UL) >= pRequest_X->TimeoutMs_UL)) {
+            CompleteAtRequest(pRequest_X, FONA_MODULE_AT_STS_TIMEOUT);
+        }
+    }
+}
+
+
+unsigned long FonaModule::requestAt(const char * pCommand_UB, unsigned long TimeoutMs_UL, const char * pInfoPrefix_UB, const char * pFinal_UB, FONA_MODULE_AT_CALLBACK pFctCallback, boolean Chained_B) {
+
+    FONA_MODULE_AT_REQUEST_STRUCT * pRequest_X;
+
+    if ((GL_AtNextTicket_UL - GL_AtHeadTicket_UL) >= FONA_MODULE_AT_QUEUE_SIZE) {
+        DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "AT queue full -> request discarded !");
+        return 0;
+    }
+
+    if ((pCommand_UB != NULL) && (strlen(pCommand_UB) >= FONA_MODULE_AT_COMMAND_SIZE)) {
+        DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "AT command too long -> request discarded !");
+        return 0;
+    }
+
+    pRequest_X = &GL_pAtQueue_X[GL_AtNextTicket_UL & (FONA_MODULE_AT_QUEUE_SIZE - 1)];
+
+    pRequest_X->Ticket_UL = GL_AtNextTicket_UL;
+    pRequest_X->Status_E = FONA_MODULE_AT_STS_QUEUED;
+    pRequest_X->FromStaging_B = (pCommand_UB == NULL);
+    pRequest_X->RawData_B = false;
+    pRequest_X->pCommand_UB[0] = 0;
+    if (pCommand_UB != NULL)
+        strcpy(pRequest_X->pCommand_UB, pCommand_UB);
+    pRequest_X->Chained_B = Chained_B;
+    pRequest_X->ChainBroken_B = false;
+    pRequest_X->pFinal_UB = pFinal_UB;
+    pRequest_X->pInfoPrefix_UB = pInfoPrefix_UB;
+    pRequest_X->FinalReceived_B = false;
+    pRequest_X->InfoReceived_B = false;
+    pRequest_X->TimeoutMs_UL = TimeoutMs_UL;
+    pRequest_X->StartTime_UL = millis();
+    pRequest_X->TxIndex_UI = 0;
+    pRequest_X->ResponseLength_UI = 0;
+    pRequest_X->pResponse_UB[0] = 0;
+    pRequest_X->pPayload_UB = NULL;
+    pRequest_X->PayloadLength_UI = 0;
+    pRequest_X->PayloadIndex_UI = 0;
+    pRequest_X->PromptReceived_B = false;
+    pRequest_X->pFctCallback = pFctCallback;
+
+    // Previous request already completed -> its status is known now (otherwise given on its completion)
+    if ((GetAtRequest(GL_AtNextTicket_UL - 1) != NULL) && !isAtPending(GL_AtNextTicket_UL - 1))
+        pRequest_X->ChainBroken_B = (getAtStatus(GL_AtNextTicket_UL - 1) != FONA_MODULE_AT_STS_OK);
+
+    return GL_AtNextTicket_UL++;
+}
+
+// Payload must stay valid until the request is completed
+unsigned long FonaModule::requestAtPayload(const char * pCommand_UB, const unsigned char * pPayload_UB, unsigned int PayloadLength_UI, unsigned long TimeoutMs_UL, const char * pFinal_UB, FONA_MODULE_AT_CALLBACK pFctCallback) {
+
+    unsigned long Ticket_UL = requestAt(pCommand_UB, TimeoutMs_UL, NULL, pFinal_UB, pFctCallback);
+    FONA_MODULE_AT_REQUEST_STRUCT * pRequest_X = GetAtRequest(Ticket_UL);
+
+    if (pRequest_X != NULL) {
+        pRequest_X->pPayload_UB = pPayload_UB;
+        pRequest_X->PayloadLength_UI = PayloadLength_UI;
+    }
+
+    return Ticket_UL;
+}
+
+void FonaModule::setUrcCallback(FONA_MODULE_URC_CALLBACK pFctUrcCallback) {
+    GL_pFctAtUrcCallback = pFctUrcCallback;
+}
+
+unsigned long FonaModule::requestStagedAt(unsigned long TimeoutMs_UL, const char * pInfoPrefix_UB, const char * pFinal_UB, FONA_MODULE_AT_CALLBACK pFctCallback, boolean Chained_B) {
+
+    if (GL_AtStagingTicket_UL != 0) {
+        DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "Staging buffer already in use -> request discarded !");
+        return 0;
+    }
+
+    if (GL_AtStagingOverflow_B) {
+        DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "Staged AT command too long -> request discarded !");
+        return 0;
+    }
+
+    GL_AtStagingTicket_UL = requestAt(NULL, TimeoutMs_UL, pInfoPrefix_UB, pFinal_UB, pFctCallback, Chained_B);
+    return GL_AtStagingTicket_UL;
+}
+
+
+FONA_MODULE_AT_STS_ENUM FonaModule::getAtStatus(unsigned long Ticket_UL) {
+    FONA_MODULE_AT_REQUEST_STRUCT * pRequest_X = GetAtRequest(Ticket_UL);
+    return ((pRequest_X != NULL) ? pRequest_X->Status_E : FONA_MODULE_AT_STS_FREE);
+}
+
+const char * FonaModule::getAtResponse(unsigned long Ticket_UL) {
+    FONA_MODULE_AT_REQUEST_STRUCT * pRequest_X = GetAtRequest(Ticket_UL);
+    return ((pRequest_X != NULL) ? pRequest_X->pResponse_UB : "");
+}
+
+boolean FonaModule::isAtPending(unsigned long Ticket_UL) {
+    switch (getAtStatus(Ticket_UL)) {
+    case FONA_MODULE_AT_STS_QUEUED:
+    case FONA_MODULE_AT_STS_SENDING:
+    case FONA_MODULE_AT_STS_WAITING:
+        return true;
+    default:
+        return false;
+    }
+}
+
+boolean FonaModule::isAtBusy(void) {
+    return (GL_AtHeadTicket_UL != GL_AtNextTicket_UL);
+}
+
+void FonaModule::abortAtRequests(void) {
+
+    // Discard all pending requests (callbacks are not called)
+    while (GL_AtHeadTicket_UL != GL_AtNextTicket_UL) {
+        GL_pAtQueue_X[GL_AtHeadTicket_UL & (FONA_MODULE_AT_QUEUE_SIZE - 1)].Status_E = FONA_MODULE_AT_STS_ABORTED;
+        GL_AtHeadTicket_UL++;
+    }
+
+    GL_AtStagingTicket_UL = 0;
+    GL_AtLineLength_UI = 0;
+    GL_AtSkipPromptSpace_B = false;
+    GL_AtRawDataNb_UI = 0;
+
+    // Flush input
+    if (GL_FonaModuleParam_X.IsInitialized_B) {
+        while (GL_pFonaSerial_H->available())
+            GL_pFonaSerial_H->read();
+    }
+}
+
+
+boolean FonaModule::stageAtCommand(const char * pData_UB) {
+
+    if (GL_AtStagingTicket_UL != 0) {
+        DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "Staging buffer already in use !");
+        return false;
+    }
+
+    GL_AtStagingLength_UI = 0;
+    GL_AtStagingOverflow_B = false;
+    GL_pAtStagingBuffer_UB[0] = 0;
+    AppendStaging(pData_UB);
+
+    return true;
+}
+
+void FonaModule::stageAtData(int Data_SI, boolean Quoted_B) {
+    char pValue_UB[12];
+    sprintf(pValue_UB, "%d", Data_SI);
+    stageAtData((const char *)(pValue_UB), Quoted_B);
+}
+
+void FonaModule::stageAtData(char Data_UB, boolean Quoted_B) {
+    char pValue_UB[2] = { Data_UB, 0 };
+    stageAtData((const char *)(pValue_UB), Quoted_B);
+}
+
+void FonaModule::stageAtData(unsigned long Data_UL, boolean Quoted_B) {
+    char pValue_UB[12];
+    sprintf(pValue_UB, "%lu", Data_UL);
+    stageAtData((const char *)(pValue_UB), Quoted_B);
+}
+
+void FonaModule::stageAtData(const char * pData_UB, boolean Quoted_B) {
+    if (Quoted_B) AppendStaging("\"");
+    AppendStaging(pData_UB);
+    if (Quoted_B) AppendStaging("\"");
+}
+
+void FonaModule::stageAtData(String Data_Str, boolean Quoted_B) {
+    stageAtData(Data_Str.c_str(), Quoted_B);
+}
+
+
+unsigned long FonaModule::requestHttpParam(FONA_MODULE_HTTP_PARAM_ENUM Param_E, int Value_SI, FONA_MODULE_AT_CALLBACK pFctCallback) {
+    char pCommand_UB[FONA_MODULE_AT_COMMAND_SIZE];
+
+    DBG_PRINT(DEBUG_SEVERITY_INFO, "Request HTTP Parameters Value (int) : ");
+    DBG_PRINTDATA(GL_pFonaModuleHttpParam_Str[Param_E]);
+    DBG_PRINTDATA(",");
+    DBG_PRINTDATA(Value_SI);
+    DBG_ENDSTR();
+
+    snprintf(pCommand_UB, FONA_MODULE_AT_COMMAND_SIZE, "AT+HTTPPARA=\"%s\",%d", GL_pFonaModuleHttpParam_Str[Param_E].c_str(), Value_SI);
+    return requestAt(pCommand_UB, FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, NULL, "OK", pFctCallback);
+}
+
+unsigned long FonaModule::requestHttpParam(FONA_MODULE_HTTP_PARAM_ENUM Param_E, const char * pParamValue_UB, FONA_MODULE_AT_CALLBACK pFctCallback) {
+    char pCommand_UB[FONA_MODULE_AT_COMMAND_SIZE];
+
+    DBG_PRINT(DEBUG_SEVERITY_INFO, "Request HTTP Parameters Value (char array) : ");
+    DBG_PRINTDATA(GL_pFonaModuleHttpParam_Str[Param_E]);
+    DBG_PRINTDATA(",");
+    DBG_PRINTDATA(pParamValue_UB);
+    DBG_ENDSTR();
+
+    if (snprintf(pCommand_UB, FONA_MODULE_AT_COMMAND_SIZE, "AT+HTTPPARA=\"%s\",\"%s\"", GL_pFonaModuleHttpParam_Str[Param_E].c_str(), pParamValue_UB) >= FONA_MODULE_AT_COMMAND_SIZE) {
+        DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "HTTP Parameter too long -> use staging functions !");
+        return 0;
+    }
+
+    return requestAt(pCommand_UB, FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, NULL, "OK", pFctCallback);
+}
+
+boolean FonaModule::stageHttpParam(FONA_MODULE_HTTP_PARAM_ENUM Param_E) {
+    if (!stageAtCommand("AT+HTTPPARA="))
+        return false;
+
+    stageAtData(GL_pFonaModuleHttpParam_Str[Param_E], true);   // Quoted Param Identifier
+    stageAtData(',');
+    return true;
+}
+
+unsigned long FonaModule::requestStagedHttpParam(FONA_MODULE_AT_CALLBACK pFctCallback) {
+    DBG_PRINT(DEBUG_SEVERITY_INFO, "Request staged HTTP Parameter (");
+    DBG_PRINTDATA(GL_AtStagingLength_UI);
+    DBG_PRINTDATA(" chars)");
+    DBG_ENDSTR();
+    return requestStagedAt(FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, NULL, "OK", pFctCallback);
+}
+
+boolean FonaModule::stageHttpData(void) {
+    return stageAtCommand("");
+}
+
+// Announces the size of the staged data : the data is sent by requestStagedHttpData() once DOWNLOAD is received
+unsigned long FonaModule::requestHttpData(FONA_MODULE_AT_CALLBACK pFctCallback) {
+    char pCommand_UB[FONA_MODULE_AT_COMMAND_SIZE];
+
+    DBG_PRINT(DEBUG_SEVERITY_INFO, "Request HTTP Data (");
+    DBG_PRINTDATA(GL_AtStagingLength_UI);
+    DBG_PRINTDATA(" chars)");
+    DBG_ENDSTR();
+
+    if ((GL_AtStagingTicket_UL != 0) || GL_AtStagingOverflow_B) {
+        DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "Staged HTTP Data not valid -> request discarded !");
+        return 0;
+    }
+
+    sprintf(pCommand_UB, "AT+HTTPDATA=%u,%lu", GL_AtStagingLength_UI, (unsigned long)FONA_MODULE_HTTP_DATA_TIMEOUT_MS);
+    return requestAt(pCommand_UB, FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, NULL, "DOWNLOAD", pFctCallback);
+}
+
+// Exactly the announced number of bytes is sent (no CR LF) - the module answers OK once all of them are received
+unsigned long FonaModule::requestStagedHttpData(FONA_MODULE_AT_CALLBACK pFctCallback) {
+    FONA_MODULE_AT_REQUEST_STRUCT * pRequest_X;
+    unsigned long Ticket_UL = requestStagedAt(FONA_MODULE_HTTP_DATA_TIMEOUT_MS, NULL, "OK", pFctCallback);
+
+    if ((pRequest_X = GetAtRequest(Ticket_UL)) != NULL)
+        pRequest_X->RawData_B = true;
+
+    return Ticket_UL;
+}
+
+unsigned long FonaModule::requestHttpAction(FONA_MODULE_HTTP_ACTION_ENUM Action_E, FONA_MODULE_AT_CALLBACK pFctCallback, boolean Chained_B) {
+    char pCommand_UB[FONA_MODULE_AT_COMMAND_SIZE];
+
+    DBG_PRINT(DEBUG_SEVERITY_INFO, "Request HTTP Mehod Action : ");
+    DBG_PRINTDATA(GL_pFonaModuleHttpAction_Str[Action_E]);
+    DBG_ENDSTR();
+
+    sprintf(pCommand_UB, "AT+HTTPACTION=%d", (int)(Action_E));
+    return requestAt(pCommand_UB, FONA_MODULE_HTTP_ACTION_TIMEOUT_MS, "+HTTPACTION: ", "OK", pFctCallback, Chained_B);   // Should reply OK then +HTTPACTION: 0,302,14
+}
+
+unsigned long FonaModule::requestHttpRead(FONA_MODULE_AT_CALLBACK pFctCallback) {
+    DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Request the HTTP Server Response (all data present)");
+    return requestAt("AT+HTTPREAD", FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, "+HTTPREAD: ", "OK", pFctCallback);
+}
+
+
+signed int FonaModule::parseSignalStrength(const char * pResponse_UB) {
+
+    int RawValue_SI = 0;
+
+    // Response should be : +CSQ: rssi,ber
+    if (!parseResponse(pResponse_UB, "+CSQ: ", &RawValue_SI, ',', 0))
+        return 0;
+
+    if (RawValue_SI == 0) {
+        return -115;
+    }
+    else if (RawValue_SI == 1) {
+        return -111;
+    }
+    else if ((RawValue_SI >= 2) && (RawValue_SI <= 30)) {
+        return ((RawValue_SI << 1) - 114);
+    }
+    else if (RawValue_SI == 31) {
+        return -52;
+    }
+    else {
+        return 0;    // Error
+    }
+}
+
+unsigned int FonaModule::parseBatteryLevel(const char * pResponse_UB) {
+
+    int Level_SI = 0;
+
+    // Response should be : +CBC: 0,64,3916
+    if (!parseResponse(pResponse_UB, "+CBC: ", &Level_SI, ',', 1))
+        return 0;
+
+    return Level_SI;
+}
+
+boolean FonaModule::parseGprsState(const char * pResponse_UB) {
+
+    int State_SI = 0;
+
+    // Response should be : +CGATT: state
+    if (!parseResponse(pResponse_UB, "+CGATT: ", &State_SI, ',', 0))
+        return false;
+
+    return (State_SI == 1);
+}
+
+boolean FonaModule::parseNetworkStatus(const char * pResponse_UB, int * pStatus_SI) {
+
+    // Response should be : +CREG: n,stat
+    return parseResponse(pResponse_UB, "+CREG: ", pStatus_SI, ',', 1);
+}
+
+boolean FonaModule::parseHttpAction(const char * pResponse_UB, int * pServerResponse_SI, int * pDataSize_SI) {
+
+    // Response should be : +HTTPACTION: method,status,length
+    if (!parseResponse(pResponse_UB, "+HTTPACTION: ", pServerResponse_SI, ',', 1))
+        return false;
+    if (!parseResponse(pResponse_UB, "+HTTPACTION: ", pDataSize_SI, ',', 2))
+        return false;
+
+    return true;
+}
+
+int FonaModule::parseHttpRead(const char * pResponse_UB, char * pData_UB) {
+
+    int DataLength_SI = 0;
+    const char * p;
+
+    // Response should be : +HTTPREAD: length\ndata
+    if (!parseResponse(pResponse_UB, "+HTTPREAD: ", &DataLength_SI, ',', 0))
+        return 0;
+
+    p = strchr(strstr(pResponse_UB, "+HTTPREAD: "), '\n');
+    if (p == NULL)
+        return 0;
+    p++;    // Data start right after the line separator
+
+    for (int i = 0; i < DataLength_SI; i++) {
+        if (p[i] == 0) {
+            DataLength_SI = i;
+            break;
+        }
+        pData_UB[i] = p[i];
+    }
+
+    return DataLength_SI;
+}
+
+
+/* ******************************************************************************** */
+/* Internal Functions
+/* ******************************************************************************** */
+
+FONA_MODULE_AT_REQUEST_STRUCT * GetAtRequest(unsigned long Ticket_UL) {
+    FONA_MODULE_AT_REQUEST_STRUCT * pRequest_X = &GL_pAtQueue_X[Ticket_UL & (FONA_MODULE_AT_QUEUE_SIZE - 1)];
+
+    // Slot may have been re-used by a more recent request
+    if ((Ticket_UL == 0) || (pRequest_X->Ticket_UL != Ticket_UL))
+        return NULL;
+
+    return pRequest_X;
+}
+
+void ProcessAtLine(void) {
+
+    FONA_MODULE_AT_REQUEST_STRUCT * pRequest_X = NULL;
+    unsigned int Length_UI = 0;
+
+    // Unsolicited result code handled by the owner of the callback
+    if ((GL_pFctAtUrcCallback != NULL) && GL_pFctAtUrcCallback(GL_pAtLineBuffer_UB))
+        return;
+
+    if (GL_AtHeadTicket_UL != GL_AtNextTicket_UL)
+        pRequest_X = &GL_pAtQueue_X[GL_AtHeadTicket_UL & (FONA_MODULE_AT_QUEUE_SIZE - 1)];
+
+    // Unsolicited line
+    if ((pRequest_X == NULL) || ((pRequest_X->Status_E != FONA_MODULE_AT_STS_SENDING) && (pRequest_X->Status_E != FONA_MODULE_AT_STS_WAITING))) {
+        DBG_PRINT(DEBUG_SEVERITY_INFO, "Unsolicited line : ");
+        DBG_PRINTDATA(GL_pAtLineBuffer_UB);
+        DBG_ENDSTR();
+        return;
+    }
+
+    // Final response
+    if (strcmp(GL_pAtLineBuffer_UB, pRequest_X->pFinal_UB) == 0) {
+        pRequest_X->FinalReceived_B = true;
+    }
+    else if ((strcmp(GL_pAtLineBuffer_UB, "ERROR") == 0) || (strncmp(GL_pAtLineBuffer_UB, "+CME ERROR", 10) == 0)) {
+        CompleteAtRequest(pRequest_X, FONA_MODULE_AT_STS_ERROR);
+        return;
+    }
+    else {
+        // Information line
+        if ((pRequest_X->pInfoPrefix_UB != NULL) && (strncmp(GL_pAtLineBuffer_UB, pRequest_X->pInfoPrefix_UB, strlen(pRequest_X->pInfoPrefix_UB)) == 0))
+            pRequest_X->InfoReceived_B = true;
+
+        // Collect line in the response (lines separated by '\n', truncated if too long)
+        if ((pRequest_X->ResponseLength_UI > 0) && (pRequest_X->ResponseLength_UI < (FONA_MODULE_AT_RESPONSE_SIZE - 1)))
+            pRequest_X->pResponse_UB[pRequest_X->ResponseLength_UI++] = '\n';
+
+        Length_UI = strlen(GL_pAtLineBuffer_UB);
+        if (Length_UI > (FONA_MODULE_AT_RESPONSE_SIZE - 1 - pRequest_X->ResponseLength_UI))
+            Length_UI = FONA_MODULE_AT_RESPONSE_SIZE - 1 - pRequest_X->ResponseLength_UI;
+
+        memcpy(&(pRequest_X->pResponse_UB[pRequest_X->ResponseLength_UI]), GL_pAtLineBuffer_UB, Length_UI);
+        pRequest_X->ResponseLength_UI += Length_UI;
+        pRequest_X->pResponse_UB[pRequest_X->ResponseLength_UI] = 0;   // NULL termination
+
+        // The body of the HTTP response follows : <length> bytes, not lines
+        if (strncmp(GL_pAtLineBuffer_UB, "+HTTPREAD: ", 11) == 0) {
+            GL_AtRawDataNb_UI = atoi(&(GL_pAtLineBuffer_UB[11]));
+            CollectAtRawData('\n');
+        }
+    }
+
+    // Completion (final response and information line if required, in any order)
+    if (pRequest_X->FinalReceived_B && ((pRequest_X->pInfoPrefix_UB == NULL) || pRequest_X->InfoReceived_B))
+        CompleteAtRequest(pRequest_X, FONA_MODULE_AT_STS_OK);
+}
+
+// Byte added to the response of the current request (truncated if too long)
+void CollectAtRawData(char Data_UB) {
+
+    FONA_MODULE_AT_REQUEST_STRUCT * pRequest_X;
+
+    if (GL_AtHeadTicket_UL == GL_AtNextTicket_UL)
+        return;
+
+    pRequest_X = &GL_pAtQueue_X[GL_AtHeadTicket_UL & (FONA_MODULE_AT_QUEUE_SIZE - 1)];
+    if ((pRequest_X->Status_E != FONA_MODULE_AT_STS_SENDING) && (pRequest_X->Status_E != FONA_MODULE_AT_STS_WAITING))
+        return;
+
+    if (pRequest_X->ResponseLength_UI < (FONA_MODULE_AT_RESPONSE_SIZE - 1)) {
+        pRequest_X->pResponse_UB[pRequest_X->ResponseLength_UI++] = Data_UB;
+        pRequest_X->pResponse_UB[pRequest_X->ResponseLength_UI] = 0;   // NULL termination
+    }
+}
+
+void CompleteAtRequest(FONA_MODULE_AT_REQUEST_STRUCT * pRequest_X, FONA_MODULE_AT_STS_ENUM Status_E) {
+
+    pRequest_X->Status_E = Status_E;
+
+    if (Status_E != FONA_MODULE_AT_STS_OK) {
+        DBG_PRINT(DEBUG_SEVERITY_WARNING, "AT request failed (");
+        DBG_PRINTDATA(Status_E);
+        DBG_PRINTDATA(") : ");
+        DBG_PRINTDATA((pRequest_X->FromStaging_B) ? "<staged command>" : pRequest_X->pCommand_UB);
+        DBG_ENDSTR();
+    }
+
+    if (pRequest_X->FromStaging_B)
+        GL_AtStagingTicket_UL = 0;  // Staging buffer available again
+
+    GL_AtRawDataNb_UI = 0;
+
+    GL_AtLastCompletionTime_UL = millis();
+    GL_AtHeadTicket_UL++;
+
+    // Status given to the next request (if chained, it is aborted when started)
+    if (GL_AtHeadTicket_UL != GL_AtNextTicket_UL)
+        GL_pAtQueue_X[GL_AtHeadTicket_UL & (FONA_MODULE_AT_QUEUE_SIZE - 1)].ChainBroken_B = (Status_E != FONA_MODULE_AT_STS_OK);
+
+    // Callback is called last so that it can queue new requests
+    if (pRequest_X->pFctCallback != NULL)
+        pRequest_X->pFctCallback(Status_E, pRequest_X->pResponse_UB);
+}
+
+void AppendStaging(const char * pData_UB) {
+    unsigned int Length_UI = strlen(pData_UB);
+
+    // Staged command already queued -> must not be modified
+    if (GL_AtStagingTicket_UL != 0)
+        return;
+
+    if ((GL_AtStagingLength_UI + Length_UI) >= FONA_MODULE_AT_STAGING_SIZE) {
+        GL_AtStagingOverflow_B = true;
+        return;
+    }
+
+    memcpy(&(GL_pAtStagingBuffer_UB[GL_AtStagingLength_UI]), pData_UB, Length_UI);
+    GL_AtStagingLength_UI += Length_UI;
+    GL_pAtStagingBuffer_UB[GL_AtStagingLength_UI] = 0;
+}
@@ -8,6 +8,7 @@
 /*		external GSM module through Serial communication.       					*/
 /*                                                                                  */
 /* History :	25/05/2017	(RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Add URC hook and payload requests ('>' prompt)	*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -26,6 +27,16 @@
 
 #define FONA_MODULE_DEFAULT_BAUDRATE    4800UL
 
+// Asynchronous AT engine
+#define FONA_MODULE_AT_QUEUE_SIZE           8       // Number of requests that can be queued (must be a power of 2)
+#define FONA_MODULE_AT_COMMAND_SIZE         96      // Maximum length of a queued AT command
+#define FONA_MODULE_AT_RESPONSE_SIZE        256     // Maximum length of the collected response of a request
+#define FONA_MODULE_AT_LINE_SIZE            256     // Maximum length of a line received from the module
+#define FONA_MODULE_AT_STAGING_SIZE         1024    // Maximum length of a staged (long) AT command
+#define FONA_MODULE_AT_DEFAULT_TIMEOUT_MS   1000
+#define FONA_MODULE_AT_GUARD_TIME_MS        5       // Minimum time between the end of a request and the next command
+#define FONA_MODULE_AT_MAX_RX_PER_PROCESS   64      // Maximum bytes handled per call to process()
+
 /* ******************************************************************************** */
 /* Structure & Enumeration
 /* ******************************************************************************** */
@@ -39,6 +50,45 @@ typedef struct {
     char pPinCode_UB[4];
 } FONA_MODULE_PARAM;
 
+
+typedef enum {
+    FONA_MODULE_AT_STS_FREE = 0,        // Unknown ticket (never queued or slot re-used)
+    FONA_MODULE_AT_STS_QUEUED,          // Waiting in the queue
+    FONA_MODULE_AT_STS_SENDING,         // Command being sent to the module
+    FONA_MODULE_AT_STS_WAITING,         // Command sent, waiting for the final response
+    FONA_MODULE_AT_STS_OK,              // Final response received
+    FONA_MODULE_AT_STS_ERROR,           // ERROR received from the module
+    FONA_MODULE_AT_STS_TIMEOUT,         // No final response within the timeout
+    FONA_MODULE_AT_STS_ABORTED          // Request discarded (queue aborted or previous chained request failed)
+} FONA_MODULE_AT_STS_ENUM;
+
+typedef void(*FONA_MODULE_AT_CALLBACK)(FONA_MODULE_AT_STS_ENUM Status_E, const char * pResponse_UB);
+typedef boolean(*FONA_MODULE_URC_CALLBACK)(const char * pLine_UB);     // Returns true if the line is consumed
+
+typedef struct {
+    unsigned long Ticket_UL;
+    FONA_MODULE_AT_STS_ENUM Status_E;
+    char pCommand_UB[FONA_MODULE_AT_COMMAND_SIZE];
+    boolean FromStaging_B;              // Command is taken from the staging buffer
+    boolean RawData_B;                  // Command sent as is, without CR LF (e.g. data after the DOWNLOAD prompt)
+    boolean Chained_B;                  // Request aborted if the previous one failed
+    boolean ChainBroken_B;              // Previous request (queued just before) failed -> set on its completion
+    const char * pFinal_UB;             // Final response on success ("OK" by default)
+    const char * pInfoPrefix_UB;        // Information line required before completion (NULL if none)
+    boolean FinalReceived_B;
+    boolean InfoReceived_B;
+    unsigned long TimeoutMs_UL;
+    unsigned long StartTime_UL;
+    unsigned int TxIndex_UI;
+    unsigned int ResponseLength_UI;
+    char pResponse_UB[FONA_MODULE_AT_RESPONSE_SIZE];    // Intermediate lines, separated by '\n'
+    const unsigned char * pPayload_UB;  // Data sent after the '>' prompt (NULL if none) - owned by the caller
+    unsigned int PayloadLength_UI;
+    unsigned int PayloadIndex_UI;
+    boolean PromptReceived_B;
+    FONA_MODULE_AT_CALLBACK pFctCallback;
+} FONA_MODULE_AT_REQUEST_STRUCT;
+
 const String GL_pFonaModuleApn_Str[] = { "mworld.be", "internet.proximus.be", "publicip.m2mmobi.be", "standard.m2mmobi.be" };
 const String GL_FonaModuleUserAgent_Str = "WLINK";
 
@@ -128,8 +178,8 @@ public:
 
     boolean checkAtResponse(char * pData_UB);
     boolean checkAtResponse(String Data_Str);
-    boolean parseResponse(char * pBuffer_UB, char * pPrefix_UB, int * pValue_SI, char Token_UB = ',', unsigned int Index_UI = 0);
-    boolean parseResponse(char * pBuffer_UB, String Prefix_Str, int * pValue_SI, char Token_UB = ',', unsigned int Index_UI = 0);
+    boolean parseResponse(const char * pBuffer_UB, const char * pPrefix_UB, int * pValue_SI, char Token_UB = ',', unsigned int Index_UI = 0);
+    boolean parseResponse(const char * pBuffer_UB, String Prefix_Str, int * pValue_SI, char Token_UB = ',', unsigned int Index_UI = 0);
     boolean begin(void);
 
 
@@ -162,6 +212,43 @@ public:
     boolean httpRead(char * pData_UB, unsigned long StartAddr_UL, unsigned long DataLength_UL);
 
 
+    // Asynchronous AT engine
+    void process(void);
+    unsigned long requestAt(const char * pCommand_UB, unsigned long TimeoutMs_UL = FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, const char * pInfoPrefix_UB = NULL, const char * pFinal_UB = "OK", FONA_MODULE_AT_CALLBACK pFctCallback = NULL, boolean Chained_B = false);
+    unsigned long requestStagedAt(unsigned long TimeoutMs_UL = FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, const char * pInfoPrefix_UB = NULL, const char * pFinal_UB = "OK", FONA_MODULE_AT_CALLBACK pFctCallback = NULL, boolean Chained_B = false);
+    unsigned long requestAtPayload(const char * pCommand_UB, const unsigned char * pPayload_UB, unsigned int PayloadLength_UI, unsigned long TimeoutMs_UL, const char * pFinal_UB, FONA_MODULE_AT_CALLBACK pFctCallback = NULL);
+    void setUrcCallback(FONA_MODULE_URC_CALLBACK pFctUrcCallback);
+    FONA_MODULE_AT_STS_ENUM getAtStatus(unsigned long Ticket_UL);
+    const char * getAtResponse(unsigned long Ticket_UL);
+    boolean isAtPending(unsigned long Ticket_UL);
+    boolean isAtBusy(void);
+    void abortAtRequests(void);
+
+    boolean stageAtCommand(const char * pData_UB);
+    void stageAtData(int Data_SI, boolean Quoted_B = false);
+    void stageAtData(char Data_UB, boolean Quoted_B = false);
+    void stageAtData(unsigned long Data_UL, boolean Quoted_B = false);
+    void stageAtData(const char * pData_UB, boolean Quoted_B = false);
+    void stageAtData(String Data_Str, boolean Quoted_B = false);
+
+    unsigned long requestHttpParam(FONA_MODULE_HTTP_PARAM_ENUM Param_E, int Value_SI, FONA_MODULE_AT_CALLBACK pFctCallback = NULL);
+    unsigned long requestHttpParam(FONA_MODULE_HTTP_PARAM_ENUM Param_E, const char * pParamValue_UB, FONA_MODULE_AT_CALLBACK pFctCallback = NULL);
+    boolean stageHttpParam(FONA_MODULE_HTTP_PARAM_ENUM Param_E);
+    unsigned long requestStagedHttpParam(FONA_MODULE_AT_CALLBACK pFctCallback = NULL);
+    boolean stageHttpData(void);
+    unsigned long requestHttpData(FONA_MODULE_AT_CALLBACK pFctCallback = NULL);
+    unsigned long requestStagedHttpData(FONA_MODULE_AT_CALLBACK pFctCallback = NULL);
+    unsigned long requestHttpAction(FONA_MODULE_HTTP_ACTION_ENUM Action_E, FONA_MODULE_AT_CALLBACK pFctCallback = NULL, boolean Chained_B = true);
+    unsigned long requestHttpRead(FONA_MODULE_AT_CALLBACK pFctCallback = NULL);
+
+    signed int parseSignalStrength(const char * pResponse_UB);
+    unsigned int parseBatteryLevel(const char * pResponse_UB);
+    boolean parseGprsState(const char * pResponse_UB);
+    boolean parseNetworkStatus(const char * pResponse_UB, int * pStatus_SI);
+    boolean parseHttpAction(const char * pResponse_UB, int * pServerResponse_SI, int * pDataSize_SI);
+    int parseHttpRead(const char * pResponse_UB, char * pData_UB);
+
+
     FONA_MODULE_PARAM GL_FonaModuleParam_X;
 };
 
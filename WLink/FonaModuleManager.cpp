@@ -6,6 +6,7 @@
 /*		Describes the state machine to manage the Fona Module object				*/
 /*                                                                                  */
 /* History :  	17/07/2017  (RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Publish the GPRS state on the Event Bus			*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -16,8 +17,10 @@
 /* ******************************************************************************** */
 
 #include "FonaModuleManager.h"
+#include "EventBus.h"
 
 #include "Debug.h"
+#include "LoopProfiler.h"
 
 /* ******************************************************************************** */
 /* Define
@@ -27,6 +30,7 @@
 #define FONA_MODULE_MANAGER_RESET_PULSE_LENGTH_MS				100
 #define FONA_MODULE_MANAGER_NETWORK_REGISTRATION_TIMEOUT_MS		20000
 #define FONA_MODULE_MANAGER_POLLING_INTERVAL_MS					2000
+#define FONA_MODULE_MANAGER_REGISTRATION_POLLING_MS				1000
 
 
 /* ******************************************************************************** */
@@ -62,6 +66,42 @@ static boolean GL_FonaModuleManagerEnabled_B = false;
 static boolean GL_FonaModuleManagerEnableGprs_B = false;
 static boolean GL_FonaModuleManagerEnableStatusPolling_B = false;
 static unsigned long GL_FonaModuleManagerPollingIndex_UL = 0;
+static unsigned long GL_FonaPollingTime_UL = 0;
+
+static unsigned long GL_FonaAtTicket_UL = 0;            // Ticket of the current AT request (0 = none)
+static unsigned long GL_FonaAtStepIdx_UL = 0;           // Current step in the AT sequence
+static char GL_pFonaAtCommand_UB[FONA_MODULE_AT_COMMAND_SIZE];
+
+// Step of an AT sequence ('%s' in the command is replaced by the APN)
+typedef struct {
+    const char * pCommand_UB;
+    const char * pFinal_UB;
+    unsigned long TimeoutMs_UL;
+    boolean IgnoreError_B;
+    const char * pDescr_UB;
+} FONA_MODULE_MANAGER_AT_STEP_STRUCT;
+
+static const FONA_MODULE_MANAGER_AT_STEP_STRUCT GL_pFonaBeginSequence_X[] = {
+    { "AT",                                 "OK",       1000,   true,   "Open Communication with AT" },     // Flush communication (auto-baud)
+    { "AT",                                 "OK",       1000,   false,  "Open Communication with AT" },
+    { "ATZ",                                "OK",       1000,   false,  "Reset Factory settings.." },
+    { "ATE0",                               "OK",       1000,   false,  "Turn off echo.." },
+    { "ATI",                                "OK",       1000,   false,  "Get module information.." },
+    { "AT+GSN",                             "OK",       1000,   false,  "Get IMEI.." },
+    { "AT",                                 "OK",       1000,   false,  "Send last 'AT'.." }
+};
+
+static const FONA_MODULE_MANAGER_AT_STEP_STRUCT GL_pFonaEnableGprsSequence_X[] = {
+    { "AT+CIPSHUT",                         "SHUT OK",  20000,  false,  "Disconnect all Sockets" },
+    { "AT+CIPMUX=1",                        "OK",       1000,   false,  "Enable Multi-Connection" },            // Required by the GSM Server (AT+CIPSERVER)
+    { "AT+CGATT=1",                         "OK",       10000,  false,  "Attach to GPRS Service" },                     // 1 = Attach
+    { "AT+SAPBR=3,1,\"CONTYPE\",\"GPRS\"",    "OK",       10000,  false,  "Configure Bearer Profile - Type GPRS" },       // 3 = Configure Bearer, 1 = Bearer Profile Identifier
+    { "AT+SAPBR=3,1,\"APN\",\"%s\"",          "OK",       10000,  false,  "Configure Bearer Profile - APN" },
+    { "AT+CSTT=\"%s\"",                     "OK",       10000,  false,  "Start Task and Set APN" },
+    { "AT+SAPBR=1,1",                       "OK",       30000,  false,  "Open Bearer Profile" },                        // 1 = Open Bearer, 1 = Bearer Profile Identifier
+    { "AT+SAPBR=2,1",                       "OK",       30000,  false,  "Check Bearer Status" },
+    { "AT+CIICR",                           "OK",       10000,  false,  "Bring Up Wireless Connection with GPRS" }
+};
 
 
 /* ******************************************************************************** */
@@ -80,6 +120,11 @@ static void ProcessEnableGprs(void);
 static void ProcessRunning(void);
 static void ProcessError(void);
 
+static FONA_MODULE_AT_STS_ENUM ProcessAtSequence(const FONA_MODULE_MANAGER_AT_STEP_STRUCT * pSequence_X, unsigned long SequenceNb_UL);
+static void OnSignalStrength(FONA_MODULE_AT_STS_ENUM Status_E, const char * pResponse_UB);
+static void OnGprsState(FONA_MODULE_AT_STS_ENUM Status_E, const char * pResponse_UB);
+static void SetGprsState(boolean GprsState_B);
+
 static void TransitionToIdle(void);
 static void TransitionToWaitReaction(void);
 static void TransitionToApplyPowerPulse(void);
@@ -124,7 +169,11 @@ void FonaModuleManager_Process() {
         TransitionToIdle();
     }
 
+    /* AT Engine */
+    GL_pFona_H->process();
+
     /* State Machine */
+    LOOP_PROFILER_SET_STATE(LOOP_PROFILER_ID_FONA_MODULE, GL_FonaModuleManager_CurrentState_E);
     switch (GL_FonaModuleManager_CurrentState_E) {
     case FONA_MODULE_MANAGER_IDLE:
         ProcessIdle();
@@ -266,29 +315,94 @@ void ProcessCheckPowerPin(void) {
 }
 
 void ProcessBegin(void) {
-	if (GL_pFona_H->begin()) {
+	switch (ProcessAtSequence(GL_pFonaBeginSequence_X, sizeof(GL_pFonaBeginSequence_X) / sizeof(FONA_MODULE_MANAGER_AT_STEP_STRUCT))) {
+	case FONA_MODULE_AT_STS_OK:
+		DBG_PRINTLN(DEBUG_SEVERITY_INFO, "FONA module ready for duty !");
 		GL_FonaModuleManager_NextState_E = FONA_MODULE_MANAGER_STATE::FONA_MODULE_MANAGER_UNLOCK_SIM;
 		TransitionToWaitReaction();
-	}
-	else {
+		break;
+
+	case FONA_MODULE_AT_STS_ERROR:
 		DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "Error while trying to establish/begin communication with FONA module !");
 		TransitionToError();
+		break;
+
+	default:
+		break;
 	}
 }
 
 void ProcessUnlockSim(void) {
-	if (GL_pFona_H->enterPinCode())
-		TransitiontToWaitNetworkRegistration();
-    else
-        TransitionToError();
+
+	// Send request
+	if (GL_FonaAtTicket_UL == 0) {
+		if (GL_FonaAtStepIdx_UL == 0) {
+			DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Get PIN requirement");
+			GL_FonaAtTicket_UL = GL_pFona_H->requestAt("AT+CPIN?", FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, "+CPIN: ");
+		}
+		else {
+			DBG_PRINTLN(DEBUG_SEVERITY_INFO, "PIN code requested > Send PIN ****");
+			snprintf(GL_pFonaAtCommand_UB, FONA_MODULE_AT_COMMAND_SIZE, "AT+CPIN=%.4s", GL_pFona_H->GL_FonaModuleParam_X.pPinCode_UB);
+			GL_FonaAtTicket_UL = GL_pFona_H->requestAt(GL_pFonaAtCommand_UB);
+		}
+		return;
+	}
+
+	// Wait for completion
+	if (GL_pFona_H->isAtPending(GL_FonaAtTicket_UL))
+		return;
+
+	if (GL_pFona_H->getAtStatus(GL_FonaAtTicket_UL) == FONA_MODULE_AT_STS_OK) {
+		if (GL_FonaAtStepIdx_UL == 0) {
+			if (strstr(GL_pFona_H->getAtResponse(GL_FonaAtTicket_UL), "+CPIN: READY") != NULL) {
+				DBG_PRINTLN(DEBUG_SEVERITY_INFO, "PIN code not requested");
+				TransitiontToWaitNetworkRegistration();
+			}
+			else if (strstr(GL_pFona_H->getAtResponse(GL_FonaAtTicket_UL), "+CPIN: SIM PIN") != NULL) {
+				GL_FonaAtTicket_UL = 0;
+				GL_FonaAtStepIdx_UL++;
+			}
+			else {
+				DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "Problem with PIN > Card should be unlocked by other means..");
+				TransitionToError();
+			}
+		}
+		else {
+			DBG_PRINTLN(DEBUG_SEVERITY_INFO, "PIN code entered > SIM card unlocked");
+			TransitiontToWaitNetworkRegistration();
+		}
+	}
+	else {
+		if (GL_FonaAtStepIdx_UL == 0)
+			DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "Problem with PIN > Card should be unlocked by other means..");
+		else
+			DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "Wrong PIN > SIM card still locked");
+		TransitionToError();
+	}
 }
 
 void ProcessWaitNetworkRegistration(void) {
 
-	GL_pFona_H->getNetworkStatus(&GL_NetworkStatus_SI);
-	if ((GL_NetworkStatus_SI == FONA_MODULE_NETWORK_STATUS_REGISTERED) || (GL_NetworkStatus_SI == FONA_MODULE_NETWORK_STATUS_ROAMING)) {
-		GL_FonaModuleManager_NextState_E = FONA_MODULE_MANAGER_STATE::FONA_MODULE_MANAGER_GET_BATTERY_STATE;
-		TransitionToWaitReaction();
+	// Poll Network Status
+	if (GL_FonaAtTicket_UL == 0) {
+		if ((millis() - GL_FonaPollingTime_UL) >= FONA_MODULE_MANAGER_REGISTRATION_POLLING_MS) {
+			GL_FonaPollingTime_UL = millis();
+			GL_FonaAtTicket_UL = GL_pFona_H->requestAt("AT+CREG?", FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, "+CREG: ");
+		}
+	}
+	else if (!GL_pFona_H->isAtPending(GL_FonaAtTicket_UL)) {
+		if ((GL_pFona_H->getAtStatus(GL_FonaAtTicket_UL) == FONA_MODULE_AT_STS_OK) && GL_pFona_H->parseNetworkStatus(GL_pFona_H->getAtResponse(GL_FonaAtTicket_UL), &GL_NetworkStatus_SI)) {
+			DBG_PRINT(DEBUG_SEVERITY_INFO, "Network Status = ");
+			DBG_PRINTDATA(GL_pFonaModuleNetworkStatus_Str[GL_NetworkStatus_SI % 6]);
+			DBG_ENDSTR();
+
+			if ((GL_NetworkStatus_SI == FONA_MODULE_NETWORK_STATUS_REGISTERED) || (GL_NetworkStatus_SI == FONA_MODULE_NETWORK_STATUS_ROAMING)) {
+				GL_FonaModuleManager_NextState_E = FONA_MODULE_MANAGER_STATE::FONA_MODULE_MANAGER_GET_BATTERY_STATE;
+				TransitionToWaitReaction();
+				return;
+			}
+		}
+		GL_FonaAtTicket_UL = 0;
 	}
 
 	// Timeout on registration
@@ -300,11 +414,21 @@ void ProcessWaitNetworkRegistration(void) {
 }
 
 void ProcessGetBatteryState(void) {
-	unsigned int BatteryState_UI = 0;
-	BatteryState_UI = GL_pFona_H->getBatteryLevel();
+
+	// Send request
+	if (GL_FonaAtTicket_UL == 0) {
+		GL_FonaAtTicket_UL = GL_pFona_H->requestAt("AT+CBC", FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, "+CBC: ");
+		return;
+	}
+
+	// Wait for completion
+	if (GL_pFona_H->isAtPending(GL_FonaAtTicket_UL))
+		return;
+
+	GL_FonaModuleManagerBatteryLeve_UI = GL_pFona_H->parseBatteryLevel(GL_pFona_H->getAtResponse(GL_FonaAtTicket_UL));
 
 	DBG_PRINT(DEBUG_SEVERITY_INFO, "Battery level = ");
-	DBG_PRINTDATA(BatteryState_UI);
+	DBG_PRINTDATA(GL_FonaModuleManagerBatteryLeve_UI);
 	DBG_PRINTDATA(" [%]");
 	DBG_ENDSTR();
 
@@ -317,27 +441,32 @@ void ProcessGetBatteryState(void) {
 }
 
 void ProcessEnableGprs(void) {
-	if (GL_pFona_H->enableGprs())
-		TransitionToRunning();
-	else
-		TransitionToError();
+	switch (ProcessAtSequence(GL_pFonaEnableGprsSequence_X, sizeof(GL_pFonaEnableGprsSequence_X) / sizeof(FONA_MODULE_MANAGER_AT_STEP_STRUCT))) {
+	case FONA_MODULE_AT_STS_OK:		TransitionToRunning();	break;
+	case FONA_MODULE_AT_STS_ERROR:	TransitionToError();	break;
+	default:												break;
+	}
 }
 
 void ProcessRunning(void) {
     // Keep running
 
-    // Poll Statuses
+    // Poll Statuses (results are handled by callbacks)
     if ((millis() - GL_FonaAbsoluteTime_UL) >= FONA_MODULE_MANAGER_POLLING_INTERVAL_MS) {
 
-        switch (GL_FonaModuleManagerPollingIndex_UL) {
-        case 0:	if (GL_FonaModuleManagerEnableStatusPolling_B)  GL_FonaModuleManagerRssi_SI = GL_pFona_H->getSignalStrength();		break;
-        case 1:	GL_FonaModuleManagerGprsState_B = GL_pFona_H->isGprsEnabled();		                                                break;
-//      case 2:	GL_FonaModuleManagerBatteryLeve_UI = GL_pFona_H->getBatteryLevel();	                                                break;
-        default:	break;
-        }
+        // Do not pile up polling requests behind any other request (e.g. an HTTP transaction)
+        if (!GL_pFona_H->isAtBusy()) {
+
+            switch (GL_FonaModuleManagerPollingIndex_UL) {
+            case 0:	if (GL_FonaModuleManagerEnableStatusPolling_B)  GL_FonaAtTicket_UL = GL_pFona_H->requestAt("AT+CSQ", FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, "+CSQ: ", "OK", OnSignalStrength);	break;
+            case 1:	GL_FonaAtTicket_UL = GL_pFona_H->requestAt("AT+CGATT?", FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, "+CGATT: ", "OK", OnGprsState);                                            	break;
+//          case 2:	GL_FonaAtTicket_UL = GL_pFona_H->requestAt("AT+CBC", FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, "+CBC: ");                                                                     	break;
+            default:	break;
+            }
 
-        GL_FonaModuleManagerPollingIndex_UL++;
-        GL_FonaModuleManagerPollingIndex_UL = GL_FonaModuleManagerPollingIndex_UL % 3;
+            GL_FonaModuleManagerPollingIndex_UL++;
+            GL_FonaModuleManagerPollingIndex_UL = GL_FonaModuleManagerPollingIndex_UL % 3;
+        }
 
         GL_FonaAbsoluteTime_UL = millis();
     }
@@ -348,7 +477,7 @@ void ProcessError(void) {
 
 	// Reset Data
 	GL_FonaModuleManagerRssi_SI = 0;
-	GL_FonaModuleManagerGprsState_B = false;
+	SetGprsState(false);
 	GL_FonaModuleManagerBatteryLeve_UI = 0;
 
     // Keep holding
@@ -356,9 +485,61 @@ void ProcessError(void) {
 }
 
 
+FONA_MODULE_AT_STS_ENUM ProcessAtSequence(const FONA_MODULE_MANAGER_AT_STEP_STRUCT * pSequence_X, unsigned long SequenceNb_UL) {
+
+    // Send request for current step
+    if (GL_FonaAtTicket_UL == 0) {
+        if (GL_FonaAtStepIdx_UL >= SequenceNb_UL)
+            return FONA_MODULE_AT_STS_OK;
+
+        DBG_PRINTLN(DEBUG_SEVERITY_INFO, pSequence_X[GL_FonaAtStepIdx_UL].pDescr_UB);
+        snprintf(GL_pFonaAtCommand_UB, FONA_MODULE_AT_COMMAND_SIZE, pSequence_X[GL_FonaAtStepIdx_UL].pCommand_UB, GL_pFonaModuleApn_Str[GL_pFona_H->GL_FonaModuleParam_X.ApnIndex_UL].c_str());
+        GL_FonaAtTicket_UL = GL_pFona_H->requestAt(GL_pFonaAtCommand_UB, pSequence_X[GL_FonaAtStepIdx_UL].TimeoutMs_UL, NULL, pSequence_X[GL_FonaAtStepIdx_UL].pFinal_UB);
+        return FONA_MODULE_AT_STS_WAITING;
+    }
+
+    // Wait for completion
+    if (GL_pFona_H->isAtPending(GL_FonaAtTicket_UL))
+        return FONA_MODULE_AT_STS_WAITING;
+
+    if ((GL_pFona_H->getAtStatus(GL_FonaAtTicket_UL) != FONA_MODULE_AT_STS_OK) && !(pSequence_X[GL_FonaAtStepIdx_UL].IgnoreError_B)) {
+        DBG_PRINT(DEBUG_SEVERITY_ERROR, "AT sequence failed at step : ");
+        DBG_PRINTDATA(pSequence_X[GL_FonaAtStepIdx_UL].pDescr_UB);
+        DBG_ENDSTR();
+        GL_FonaAtTicket_UL = 0;
+        return FONA_MODULE_AT_STS_ERROR;
+    }
+
+    // Next step
+    GL_FonaAtTicket_UL = 0;
+    GL_FonaAtStepIdx_UL++;
+    return ((GL_FonaAtStepIdx_UL >= SequenceNb_UL) ? FONA_MODULE_AT_STS_OK : FONA_MODULE_AT_STS_WAITING);
+}
+
+void OnSignalStrength(FONA_MODULE_AT_STS_ENUM Status_E, const char * pResponse_UB) {
+    if (Status_E == FONA_MODULE_AT_STS_OK)
+        GL_FonaModuleManagerRssi_SI = GL_pFona_H->parseSignalStrength(pResponse_UB);
+}
+
+void OnGprsState(FONA_MODULE_AT_STS_ENUM Status_E, const char * pResponse_UB) {
+    if (Status_E == FONA_MODULE_AT_STS_OK)
+        SetGprsState(GL_pFona_H->parseGprsState(pResponse_UB));
+    else if (Status_E != FONA_MODULE_AT_STS_ABORTED)
+        SetGprsState(false);
+}
+
+// Event only published on a change of state
+void SetGprsState(boolean GprsState_B) {
+    if (GprsState_B != GL_FonaModuleManagerGprsState_B)
+        EventBus_Publish(EVENT_BUS_ID_GPRS_STATE, 0, (GprsState_B ? 1 : 0));
+
+    GL_FonaModuleManagerGprsState_B = GprsState_B;
+}
+
+
 void TransitionToIdle(void) {
     DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To IDLE");
-    GL_pFona_H->flush();        // flush Serial communication
+    GL_pFona_H->abortAtRequests();  // discard pending requests and flush Serial communication
     GL_pFona_H->setPinKey();    // default state for Power Key pin
     GL_pFona_H->setPinRst();    // default state for Reset pin
     GL_FonaModuleManager_CurrentState_E = FONA_MODULE_MANAGER_STATE::FONA_MODULE_MANAGER_IDLE;
@@ -392,34 +573,45 @@ void TransitionToCheckPowerPin(void) {
 
 void TransitionToBegin(void) {
     DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To BEGIN");
+    DBG_PRINTLN(DEBUG_SEVERITY_INFO, "FONA Module correctly powered -> start begin sequence..");
+    GL_FonaAtTicket_UL = 0;
+    GL_FonaAtStepIdx_UL = 0;
     GL_FonaModuleManager_CurrentState_E = FONA_MODULE_MANAGER_STATE::FONA_MODULE_MANAGER_BEGIN;
 }
 
 void TransitionToUnlockSim(void) {
     DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To UNLOCK SIM");
+    GL_FonaAtTicket_UL = 0;
+    GL_FonaAtStepIdx_UL = 0;
     GL_FonaModuleManager_CurrentState_E = FONA_MODULE_MANAGER_STATE::FONA_MODULE_MANAGER_UNLOCK_SIM;
 }
 
 void TransitiontToWaitNetworkRegistration(void) {
 	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To WAIT NETWORK REGISTRATION");
 	GL_FonaAbsoluteTime_UL = millis();
+	GL_FonaPollingTime_UL = GL_FonaAbsoluteTime_UL - FONA_MODULE_MANAGER_REGISTRATION_POLLING_MS;	// Poll right away
+	GL_FonaAtTicket_UL = 0;
 	GL_FonaModuleManager_CurrentState_E = FONA_MODULE_MANAGER_STATE::FONA_MODULE_MANAGER_WAIT_NEWORK_REGISTRATION;
 }
 
 void TransitionToGetBatteryState(void) {
 	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To GET BATTERY STATE");
 	GL_FonaAbsoluteTime_UL = millis();
+	GL_FonaAtTicket_UL = 0;
 	GL_FonaModuleManager_CurrentState_E = FONA_MODULE_MANAGER_STATE::FONA_MODULE_MANAGER_GET_BATTERY_STATE;
 }
 
 void TransitionToEnableGprs(void) {
 	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To ENABLE GPRS");
+	GL_FonaAtTicket_UL = 0;
+	GL_FonaAtStepIdx_UL = 0;
 	GL_FonaModuleManager_CurrentState_E = FONA_MODULE_MANAGER_STATE::FONA_MODULE_MANAGER_ENABLE_GPRS;
 }
 
 void TransitionToRunning(void) {
     DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To RUNNING");
     GL_FonaAbsoluteTime_UL = millis();
+    GL_FonaAtTicket_UL = 0;
     GL_FonaModuleManager_CurrentState_E = FONA_MODULE_MANAGER_STATE::FONA_MODULE_MANAGER_RUNNING;
 }
 
@@ -6,6 +6,7 @@
 /*		GI400 Indicator specific functions							                */
 /*                                                                                  */
 /* History :  	29/04/2017  (RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Add frame validation							*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -104,3 +105,19 @@ void GI400_ProcessFrame(unsigned char * pBuffer_UB, INDICATOR_INTERFACE_FRAME_EN
     DBG_PRINTDATA(pWeight_X->Value_UI);
     DBG_ENDSTR();
 }
+
+boolean GI400_IsFrameValid(const unsigned char * pBuffer_UB, INDICATOR_INTERFACE_FRAME_ENUM Frame_E) {
+    switch (Frame_E) {
+    case INDICATOR_INTERFACE_FRAME_ASK_WEIGHT:
+        if ((pBuffer_UB[0] != '+') && (pBuffer_UB[0] != '-'))
+            return false;
+        for (int i = 1; i < 7; i++) {
+            if ((pBuffer_UB[i] != 0x20) && ((pBuffer_UB[i] < '0') || (pBuffer_UB[i] > '9')))  // Leading zeros are sent as spaces
+                return false;
+        }
+        return true;
+
+    default:
+        return true;
+    }
+}
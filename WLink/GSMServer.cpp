@@ -0,0 +1,424 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* GSMServer.cpp																	*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Defines the utility functions that manage the GSM Server object             */
+/*		(TCP server of the GSM module driven through the asynchronous AT engine)	*/
+/*                                                                                  */
+/* History :  	18/10/2026  (RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#define MODULE_NAME		"GSMServer"
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "GSMServer.h"
+
+#include "Debug.h"
+
+/* ******************************************************************************** */
+/* Local Variables
+/* ******************************************************************************** */
+static FonaModule * GL_pFona_H;
+
+// Final responses of the multi-connection commands (must stay valid while the request is pending)
+static const char * GL_pGsmServerSendFinal_UB[GSM_SERVER_MAX_LINK_NB] = { "0, SEND OK", "1, SEND OK", "2, SEND OK", "3, SEND OK", "4, SEND OK", "5, SEND OK" };
+static const char * GL_pGsmServerCloseFinal_UB[GSM_SERVER_MAX_LINK_NB] = { "0, CLOSE OK", "1, CLOSE OK", "2, CLOSE OK", "3, CLOSE OK", "4, CLOSE OK", "5, CLOSE OK" };
+
+
+/* ******************************************************************************** */
+/* Prototypes for Internal Functions
+/* ******************************************************************************** */
+static signed int ParseLink(const char * pLine_UB, const char * pText_UB);
+static void AcceptClient(GSM_SERVER_PARAM * pParam_X, signed int Link_SI);
+static void ReleaseClient(GSM_SERVER_PARAM * pParam_X);
+static void CloseLink(GSM_SERVER_PARAM * pParam_X, signed int Link_SI);
+static void RequestClose(GSM_SERVER_PARAM * pParam_X);
+static void ParseRxData(GSM_SERVER_PARAM * pParam_X, const char * pResponse_UB);
+static void RemoveTxData(GSM_SERVER_PARAM * pParam_X, unsigned int Nb_UI);
+static unsigned char HexDigitValue(char Digit_UB);
+
+
+/* ******************************************************************************** */
+/* Constructor
+/* ******************************************************************************** */
+GSMServer::GSMServer() {
+	GL_GsmServerParam_X.IsInitialized_B = false;
+	GL_GsmServerParam_X.IsConnected_B = false;
+	GL_GsmServerParam_X.LocalPort_UI = GSM_SERVER_DEFAULT_PORT;
+	GL_GsmServerParam_X.StartTicket_UL = 0;
+	GL_GsmServerParam_X.NextClientId_UL = 1;
+	GL_GsmServerParam_X.RxTicket_UL = 0;
+	GL_GsmServerParam_X.TxTicket_UL = 0;
+	GL_GsmServerParam_X.CloseLinkMask_UB = 0;
+	ReleaseClient(&GL_GsmServerParam_X);
+}
+
+
+/* ******************************************************************************** */
+/* Functions
+/* ******************************************************************************** */
+void GSMServer::init(FonaModule * pFona_H) {
+	init(pFona_H, GSM_SERVER_DEFAULT_PORT);
+}
+
+void GSMServer::init(FonaModule * pFona_H, unsigned int LocalPort_UI) {
+	GL_pFona_H = pFona_H;
+	GL_GsmServerParam_X.LocalPort_UI = LocalPort_UI;
+	GL_GsmServerParam_X.IsInitialized_B = true;
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "GSM Server Initialized");
+}
+
+
+boolean GSMServer::isInitialized() {
+	return GL_GsmServerParam_X.IsInitialized_B;
+}
+
+
+void GSMServer::setLocalPort(unsigned int LocalPort_UI) {
+	GL_GsmServerParam_X.LocalPort_UI = LocalPort_UI;
+}
+
+unsigned int GSMServer::getLocalPort() {
+	return GL_GsmServerParam_X.LocalPort_UI;
+}
+
+
+// Queue the start sequence - the server is connected once "SERVER OK" is received
+void GSMServer::begin() {
+	char pCommand_UB[32];
+
+	end(false);
+
+	GL_pFona_H->requestAt("AT+CIPRXGET=1");		// Received data kept in the module until read (notified by "+CIPRXGET: 1,<id>")
+	GL_pFona_H->requestAt("AT+CIFSREX", FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, NULL, "OK", NULL, true);		// Local IP (needed before starting the server)
+
+	sprintf(pCommand_UB, "AT+CIPSERVER=1,%u", GL_GsmServerParam_X.LocalPort_UI);
+	GL_GsmServerParam_X.StartTicket_UL = GL_pFona_H->requestAt(pCommand_UB, GSM_SERVER_START_TIMEOUT_MS, NULL, "OK", NULL, true);
+
+	DBG_PRINT(DEBUG_SEVERITY_INFO, "GSM Server Starting on port ");
+	DBG_PRINTDATA(GL_GsmServerParam_X.LocalPort_UI);
+	DBG_ENDSTR();
+}
+
+void GSMServer::end(boolean CloseServer_B) {
+	if (CloseServer_B && (GL_GsmServerParam_X.StartTicket_UL != 0))
+		GL_pFona_H->requestAt("AT+CIPSERVER=0", GSM_SERVER_CLOSE_TIMEOUT_MS);
+
+	GL_GsmServerParam_X.IsConnected_B = false;
+	GL_GsmServerParam_X.StartTicket_UL = 0;
+	GL_GsmServerParam_X.RxTicket_UL = 0;
+	GL_GsmServerParam_X.TxTicket_UL = 0;
+	ReleaseClient(&GL_GsmServerParam_X);
+}
+
+boolean GSMServer::isConnected(void) {
+	return GL_GsmServerParam_X.IsConnected_B;
+}
+
+boolean GSMServer::isStartFailed(void) {
+	if ((GL_GsmServerParam_X.StartTicket_UL == 0) || GL_pFona_H->isAtPending(GL_GsmServerParam_X.StartTicket_UL))
+		return false;
+
+	return ((GL_pFona_H->getAtStatus(GL_GsmServerParam_X.StartTicket_UL) == FONA_MODULE_AT_STS_OK) ? false : true);
+}
+
+
+// Handle the completed requests and queue the next ones - never blocks
+void GSMServer::process(void) {
+	GSM_SERVER_PARAM * pParam_X = &GL_GsmServerParam_X;
+	char pCommand_UB[32];
+
+	if (!pParam_X->IsInitialized_B)
+		return;
+
+	// Read completed
+	if ((pParam_X->RxTicket_UL != 0) && !GL_pFona_H->isAtPending(pParam_X->RxTicket_UL)) {
+		if (GL_pFona_H->getAtStatus(pParam_X->RxTicket_UL) == FONA_MODULE_AT_STS_OK)
+			ParseRxData(pParam_X, GL_pFona_H->getAtResponse(pParam_X->RxTicket_UL));
+		pParam_X->RxTicket_UL = 0;
+	}
+
+	// Send completed
+	if ((pParam_X->TxTicket_UL != 0) && !GL_pFona_H->isAtPending(pParam_X->TxTicket_UL)) {
+		if (GL_pFona_H->getAtStatus(pParam_X->TxTicket_UL) != FONA_MODULE_AT_STS_OK) {
+			DBG_PRINT(DEBUG_SEVERITY_WARNING, "Send failed -> ");
+			DBG_PRINTDATA(pParam_X->SendNb_UI);
+			DBG_PRINTDATA(" byte(s) lost");
+			DBG_ENDSTR();
+		}
+		RemoveTxData(pParam_X, pParam_X->SendNb_UI);
+		pParam_X->TxTicket_UL = 0;
+	}
+
+	// Connections closing while the AT queue was full
+	RequestClose(pParam_X);
+
+	if (pParam_X->ClientLink_SI < 0)
+		return;
+
+	// Read the data waiting in the module (only if a whole chunk fits in the RX buffer)
+	if ((pParam_X->RxTicket_UL == 0) && pParam_X->HasRxData_B && ((GSM_SERVER_RX_BUFFER_SIZE - pParam_X->RxNb_UI) >= GSM_SERVER_READ_CHUNK)) {
+		sprintf(pCommand_UB, "AT+CIPRXGET=3,%d,%u", pParam_X->ClientLink_SI, (unsigned int)GSM_SERVER_READ_CHUNK);
+		pParam_X->RxTicket_UL = GL_pFona_H->requestAt(pCommand_UB, GSM_SERVER_READ_TIMEOUT_MS, "+CIPRXGET: 3,");
+		if (pParam_X->RxTicket_UL != 0)
+			pParam_X->HasRxData_B = false;		// Set again by the response or by a new notification
+	}
+
+	// Send the data ready (payload written after the '>' prompt)
+	if ((pParam_X->TxTicket_UL == 0) && (pParam_X->ReadyNb_UI > 0)) {
+		sprintf(pCommand_UB, "AT+CIPSEND=%d,%u", pParam_X->ClientLink_SI, pParam_X->ReadyNb_UI);
+		pParam_X->TxTicket_UL = GL_pFona_H->requestAtPayload(pCommand_UB, pParam_X->pTxBuffer_UB, pParam_X->ReadyNb_UI, GSM_SERVER_SEND_TIMEOUT_MS, GL_pGsmServerSendFinal_UB[pParam_X->ClientLink_SI]);
+		if (pParam_X->TxTicket_UL != 0)
+			pParam_X->SendNb_UI = pParam_X->ReadyNb_UI;
+	}
+
+	// Close the connection once everything has been sent
+	if (pParam_X->CloseRequested_B && (pParam_X->TxTicket_UL == 0) && (pParam_X->TxNb_UI == 0)) {
+		CloseLink(pParam_X, pParam_X->ClientLink_SI);
+		ReleaseClient(pParam_X);
+	}
+}
+
+// Unsolicited result codes of the TCP server - return true if the line is consumed
+boolean GSMServer::processUrc(const char * pLine_UB) {
+	GSM_SERVER_PARAM * pParam_X = &GL_GsmServerParam_X;
+	signed int Link_SI;
+
+	if (!pParam_X->IsInitialized_B)
+		return false;
+
+	// Data received : "+CIPRXGET: 1,<id>"
+	if (strncmp(pLine_UB, "+CIPRXGET: 1,", 13) == 0) {
+		if (atoi(&(pLine_UB[13])) == pParam_X->ClientLink_SI)
+			pParam_X->HasRxData_B = true;
+		return true;
+	}
+
+	// New connection : "<id>, REMOTE IP: <ip>"
+	Link_SI = ParseLink(pLine_UB, ", REMOTE IP:");
+	if (Link_SI >= 0) {
+		AcceptClient(pParam_X, Link_SI);
+		return true;
+	}
+
+	// Connection closed by the client : "<id>, CLOSED"
+	Link_SI = ParseLink(pLine_UB, ", CLOSED");
+	if (Link_SI >= 0) {
+		pParam_X->CloseLinkMask_UB &= ~(1 << Link_SI);
+		if (Link_SI == pParam_X->ClientLink_SI)
+			ReleaseClient(pParam_X);
+		return true;
+	}
+
+	if (strcmp(pLine_UB, "SERVER OK") == 0) {
+		pParam_X->IsConnected_B = true;
+		DBG_PRINTLN(DEBUG_SEVERITY_INFO, "GSM Server Started");
+		return true;
+	}
+
+	// Server closed or GPRS context lost
+	if ((strcmp(pLine_UB, "SERVER CLOSE") == 0) || (strncmp(pLine_UB, "+PDP: DEACT", 11) == 0)) {
+		pParam_X->IsConnected_B = false;
+		ReleaseClient(pParam_X);
+		DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "GSM Server Closed");
+		return true;
+	}
+
+	return false;
+}
+
+
+boolean GSMServer::hasClient(void) {
+	return ((GL_GsmServerParam_X.ClientLink_SI >= 0) ? true : false);
+}
+
+boolean GSMServer::isClientConnected(void) {
+	return (hasClient() && GL_GsmServerParam_X.IsConnected_B && !(GL_GsmServerParam_X.CloseRequested_B));
+}
+
+unsigned long GSMServer::getClientId(void) {
+	return (hasClient() ? GL_GsmServerParam_X.ClientId_UL : 0);
+}
+
+// Discard the received data
+void GSMServer::flushClient(void) {
+	GL_GsmServerParam_X.RxHead_UI = 0;
+	GL_GsmServerParam_X.RxNb_UI = 0;
+}
+
+// Connection closed once the pending data are sent
+void GSMServer::stopClient(void) {
+	if (!hasClient() || GL_GsmServerParam_X.CloseRequested_B)
+		return;
+
+	send();
+	GL_GsmServerParam_X.CloseRequested_B = true;
+}
+
+
+int GSMServer::available(void) {
+	return GL_GsmServerParam_X.RxNb_UI;
+}
+
+int GSMServer::read(void) {
+	unsigned char Data_UB;
+
+	if (GL_GsmServerParam_X.RxNb_UI == 0)
+		return -1;
+
+	Data_UB = GL_GsmServerParam_X.pRxBuffer_UB[GL_GsmServerParam_X.RxHead_UI];
+	GL_GsmServerParam_X.RxHead_UI = (GL_GsmServerParam_X.RxHead_UI + 1) % GSM_SERVER_RX_BUFFER_SIZE;
+	GL_GsmServerParam_X.RxNb_UI--;
+
+	return Data_UB;
+}
+
+int GSMServer::read(unsigned char * pBuffer_UB, unsigned int MaxNb_UI) {
+	int Nb_SI = 0;
+
+	while (((unsigned int)Nb_SI < MaxNb_UI) && (GL_GsmServerParam_X.RxNb_UI > 0))
+		pBuffer_UB[Nb_SI++] = read();
+
+	return Nb_SI;
+}
+
+void GSMServer::write(unsigned char Data_UB) {
+	write(&Data_UB, 1);
+}
+
+// Data are buffered until send() is called
+void GSMServer::write(const unsigned char * pBuffer_UB, unsigned int NbData_UI) {
+	if (!isClientConnected())
+		return;
+
+	if (NbData_UI > (GSM_SERVER_TX_BUFFER_SIZE - GL_GsmServerParam_X.TxNb_UI)) {
+		DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "TX buffer full -> data truncated");
+		NbData_UI = GSM_SERVER_TX_BUFFER_SIZE - GL_GsmServerParam_X.TxNb_UI;
+	}
+
+	memcpy(&(GL_GsmServerParam_X.pTxBuffer_UB[GL_GsmServerParam_X.TxNb_UI]), pBuffer_UB, NbData_UI);
+	GL_GsmServerParam_X.TxNb_UI += NbData_UI;
+}
+
+void GSMServer::send(void) {
+	GL_GsmServerParam_X.ReadyNb_UI = GL_GsmServerParam_X.TxNb_UI;
+}
+
+
+/* ******************************************************************************** */
+/* Internal Functions
+/* ******************************************************************************** */
+
+// Link ID of a line "<id><text>" (-1 if the line does not match)
+signed int ParseLink(const char * pLine_UB, const char * pText_UB) {
+	if ((pLine_UB[0] < '0') || (pLine_UB[0] >= ('0' + GSM_SERVER_MAX_LINK_NB)))
+		return -1;
+
+	if (strncmp(&(pLine_UB[1]), pText_UB, strlen(pText_UB)) != 0)
+		return -1;
+
+	return (pLine_UB[0] - '0');
+}
+
+// Only one client at a time - other connections are closed
+void AcceptClient(GSM_SERVER_PARAM * pParam_X, signed int Link_SI) {
+	pParam_X->CloseLinkMask_UB &= ~(1 << Link_SI);		// New connection on a link closed in the meantime
+
+	if (pParam_X->ClientLink_SI >= 0) {
+		DBG_PRINT(DEBUG_SEVERITY_WARNING, "Client already connected -> connection ");
+		DBG_PRINTDATA(Link_SI);
+		DBG_PRINTDATA(" refused");
+		DBG_ENDSTR();
+		CloseLink(pParam_X, Link_SI);
+		return;
+	}
+
+	ReleaseClient(pParam_X);
+	pParam_X->ClientLink_SI = Link_SI;
+	pParam_X->ClientId_UL = pParam_X->NextClientId_UL++;
+
+	DBG_PRINT(DEBUG_SEVERITY_INFO, "New client on connection ");
+	DBG_PRINTDATA(Link_SI);
+	DBG_ENDSTR();
+}
+
+// Pending requests are left to complete - their result is discarded
+void ReleaseClient(GSM_SERVER_PARAM * pParam_X) {
+	pParam_X->ClientLink_SI = -1;
+	pParam_X->CloseRequested_B = false;
+	pParam_X->HasRxData_B = false;
+	pParam_X->RxHead_UI = 0;
+	pParam_X->RxNb_UI = 0;
+	pParam_X->TxNb_UI = 0;
+	pParam_X->SendNb_UI = 0;
+	pParam_X->ReadyNb_UI = 0;
+}
+
+// The connection stays marked as closing until its AT+CIPCLOSE is queued
+void CloseLink(GSM_SERVER_PARAM * pParam_X, signed int Link_SI) {
+	pParam_X->CloseLinkMask_UB |= (1 << Link_SI);
+	RequestClose(pParam_X);
+}
+
+void RequestClose(GSM_SERVER_PARAM * pParam_X) {
+	char pCommand_UB[16];
+
+	for (int i = 0; i < GSM_SERVER_MAX_LINK_NB; i++) {
+		if (!(pParam_X->CloseLinkMask_UB & (1 << i)))
+			continue;
+
+		sprintf(pCommand_UB, "AT+CIPCLOSE=%d", i);
+		if (GL_pFona_H->requestAt(pCommand_UB, GSM_SERVER_CLOSE_TIMEOUT_MS, NULL, GL_pGsmServerCloseFinal_UB[i]) == 0)
+			return;		// AT queue full : retried by process()
+
+		pParam_X->CloseLinkMask_UB &= ~(1 << i);
+	}
+}
+
+// Response of AT+CIPRXGET=3 : "+CIPRXGET: 3,<id>,<reqlength>,<cnflength>" followed by the data in hex
+void ParseRxData(GSM_SERVER_PARAM * pParam_X, const char * pResponse_UB) {
+	const char * pData_UB = strstr(pResponse_UB, "+CIPRXGET: 3,");
+	int Link_SI = -1;
+	int ReqLength_SI = 0;
+	int CnfLength_SI = 0;
+
+	if ((pData_UB == NULL) || (sscanf(&(pData_UB[13]), "%d,%d,%d", &Link_SI, &ReqLength_SI, &CnfLength_SI) != 3))
+		return;
+
+	if (Link_SI != pParam_X->ClientLink_SI)
+		return;		// Client released in the meantime
+
+	if (CnfLength_SI > 0)
+		pParam_X->HasRxData_B = true;
+
+	pData_UB = strchr(pData_UB, '\n');
+	if (pData_UB == NULL)
+		return;
+	pData_UB++;
+
+	for (int i = 0; (i < ReqLength_SI) && isxdigit(pData_UB[0]) && isxdigit(pData_UB[1]) && (pParam_X->RxNb_UI < GSM_SERVER_RX_BUFFER_SIZE); i++) {
+		pParam_X->pRxBuffer_UB[(pParam_X->RxHead_UI + pParam_X->RxNb_UI) % GSM_SERVER_RX_BUFFER_SIZE] = (HexDigitValue(pData_UB[0]) << 4) | HexDigitValue(pData_UB[1]);
+		pParam_X->RxNb_UI++;
+		pData_UB += 2;
+	}
+}
+
+// Remove the bytes sent from the TX buffer (data written in the meantime are kept)
+void RemoveTxData(GSM_SERVER_PARAM * pParam_X, unsigned int Nb_UI) {
+	if (Nb_UI > pParam_X->TxNb_UI)
+		Nb_UI = pParam_X->TxNb_UI;
+
+	memmove(pParam_X->pTxBuffer_UB, &(pParam_X->pTxBuffer_UB[Nb_UI]), pParam_X->TxNb_UI - Nb_UI);
+	pParam_X->TxNb_UI -= Nb_UI;
+	pParam_X->ReadyNb_UI = (pParam_X->ReadyNb_UI > Nb_UI) ? (pParam_X->ReadyNb_UI - Nb_UI) : 0;
+	pParam_X->SendNb_UI = 0;
+}
+
+unsigned char HexDigitValue(char Digit_UB) {
+	return ((Digit_UB <= '9') ? (Digit_UB - '0') : ((Digit_UB & 0xDF) - 'A' + 10));
+}
@@ -0,0 +1,105 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* GSMServer.h																		*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Header file for GSMServer.cpp												*/
+/*		This class creates and manages a GSMServer object to dialog with a TCP		*/
+/*		client through the TCP server of the external GSM module					*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __GSM_SERVER_H__
+#define __GSM_SERVER_H__
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include <Arduino.h>
+#include "FonaModule.h"
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+#define GSM_SERVER_DEFAULT_PORT			8888
+
+#define GSM_SERVER_MAX_LINK_NB			6		// Connections of the module in multi-connection mode (AT+CIPMUX=1)
+#define GSM_SERVER_RX_BUFFER_SIZE		256
+#define GSM_SERVER_TX_BUFFER_SIZE		1024	// Holds a whole batch of W-Command responses
+#define GSM_SERVER_READ_CHUNK			100		// Bytes read per AT+CIPRXGET (hex mode : twice as many characters in the response)
+#define GSM_SERVER_START_TIMEOUT_MS		10000
+#define GSM_SERVER_READ_TIMEOUT_MS		2000
+#define GSM_SERVER_SEND_TIMEOUT_MS		10000
+#define GSM_SERVER_CLOSE_TIMEOUT_MS		5000
+
+
+/* ******************************************************************************** */
+/* Structure & Enumeration
+/* ******************************************************************************** */
+typedef struct {
+	boolean IsInitialized_B;
+	boolean IsConnected_B;					// "SERVER OK" received
+	unsigned int LocalPort_UI;
+	unsigned long StartTicket_UL;			// Last request of the start sequence
+	signed int ClientLink_SI;				// Connection of the client (-1 = none)
+	unsigned long ClientId_UL;				// Changes for each new connection
+	unsigned long NextClientId_UL;
+	boolean CloseRequested_B;				// Connection closed once the TX buffer is sent
+	unsigned char CloseLinkMask_UB;			// Connections closing (bit = link ID) whose AT+CIPCLOSE is not queued yet
+	boolean HasRxData_B;					// Data waiting in the module
+	unsigned long RxTicket_UL;
+	unsigned char pRxBuffer_UB[GSM_SERVER_RX_BUFFER_SIZE];
+	unsigned int RxHead_UI;
+	unsigned int RxNb_UI;
+	unsigned long TxTicket_UL;
+	unsigned char pTxBuffer_UB[GSM_SERVER_TX_BUFFER_SIZE];
+	unsigned int TxNb_UI;					// Bytes in the TX buffer
+	unsigned int SendNb_UI;					// Bytes of the TX buffer being sent (AT+CIPSEND pending)
+	unsigned int ReadyNb_UI;				// Bytes of the TX buffer that can be sent
+} GSM_SERVER_PARAM;
+
+/* ******************************************************************************** */
+/* Class
+/* ******************************************************************************** */
+class GSMServer {
+public:
+	// Constructor
+	GSMServer();
+
+	// Functions
+	void init(FonaModule * pFona_H);
+	void init(FonaModule * pFona_H, unsigned int LocalPort_UI);
+	boolean isInitialized();
+
+	void setLocalPort(unsigned int LocalPort_UI);
+	unsigned int getLocalPort();
+
+	void begin();
+	void end(boolean CloseServer_B = true);
+	boolean isConnected(void);
+	boolean isStartFailed(void);
+
+	void process(void);
+	boolean processUrc(const char * pLine_UB);
+
+	boolean hasClient(void);
+	boolean isClientConnected(void);
+	unsigned long getClientId(void);
+	void flushClient(void);
+	void stopClient(void);
+
+	int available(void);
+	int read(void);
+	int read(unsigned char * pBuffer_UB, unsigned int MaxNb_UI);
+	void write(unsigned char Data_UB);
+	void write(const unsigned char * pBuffer_UB, unsigned int NbData_UI);
+	void send(void);
+
+	GSM_SERVER_PARAM GL_GsmServerParam_X;
+};
+
+#endif // __GSM_SERVER_H__
+
@@ -0,0 +1,207 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* GSMServerManager.cpp																*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Describes the state machine to manage the GSM Server object					*/
+/*                                                                                  */
+/* History :  	18/10/2026  (RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#define MODULE_NAME		"GSMServerManager"
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "GSMServerManager.h"
+#include "FonaModuleManager.h"
+
+#include "Debug.h"
+#include "LoopProfiler.h"
+
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+#define GSM_SERVER_MANAGER_CONNECTING_TIMEOUT_MS	30000
+#define GSM_SERVER_MANAGER_RETRY_DELAY_MS			10000
+
+
+/* ******************************************************************************** */
+/* Local Variables
+/* ******************************************************************************** */
+enum GSM_SERVER_MANAGER_STATE {
+	GSM_SERVER_MANAGER_IDLE,
+	GSM_SERVER_MANAGER_CONNECTING,
+	GSM_SERVER_MANAGER_WAIT_CLIENT,
+	GSM_SERVER_MANAGER_RUNNING,
+	GSM_SERVER_MANAGER_ERROR
+};
+
+static GSM_SERVER_MANAGER_STATE GL_GSMServerManager_CurrentState_E = GSM_SERVER_MANAGER_STATE::GSM_SERVER_MANAGER_IDLE;
+
+static FonaModule * GL_pFona_H;
+static GSMServer * GL_pGsmServer_H;
+
+static boolean GL_GsmServerManagerEnabled_B = false;
+static unsigned long GL_GsmServerAbsoluteTime_UL = 0;
+
+
+/* ******************************************************************************** */
+/* Prototypes for Internal Functions
+/* ******************************************************************************** */
+static void ProcessIdle(void);
+static void ProcessConnecting(void);
+static void ProcessWaitClient(void);
+static void ProcessRunning(void);
+static void ProcessError(void);
+
+static boolean OnUrc(const char * pLine_UB);
+
+static void TransitionToIdle(void);
+static void TransitionToConnecting(void);
+static void TransitionToWaitClient(void);
+static void TransitionToRunning(void);
+static void TransitionToError(void);
+
+
+/* ******************************************************************************** */
+/* Functions
+/* ******************************************************************************** */
+
+void GSMServerManager_Init(FonaModule * pFona_H, GSMServer * pGSMServer_H) {
+	GL_pFona_H = pFona_H;
+	GL_pGsmServer_H = pGSMServer_H;
+	GL_GsmServerManagerEnabled_B = false;
+	GL_pFona_H->setUrcCallback(OnUrc);
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "GSM Server Manager Initialized");
+}
+
+void GSMServerManager_Enable() {
+	GL_GsmServerManagerEnabled_B = true;
+}
+
+void GSMServerManager_Disable() {
+	GL_GsmServerManagerEnabled_B = false;
+}
+
+void GSMServerManager_Process() {
+
+	/* Reset Condition */
+	if ((GL_GSMServerManager_CurrentState_E != GSM_SERVER_MANAGER_IDLE) && (!(FonaModuleManager_IsRunning() && GL_GsmServerManagerEnabled_B))) {
+		TransitionToIdle();
+	}
+
+	/* State Machine */
+	LOOP_PROFILER_SET_STATE(LOOP_PROFILER_ID_GSM_SERVER, GL_GSMServerManager_CurrentState_E);
+	switch (GL_GSMServerManager_CurrentState_E) {
+	case GSM_SERVER_MANAGER_IDLE:
+		ProcessIdle();
+		break;
+
+	case GSM_SERVER_MANAGER_CONNECTING:
+		ProcessConnecting();
+		break;
+
+	case GSM_SERVER_MANAGER_WAIT_CLIENT:
+		ProcessWaitClient();
+		break;
+
+	case GSM_SERVER_MANAGER_RUNNING:
+		ProcessRunning();
+		break;
+
+	case GSM_SERVER_MANAGER_ERROR:
+		ProcessError();
+		break;
+	}
+}
+
+boolean GSMServerManager_IsRunning(void) {
+	return (((GL_GSMServerManager_CurrentState_E == GSM_SERVER_MANAGER_WAIT_CLIENT) || (GL_GSMServerManager_CurrentState_E == GSM_SERVER_MANAGER_RUNNING)) ? true : false);
+}
+
+
+/* ******************************************************************************** */
+/* Internal Functions
+/* ******************************************************************************** */
+
+void ProcessIdle(void) {
+	if (GL_pGsmServer_H->isInitialized() && FonaModuleManager_IsRunning() && GL_GsmServerManagerEnabled_B)
+		TransitionToConnecting();
+}
+
+void ProcessConnecting(void) {
+	if (GL_pGsmServer_H->isConnected()) {
+		TransitionToWaitClient();
+	}
+	else if (GL_pGsmServer_H->isStartFailed() || ((millis() - GL_GsmServerAbsoluteTime_UL) >= GSM_SERVER_MANAGER_CONNECTING_TIMEOUT_MS)) {
+		TransitionToError();
+	}
+}
+
+void ProcessWaitClient(void) {
+	GL_pGsmServer_H->process();
+
+	if (!(GL_pGsmServer_H->isConnected())) {
+		TransitionToError();
+	}
+	else if (GL_pGsmServer_H->hasClient()) {
+		TransitionToRunning();
+	}
+}
+
+void ProcessRunning(void) {
+	GL_pGsmServer_H->process();
+
+	if (!(GL_pGsmServer_H->isConnected())) {
+		TransitionToError();
+	}
+	else if (!(GL_pGsmServer_H->hasClient())) {
+		TransitionToWaitClient();
+	}
+}
+
+void ProcessError(void) {
+	// Retry later (GPRS context may be restored in the meantime)
+	if ((millis() - GL_GsmServerAbsoluteTime_UL) >= GSM_SERVER_MANAGER_RETRY_DELAY_MS)
+		TransitionToIdle();
+}
+
+
+boolean OnUrc(const char * pLine_UB) {
+	return GL_pGsmServer_H->processUrc(pLine_UB);
+}
+
+
+void TransitionToIdle(void) {
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To IDLE");
+	GL_pGsmServer_H->end(FonaModuleManager_IsRunning());	// Pending requests discarded by the FONA Module Manager otherwise
+	GL_GSMServerManager_CurrentState_E = GSM_SERVER_MANAGER_STATE::GSM_SERVER_MANAGER_IDLE;
+}
+
+void TransitionToConnecting(void) {
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To CONNECTING");
+	GL_pGsmServer_H->begin();
+	GL_GsmServerAbsoluteTime_UL = millis();
+	GL_GSMServerManager_CurrentState_E = GSM_SERVER_MANAGER_STATE::GSM_SERVER_MANAGER_CONNECTING;
+}
+
+void TransitionToWaitClient(void) {
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To WAIT CLIENT");
+	GL_GSMServerManager_CurrentState_E = GSM_SERVER_MANAGER_STATE::GSM_SERVER_MANAGER_WAIT_CLIENT;
+}
+
+void TransitionToRunning(void) {
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To RUNNING");
+	GL_GSMServerManager_CurrentState_E = GSM_SERVER_MANAGER_STATE::GSM_SERVER_MANAGER_RUNNING;
+}
+
+void TransitionToError(void) {
+	DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "Transition To ERROR");
+	GL_pGsmServer_H->end(FonaModuleManager_IsRunning());
+	GL_GsmServerAbsoluteTime_UL = millis();
+	GL_GSMServerManager_CurrentState_E = GSM_SERVER_MANAGER_STATE::GSM_SERVER_MANAGER_ERROR;
+}
@@ -0,0 +1,40 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* GSMServerManager.h																*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Header file for GSMServerManager.cpp										*/
+/*		Process functions to manage the GSM Server object							*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __GSM_SERVER_MANAGER_H__
+#define __GSM_SERVER_MANAGER_H__
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+#include "GSMServer.h"
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+
+/* ******************************************************************************** */
+/* Structure & Enumeration
+/* ******************************************************************************** */
+
+/* ******************************************************************************** */
+/* Functions Prototypes
+/* ******************************************************************************** */
+void GSMServerManager_Init(FonaModule * pFona_H, GSMServer * pGSMServer_H);
+void GSMServerManager_Enable();
+void GSMServerManager_Disable();
+void GSMServerManager_Process();
+
+boolean GSMServerManager_IsRunning();
+
+
+#endif // __GSM_SERVER_MANAGER_H__
@@ -6,6 +6,7 @@
 /*		Header file for hardware related definition                                 */
 /*                                                                                  */
 /* History :	14/05/2016	(RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Add host-native build switch                    */
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -16,6 +17,19 @@
 /* Include
 /* ******************************************************************************** */
 
+/* ******************************************************************************** */
+/* Target
+/* ******************************************************************************** */
+
+/* Define WLINK_HOST_BUILD (e.g. -DWLINK_HOST_BUILD) to build the firmware for a host
+ * against a HAL shim instead of the Arduino Due core. The pin mapping below is kept
+ * as is, the shim being in charge of the simulated peripherals. See WLink.ino */
+#ifdef WLINK_HOST_BUILD
+#define WLINK_TARGET_NAME	"Host"
+#else
+#define WLINK_TARGET_NAME	"Arduino Due"
+#endif
+
 /* ******************************************************************************** */
 /* Pin Defintion
 /* ******************************************************************************** */
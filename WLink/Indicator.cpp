@@ -8,6 +8,10 @@
 /* History :  	01/12/2014  (RW)	Creation of this file                           */
 /*				12/01/2015  (RW)	Manage indicator with low-level functions       */
 /*				06/06/2016	(RW)	Re-mastered version								*/	
+/*				18/10/2026	(RW)	Per-instance serial, buffer and FIFO			*/
+/*				18/10/2026	(RW)	Incremental frame assembler fed by CommEvent	*/
+/*				18/10/2026	(RW)	Add counter of validated responses				*/
+/*				18/10/2026	(RW)	Receive through a stream buffer (span access)	*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -25,23 +29,11 @@
 /* ******************************************************************************** */
 /* Define
 /* ******************************************************************************** */
-#define INDICATOR_FIFO_MAX_NB       64
 
 /* ******************************************************************************** */
 /* Local Variables
 /* ******************************************************************************** */
 
-static HardwareSerial * GL_pIndicatorSerial_H;
-static HardwareSerial * GL_pIndicatorEcho_H;
-
-static INDICATOR_INTERFACE_DEVICES_ENUM GL_IndicatorDevice_E;
-
-static unsigned char GL_pIndicatorBuffer_UB[INDICATOR_INTERFACE_MAX_RESP_SIZE];
-
-static unsigned long GL_IndicatorFifoPushIndex_UL = 0;
-static unsigned long GL_IndicatorFifoPopIndex_UL = 0;
-static signed int GL_pIndicatorFifo_SI[INDICATOR_FIFO_MAX_NB];
-
 extern INDICATOR_INTERFACE_STRUCT GL_pIndicatorInterface_X[INDICATOR_INTERFACE_DEVICES_NUM];
 
 /* ******************************************************************************** */
@@ -56,56 +48,75 @@ Indicator::Indicator() {
 	GL_IndicatorParam_X.Weight_X.Sign_E = INDICATOR_WEIGHT_SIGN_UNDEFINED;
 	GL_IndicatorParam_X.Weight_X.Value_UI = 0;
 	GL_IndicatorParam_X.Weight_X.Alibi_UI = 0;
-    GL_IndicatorFifoPushIndex_UL = 0;
-    GL_IndicatorFifoPopIndex_UL = 0;
+	GL_IndicatorParam_X.IrqReceived_B = false;
+	GL_IndicatorData_X.pSerial_H = NULL;
+	GL_IndicatorData_X.pEcho_H = NULL;
+	GL_IndicatorData_X.Device_E = INDICATOR_LD5218;
+	GL_IndicatorData_X.RespFrame_E = INDICATOR_INTERFACE_FRAME_ASK_WEIGHT;
+	GL_IndicatorData_X.RespIndex_UL = 0;
+	GL_IndicatorData_X.IsFrameReady_B = false;
+	GL_IndicatorData_X.IsStreamed_B = false;
+	GL_IndicatorData_X.FrameTimeStamp_UL = 0;
+	GL_IndicatorData_X.ResyncNb_UL = 0;
+	GL_IndicatorData_X.FrameNb_UL = 0;
+    GL_IndicatorData_X.FifoPushIndex_UL = 0;
+    GL_IndicatorData_X.FifoPopIndex_UL = 0;
 }
 
 /* ******************************************************************************** */
 /* Functions
 /* ******************************************************************************** */
 void Indicator::init(HardwareSerial * pSerial_H, boolean Begin_B) {
-	GL_pIndicatorSerial_H = pSerial_H;
-	if(Begin_B) GL_pIndicatorSerial_H->begin(INDICATOR_DEFAULT_BAUDRATE);
+	GL_IndicatorData_X.pSerial_H = pSerial_H;
+	if(Begin_B) GL_IndicatorData_X.pSerial_H->begin(INDICATOR_DEFAULT_BAUDRATE);
     GL_IndicatorParam_X.HasEcho_B = false;
     GL_IndicatorParam_X.IsAlibi_B = false;
 	GL_IndicatorParam_X.IsInitialized_B = true;
-    GL_IndicatorFifoPushIndex_UL = 0;
-    GL_IndicatorFifoPopIndex_UL = 0;
+	StreamBuffer_Init(&(GL_IndicatorData_X.RxStream_X), GL_IndicatorData_X.pRxStream_UB, INDICATOR_RX_STREAM_SIZE);
+	GL_IndicatorData_X.RespIndex_UL = 0;
+	GL_IndicatorData_X.IsFrameReady_B = false;
+	GL_IndicatorData_X.IsStreamed_B = false;
+    GL_IndicatorData_X.FifoPushIndex_UL = 0;
+    GL_IndicatorData_X.FifoPopIndex_UL = 0;
 	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Indicator Initialized");
 }
 
 void Indicator::init(HardwareSerial * pSerial_H, unsigned long BaudRate_UL, boolean Begin_B) {
-	GL_pIndicatorSerial_H = pSerial_H;
-    if (Begin_B) GL_pIndicatorSerial_H->begin(BaudRate_UL);
+	GL_IndicatorData_X.pSerial_H = pSerial_H;
+    if (Begin_B) GL_IndicatorData_X.pSerial_H->begin(BaudRate_UL);
     GL_IndicatorParam_X.HasEcho_B = false;
     GL_IndicatorParam_X.IsAlibi_B = false;
 	GL_IndicatorParam_X.IsInitialized_B = true;
-    GL_IndicatorFifoPushIndex_UL = 0;
-    GL_IndicatorFifoPopIndex_UL = 0;
+	StreamBuffer_Init(&(GL_IndicatorData_X.RxStream_X), GL_IndicatorData_X.pRxStream_UB, INDICATOR_RX_STREAM_SIZE);
+	GL_IndicatorData_X.RespIndex_UL = 0;
+	GL_IndicatorData_X.IsFrameReady_B = false;
+	GL_IndicatorData_X.IsStreamed_B = false;
+    GL_IndicatorData_X.FifoPushIndex_UL = 0;
+    GL_IndicatorData_X.FifoPopIndex_UL = 0;
 	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Indicator Initialized");
 }
 
 void Indicator::setIndicatorDevice(INDICATOR_INTERFACE_DEVICES_ENUM Device_E) {
-	GL_IndicatorDevice_E = Device_E;
+	GL_IndicatorData_X.Device_E = Device_E;
 }
 
 void Indicator::attachEcho(HardwareSerial * pSerial_H, boolean Begin_B) {
-	GL_pIndicatorEcho_H = pSerial_H;
-	if (Begin_B) GL_pIndicatorEcho_H->begin(INDICATOR_ECHO_DEFAULT_BAUDRATE);
+	GL_IndicatorData_X.pEcho_H = pSerial_H;
+	if (Begin_B) GL_IndicatorData_X.pEcho_H->begin(INDICATOR_ECHO_DEFAULT_BAUDRATE);
 	GL_IndicatorParam_X.HasEcho_B = true;
 	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Attach Echo to Indicator");
 }
 
 void Indicator::attachEcho(HardwareSerial * pSerial_H, unsigned long BaudRate_UL, boolean Begin_B) {
-	GL_pIndicatorEcho_H = pSerial_H;
-	if (Begin_B) GL_pIndicatorEcho_H->begin(BaudRate_UL);
+	GL_IndicatorData_X.pEcho_H = pSerial_H;
+	if (Begin_B) GL_IndicatorData_X.pEcho_H->begin(BaudRate_UL);
 	GL_IndicatorParam_X.HasEcho_B = true;
 	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Attach Echo to Indicator");
 }
 
 void Indicator::detachEcho(void) {
-	GL_pIndicatorEcho_H->flush();
-	GL_pIndicatorEcho_H->end();
+	GL_IndicatorData_X.pEcho_H->flush();
+	GL_IndicatorData_X.pEcho_H->end();
 	GL_IndicatorParam_X.HasEcho_B = false;
 	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Detach Echo from Indicator");
 }
@@ -137,37 +148,36 @@ boolean Indicator::hasEcho() {
 
 void Indicator::sendFrame(INDICATOR_INTERFACE_FRAME_ENUM Frame_E) {
 	DBG_PRINT(DEBUG_SEVERITY_INFO, "Send Frame to Indicator [");	
-	DBG_PRINTDATA(pIndicatorInterfaceDeviceLut_Str[GL_IndicatorDevice_E]);
+	DBG_PRINTDATA(pIndicatorInterfaceDeviceLut_Str[GL_IndicatorData_X.Device_E]);
 	DBG_PRINTDATA("] : ");
 	DBG_PRINTDATA(pIndicatorInterfaceFrameLut_Str[Frame_E]);
 	DBG_ENDSTR();
-	for (int i = 0; i < GL_pIndicatorInterface_X[GL_IndicatorDevice_E].pFrame[Frame_E].Size_UB; i++)
-		GL_pIndicatorSerial_H->write(GL_pIndicatorInterface_X[GL_IndicatorDevice_E].pFrame[Frame_E].pWords_UB[i]);
+	for (int i = 0; i < GL_pIndicatorInterface_X[GL_IndicatorData_X.Device_E].pFrame[Frame_E].Size_UB; i++)
+		GL_IndicatorData_X.pSerial_H->write(GL_pIndicatorInterface_X[GL_IndicatorData_X.Device_E].pFrame[Frame_E].pWords_UB[i]);
+
+	// Expect the response of this frame (frames without response keep the previous expectation)
+	if (GL_pIndicatorInterface_X[GL_IndicatorData_X.Device_E].pFrame[Frame_E].RespSize_UB != 0) {
+		GL_IndicatorData_X.RespFrame_E = Frame_E;
+		GL_IndicatorData_X.RespIndex_UL = 0;
+		GL_IndicatorData_X.IsFrameReady_B = false;
+	}
 }
 
 boolean Indicator::isResponseAvailable(INDICATOR_INTERFACE_FRAME_ENUM Frame_E) {
-	if (GL_pIndicatorSerial_H->available() >= GL_pIndicatorInterface_X[GL_IndicatorDevice_E].pFrame[Frame_E].RespSize_UB)
-		return true;
-	else
-		return false;
-}
-
-void Indicator::processFrame(INDICATOR_INTERFACE_FRAME_ENUM Frame_E) {
-	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Retreive Data from Serial Buffer");
-	if (GL_IndicatorParam_X.HasEcho_B)
-		DBG_PRINTLN(DEBUG_SEVERITY_INFO, "(With ECHO)");
-	for (int i = 0; i < GL_pIndicatorInterface_X[GL_IndicatorDevice_E].pFrame[Frame_E].RespSize_UB; i++) {
-		GL_pIndicatorBuffer_UB[i] = (unsigned char)GL_pIndicatorSerial_H->read();
-		if (GL_IndicatorParam_X.HasEcho_B)
-			GL_pIndicatorEcho_H->write(GL_pIndicatorBuffer_UB[i]);
+	if (Frame_E != GL_IndicatorData_X.RespFrame_E) {
+		GL_IndicatorData_X.RespFrame_E = Frame_E;
+		GL_IndicatorData_X.RespIndex_UL = 0;
+		GL_IndicatorData_X.IsFrameReady_B = false;
 	}
 
-	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Process Data with Low-Level Function");
-	GL_pIndicatorInterface_X[GL_IndicatorDevice_E].FctHandler(GL_pIndicatorBuffer_UB, Frame_E, &(GL_IndicatorParam_X.Weight_X));
+	receive();	// In case no CommEvent is mapped on the COM port
+
+	return GL_IndicatorData_X.IsFrameReady_B;
+}
 
-	//DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Flush Serial buffer (RX)");
-	//while(GL_pIndicatorSerial_H->available())
-	//	GL_pIndicatorSerial_H->read();
+void Indicator::processFrame(INDICATOR_INTERFACE_FRAME_ENUM Frame_E) {
+	// Response already decoded by the frame assembler -> consume it
+	GL_IndicatorData_X.IsFrameReady_B = false;
 
 	if (GL_IndicatorParam_X.IsAlibi_B) {
 		DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "Reset Alibi Flag");
@@ -175,12 +185,106 @@ void Indicator::processFrame(INDICATOR_INTERFACE_FRAME_ENUM Frame_E) {
 	}
 }
 
+void Indicator::receive(void) {
+	const INDICATOR_INTERFACE_STRUCT * pInterface_X = &GL_pIndicatorInterface_X[GL_IndicatorData_X.Device_E];
+	unsigned long RespSize_UL = pInterface_X->pFrame[GL_IndicatorData_X.RespFrame_E].RespSize_UB;
+	unsigned char RespEnd_UB = pInterface_X->pFrame[GL_IndicatorData_X.RespFrame_E].RespEnd_UB;
+	unsigned char Data_UB = 0;
+	const unsigned char * pSpan_UB;
+	unsigned int Span_UI = 0;
+
+	if (!(GL_IndicatorParam_X.IsInitialized_B))
+		return;
+
+	StreamBuffer_FillFromSerial(&(GL_IndicatorData_X.RxStream_X), GL_IndicatorData_X.pSerial_H);
+
+	while ((Span_UI = StreamBuffer_GetReadSpan(&(GL_IndicatorData_X.RxStream_X), &pSpan_UB)) > 0) {
+		if (GL_IndicatorParam_X.HasEcho_B)
+			GL_IndicatorData_X.pEcho_H->write(pSpan_UB, Span_UI);
+
+		if ((RespSize_UL == 0) || (RespSize_UL > INDICATOR_INTERFACE_MAX_RESP_SIZE)) {
+			StreamBuffer_Consume(&(GL_IndicatorData_X.RxStream_X), Span_UI);
+			continue;	// No response expected
+		}
+
+		for (unsigned int i = 0; i < Span_UI; i++) {
+			Data_UB = pSpan_UB[i];
+
+			GL_IndicatorData_X.pBuffer_UB[GL_IndicatorData_X.RespIndex_UL++] = Data_UB;
+
+			// Delimiter received too early -> next byte starts a new response
+			if ((RespEnd_UB != 0x00) && (Data_UB == RespEnd_UB) && (GL_IndicatorData_X.RespIndex_UL < RespSize_UL)) {
+				GL_IndicatorData_X.ResyncNb_UL += GL_IndicatorData_X.RespIndex_UL;
+				GL_IndicatorData_X.RespIndex_UL = 0;
+				continue;
+			}
+
+			if (GL_IndicatorData_X.RespIndex_UL < RespSize_UL)
+				continue;
+
+			// Complete response -> check delimiter and content
+			if (((RespEnd_UB == 0x00) || (Data_UB == RespEnd_UB)) && pInterface_X->FctIsValid(GL_IndicatorData_X.pBuffer_UB, GL_IndicatorData_X.RespFrame_E)) {
+				pInterface_X->FctHandler(GL_IndicatorData_X.pBuffer_UB, GL_IndicatorData_X.RespFrame_E, &(GL_IndicatorParam_X.Weight_X));
+				GL_IndicatorData_X.FrameTimeStamp_UL = millis();
+				GL_IndicatorData_X.FrameNb_UL++;
+				GL_IndicatorData_X.IsFrameReady_B = true;
+				GL_IndicatorData_X.RespIndex_UL = 0;
+
+				if (GL_IndicatorData_X.IsStreamed_B) {
+					DBG_PRINT(DEBUG_SEVERITY_INFO, "Push new value into FIFO : ");
+					DBG_PRINTDATA(getWeightValue());
+					DBG_ENDSTR();
+					fifoPush(getWeightValue(), GL_IndicatorData_X.FrameTimeStamp_UL);
+					GL_IndicatorData_X.IsFrameReady_B = false;
+				}
+			}
+			else {
+				// Out of sync -> drop the first byte and try again with the next one
+				memmove(GL_IndicatorData_X.pBuffer_UB, &(GL_IndicatorData_X.pBuffer_UB[1]), RespSize_UL - 1);
+				GL_IndicatorData_X.RespIndex_UL--;
+				GL_IndicatorData_X.ResyncNb_UL++;
+			}
+		}
+
+		StreamBuffer_Consume(&(GL_IndicatorData_X.RxStream_X), Span_UI);
+	}
+}
+
+void Indicator::startStream(INDICATOR_INTERFACE_FRAME_ENUM Frame_E) {
+	GL_IndicatorData_X.RespFrame_E = Frame_E;
+	GL_IndicatorData_X.RespIndex_UL = 0;
+	GL_IndicatorData_X.IsFrameReady_B = false;
+	GL_IndicatorData_X.IsStreamed_B = true;
+}
+
+void Indicator::stopStream(void) {
+	GL_IndicatorData_X.IsStreamed_B = false;
+}
+
+unsigned long Indicator::getFrameTimeStamp(void) {
+	return GL_IndicatorData_X.FrameTimeStamp_UL;
+}
+
+unsigned long Indicator::getResyncNumber(void) {
+	return GL_IndicatorData_X.ResyncNb_UL;
+}
+
+unsigned long Indicator::getFrameNumber(void) {
+	return GL_IndicatorData_X.FrameNb_UL;
+}
+
 
 void Indicator::flushIndicator(void) {
+	if (!(GL_IndicatorParam_X.IsInitialized_B))
+		return;
+
 	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Flush Serial Buffer of Indicator");
-	GL_pIndicatorSerial_H->flush();
-    while(GL_pIndicatorSerial_H->available())
-    	GL_pIndicatorSerial_H->read();
+	GL_IndicatorData_X.pSerial_H->flush();
+	while (GL_IndicatorData_X.pSerial_H->available()) {
+		GL_IndicatorData_X.pSerial_H->read();
+	}
+	StreamBuffer_Reset(&(GL_IndicatorData_X.RxStream_X));
+	GL_IndicatorData_X.RespIndex_UL = 0;
 }
 
 
@@ -208,6 +312,11 @@ unsigned int Indicator::getAlibiValue() {
 }
 
 
+void Indicator::commEvent(void) {
+    setIrq();
+    receive();
+}
+
 void Indicator::setIrq(void) {
     GL_IndicatorParam_X.IrqReceived_B = true;
 }
@@ -220,29 +329,32 @@ boolean Indicator::isInterruptReceived(void) {
     return GL_IndicatorParam_X.IrqReceived_B;
 }
 
-void Indicator::fifoPush(signed int Value_SI) {
+void Indicator::fifoPush(signed int Value_SI, unsigned long TimeStamp_UL) {
     if (!isFifoFull()) {
-        GL_pIndicatorFifo_SI[GL_IndicatorFifoPushIndex_UL] = Value_SI;
-        GL_IndicatorFifoPushIndex_UL = (GL_IndicatorFifoPushIndex_UL + 1) % INDICATOR_FIFO_MAX_NB;
+        GL_IndicatorData_X.pFifo_SI[GL_IndicatorData_X.FifoPushIndex_UL] = Value_SI;
+        GL_IndicatorData_X.pFifoTimeStamp_UL[GL_IndicatorData_X.FifoPushIndex_UL] = TimeStamp_UL;
+        GL_IndicatorData_X.FifoPushIndex_UL = (GL_IndicatorData_X.FifoPushIndex_UL + 1) % INDICATOR_FIFO_MAX_NB;
     }
 }
 
-signed int Indicator::fifoPop(void) {
+signed int Indicator::fifoPop(unsigned long * pTimeStamp_UL) {
     signed int Value_SI = 0;
     if (!isFifoEmpty()) {
-        Value_SI = GL_pIndicatorFifo_SI[GL_IndicatorFifoPopIndex_UL];
-        GL_IndicatorFifoPopIndex_UL = (GL_IndicatorFifoPopIndex_UL + 1) % INDICATOR_FIFO_MAX_NB;
+        Value_SI = GL_IndicatorData_X.pFifo_SI[GL_IndicatorData_X.FifoPopIndex_UL];
+        if (pTimeStamp_UL != NULL)
+            *pTimeStamp_UL = GL_IndicatorData_X.pFifoTimeStamp_UL[GL_IndicatorData_X.FifoPopIndex_UL];
+        GL_IndicatorData_X.FifoPopIndex_UL = (GL_IndicatorData_X.FifoPopIndex_UL + 1) % INDICATOR_FIFO_MAX_NB;
     }
     return Value_SI;
 }
 
 boolean Indicator::isFifoEmpty(void) {
-    return ((GL_IndicatorFifoPopIndex_UL == GL_IndicatorFifoPushIndex_UL) ? true : false);
+    return ((GL_IndicatorData_X.FifoPopIndex_UL == GL_IndicatorData_X.FifoPushIndex_UL) ? true : false);
 }
 
 boolean Indicator::isFifoFull(void) {
-    if (GL_IndicatorFifoPushIndex_UL >= GL_IndicatorFifoPopIndex_UL) {
-        if ((GL_IndicatorFifoPushIndex_UL - GL_IndicatorFifoPopIndex_UL) >= (INDICATOR_FIFO_MAX_NB - 1)) {
+    if (GL_IndicatorData_X.FifoPushIndex_UL >= GL_IndicatorData_X.FifoPopIndex_UL) {
+        if ((GL_IndicatorData_X.FifoPushIndex_UL - GL_IndicatorData_X.FifoPopIndex_UL) >= (INDICATOR_FIFO_MAX_NB - 1)) {
             return true;
         }
         else {
@@ -250,7 +362,7 @@ boolean Indicator::isFifoFull(void) {
         }
     }
     else {
-        if ((GL_IndicatorFifoPushIndex_UL + INDICATOR_FIFO_MAX_NB - GL_IndicatorFifoPopIndex_UL) >= (INDICATOR_FIFO_MAX_NB - 1)) {
+        if ((GL_IndicatorData_X.FifoPushIndex_UL + INDICATOR_FIFO_MAX_NB - GL_IndicatorData_X.FifoPopIndex_UL) >= (INDICATOR_FIFO_MAX_NB - 1)) {
             return true;
         }
         else {
@@ -6,6 +6,9 @@
 /*		Header file for Indicator.cpp												*/
 /*                                                                                  */
 /* History :  	06/06/2015  (RW)	Creation of this file							*/
+/*				18/10/2026	(RW)	Incremental frame assembler						*/
+/*				18/10/2026	(RW)	Add counter of validated responses				*/
+/*				18/10/2026	(RW)	Receive through a stream buffer (span access)	*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -19,16 +22,38 @@
 #include <HardwareSerial.h>
 
 #include "IndicatorInterface.h"
+#include "StreamBuffer.h"
 
 /* ******************************************************************************** */
 /* Define
 /* ******************************************************************************** */
 #define INDICATOR_DEFAULT_BAUDRATE			2400
 #define INDICATOR_ECHO_DEFAULT_BAUDRATE		9600
+#define INDICATOR_FIFO_MAX_NB				64
+#define INDICATOR_RX_STREAM_SIZE			128		// Power of 2
 
 /* ******************************************************************************** */
 /* Structure & Enumeration
 /* ******************************************************************************** */
+typedef struct {
+	HardwareSerial * pSerial_H;									// Serial connected to the indicator
+	HardwareSerial * pEcho_H;									// Serial to echo the frames (optional)
+	INDICATOR_INTERFACE_DEVICES_ENUM Device_E;
+	STREAM_BUFFER_STRUCT RxStream_X;							// Bytes taken from the serial, parsed by spans
+	unsigned char pRxStream_UB[INDICATOR_RX_STREAM_SIZE];
+	unsigned char pBuffer_UB[INDICATOR_INTERFACE_MAX_RESP_SIZE];
+	INDICATOR_INTERFACE_FRAME_ENUM RespFrame_E;					// Response expected by the frame assembler
+	unsigned long RespIndex_UL;									// Number of bytes assembled in pBuffer_UB
+	boolean IsFrameReady_B;										// A validated response has been decoded
+	boolean IsStreamed_B;										// Push each validated response into the FIFO
+	unsigned long FrameTimeStamp_UL;							// millis() when the last validated response was completed
+	unsigned long ResyncNb_UL;									// Number of bytes dropped to resynchronize
+	unsigned long FrameNb_UL;									// Number of validated responses (new weight)
+	unsigned long FifoPushIndex_UL;
+	unsigned long FifoPopIndex_UL;
+	signed int pFifo_SI[INDICATOR_FIFO_MAX_NB];
+	unsigned long pFifoTimeStamp_UL[INDICATOR_FIFO_MAX_NB];
+} INDICATOR_DATA_STRUCT;
 
 /* ******************************************************************************** */
 /* Class
@@ -60,6 +85,13 @@ public:
 	boolean isResponseAvailable(INDICATOR_INTERFACE_FRAME_ENUM Frame_E);
 	void processFrame(INDICATOR_INTERFACE_FRAME_ENUM Frame_E);
 
+	void receive(void);
+	void startStream(INDICATOR_INTERFACE_FRAME_ENUM Frame_E);
+	void stopStream(void);
+	unsigned long getFrameTimeStamp(void);
+	unsigned long getResyncNumber(void);
+	unsigned long getFrameNumber(void);
+
 	void flushIndicator(void);
 
 	INDICATOR_WEIGHT_STATUS_ENUM getWeightStatus();
@@ -68,17 +100,19 @@ public:
 	unsigned int getWeightUnsignedValue();
 	unsigned int getAlibiValue();
 
+    void commEvent(void);
     void setIrq(void);
     void resetIrq(void);
     boolean isInterruptReceived(void);
 
-    void fifoPush(signed int Value_SI);
-    signed int fifoPop(void);
+    void fifoPush(signed int Value_SI, unsigned long TimeStamp_UL);
+    signed int fifoPop(unsigned long * pTimeStamp_UL = NULL);
     boolean isFifoEmpty(void);
     boolean isFifoFull(void);
 
 
 	INDICATOR_PARAM GL_IndicatorParam_X;
+	INDICATOR_DATA_STRUCT GL_IndicatorData_X;
 };
 
 #endif // __INDICATOR_H__
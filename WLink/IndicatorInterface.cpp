@@ -7,6 +7,7 @@
 /*                                                                                  */
 /* History :  	07/06/2016  (RW)	Creation of this file                           */
 /*              29/04/2017  (RW)    Add GI400 indicator                             */
+/*              18/10/2026  (RW)    Add response delimiter and validation function  */
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -35,18 +36,22 @@ void IndicatorInterface_Init(void) {
 
 	// Fill-Up LD5218 Parameters and Function
 	GL_pIndicatorInterface_X[INDICATOR_LD5218].FctHandler = LD5218_ProcessFrame;
+	GL_pIndicatorInterface_X[INDICATOR_LD5218].FctIsValid = LD5218_IsFrameValid;
 	for (int i = 0; i < INDICATOR_INTERFACE_FRAME_NUM; i++) {
 		GL_pIndicatorInterface_X[INDICATOR_LD5218].pFrame[i].Size_UB = GL_pLD5218Frames_X[i].Size_UB;
 		GL_pIndicatorInterface_X[INDICATOR_LD5218].pFrame[i].RespSize_UB = GL_pLD5218Frames_X[i].RespSize_UB;
+		GL_pIndicatorInterface_X[INDICATOR_LD5218].pFrame[i].RespEnd_UB = GL_pLD5218Frames_X[i].RespEnd_UB;
 		for (int j = 0; j < GL_pIndicatorInterface_X[INDICATOR_LD5218].pFrame[i].Size_UB; j++)
 			GL_pIndicatorInterface_X[INDICATOR_LD5218].pFrame[i].pWords_UB[j] = GL_pLD5218Frames_X[i].pWords_UB[j];
 	}
 
     // Fill-Up GI400 Parameters and Function
     GL_pIndicatorInterface_X[INDICATOR_GI400].FctHandler = GI400_ProcessFrame;
+    GL_pIndicatorInterface_X[INDICATOR_GI400].FctIsValid = GI400_IsFrameValid;
     for (int i = 0; i < INDICATOR_INTERFACE_FRAME_NUM; i++) {
         GL_pIndicatorInterface_X[INDICATOR_GI400].pFrame[i].Size_UB = GL_pGI400Frames_X[i].Size_UB;
         GL_pIndicatorInterface_X[INDICATOR_GI400].pFrame[i].RespSize_UB = GL_pGI400Frames_X[i].RespSize_UB;
+        GL_pIndicatorInterface_X[INDICATOR_GI400].pFrame[i].RespEnd_UB = GL_pGI400Frames_X[i].RespEnd_UB;
         for (int j = 0; j < GL_pIndicatorInterface_X[INDICATOR_GI400].pFrame[i].Size_UB; j++)
             GL_pIndicatorInterface_X[INDICATOR_GI400].pFrame[i].pWords_UB[j] = GL_pGI400Frames_X[i].pWords_UB[j];
     }
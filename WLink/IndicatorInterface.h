@@ -6,6 +6,7 @@
 /*		TODO																		*/
 /*                                                                                  */
 /* History :  	07/06/2015  (RW)	Creation of this file							*/
+/*				18/10/2026	(RW)	Add response delimiter and validation function	*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -80,11 +81,13 @@ typedef struct {
 	char Size_UB;
 	char pWords_UB[INDICATOR_INTERFACE_MAX_FRAME_SIZE];
 	char RespSize_UB;
+	char RespEnd_UB;			// Last byte of the response (0x00 = no delimiter, size only)
 } INDICATOR_INTERFACE_FRAME_STRUCT;
 
 typedef struct {
 	INDICATOR_INTERFACE_FRAME_STRUCT pFrame[INDICATOR_INTERFACE_FRAME_NUM];
 	void(*FctHandler)(unsigned char *, INDICATOR_INTERFACE_FRAME_ENUM, INDICATOR_WEIGHT_STRUCT *);
+	boolean(*FctIsValid)(const unsigned char *, INDICATOR_INTERFACE_FRAME_ENUM);		// Check the content of a complete response
 } INDICATOR_INTERFACE_STRUCT;
 
 /* ******************************************************************************** */
@@ -7,6 +7,10 @@
 /*                                                                                  */
 /* History :  	02/06/2015  (RW)	Creation of this file                           */
 /*				08/06/2016  (RW)	Re-mastered version								*/
+/*				18/10/2026  (RW)	One state machine per indicator (round-robin)	*/
+/*				18/10/2026  (RW)	Use the frame assembler of the Indicator		*/
+/*				18/10/2026  (RW)	Programmable and adaptive timings				*/
+/*				18/10/2026  (RW)	Publish new weights on the Event Bus			*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -17,8 +21,10 @@
 /* ******************************************************************************** */
 
 #include "IndicatorManager.h"
+#include "EventBus.h"
 
 #include "Debug.h"
+#include "LoopProfiler.h"
 
 
 /* ******************************************************************************** */
@@ -37,102 +43,199 @@ enum INDICATOR_MANAGER_STATE {
 	INDICATOR_MANAGER_WAIT_RESET_DELAY
 } ;
 
-static INDICATOR_MANAGER_STATE GL_IndicatorManager_CurrentState_E = INDICATOR_MANAGER_STATE::INDICATOR_MANAGER_IDLE;
-
-static Indicator * GL_pIndicator_H;
-
-
 typedef struct {
+	INDICATOR_MANAGER_STATE CurrentState_E;
+	Indicator * pIndicator_H;
+	unsigned char Idx_UB;
 	boolean IsEnabled_B;
     boolean HasInterrupt_B;
 	boolean SetToZero_B;
     boolean AutomaticFlush_B;
-	unsigned long Timer_UL;
+	unsigned long Timer_UL;					// Time of the first request -> reference for the scan period
+	unsigned long TryTimer_UL;				// Time of the last request -> reference for the response delay
 	unsigned long ScanPeriod_UL;
 	unsigned long ResponseDelay_UL;
 	unsigned long ResetDelay_UL;
 	unsigned char MaxTryNumber_UB;
 	unsigned char TryNumber_UB;
 	INDICATOR_INTERFACE_FRAME_ENUM FrameType_E;
+	boolean IsAdaptive_B;
+	unsigned long AdaptiveScanPeriod_UL;
+	unsigned long AdaptiveResponseDelay_UL;
+	unsigned long LatencyP99_UL;
+	unsigned long LatencySampleNb_UL;
+	unsigned long pLatencyHisto_UL[INDICATOR_MANAGER_LATENCY_BUCKET_NB];
+	unsigned long FrameNb_UL;				// Validated responses already published
 } INDICATOR_MANAGER_PARAM;
 
-static INDICATOR_MANAGER_PARAM GL_IndicatorManagerParam_X;
+static INDICATOR_MANAGER_PARAM GL_pIndicatorManagerParam_X[INDICATOR_MANAGER_MAX_NB];
+static unsigned char GL_IndicatorManagerNextIdx_UB = 0;		// Next indicator to process (round-robin)
 
 /* ******************************************************************************** */
 /* Prototypes for Internal Functions
 /* ******************************************************************************** */
-static void ProcessIdle(void);
-static void ProcessWaitInterrupt(void);
-static void ProcessWaitScanPeriod(void);
-static void ProcessWaitResponseDelay(void);
-static void ProcessWaitResetDelay(void);
-
-static void TransitionToIdle(void);
-static void TransitionToWaitInterrupt(void);
-static void TransitionToWaitScanPeriod(void);
-static void TransitionToWaitResponseDelay(void);
-static void TransitionToWaitResetDelay(void);
+static void ProcessIdle(INDICATOR_MANAGER_PARAM * pParam_X);
+static void ProcessWaitInterrupt(INDICATOR_MANAGER_PARAM * pParam_X);
+static void ProcessWaitScanPeriod(INDICATOR_MANAGER_PARAM * pParam_X);
+static void ProcessWaitResponseDelay(INDICATOR_MANAGER_PARAM * pParam_X);
+static void ProcessWaitResetDelay(INDICATOR_MANAGER_PARAM * pParam_X);
+
+static void TransitionToIdle(INDICATOR_MANAGER_PARAM * pParam_X);
+static void TransitionToWaitInterrupt(INDICATOR_MANAGER_PARAM * pParam_X);
+static void TransitionToWaitScanPeriod(INDICATOR_MANAGER_PARAM * pParam_X);
+static void TransitionToWaitResponseDelay(INDICATOR_MANAGER_PARAM * pParam_X);
+static void TransitionToWaitResetDelay(INDICATOR_MANAGER_PARAM * pParam_X);
+
+static unsigned long GetScanPeriod(INDICATOR_MANAGER_PARAM * pParam_X);
+static unsigned long GetResponseDelay(INDICATOR_MANAGER_PARAM * pParam_X);
+static void ResetLatency(INDICATOR_MANAGER_PARAM * pParam_X);
+static void AddLatencySample(INDICATOR_MANAGER_PARAM * pParam_X, unsigned long Latency_UL);
+static void PublishWeight(INDICATOR_MANAGER_PARAM * pParam_X);
 
 /* ******************************************************************************** */
 /* Functions
 /* ******************************************************************************** */
-void IndicatorManager_Init(Indicator * pIndicator_H) {
-	GL_IndicatorManager_CurrentState_E = INDICATOR_MANAGER_STATE::INDICATOR_MANAGER_IDLE;
-	GL_pIndicator_H = pIndicator_H;
-	GL_IndicatorManagerParam_X.IsEnabled_B = false;
-    GL_IndicatorManagerParam_X.HasInterrupt_B = false;
-	GL_IndicatorManagerParam_X.SetToZero_B = false;
-    GL_IndicatorManagerParam_X.AutomaticFlush_B = false;
-	GL_IndicatorManagerParam_X.ScanPeriod_UL = INDICATOR_MANAGER_DEFAULT_SCAN_PERIOD;		// TODO : Add function to make it programmable
-	GL_IndicatorManagerParam_X.ResponseDelay_UL = INDICATOR_MANAGER_DEFAULT_RESPONSE_DELAY;	// TODO : Add function to make it programmable
-	GL_IndicatorManagerParam_X.ResetDelay_UL = INDICATOR_MANAGER_DEFAULT_RESET_DELAY;		// TODO : Add function to make it programmable
-	GL_IndicatorManagerParam_X.TryNumber_UB = 0;
-	GL_IndicatorManagerParam_X.MaxTryNumber_UB = INDICATOR_MANAGER_DEFAULT_MAX_TRY_NUMBER;	// TODO : Add function to make it programmable
-	GL_IndicatorManagerParam_X.FrameType_E = INDICATOR_INTERFACE_FRAME_ASK_WEIGHT;			// TODO : Add function to make it programmable
-	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Indicator Manager Initialized");
+void IndicatorManager_Init(unsigned char Idx_UB, Indicator * pIndicator_H) {
+	INDICATOR_MANAGER_PARAM * pParam_X;
+
+	if (Idx_UB >= INDICATOR_MANAGER_MAX_NB)
+		return;
+
+	pParam_X = &GL_pIndicatorManagerParam_X[Idx_UB];
+	pParam_X->CurrentState_E = INDICATOR_MANAGER_STATE::INDICATOR_MANAGER_IDLE;
+	pParam_X->pIndicator_H = pIndicator_H;
+	pParam_X->Idx_UB = Idx_UB;
+	pParam_X->IsEnabled_B = false;
+    pParam_X->HasInterrupt_B = false;
+	pParam_X->SetToZero_B = false;
+    pParam_X->AutomaticFlush_B = false;
+	pParam_X->ScanPeriod_UL = INDICATOR_MANAGER_DEFAULT_SCAN_PERIOD;		// See IndicatorManager_SetTiming()
+	pParam_X->ResponseDelay_UL = INDICATOR_MANAGER_DEFAULT_RESPONSE_DELAY;
+	pParam_X->ResetDelay_UL = INDICATOR_MANAGER_DEFAULT_RESET_DELAY;
+	pParam_X->TryNumber_UB = 0;
+	pParam_X->MaxTryNumber_UB = INDICATOR_MANAGER_DEFAULT_MAX_TRY_NUMBER;
+	pParam_X->FrameType_E = INDICATOR_INTERFACE_FRAME_ASK_WEIGHT;			// See IndicatorManager_Enable()
+	pParam_X->IsAdaptive_B = false;
+	pParam_X->FrameNb_UL = pIndicator_H->getFrameNumber();
+	ResetLatency(pParam_X);
+
+	DBG_PRINT(DEBUG_SEVERITY_INFO, "Indicator Manager Initialized [");
+	DBG_PRINTDATA(Idx_UB);
+	DBG_PRINTDATA("]");
+	DBG_ENDSTR();
+}
+
+void IndicatorManager_Enable(unsigned char Idx_UB, INDICATOR_INTERFACE_FRAME_ENUM FrameType_E, boolean HasInterrupt_B, boolean AutomaticFlush_B) {
+	if (Idx_UB >= INDICATOR_MANAGER_MAX_NB)
+		return;
+
+	if (GL_pIndicatorManagerParam_X[Idx_UB].FrameType_E != FrameType_E)
+		ResetLatency(&GL_pIndicatorManagerParam_X[Idx_UB]);	// Latency depends on the frame
+
+	GL_pIndicatorManagerParam_X[Idx_UB].FrameType_E = FrameType_E;
+	GL_pIndicatorManagerParam_X[Idx_UB].IsEnabled_B = true;
+    GL_pIndicatorManagerParam_X[Idx_UB].HasInterrupt_B = HasInterrupt_B;
+    GL_pIndicatorManagerParam_X[Idx_UB].AutomaticFlush_B = AutomaticFlush_B;
 }
 
-void IndicatorManager_Enable(INDICATOR_INTERFACE_FRAME_ENUM FrameType_E, boolean HasInterrupt_B, boolean AutomaticFlush_B) {
-	GL_IndicatorManagerParam_X.FrameType_E = FrameType_E;
-	GL_IndicatorManagerParam_X.IsEnabled_B = true;
-    GL_IndicatorManagerParam_X.HasInterrupt_B = HasInterrupt_B;
-    GL_IndicatorManagerParam_X.AutomaticFlush_B = AutomaticFlush_B;
+void IndicatorManager_Disable(unsigned char Idx_UB) {
+	if (Idx_UB < INDICATOR_MANAGER_MAX_NB)
+		GL_pIndicatorManagerParam_X[Idx_UB].IsEnabled_B = false;
 }
 
-void IndicatorManager_Disable() {
-	GL_IndicatorManagerParam_X.IsEnabled_B = false;
+void IndicatorManager_SetZeroIndicator(unsigned char Idx_UB) {
+	if (Idx_UB < INDICATOR_MANAGER_MAX_NB)
+		GL_pIndicatorManagerParam_X[Idx_UB].SetToZero_B = true;
 }
 
-void IndicatorManager_SetZeroIndicator() {
-	GL_IndicatorManagerParam_X.SetToZero_B = true;
+// A null value keeps the default value
+void IndicatorManager_SetTiming(unsigned char Idx_UB, unsigned long ScanPeriod_UL, unsigned long ResponseDelay_UL, unsigned long ResetDelay_UL, unsigned char MaxTryNumber_UB, boolean IsAdaptive_B) {
+	INDICATOR_MANAGER_PARAM * pParam_X;
+
+	if (Idx_UB >= INDICATOR_MANAGER_MAX_NB)
+		return;
+
+	pParam_X = &GL_pIndicatorManagerParam_X[Idx_UB];
+	pParam_X->ScanPeriod_UL = (ScanPeriod_UL != 0) ? ScanPeriod_UL : INDICATOR_MANAGER_DEFAULT_SCAN_PERIOD;
+	pParam_X->ResponseDelay_UL = (ResponseDelay_UL != 0) ? ResponseDelay_UL : INDICATOR_MANAGER_DEFAULT_RESPONSE_DELAY;
+	pParam_X->ResetDelay_UL = (ResetDelay_UL != 0) ? ResetDelay_UL : INDICATOR_MANAGER_DEFAULT_RESET_DELAY;
+	pParam_X->MaxTryNumber_UB = (MaxTryNumber_UB != 0) ? MaxTryNumber_UB : INDICATOR_MANAGER_DEFAULT_MAX_TRY_NUMBER;
+	pParam_X->IsAdaptive_B = IsAdaptive_B;
+	ResetLatency(pParam_X);
+
+	DBG_PRINT(DEBUG_SEVERITY_INFO, "Timing [");
+	DBG_PRINTDATA(Idx_UB);
+	DBG_PRINTDATA("] : Scan = ");
+	DBG_PRINTDATA(pParam_X->ScanPeriod_UL);
+	DBG_PRINTDATA(" - Response = ");
+	DBG_PRINTDATA(pParam_X->ResponseDelay_UL);
+	DBG_PRINTDATA(" - Reset = ");
+	DBG_PRINTDATA(pParam_X->ResetDelay_UL);
+	DBG_PRINTDATA("[ms] - Max Try = ");
+	DBG_PRINTDATA(pParam_X->MaxTryNumber_UB);
+	DBG_PRINTDATA((IsAdaptive_B ? " - Adaptive" : ""));
+	DBG_ENDSTR();
 }
 
 void IndicatorManager_Process() {
-	switch (GL_IndicatorManager_CurrentState_E) {
+	INDICATOR_MANAGER_PARAM * pParam_X = NULL;
+
+	// Process one indicator per call -> each state machine is scheduled in turn
+	for (unsigned char i = 0; (i < INDICATOR_MANAGER_MAX_NB) && (pParam_X == NULL); i++) {
+		if (GL_pIndicatorManagerParam_X[GL_IndicatorManagerNextIdx_UB].pIndicator_H != NULL)
+			pParam_X = &GL_pIndicatorManagerParam_X[GL_IndicatorManagerNextIdx_UB];
+
+		GL_IndicatorManagerNextIdx_UB = (GL_IndicatorManagerNextIdx_UB + 1) % INDICATOR_MANAGER_MAX_NB;
+	}
+
+	if (pParam_X == NULL)
+		return;
+
+	LOOP_PROFILER_SET_STATE(LOOP_PROFILER_ID_INDICATOR, pParam_X->CurrentState_E);
+	switch (pParam_X->CurrentState_E) {
 	case INDICATOR_MANAGER_IDLE:
-		ProcessIdle();
+		ProcessIdle(pParam_X);
 		break;
 
     case INDICATOR_MANAGER_WAIT_INTERRUPT:
-        ProcessWaitInterrupt();
+        ProcessWaitInterrupt(pParam_X);
         break;
 
 	case INDICATOR_MANAGER_WAIT_SCAN_PERIOD:
-		ProcessWaitScanPeriod();
+		ProcessWaitScanPeriod(pParam_X);
 		break;
 
 	case INDICATOR_MANAGER_WAIT_RESPONSE_DELAY:
-		ProcessWaitResponseDelay();
+		ProcessWaitResponseDelay(pParam_X);
 		break;
 
 	case INDICATOR_MANAGER_WAIT_RESET_DELAY:
-		ProcessWaitResetDelay();
+		ProcessWaitResetDelay(pParam_X);
 		break;
 	}
+
+	PublishWeight(pParam_X);
 }
 
-boolean IndicatorManager_IsRunning() {
-    return ((GL_IndicatorManager_CurrentState_E != INDICATOR_MANAGER_IDLE) ? true : false);
+boolean IndicatorManager_IsRunning(unsigned char Idx_UB) {
+	if (Idx_UB >= INDICATOR_MANAGER_MAX_NB)
+		return false;
+
+    return ((GL_pIndicatorManagerParam_X[Idx_UB].CurrentState_E != INDICATOR_MANAGER_IDLE) ? true : false);
+}
+
+boolean IndicatorManager_GetLatency(unsigned char Idx_UB, INDICATOR_MANAGER_LATENCY_STRUCT * pLatency_X) {
+	if (Idx_UB >= INDICATOR_MANAGER_MAX_NB)
+		return false;
+
+	INDICATOR_MANAGER_PARAM * pParam_X = &GL_pIndicatorManagerParam_X[Idx_UB];
+
+	pLatency_X->ScanPeriod_UL = GetScanPeriod(pParam_X);
+	pLatency_X->ResponseDelay_UL = GetResponseDelay(pParam_X);
+	pLatency_X->LatencyP99_UL = pParam_X->LatencyP99_UL;
+	pLatency_X->SampleNb_UL = pParam_X->LatencySampleNb_UL;
+
+	return true;
 }
 
 
@@ -140,125 +243,222 @@ boolean IndicatorManager_IsRunning() {
 /* Internal Functions
 /* ******************************************************************************** */
 
-void ProcessIdle(void) {
-    if (GL_pIndicator_H->isInitialized() && GL_IndicatorManagerParam_X.IsEnabled_B) {
-        if (GL_IndicatorManagerParam_X.HasInterrupt_B)
-            TransitionToWaitInterrupt();
+void ProcessIdle(INDICATOR_MANAGER_PARAM * pParam_X) {
+    if (pParam_X->pIndicator_H->isInitialized() && pParam_X->IsEnabled_B) {
+        if (pParam_X->HasInterrupt_B)
+            TransitionToWaitInterrupt(pParam_X);
         else
-            TransitionToWaitResponseDelay();
+            TransitionToWaitResponseDelay(pParam_X);
     }
 }
 
-void ProcessWaitInterrupt(void) {
-    if (GL_IndicatorManagerParam_X.IsEnabled_B) {
-        // Check if interrupt is received
-        if (GL_pIndicator_H->isInterruptReceived()) {
-            // Get frame
-            if (GL_pIndicator_H->isResponseAvailable(GL_IndicatorManagerParam_X.FrameType_E)) {
-                GL_pIndicator_H->processFrame(GL_IndicatorManagerParam_X.FrameType_E);
-
-                if (GL_IndicatorManagerParam_X.AutomaticFlush_B)
-                    GL_pIndicator_H->flushIndicator();
-
-                // Push into FIFO if not full
-                if (!(GL_pIndicator_H->isFifoFull())) {
-                    DBG_PRINT(DEBUG_SEVERITY_INFO, "Push new value into FIFO : ");
-                    DBG_PRINTDATA(GL_pIndicator_H->getWeightValue());
-                    DBG_ENDSTR();
-                    GL_pIndicator_H->fifoPush(GL_pIndicator_H->getWeightValue());
-                }
-
-            }
+void ProcessWaitInterrupt(INDICATOR_MANAGER_PARAM * pParam_X) {
+    if (pParam_X->IsEnabled_B) {
+        // Check if interrupt is received - Frames are assembled and pushed into the FIFO by the Indicator
+        if (pParam_X->pIndicator_H->isInterruptReceived()) {
+            pParam_X->pIndicator_H->receive();
+
+            if (pParam_X->AutomaticFlush_B)
+                pParam_X->pIndicator_H->flushIndicator();
+
             // Reset interrupt flag
-            GL_pIndicator_H->resetIrq();
+            pParam_X->pIndicator_H->resetIrq();
         }
     }
     else {
-        TransitionToIdle();
+        TransitionToIdle(pParam_X);
     }
 }
 
-void ProcessWaitScanPeriod(void) {
-	if (GL_IndicatorManagerParam_X.IsEnabled_B) {
-		if ((millis() - GL_IndicatorManagerParam_X.Timer_UL) >= GL_IndicatorManagerParam_X.ScanPeriod_UL)
-			TransitionToWaitResponseDelay();
-		else if (GL_IndicatorManagerParam_X.SetToZero_B)
-			TransitionToWaitResetDelay();
+void ProcessWaitScanPeriod(INDICATOR_MANAGER_PARAM * pParam_X) {
+	if (pParam_X->IsEnabled_B) {
+		if ((millis() - pParam_X->Timer_UL) >= GetScanPeriod(pParam_X))
+			TransitionToWaitResponseDelay(pParam_X);
+		else if (pParam_X->SetToZero_B)
+			TransitionToWaitResetDelay(pParam_X);
 	} else {
-		TransitionToIdle();
+		TransitionToIdle(pParam_X);
 	}
 }
 
-void ProcessWaitResponseDelay(void) {
-	boolean ResponseDelayCondition_B = false;
+void ProcessWaitResponseDelay(INDICATOR_MANAGER_PARAM * pParam_X) {
+
+	// Response is taken as soon as it is assembled
+	if (pParam_X->pIndicator_H->isResponseAvailable(pParam_X->FrameType_E)) {
+		DBG_PRINT(DEBUG_SEVERITY_INFO, "Weight Available - Delay = ");
+		DBG_PRINTDATA((pParam_X->pIndicator_H->getFrameTimeStamp() - pParam_X->Timer_UL));
+		DBG_PRINTDATA("[ms]");
+		DBG_ENDSTR();
+
+		// Only the answers to a first request are measured : an answer after a retry may belong to the previous request
+		if (pParam_X->TryNumber_UB == 0)
+			AddLatencySample(pParam_X, pParam_X->pIndicator_H->getFrameTimeStamp() - pParam_X->TryTimer_UL);
+
+		pParam_X->pIndicator_H->processFrame(pParam_X->FrameType_E);
+        if (pParam_X->AutomaticFlush_B)
+            pParam_X->pIndicator_H->flushIndicator();
+		TransitionToWaitScanPeriod(pParam_X);
+		return;
+	}
 
-	if ((millis() - GL_IndicatorManagerParam_X.Timer_UL) >= (GL_IndicatorManagerParam_X.ResponseDelay_UL * (GL_IndicatorManagerParam_X.TryNumber_UB + 1))) {
-		ResponseDelayCondition_B = true;
+	// No response within the delay -> ask again (same window for each try)
+	if ((millis() - pParam_X->TryTimer_UL) >= GetResponseDelay(pParam_X)) {
 		DBG_PRINT(DEBUG_SEVERITY_INFO, "Response Delay with Try Number = ");
-		DBG_PRINTDATA((GL_IndicatorManagerParam_X.TryNumber_UB+1)); // add 1 because start from 0
+		DBG_PRINTDATA((pParam_X->TryNumber_UB+1)); // add 1 because start from 0
 		DBG_PRINTDATA(" - Delay = ");
-		DBG_PRINTDATA((millis() - GL_IndicatorManagerParam_X.Timer_UL));
+		DBG_PRINTDATA((millis() - pParam_X->Timer_UL));
 		DBG_PRINTDATA("[ms]");
 		DBG_ENDSTR();
-	}
 
-	if (ResponseDelayCondition_B) {
-		if (GL_pIndicator_H->isResponseAvailable(GL_IndicatorManagerParam_X.FrameType_E)) {
-			DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Weight Available");
-			GL_pIndicator_H->processFrame(GL_IndicatorManagerParam_X.FrameType_E);
-            if (GL_IndicatorManagerParam_X.AutomaticFlush_B)
-                GL_pIndicator_H->flushIndicator();
-			TransitionToWaitScanPeriod();
+		if (pParam_X->TryNumber_UB >= (pParam_X->MaxTryNumber_UB - 1)) {
+			DBG_PRINT(DEBUG_SEVERITY_WARNING, "Max Try Number Reached [");
+			DBG_PRINTDATA(pParam_X->MaxTryNumber_UB);
+			DBG_PRINTDATA("] -> Flush Indicator");
+			DBG_ENDSTR();
+			pParam_X->pIndicator_H->flushIndicator();
+
+			// Adapted timings are too tight -> back to the configured ones until new samples are gathered
+			if (pParam_X->IsAdaptive_B)
+				ResetLatency(pParam_X);
+
+			TransitionToWaitScanPeriod(pParam_X);
 		} else {
-			if (GL_IndicatorManagerParam_X.TryNumber_UB >= (GL_IndicatorManagerParam_X.MaxTryNumber_UB - 1)) {
-				DBG_PRINT(DEBUG_SEVERITY_WARNING, "Max Try Number Reached [");
-				DBG_PRINTDATA(GL_IndicatorManagerParam_X.MaxTryNumber_UB);
-				DBG_PRINTDATA("] -> Flush Indicator");
-				DBG_ENDSTR();
-				GL_pIndicator_H->flushIndicator();
-				TransitionToWaitScanPeriod();
-			} else {
-				DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Ask Again");
-				GL_pIndicator_H->sendFrame(GL_IndicatorManagerParam_X.FrameType_E);
-				GL_IndicatorManagerParam_X.TryNumber_UB++;
-			}
+			DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Ask Again");
+			pParam_X->pIndicator_H->sendFrame(pParam_X->FrameType_E);
+			pParam_X->TryTimer_UL = millis();
+			pParam_X->TryNumber_UB++;
 		}
 	}
 }
 
-void ProcessWaitResetDelay(void) {
-	if ((millis() - GL_IndicatorManagerParam_X.Timer_UL) >= GL_IndicatorManagerParam_X.ResetDelay_UL) {
-		GL_IndicatorManagerParam_X.SetToZero_B = false;
-		TransitionToWaitScanPeriod();
+void ProcessWaitResetDelay(INDICATOR_MANAGER_PARAM * pParam_X) {
+	if ((millis() - pParam_X->Timer_UL) >= pParam_X->ResetDelay_UL) {
+		pParam_X->SetToZero_B = false;
+		TransitionToWaitScanPeriod(pParam_X);
 	}
 }
 
 
-void TransitionToIdle(void) {
-	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To IDLE");
-	GL_IndicatorManager_CurrentState_E = INDICATOR_MANAGER_STATE::INDICATOR_MANAGER_IDLE;
+void TransitionToIdle(INDICATOR_MANAGER_PARAM * pParam_X) {
+	DBG_PRINT(DEBUG_SEVERITY_INFO, "Transition To IDLE [");
+	DBG_PRINTDATA(pParam_X->Idx_UB);
+	DBG_PRINTDATA("]");
+	DBG_ENDSTR();
+	pParam_X->pIndicator_H->stopStream();
+	pParam_X->CurrentState_E = INDICATOR_MANAGER_STATE::INDICATOR_MANAGER_IDLE;
+}
+
+void TransitionToWaitInterrupt(INDICATOR_MANAGER_PARAM * pParam_X) {
+	DBG_PRINT(DEBUG_SEVERITY_INFO, "Transition To WAIT INTERRUPT [");
+	DBG_PRINTDATA(pParam_X->Idx_UB);
+	DBG_PRINTDATA("]");
+	DBG_ENDSTR();
+    pParam_X->pIndicator_H->startStream(pParam_X->FrameType_E);
+    pParam_X->CurrentState_E = INDICATOR_MANAGER_STATE::INDICATOR_MANAGER_WAIT_INTERRUPT;
+}
+
+static void TransitionToWaitScanPeriod(INDICATOR_MANAGER_PARAM * pParam_X) {
+	DBG_PRINT(DEBUG_SEVERITY_INFO, "Transition To WAIT SCAN PERIOD [");
+	DBG_PRINTDATA(pParam_X->Idx_UB);
+	DBG_PRINTDATA("]");
+	DBG_ENDSTR();
+	pParam_X->CurrentState_E = INDICATOR_MANAGER_STATE::INDICATOR_MANAGER_WAIT_SCAN_PERIOD;
+}
+
+static void TransitionToWaitResponseDelay(INDICATOR_MANAGER_PARAM * pParam_X) {
+	DBG_PRINT(DEBUG_SEVERITY_INFO, "Transition To WAIT RESPONSE DELAY [");
+	DBG_PRINTDATA(pParam_X->Idx_UB);
+	DBG_PRINTDATA("]");
+	DBG_ENDSTR();
+	pParam_X->Timer_UL = millis();
+	pParam_X->TryTimer_UL = pParam_X->Timer_UL;
+	pParam_X->TryNumber_UB = 0;
+	pParam_X->pIndicator_H->sendFrame(pParam_X->FrameType_E);
+	pParam_X->CurrentState_E = INDICATOR_MANAGER_STATE::INDICATOR_MANAGER_WAIT_RESPONSE_DELAY;
+}
+
+static void TransitionToWaitResetDelay(INDICATOR_MANAGER_PARAM * pParam_X) {
+	DBG_PRINT(DEBUG_SEVERITY_INFO, "Transition To WAIT RESET DELAY [");
+	DBG_PRINTDATA(pParam_X->Idx_UB);
+	DBG_PRINTDATA("]");
+	DBG_ENDSTR();
+	pParam_X->pIndicator_H->sendFrame(INDICATOR_INTERFACE_FRAME_SET_ZERO);
+	pParam_X->CurrentState_E = INDICATOR_MANAGER_STATE::INDICATOR_MANAGER_WAIT_RESET_DELAY;
+}
+
+
+unsigned long GetScanPeriod(INDICATOR_MANAGER_PARAM * pParam_X) {
+	return ((pParam_X->IsAdaptive_B && (pParam_X->LatencyP99_UL != 0)) ? pParam_X->AdaptiveScanPeriod_UL : pParam_X->ScanPeriod_UL);
 }
 
-void TransitionToWaitInterrupt(void) {
-    DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To WAIT INTERRUPT");
-    GL_IndicatorManager_CurrentState_E = INDICATOR_MANAGER_STATE::INDICATOR_MANAGER_WAIT_INTERRUPT;
+unsigned long GetResponseDelay(INDICATOR_MANAGER_PARAM * pParam_X) {
+	return ((pParam_X->IsAdaptive_B && (pParam_X->LatencyP99_UL != 0)) ? pParam_X->AdaptiveResponseDelay_UL : pParam_X->ResponseDelay_UL);
 }
 
-static void TransitionToWaitScanPeriod(void) {
-	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To WAIT SCAN PERIOD");
-	GL_IndicatorManager_CurrentState_E = INDICATOR_MANAGER_STATE::INDICATOR_MANAGER_WAIT_SCAN_PERIOD;
+void ResetLatency(INDICATOR_MANAGER_PARAM * pParam_X) {
+	memset(pParam_X->pLatencyHisto_UL, 0x00, sizeof(pParam_X->pLatencyHisto_UL));
+	pParam_X->LatencySampleNb_UL = 0;
+	pParam_X->LatencyP99_UL = 0;
 }
 
-static void TransitionToWaitResponseDelay(void) {
-	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To WAIT RESPONSE DELAY");
-	GL_IndicatorManagerParam_X.Timer_UL = millis();
-	GL_IndicatorManagerParam_X.TryNumber_UB = 0;
-	GL_pIndicator_H->sendFrame(GL_IndicatorManagerParam_X.FrameType_E);
-	GL_IndicatorManager_CurrentState_E = INDICATOR_MANAGER_STATE::INDICATOR_MANAGER_WAIT_RESPONSE_DELAY;
+void AddLatencySample(INDICATOR_MANAGER_PARAM * pParam_X, unsigned long Latency_UL) {
+	unsigned long Idx_UL = Latency_UL / INDICATOR_MANAGER_LATENCY_BUCKET_WIDTH;
+	unsigned long Threshold_UL = 0;
+	unsigned long Sum_UL = 0;
+	unsigned long Window_UL = 0;
+	unsigned long Margin_UL = 0;
+
+	if (Idx_UL >= INDICATOR_MANAGER_LATENCY_BUCKET_NB)
+		Idx_UL = INDICATOR_MANAGER_LATENCY_BUCKET_NB - 1;
+
+	pParam_X->pLatencyHisto_UL[Idx_UL]++;
+	pParam_X->LatencySampleNb_UL++;
+
+	// Halve the histogram to follow a change of the line (device, baudrate, cable..)
+	if (pParam_X->LatencySampleNb_UL >= INDICATOR_MANAGER_LATENCY_WINDOW) {
+		pParam_X->LatencySampleNb_UL = 0;
+		for (int i = 0; i < INDICATOR_MANAGER_LATENCY_BUCKET_NB; i++) {
+			pParam_X->pLatencyHisto_UL[i] /= 2;
+			pParam_X->LatencySampleNb_UL += pParam_X->pLatencyHisto_UL[i];
+		}
+	}
+
+	if (!(pParam_X->IsAdaptive_B) || (pParam_X->LatencySampleNb_UL < INDICATOR_MANAGER_ADAPTIVE_MIN_SAMPLE_NB))
+		return;
+
+	// 99th percentile = upper bound of the bucket reaching 99% of the samples
+	Threshold_UL = pParam_X->LatencySampleNb_UL - (pParam_X->LatencySampleNb_UL / 100);
+	for (Idx_UL = 0; Idx_UL < INDICATOR_MANAGER_LATENCY_BUCKET_NB; Idx_UL++) {
+		Sum_UL += pParam_X->pLatencyHisto_UL[Idx_UL];
+		if (Sum_UL >= Threshold_UL)
+			break;
+	}
+	pParam_X->LatencyP99_UL = (Idx_UL + 1) * INDICATOR_MANAGER_LATENCY_BUCKET_WIDTH;
+
+	// Tighten the configured timings, never widen them
+	Margin_UL = (pParam_X->LatencyP99_UL * INDICATOR_MANAGER_ADAPTIVE_MARGIN_PERCENT) / 100;
+	if (Margin_UL < INDICATOR_MANAGER_ADAPTIVE_MIN_MARGIN)
+		Margin_UL = INDICATOR_MANAGER_ADAPTIVE_MIN_MARGIN;
+
+	Window_UL = pParam_X->LatencyP99_UL + Margin_UL;
+	pParam_X->AdaptiveResponseDelay_UL = (Window_UL < pParam_X->ResponseDelay_UL) ? Window_UL : pParam_X->ResponseDelay_UL;
+
+	Window_UL = pParam_X->AdaptiveResponseDelay_UL * INDICATOR_MANAGER_ADAPTIVE_SCAN_FACTOR;
+	if (Window_UL < INDICATOR_MANAGER_ADAPTIVE_MIN_SCAN_PERIOD)
+		Window_UL = INDICATOR_MANAGER_ADAPTIVE_MIN_SCAN_PERIOD;
+	pParam_X->AdaptiveScanPeriod_UL = (Window_UL < pParam_X->ScanPeriod_UL) ? Window_UL : pParam_X->ScanPeriod_UL;
 }
 
-static void TransitionToWaitResetDelay(void) {
-	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To WAIT RESET DELAY");
-	GL_pIndicator_H->sendFrame(INDICATOR_INTERFACE_FRAME_SET_ZERO);
-	GL_IndicatorManager_CurrentState_E = INDICATOR_MANAGER_STATE::INDICATOR_MANAGER_WAIT_RESET_DELAY;
+// One event per validated response, whatever the mode (interrupt or cyclic asking)
+void PublishWeight(INDICATOR_MANAGER_PARAM * pParam_X) {
+	unsigned long FrameNb_UL = pParam_X->pIndicator_H->getFrameNumber();
+	signed int Weight_SI;
+
+	if (FrameNb_UL == pParam_X->FrameNb_UL)
+		return;
+
+	pParam_X->FrameNb_UL = FrameNb_UL;
+	Weight_SI = pParam_X->pIndicator_H->getWeightValue();
+
+	EventBus_Publish(EVENT_BUS_ID_NEW_WEIGHT, pParam_X->Idx_UB, (unsigned long)(Weight_SI));
 }
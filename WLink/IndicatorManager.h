@@ -9,6 +9,7 @@
 /* History :  	22/12/2014  (RW)	Creation of this file                           */
 /*				12/01/2015  (RW)	Add disable() function                          */
 /*				07/06/2016	(RW)	Re-mastered version								*/	
+/*				18/10/2026	(RW)	Programmable and adaptive timings				*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -30,20 +31,40 @@
 #define INDICATOR_MANAGER_DEFAULT_RESET_DELAY	    100
 #define INDICATOR_MANAGER_DEFAULT_MAX_TRY_NUMBER	2
 
+// Adaptive mode : the response window and the scan period follow the 99th percentile of the measured latency
+#define INDICATOR_MANAGER_LATENCY_BUCKET_NB			64		// Linear histogram of the response latency
+#define INDICATOR_MANAGER_LATENCY_BUCKET_WIDTH		10		// [ms] -> last bucket gathers everything above 630 ms
+#define INDICATOR_MANAGER_LATENCY_WINDOW			256		// Histogram is halved when reached -> older samples fade out
+#define INDICATOR_MANAGER_ADAPTIVE_MIN_SAMPLE_NB	16		// Configured timings are used until enough samples are gathered
+#define INDICATOR_MANAGER_ADAPTIVE_MARGIN_PERCENT	25		// Response window = P99 + 25%
+#define INDICATOR_MANAGER_ADAPTIVE_MIN_MARGIN		10		// [ms]
+#define INDICATOR_MANAGER_ADAPTIVE_SCAN_FACTOR		2		// Scan period = 2 x Response window
+#define INDICATOR_MANAGER_ADAPTIVE_MIN_SCAN_PERIOD	50		// [ms]
+
+#define INDICATOR_MANAGER_MAX_NB				    4       // One state machine per indicator
+
 /* ******************************************************************************** */
 /* Structure & Enumeration
 /* ******************************************************************************** */
+typedef struct {
+	unsigned long ScanPeriod_UL;			// [ms] Effective value (adapted if adaptive mode)
+	unsigned long ResponseDelay_UL;			// [ms] Effective value (adapted if adaptive mode)
+	unsigned long LatencyP99_UL;			// [ms] Upper bound of the histogram bucket - 0 if not enough samples
+	unsigned long SampleNb_UL;				// Samples currently in the histogram
+} INDICATOR_MANAGER_LATENCY_STRUCT;
 
 /* ******************************************************************************** */
 /* Functions Prototypes
 /* ******************************************************************************** */
-void IndicatorManager_Init(Indicator* Indicator_H);
-void IndicatorManager_Enable(INDICATOR_INTERFACE_FRAME_ENUM FrameType_E, boolean HasInterrupt_B, boolean AutomaticFlush_B = false);
-void IndicatorManager_Disable();
-void IndicatorManager_SetZeroIndicator();
+void IndicatorManager_Init(unsigned char Idx_UB, Indicator * pIndicator_H);
+void IndicatorManager_Enable(unsigned char Idx_UB, INDICATOR_INTERFACE_FRAME_ENUM FrameType_E, boolean HasInterrupt_B, boolean AutomaticFlush_B = false);
+void IndicatorManager_Disable(unsigned char Idx_UB);
+void IndicatorManager_SetZeroIndicator(unsigned char Idx_UB);
+void IndicatorManager_SetTiming(unsigned char Idx_UB, unsigned long ScanPeriod_UL, unsigned long ResponseDelay_UL, unsigned long ResetDelay_UL, unsigned char MaxTryNumber_UB, boolean IsAdaptive_B);
 void IndicatorManager_Process();
 
-boolean IndicatorManager_IsRunning();
+boolean IndicatorManager_IsRunning(unsigned char Idx_UB);
+boolean IndicatorManager_GetLatency(unsigned char Idx_UB, INDICATOR_MANAGER_LATENCY_STRUCT * pLatency_X);
 
 #endif // __INDICATOR_MANAGER_H__
 
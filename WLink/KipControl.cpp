@@ -6,6 +6,9 @@
 /*		Describes the utilities functions for the KipControl object	                */
 /*                                                                                  */
 /* History :  	15/08/2017  (RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	RAM shadow of the working area (write-back)		*/
+/*				18/10/2026	(RW)	Write-back through the EEPROM write queue		*/
+/*				18/10/2026	(RW)	Running counters kept in a wear-leveled log		*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -23,6 +26,14 @@
 /* ******************************************************************************** */
 /* Define
 /* ******************************************************************************** */
+#define KC_COUNTER_LOG_SEQ_IDX          0
+#define KC_COUNTER_LOG_DATA_IDX         4
+#define KC_COUNTER_LOG_CRC_IDX          (KC_COUNTER_LOG_RECORD_SIZE - 2)
+
+static_assert((KC_COUNTER_LOG_DATA_IDX + KC_COUNTER_SIZE) <= KC_COUNTER_LOG_CRC_IDX, "KipControl counter log : counters do not fit the record");
+static_assert(((EEPROM_WIRE_PAGE_SIZE % KC_COUNTER_LOG_RECORD_SIZE) == 0) && ((KC_COUNTER_LOG_ADDR % KC_COUNTER_LOG_RECORD_SIZE) == 0), "KipControl counter log : records must not cross an EEPROM page");
+static_assert(((KC_WORKING_AREA_OFFSET + KC_WORKING_AREA_SIZE) <= KC_COUNTER_LOG_ADDR) &&
+			  ((KC_COUNTER_LOG_ADDR + KC_COUNTER_LOG_SLOT_NB * KC_COUNTER_LOG_RECORD_SIZE) <= KC_REFERENCE_TABLE_START_ADDR), "KipControl counter log : overlaps the working area or the reference tables");
 
 /* ******************************************************************************** */
 /* External Variables
@@ -35,39 +46,171 @@ extern GLOBAL_CONFIG_STRUCT GL_GlobalConfig_X;
 /* ******************************************************************************** */
 unsigned char GL_pBuffer_UB[8];
 
+/* ******************************************************************************** */
+/* Prototypes for Internal Functions
+/* ******************************************************************************** */
+static boolean ReadShadow(KipControl * pKipControl_H, unsigned int Addr_UW, unsigned char * pData_UB, unsigned long Size_UL);
+static void WriteShadow(KipControl * pKipControl_H, unsigned int Addr_UW, unsigned char * pData_UB, unsigned long Size_UL);
+static void MarkDirty(KIP_CONTROL_PARAM * pParam_X, unsigned int Offset_UI, unsigned long Size_UL);
+static boolean WriteBack(KIP_CONTROL_PARAM * pParam_X, unsigned int Addr_UW, unsigned char * pData_UB, unsigned long Size_UL);
+static void RecoverCounters(KIP_CONTROL_PARAM * pParam_X);
+static boolean AppendCounters(KIP_CONTROL_PARAM * pParam_X);
+
 /* ******************************************************************************** */
 /* Constructor
 /* ******************************************************************************** */
 KipControl::KipControl() {
-
+	GL_KipControlParam_X.IsLoaded_B = false;
+	GL_KipControlParam_X.IsDirty_B = false;
+	GL_KipControlParam_X.FlushNb_UL = 0;
+	GL_KipControlParam_X.WriteTicket_UL = 0;
+	GL_KipControlParam_X.LogSeq_UL = 0;
 }
 
 /* ******************************************************************************** */
 /* Functions
 /* ******************************************************************************** */
+
+// Working area read once : the getters are then served from RAM
+boolean KipControl::load(void) {
+	if (GL_KipControlParam_X.IsLoaded_B)
+		return true;
+
+	if (GL_GlobalData_X.Eeprom_H.read(KC_WORKING_AREA_OFFSET, GL_KipControlParam_X.pShadow_UB, KC_WORKING_AREA_SIZE) != KC_WORKING_AREA_SIZE)
+		return false;
+
+	RecoverCounters(&GL_KipControlParam_X);
+
+	GL_KipControlParam_X.IsLoaded_B = true;
+	GL_KipControlParam_X.IsDirty_B = false;
+	return true;
+}
+
+// To be called when the EEPROM has been written behind the shadow (pending modifications are lost)
+void KipControl::invalidate(void) {
+	GL_KipControlParam_X.IsLoaded_B = false;
+	GL_KipControlParam_X.IsDirty_B = false;
+	GL_KipControlParam_X.WriteTicket_UL = 0;
+}
+
+boolean KipControl::isDirty(void) {
+	return GL_KipControlParam_X.IsDirty_B;
+}
+
+// All the modifications since the last write-back : configuration written in place, running counters in one log record
+void KipControl::flush(void) {
+	boolean IsWritten_B = true;
+
+	if (!(GL_KipControlParam_X.IsDirty_B))
+		return;
+
+	// Range added to the write-back still queued, if any
+	if ((GL_KipControlParam_X.WriteTicket_UL == 0) || (GL_KipControlParam_X.DirtyStart_UI < GL_KipControlParam_X.WriteStart_UI))
+		GL_KipControlParam_X.WriteStart_UI = GL_KipControlParam_X.DirtyStart_UI;
+	if ((GL_KipControlParam_X.WriteTicket_UL == 0) || (GL_KipControlParam_X.DirtyEnd_UI > GL_KipControlParam_X.WriteEnd_UI))
+		GL_KipControlParam_X.WriteEnd_UI = GL_KipControlParam_X.DirtyEnd_UI;
+
+	if (GL_KipControlParam_X.DirtyStart_UI < KC_COUNTER_OFFSET) {
+		unsigned int Addr_UW = KC_WORKING_AREA_OFFSET + GL_KipControlParam_X.DirtyStart_UI;
+		unsigned char * pData_UB = &(GL_KipControlParam_X.pShadow_UB[GL_KipControlParam_X.DirtyStart_UI]);
+		unsigned long Size_UL = ((GL_KipControlParam_X.DirtyEnd_UI < KC_COUNTER_OFFSET) ? GL_KipControlParam_X.DirtyEnd_UI : KC_COUNTER_OFFSET) - GL_KipControlParam_X.DirtyStart_UI;
+
+		if (!WriteBack(&GL_KipControlParam_X, Addr_UW, pData_UB, Size_UL))
+			IsWritten_B = false;
+	}
+
+	if (GL_KipControlParam_X.DirtyEnd_UI > KC_COUNTER_OFFSET) {
+		if (!AppendCounters(&GL_KipControlParam_X))
+			IsWritten_B = false;
+	}
+
+	GL_KipControlParam_X.IsDirty_B = false;
+	GL_KipControlParam_X.FlushNb_UL++;
+
+	if (!IsWritten_B) {
+		DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "Write-back lost");
+		MarkDirty(&GL_KipControlParam_X, GL_KipControlParam_X.WriteStart_UI, GL_KipControlParam_X.WriteEnd_UI - GL_KipControlParam_X.WriteStart_UI);
+	}
+}
+
+// Write-back policy : power fail, idle manager or maximum delay
+void KipControl::process(boolean IsIdle_B) {
+	unsigned long DirtyDelay_UL;
+
+	// Queued write-back over : a chunk lost by the EEPROM makes its range dirty again
+	if ((GL_KipControlParam_X.WriteTicket_UL != 0) && !(GL_GlobalData_X.Eeprom_H.isWritePending(GL_KipControlParam_X.WriteEndTicket_UL))) {
+		if (GL_GlobalData_X.Eeprom_H.isWriteFailed(GL_KipControlParam_X.WriteTicket_UL)) {
+			DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "Write-back lost");
+			MarkDirty(&GL_KipControlParam_X, GL_KipControlParam_X.WriteStart_UI, GL_KipControlParam_X.WriteEnd_UI - GL_KipControlParam_X.WriteStart_UI);
+		}
+		GL_KipControlParam_X.WriteTicket_UL = 0;
+	}
+
+	if (!(GL_KipControlParam_X.IsDirty_B))
+		return;
+
+#ifdef KC_POWER_FAIL_PIN
+	if (digitalRead(KC_POWER_FAIL_PIN) == LOW) {
+		flush();
+		return;
+	}
+#endif
+
+	DirtyDelay_UL = millis() - GL_KipControlParam_X.DirtyTime_UL;
+	if ((DirtyDelay_UL >= KC_FLUSH_MAX_DELAY_MS) || (IsIdle_B && (DirtyDelay_UL >= KC_FLUSH_IDLE_DELAY_MS)))
+		flush();
+}
+
+// Counters written in place behind the shadow (EEPROM W-Command) : taken as the newest values
+void KipControl::importCounters(unsigned int Addr_UW, unsigned long Size_UL) {
+	unsigned char pCounter_UB[KC_COUNTER_SIZE];
+
+	if ((Addr_UW >= (KC_WORKING_AREA_OFFSET + KC_WORKING_AREA_SIZE)) || ((Addr_UW + Size_UL) <= KC_CURRENT_IDX_ADDR))
+		return;
+
+	if (GL_GlobalData_X.Eeprom_H.read(KC_CURRENT_IDX_ADDR, pCounter_UB, KC_COUNTER_SIZE) == KC_COUNTER_SIZE) {
+		WriteShadow(this, KC_CURRENT_IDX_ADDR, pCounter_UB, KC_COUNTER_SIZE);
+		flush();
+	}
+}
+
+// Counters bytes of an EEPROM read replaced by the current values (the copy in place is not kept up to date)
+void KipControl::exportCounters(unsigned int Addr_UW, unsigned char * pData_UB, unsigned long Size_UL) {
+	if ((Addr_UW >= (KC_WORKING_AREA_OFFSET + KC_WORKING_AREA_SIZE)) || ((Addr_UW + Size_UL) <= KC_CURRENT_IDX_ADDR))
+		return;
+
+	if (!load())
+		return;
+
+	for (unsigned long i = 0; i < Size_UL; i++) {
+		if (((Addr_UW + i) >= KC_CURRENT_IDX_ADDR) && ((Addr_UW + i) < (KC_WORKING_AREA_OFFSET + KC_WORKING_AREA_SIZE)))
+			pData_UB[i] = GL_KipControlParam_X.pShadow_UB[Addr_UW + i - KC_WORKING_AREA_OFFSET];
+	}
+}
+
 boolean KipControl::getConfiguredFlag(void) {
-	if (GL_GlobalData_X.Eeprom_H.read(KC_GLOBAL_DATA_ADDR, GL_pBuffer_UB, 1) == 1)
+	if (ReadShadow(this, KC_GLOBAL_DATA_ADDR, GL_pBuffer_UB, 1))
 		return ((GL_pBuffer_UB[0] & 0x01) == 0x01);
 	else
 		return false;
 }
 
 boolean KipControl::getRunningFlag(void) {
-	if (GL_GlobalData_X.Eeprom_H.read(KC_GLOBAL_DATA_ADDR, GL_pBuffer_UB, 1) == 1)
+	if (ReadShadow(this, KC_GLOBAL_DATA_ADDR, GL_pBuffer_UB, 1))
 		return ((GL_pBuffer_UB[0] & 0x02) == 0x02);
 	else
 		return false;
 }
 
 unsigned char KipControl::getTolerance(void) {
-	if (GL_GlobalData_X.Eeprom_H.read(KC_TOLERANCE_ADDR, GL_pBuffer_UB, 1) == 1)
+	if (ReadShadow(this, KC_TOLERANCE_ADDR, GL_pBuffer_UB, 1))
 		return GL_pBuffer_UB[0];
 	else
 		return 0;
 }
 
 signed int KipControl::getWeightMin(void) {
-	if (GL_GlobalData_X.Eeprom_H.read(KC_WEIGHT_MIN_ADDR, GL_pBuffer_UB, 2) == 2)
+	if (ReadShadow(this, KC_WEIGHT_MIN_ADDR, GL_pBuffer_UB, 2))
 		return ((signed int)((GL_pBuffer_UB[1] << 8) + GL_pBuffer_UB[0]));
 	else
 		return 0;
@@ -75,21 +218,21 @@ signed int KipControl::getWeightMin(void) {
 }
 
 unsigned char KipControl::getReferenceDataId(void) {
-	if (GL_GlobalData_X.Eeprom_H.read(KC_REFERENCE_DATA_ID_ADDR, GL_pBuffer_UB, 1) == 1)
+	if (ReadShadow(this, KC_REFERENCE_DATA_ID_ADDR, GL_pBuffer_UB, 1))
 		return GL_pBuffer_UB[0];
 	else
 		return 0;
 }
 
 unsigned char KipControl::getBatchId(void) {
-	if (GL_GlobalData_X.Eeprom_H.read(KC_BATCH_ID_ADDR, GL_pBuffer_UB, 1) == 1)
+	if (ReadShadow(this, KC_BATCH_ID_ADDR, GL_pBuffer_UB, 1))
 		return GL_pBuffer_UB[0];
 	else
 		return 0;
 }
 
 unsigned char KipControl::getStartIdx(void) {
-	if (GL_GlobalData_X.Eeprom_H.read(KC_START_IDX_ADDR, GL_pBuffer_UB, 1) == 1)
+	if (ReadShadow(this, KC_START_IDX_ADDR, GL_pBuffer_UB, 1))
 		return GL_pBuffer_UB[0];
 	else
 		return 0;
@@ -98,7 +241,7 @@ unsigned char KipControl::getStartIdx(void) {
 RTC_DATE_STRUCT KipControl::getStartDate(void) {
 	RTC_DATE_STRUCT Date_X;
 
-	if (GL_GlobalData_X.Eeprom_H.read(KC_START_DATE_ADDR, GL_pBuffer_UB, 3) == 3) {
+	if (ReadShadow(this, KC_START_DATE_ADDR, GL_pBuffer_UB, 3)) {
 		Date_X.Day_UB = GL_pBuffer_UB[0];
 		Date_X.Month_UB = GL_pBuffer_UB[1];
 		Date_X.Year_UB = GL_pBuffer_UB[2];
@@ -113,79 +256,89 @@ RTC_DATE_STRUCT KipControl::getStartDate(void) {
 }
 
 unsigned char KipControl::getCurrentIdx(void) {
-	if (GL_GlobalData_X.Eeprom_H.read(KC_CURRENT_IDX_ADDR, GL_pBuffer_UB, 1) == 1)
+	if (ReadShadow(this, KC_CURRENT_IDX_ADDR, GL_pBuffer_UB, 1))
 		return GL_pBuffer_UB[0];
 	else
 		return 0;
 }
 
 unsigned long KipControl::getTotalValue(void) {
-	if (GL_GlobalData_X.Eeprom_H.read(KC_TOTAL_VALUE_ADDR, GL_pBuffer_UB, 4) == 4)
+	if (ReadShadow(this, KC_TOTAL_VALUE_ADDR, GL_pBuffer_UB, 4))
 		return ((GL_pBuffer_UB[3] << 24) + (GL_pBuffer_UB[2] << 16) + (GL_pBuffer_UB[1] << 8) + GL_pBuffer_UB[0]);
 	else
 		return 0;
 }
 
 unsigned long KipControl::getValueNb(void) {
-	if (GL_GlobalData_X.Eeprom_H.read(KC_VALUE_NB_ADDR, GL_pBuffer_UB, 4) == 4)
+	if (ReadShadow(this, KC_VALUE_NB_ADDR, GL_pBuffer_UB, 4))
 		return ((GL_pBuffer_UB[3] << 24) + (GL_pBuffer_UB[2] << 16) + (GL_pBuffer_UB[1] << 8) + GL_pBuffer_UB[0]);
 	else
 		return 0;
 }
 
 
+// Configuration : written through at once
 void KipControl::setConfiguredFlag(boolean Configured_B) {
-    if (GL_GlobalData_X.Eeprom_H.read(KC_GLOBAL_DATA_ADDR, GL_pBuffer_UB, 1) == 1) {
+    if (ReadShadow(this, KC_GLOBAL_DATA_ADDR, GL_pBuffer_UB, 1)) {
         if (Configured_B)
             GL_pBuffer_UB[0] |= 0x01;
         else
             GL_pBuffer_UB[0] &= ~0x01;
-        GL_GlobalData_X.Eeprom_H.write(KC_GLOBAL_DATA_ADDR, GL_pBuffer_UB, 1);
+        WriteShadow(this, KC_GLOBAL_DATA_ADDR, GL_pBuffer_UB, 1);
+        flush();
     }
 }
 
 void KipControl::setRunningFlag(boolean Running_B) {
-	if (GL_GlobalData_X.Eeprom_H.read(KC_GLOBAL_DATA_ADDR, GL_pBuffer_UB, 1) == 1) {
+	if (ReadShadow(this, KC_GLOBAL_DATA_ADDR, GL_pBuffer_UB, 1)) {
 		if (Running_B)
 			GL_pBuffer_UB[0] |= 0x02;
 		else
 			GL_pBuffer_UB[0] &= ~0x02;
-		GL_GlobalData_X.Eeprom_H.write(KC_GLOBAL_DATA_ADDR, GL_pBuffer_UB, 1);
+		WriteShadow(this, KC_GLOBAL_DATA_ADDR, GL_pBuffer_UB, 1);
+		flush();
 	}
 }
 
 void KipControl::setTolerance(unsigned char Tolerance_UB) {
-	GL_GlobalData_X.Eeprom_H.write(KC_TOLERANCE_ADDR, &Tolerance_UB, 1);
+	WriteShadow(this, KC_TOLERANCE_ADDR, &Tolerance_UB, 1);
+	flush();
 }
 
 void KipControl::setWeightMin(signed int WeightMin_SI) {
 	unsigned int WeightMin_UI = (WeightMin_SI < 0) ? 0 : WeightMin_SI;
 	GL_pBuffer_UB[0] = (unsigned char)(WeightMin_UI % 256);
 	GL_pBuffer_UB[1] = (unsigned char)((WeightMin_UI >> 8) % 256);
-	GL_GlobalData_X.Eeprom_H.write(KC_WEIGHT_MIN_ADDR, GL_pBuffer_UB, 2);
+	WriteShadow(this, KC_WEIGHT_MIN_ADDR, GL_pBuffer_UB, 2);
+	flush();
 }
 
 void KipControl::setReferenceDataId(unsigned char ReferenceDataId_UB) {
-	GL_GlobalData_X.Eeprom_H.write(KC_REFERENCE_DATA_ID_ADDR, &ReferenceDataId_UB, 1);
+	WriteShadow(this, KC_REFERENCE_DATA_ID_ADDR, &ReferenceDataId_UB, 1);
+	flush();
 }
 
 void KipControl::setBatchId(unsigned char BatchId_UB) {
-	GL_GlobalData_X.Eeprom_H.write(KC_BATCH_ID_ADDR, &BatchId_UB, 1);
+	WriteShadow(this, KC_BATCH_ID_ADDR, &BatchId_UB, 1);
+	flush();
 }
 
 void KipControl::setStartIdx(unsigned char StartIdx_UB) {
-	GL_GlobalData_X.Eeprom_H.write(KC_START_IDX_ADDR, &StartIdx_UB, 1);
+	WriteShadow(this, KC_START_IDX_ADDR, &StartIdx_UB, 1);
+	flush();
 }
 
 void KipControl::setStartDate(RTC_DATE_STRUCT StartDate_X) {
 	GL_pBuffer_UB[0] = StartDate_X.Day_UB;
 	GL_pBuffer_UB[1] = StartDate_X.Month_UB;
 	GL_pBuffer_UB[2] = StartDate_X.Year_UB;
-	GL_GlobalData_X.Eeprom_H.write(KC_START_DATE_ADDR, GL_pBuffer_UB, 3);
+	WriteShadow(this, KC_START_DATE_ADDR, GL_pBuffer_UB, 3);
+	flush();
 }
 
+// Running counters : written back by process() or flush()
 void KipControl::setCurrentIdx(unsigned char CurrentIdx_UB) {
-	GL_GlobalData_X.Eeprom_H.write(KC_CURRENT_IDX_ADDR, &CurrentIdx_UB, 1);
+	WriteShadow(this, KC_CURRENT_IDX_ADDR, &CurrentIdx_UB, 1);
 }
 
 void KipControl::setTotalValue(unsigned long TotalValue_UL) {
@@ -193,7 +346,7 @@ void KipControl::setTotalValue(unsigned long TotalValue_UL) {
 	GL_pBuffer_UB[1] = (unsigned char)((TotalValue_UL >> 8) % 256);
 	GL_pBuffer_UB[2] = (unsigned char)((TotalValue_UL >> 16) % 256);
 	GL_pBuffer_UB[3] = (unsigned char)((TotalValue_UL >> 24) % 256);
-	GL_GlobalData_X.Eeprom_H.write(KC_TOTAL_VALUE_ADDR, GL_pBuffer_UB, 4);
+	WriteShadow(this, KC_TOTAL_VALUE_ADDR, GL_pBuffer_UB, 4);
 }
 
 void KipControl::setValueNb(unsigned long ValueNb_UL) {
@@ -201,7 +354,7 @@ void KipControl::setValueNb(unsigned long ValueNb_UL) {
 	GL_pBuffer_UB[1] = (unsigned char)((ValueNb_UL >> 8) % 256);
 	GL_pBuffer_UB[2] = (unsigned char)((ValueNb_UL >> 16) % 256);
 	GL_pBuffer_UB[3] = (unsigned char)((ValueNb_UL >> 24) % 256);
-	GL_GlobalData_X.Eeprom_H.write(KC_VALUE_NB_ADDR, GL_pBuffer_UB, 4);
+	WriteShadow(this, KC_VALUE_NB_ADDR, GL_pBuffer_UB, 4);
 }
 
 
@@ -216,3 +369,119 @@ void KipControl::appendTotalValue(unsigned int Value_UW) {
 void KipControl::incValueNb(void) {
 	setValueNb(getValueNb() + 1);
 }
+
+
+/* ******************************************************************************** */
+/* Internal Functions
+/* ******************************************************************************** */
+boolean ReadShadow(KipControl * pKipControl_H, unsigned int Addr_UW, unsigned char * pData_UB, unsigned long Size_UL) {
+	if (!(pKipControl_H->load()))
+		return false;
+
+	memcpy(pData_UB, &(pKipControl_H->GL_KipControlParam_X.pShadow_UB[Addr_UW - KC_WORKING_AREA_OFFSET]), Size_UL);
+	return true;
+}
+
+// Dirty range extended to the modified bytes - unchanged data do not make the shadow dirty
+void WriteShadow(KipControl * pKipControl_H, unsigned int Addr_UW, unsigned char * pData_UB, unsigned long Size_UL) {
+	KIP_CONTROL_PARAM * pParam_X = &(pKipControl_H->GL_KipControlParam_X);
+	unsigned int Offset_UI = Addr_UW - KC_WORKING_AREA_OFFSET;
+
+	// No shadow (EEPROM not readable) -> direct write
+	if (!(pKipControl_H->load())) {
+		GL_GlobalData_X.Eeprom_H.write(Addr_UW, pData_UB, Size_UL);
+		return;
+	}
+
+	if (memcmp(&(pParam_X->pShadow_UB[Offset_UI]), pData_UB, Size_UL) == 0)
+		return;
+
+	memcpy(&(pParam_X->pShadow_UB[Offset_UI]), pData_UB, Size_UL);
+	MarkDirty(pParam_X, Offset_UI, Size_UL);
+}
+
+void MarkDirty(KIP_CONTROL_PARAM * pParam_X, unsigned int Offset_UI, unsigned long Size_UL) {
+	if (!(pParam_X->IsDirty_B)) {
+		pParam_X->IsDirty_B = true;
+		pParam_X->DirtyStart_UI = Offset_UI;
+		pParam_X->DirtyEnd_UI = Offset_UI + Size_UL;
+		pParam_X->DirtyTime_UL = millis();
+	}
+	else {
+		if (Offset_UI < pParam_X->DirtyStart_UI)
+			pParam_X->DirtyStart_UI = Offset_UI;
+		if ((Offset_UI + Size_UL) > pParam_X->DirtyEnd_UI)
+			pParam_X->DirtyEnd_UI = Offset_UI + Size_UL;
+	}
+}
+
+// Data copied into the EEPROM queue (the shadow can be modified right away) - returns false if a blocking write failed
+boolean WriteBack(KIP_CONTROL_PARAM * pParam_X, unsigned int Addr_UW, unsigned char * pData_UB, unsigned long Size_UL) {
+	unsigned long Ticket_UL = GL_GlobalData_X.Eeprom_H.writeAsync(Addr_UW, pData_UB, Size_UL);
+
+	if (Ticket_UL == 0)
+		return GL_GlobalData_X.Eeprom_H.write(Addr_UW, pData_UB, Size_UL);
+
+	// Result checked by process() once the last ticket is done
+	if (pParam_X->WriteTicket_UL == 0)
+		pParam_X->WriteTicket_UL = Ticket_UL;
+	pParam_X->WriteEndTicket_UL = Ticket_UL;
+	return true;
+}
+
+// Newest valid record of the log - counters of the working area kept if there is none (log never written)
+void RecoverCounters(KIP_CONTROL_PARAM * pParam_X) {
+	unsigned char pRecord_UB[KC_COUNTER_LOG_RECORD_SIZE];
+	unsigned long Seq_UL;
+	boolean IsFound_B = false;
+
+	pParam_X->LogSeq_UL = 0;
+
+	for (unsigned int i = 0; i < KC_COUNTER_LOG_SLOT_NB; i++) {
+		if (GL_GlobalData_X.Eeprom_H.read(KC_COUNTER_LOG_ADDR + i * KC_COUNTER_LOG_RECORD_SIZE, pRecord_UB, KC_COUNTER_LOG_RECORD_SIZE) != KC_COUNTER_LOG_RECORD_SIZE)
+			continue;
+
+		// Erased or interrupted record
+		if (Crc16(pRecord_UB, KC_COUNTER_LOG_CRC_IDX) != (unsigned int)((pRecord_UB[KC_COUNTER_LOG_CRC_IDX + 1] << 8) + pRecord_UB[KC_COUNTER_LOG_CRC_IDX]))
+			continue;
+
+		Seq_UL = (pRecord_UB[3] << 24) + (pRecord_UB[2] << 16) + (pRecord_UB[1] << 8) + pRecord_UB[0];
+		if ((Seq_UL == 0) || (IsFound_B && (((signed long)(Seq_UL - pParam_X->LogSeq_UL)) <= 0)))
+			continue;
+
+		IsFound_B = true;
+		pParam_X->LogSeq_UL = Seq_UL;
+		memcpy(&(pParam_X->pShadow_UB[KC_COUNTER_OFFSET]), &pRecord_UB[KC_COUNTER_LOG_DATA_IDX], KC_COUNTER_SIZE);
+	}
+
+	if (IsFound_B) {
+		DBG_PRINT(DEBUG_SEVERITY_INFO, "Counters Recovered - Sequence : ");
+		DBG_PRINTDATA(pParam_X->LogSeq_UL);
+		DBG_ENDSTR();
+	}
+}
+
+// One record (one page write) for all the counter updates since the last write-back - next slot overwritten, the others kept
+boolean AppendCounters(KIP_CONTROL_PARAM * pParam_X) {
+	unsigned char pRecord_UB[KC_COUNTER_LOG_RECORD_SIZE];
+	unsigned int Addr_UW;
+	unsigned int Crc_UI;
+
+	if (++(pParam_X->LogSeq_UL) == 0)
+		pParam_X->LogSeq_UL = 1;		// 0 = no record
+
+	pRecord_UB[KC_COUNTER_LOG_SEQ_IDX] = (unsigned char)(pParam_X->LogSeq_UL % 256);
+	pRecord_UB[KC_COUNTER_LOG_SEQ_IDX + 1] = (unsigned char)((pParam_X->LogSeq_UL >> 8) % 256);
+	pRecord_UB[KC_COUNTER_LOG_SEQ_IDX + 2] = (unsigned char)((pParam_X->LogSeq_UL >> 16) % 256);
+	pRecord_UB[KC_COUNTER_LOG_SEQ_IDX + 3] = (unsigned char)((pParam_X->LogSeq_UL >> 24) % 256);
+	memcpy(&pRecord_UB[KC_COUNTER_LOG_DATA_IDX], &(pParam_X->pShadow_UB[KC_COUNTER_OFFSET]), KC_COUNTER_SIZE);
+	for (unsigned int i = KC_COUNTER_LOG_DATA_IDX + KC_COUNTER_SIZE; i < KC_COUNTER_LOG_CRC_IDX; i++)
+		pRecord_UB[i] = 0x00;
+
+	Crc_UI = Crc16(pRecord_UB, KC_COUNTER_LOG_CRC_IDX);
+	pRecord_UB[KC_COUNTER_LOG_CRC_IDX] = (unsigned char)(Crc_UI % 256);
+	pRecord_UB[KC_COUNTER_LOG_CRC_IDX + 1] = (unsigned char)((Crc_UI >> 8) % 256);
+
+	Addr_UW = KC_COUNTER_LOG_ADDR + (pParam_X->LogSeq_UL % KC_COUNTER_LOG_SLOT_NB) * KC_COUNTER_LOG_RECORD_SIZE;
+	return WriteBack(pParam_X, Addr_UW, pRecord_UB, KC_COUNTER_LOG_RECORD_SIZE);
+}
@@ -6,6 +6,8 @@
 /*		Header file for KipControl.cpp												*/
 /*                                                                                  */
 /* History :	15/08/2017	(RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	RAM shadow of the working area (write-back)		*/
+/*				18/10/2026	(RW)	Running counters kept in a wear-leveled log		*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -33,10 +35,37 @@
 #define KC_CURRENT_IDX_ADDR             (KC_WORKING_AREA_OFFSET + 0x000B)
 #define KC_TOTAL_VALUE_ADDR             (KC_WORKING_AREA_OFFSET + 0x000C)
 #define KC_VALUE_NB_ADDR                (KC_WORKING_AREA_OFFSET + 0x0010)
+#define KC_WORKING_AREA_SIZE            0x0014          // Up to KC_VALUE_NB_ADDR included
+
+// Running counters (KC_CURRENT_IDX_ADDR to KC_VALUE_NB_ADDR) are not written in place but appended to a log of records :
+// Sequence number (4 bytes LSB first) + counters (same encoding as the working area) + reserved byte + CRC16 (2 bytes LSB first)
+#define KC_COUNTER_OFFSET               (KC_CURRENT_IDX_ADDR - KC_WORKING_AREA_OFFSET)
+#define KC_COUNTER_SIZE                 (KC_WORKING_AREA_SIZE - KC_COUNTER_OFFSET)
+#define KC_COUNTER_LOG_ADDR             0x0440          // Between the working area and the reference tables
+#define KC_COUNTER_LOG_RECORD_SIZE      16              // Records never cross an EEPROM page
+#define KC_COUNTER_LOG_SLOT_NB          48              // Slot used by a record = sequence number modulo this value
+
+#define KC_FLUSH_IDLE_DELAY_MS          1000            // Dirty shadow written back once the manager is idle for this delay
+#define KC_FLUSH_MAX_DELAY_MS           10000           // Dirty shadow written back at the latest after this delay
+//#define KC_POWER_FAIL_PIN             PIN_GPIO_INPUT3 // Uncomment line to write back the shadow as soon as this input goes low
 
 /* ******************************************************************************** */
 /* Structure & Enumeration
 /* ******************************************************************************** */
+typedef struct {
+	boolean IsLoaded_B;
+	unsigned char pShadow_UB[KC_WORKING_AREA_SIZE];		// RAM copy of the working area
+	boolean IsDirty_B;
+	unsigned int DirtyStart_UI;							// First modified byte (offset in the working area)
+	unsigned int DirtyEnd_UI;							// Last modified byte + 1
+	unsigned long DirtyTime_UL;							// millis() of the first modification since the last write-back
+	unsigned long FlushNb_UL;
+	unsigned long WriteTicket_UL;						// First EEPROM ticket of the write-back in progress (0 = none)
+	unsigned long WriteEndTicket_UL;					// Last EEPROM ticket of the write-back in progress
+	unsigned int WriteStart_UI;							// Range of the write-back in progress - dirty again if it is lost
+	unsigned int WriteEnd_UI;
+	unsigned long LogSeq_UL;							// Sequence number of the newest counter record (0 = none)
+} KIP_CONTROL_PARAM;
 
 /* ******************************************************************************** */
 /* Class
@@ -47,6 +76,14 @@ public:
 	KipControl();
 
 	// Functions
+	boolean load(void);
+	void invalidate(void);
+	boolean isDirty(void);
+	void flush(void);
+	void process(boolean IsIdle_B);
+	void importCounters(unsigned int Addr_UW, unsigned long Size_UL);
+	void exportCounters(unsigned int Addr_UW, unsigned char * pData_UB, unsigned long Size_UL);
+
 	boolean getConfiguredFlag(void);
 	boolean getRunningFlag(void);
 	unsigned char getTolerance(void);
@@ -75,6 +112,7 @@ public:
 	void appendTotalValue(unsigned int Value_UW);
 	void incValueNb(void);
 
+	KIP_CONTROL_PARAM GL_KipControlParam_X;
 };
 
 #endif // __KIP_CONTROL_H__
@@ -0,0 +1,317 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* KipControlJournal.cpp											                */
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Describes the persistent journal of the weights that could not be sent		*/
+/*		to the portal (offline mode or transaction failure).						*/
+/*		The journal is a ring buffer stored on the Memory Card when available,		*/
+/*		in the upper part of the EEPROM otherwise.									*/
+/*                                                                                  */
+/* History :  	18/10/2026  (RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#define MODULE_NAME		"KipControlJournal"
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "KipControlJournal.h"
+#include "Utilz.h"
+
+#include "Debug.h"
+
+
+/* ******************************************************************************** */
+/* Local Structures
+/* ******************************************************************************** */
+
+// Journal header (16 bytes) - stored at the beginning of the storage area
+typedef struct {
+	unsigned long Magic_UL;				// KC_JOURNAL_MAGIC
+	unsigned long Head_UL;				// Index of the oldest record
+	unsigned long Count_UL;				// Number of records in the journal
+	unsigned long Checksum_UL;			// CRC-16 of the fields above
+} KC_JOURNAL_HEADER_STRUCT;
+
+
+/* ******************************************************************************** */
+/* Local Variables
+/* ******************************************************************************** */
+
+static MemoryCard * GL_pJournalMemCard_H = NULL;
+static EepromWire * GL_pJournalEeprom_H = NULL;
+
+static KC_JOURNAL_STORAGE_ENUM GL_JournalStorage_E = KC_JOURNAL_STORAGE_NONE;
+static unsigned long GL_JournalCapacity_UL = 0;
+static KC_JOURNAL_HEADER_STRUCT GL_JournalHeader_X;
+static char GL_pJournalFileName_UB[] = KC_JOURNAL_FILE_NAME;
+
+
+/* ******************************************************************************** */
+/* Prototypes for Internal Functions
+/* ******************************************************************************** */
+static boolean ReadArea(unsigned long Offset_UL, unsigned char * pData_UB, unsigned long Size_UL);
+static boolean WriteArea(unsigned long Offset_UL, unsigned char * pData_UB, unsigned long Size_UL);
+static boolean LoadHeader(void);
+static boolean SaveHeader(void);
+static unsigned long RecordOffset(unsigned long Index_UL);
+static unsigned long HeaderChecksum(KC_JOURNAL_HEADER_STRUCT * pHeader_X);
+static void SealRecord(KC_JOURNAL_RECORD_STRUCT * pRecord_X);
+static boolean IsRecordSealed(KC_JOURNAL_RECORD_STRUCT * pRecord_X);
+
+
+/* ******************************************************************************** */
+/* Functions
+/* ******************************************************************************** */
+
+void KipControlJournal_Init(MemoryCard * pMemCard_H, EepromWire * pEeprom_H) {
+
+	GL_pJournalMemCard_H = pMemCard_H;
+	GL_pJournalEeprom_H = pEeprom_H;
+
+	// Select the storage : Memory Card first, EEPROM as fallback
+	if ((GL_pJournalMemCard_H != NULL) && GL_pJournalMemCard_H->isInitialized()) {
+		GL_JournalStorage_E = KC_JOURNAL_STORAGE_MEMORY_CARD;
+		GL_JournalCapacity_UL = KC_JOURNAL_MEMORY_CARD_CAPACITY;
+	}
+	else if ((GL_pJournalEeprom_H != NULL) && GL_pJournalEeprom_H->isInitialized()) {
+		GL_JournalStorage_E = KC_JOURNAL_STORAGE_EEPROM;
+		GL_JournalCapacity_UL = KC_JOURNAL_EEPROM_CAPACITY;
+	}
+	else {
+		GL_JournalStorage_E = KC_JOURNAL_STORAGE_NONE;
+		GL_JournalCapacity_UL = 0;
+		DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "No storage available for the journal");
+		return;
+	}
+
+	// Load the header, re-format the journal if not valid
+	if (!LoadHeader()) {
+		DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "Journal header not valid -> Format journal");
+		KipControlJournal_Clear();
+	}
+
+	DBG_PRINT(DEBUG_SEVERITY_INFO, "Journal Initialized on ");
+	DBG_PRINTDATA((GL_JournalStorage_E == KC_JOURNAL_STORAGE_MEMORY_CARD) ? "Memory Card" : "EEPROM");
+	DBG_PRINTDATA(" - Pending records = ");
+	DBG_PRINTDATA(GL_JournalHeader_X.Count_UL);
+	DBG_PRINTDATA("/");
+	DBG_PRINTDATA(GL_JournalCapacity_UL);
+	DBG_ENDSTR();
+}
+
+boolean KipControlJournal_IsAvailable(void) {
+	return (GL_JournalStorage_E != KC_JOURNAL_STORAGE_NONE);
+}
+
+KC_JOURNAL_STORAGE_ENUM KipControlJournal_GetStorage(void) {
+	return GL_JournalStorage_E;
+}
+
+boolean KipControlJournal_Append(KC_JOURNAL_RECORD_STRUCT * pRecord_X) {
+
+	unsigned long Tail_UL = 0;
+
+	if (!KipControlJournal_IsAvailable())
+		return false;
+
+	// Journal full : drop the oldest record first (header saved) so that its slot is never overwritten while still referenced
+	if (GL_JournalHeader_X.Count_UL >= GL_JournalCapacity_UL) {
+		DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "Journal full -> Oldest record dropped");
+		if (!KipControlJournal_Pop())
+			return false;
+	}
+
+	Tail_UL = (GL_JournalHeader_X.Head_UL + GL_JournalHeader_X.Count_UL) % GL_JournalCapacity_UL;
+
+	pRecord_X->pTimeStamp_UB[KC_JOURNAL_TIMESTAMP_SIZE - 1] = '\0';
+	SealRecord(pRecord_X);
+
+	// Write the record first, then the header : a reset in between loses the record but never corrupts the journal
+	if (!WriteArea(RecordOffset(Tail_UL), (unsigned char *)pRecord_X, sizeof(KC_JOURNAL_RECORD_STRUCT))) {
+		DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "Unable to write record in the journal");
+		return false;
+	}
+
+	GL_JournalHeader_X.Count_UL++;
+	return SaveHeader();
+}
+
+boolean KipControlJournal_Peek(KC_JOURNAL_RECORD_STRUCT * pRecord_X) {
+
+	// Skip the corrupted records
+	while (GL_JournalHeader_X.Count_UL > 0) {
+
+		if (!ReadArea(RecordOffset(GL_JournalHeader_X.Head_UL), (unsigned char *)pRecord_X, sizeof(KC_JOURNAL_RECORD_STRUCT)))
+			return false;
+
+		if (IsRecordSealed(pRecord_X))
+			return true;
+
+		DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "Corrupted record in the journal -> Dropped");
+		if (!KipControlJournal_Pop())
+			return false;
+	}
+
+	return false;
+}
+
+boolean KipControlJournal_PeekAt(unsigned long Position_UL, KC_JOURNAL_RECORD_STRUCT * pRecord_X) {
+
+	if (Position_UL >= GL_JournalHeader_X.Count_UL)
+		return false;
+
+	if (!ReadArea(RecordOffset((GL_JournalHeader_X.Head_UL + Position_UL) % GL_JournalCapacity_UL), (unsigned char *)pRecord_X, sizeof(KC_JOURNAL_RECORD_STRUCT)))
+		return false;
+
+	// Corrupted records are only dropped by KipControlJournal_Peek()
+	return IsRecordSealed(pRecord_X);
+}
+
+boolean KipControlJournal_Pop(unsigned long RecordNb_UL) {
+
+	if (GL_JournalHeader_X.Count_UL == 0)
+		return false;
+
+	if (RecordNb_UL > GL_JournalHeader_X.Count_UL)
+		RecordNb_UL = GL_JournalHeader_X.Count_UL;
+
+	GL_JournalHeader_X.Head_UL = (GL_JournalHeader_X.Head_UL + RecordNb_UL) % GL_JournalCapacity_UL;
+	GL_JournalHeader_X.Count_UL -= RecordNb_UL;
+
+	// Restart from the beginning of the area when the journal is empty
+	if (GL_JournalHeader_X.Count_UL == 0)
+		GL_JournalHeader_X.Head_UL = 0;
+
+	return SaveHeader();
+}
+
+void KipControlJournal_Clear(void) {
+
+	GL_JournalHeader_X.Head_UL = 0;
+	GL_JournalHeader_X.Count_UL = 0;
+
+	if (KipControlJournal_IsAvailable())
+		SaveHeader();
+}
+
+unsigned long KipControlJournal_GetCount(void) {
+	return GL_JournalHeader_X.Count_UL;
+}
+
+boolean KipControlJournal_IsEmpty(void) {
+	return (GL_JournalHeader_X.Count_UL == 0);
+}
+
+
+/* ******************************************************************************** */
+/* Internal Functions
+/* ******************************************************************************** */
+
+static boolean ReadArea(unsigned long Offset_UL, unsigned char * pData_UB, unsigned long Size_UL) {
+
+	File File_H;
+	boolean Success_B = false;
+
+	switch (GL_JournalStorage_E) {
+
+	case KC_JOURNAL_STORAGE_MEMORY_CARD:
+		if (GL_pJournalMemCard_H->openFile(&File_H, GL_pJournalFileName_UB, FILE_HANDLING_OPEN_MODE_READ_WRITE) != FILE_HANDLING_STS_OK)
+			return false;
+
+		// Area never written : unknown content
+		if (GL_pJournalMemCard_H->getFileSize(&File_H) >= (Offset_UL + Size_UL)) {
+			if (GL_pJournalMemCard_H->seekFile(&File_H, Offset_UL) == FILE_HANDLING_STS_OK)
+				Success_B = (GL_pJournalMemCard_H->readFile(&File_H, pData_UB, Size_UL) == FILE_HANDLING_STS_OK);
+		}
+
+		GL_pJournalMemCard_H->closeFile(&File_H);
+		return Success_B;
+
+	case KC_JOURNAL_STORAGE_EEPROM:
+		return (GL_pJournalEeprom_H->read(KC_JOURNAL_EEPROM_START_ADDR + Offset_UL, pData_UB, Size_UL) == Size_UL);
+
+	default:
+		return false;
+	}
+}
+
+static boolean WriteArea(unsigned long Offset_UL, unsigned char * pData_UB, unsigned long Size_UL) {
+
+	File File_H;
+	boolean Success_B = false;
+
+	switch (GL_JournalStorage_E) {
+
+	case KC_JOURNAL_STORAGE_MEMORY_CARD:
+		if (GL_pJournalMemCard_H->openFile(&File_H, GL_pJournalFileName_UB, FILE_HANDLING_OPEN_MODE_READ_WRITE) != FILE_HANDLING_STS_OK)
+			return false;
+
+		if (GL_pJournalMemCard_H->seekFile(&File_H, Offset_UL) == FILE_HANDLING_STS_OK)
+			Success_B = (GL_pJournalMemCard_H->writeFile(&File_H, pData_UB, Size_UL) == FILE_HANDLING_STS_OK);
+
+		GL_pJournalMemCard_H->closeFile(&File_H);	// Flush data on the card
+		return Success_B;
+
+	case KC_JOURNAL_STORAGE_EEPROM:
+		GL_pJournalEeprom_H->write(KC_JOURNAL_EEPROM_START_ADDR + Offset_UL, pData_UB, Size_UL);
+		return true;
+
+	default:
+		return false;
+	}
+}
+
+static boolean LoadHeader(void) {
+
+	KC_JOURNAL_HEADER_STRUCT Header_X;
+
+	if (!ReadArea(0, (unsigned char *)&Header_X, sizeof(KC_JOURNAL_HEADER_STRUCT)))
+		return false;
+
+	if ((Header_X.Magic_UL != KC_JOURNAL_MAGIC) || (Header_X.Checksum_UL != HeaderChecksum(&Header_X)))
+		return false;
+
+	if ((Header_X.Head_UL >= GL_JournalCapacity_UL) || (Header_X.Count_UL > GL_JournalCapacity_UL))
+		return false;
+
+	GL_JournalHeader_X = Header_X;
+	return true;
+}
+
+static boolean SaveHeader(void) {
+
+	GL_JournalHeader_X.Magic_UL = KC_JOURNAL_MAGIC;
+	GL_JournalHeader_X.Checksum_UL = HeaderChecksum(&GL_JournalHeader_X);
+
+	if (!WriteArea(0, (unsigned char *)&GL_JournalHeader_X, sizeof(KC_JOURNAL_HEADER_STRUCT))) {
+		DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "Unable to write journal header");
+		return false;
+	}
+
+	return true;
+}
+
+static unsigned long RecordOffset(unsigned long Index_UL) {
+	return (KC_JOURNAL_HEADER_SIZE + Index_UL * sizeof(KC_JOURNAL_RECORD_STRUCT));
+}
+
+static unsigned long HeaderChecksum(KC_JOURNAL_HEADER_STRUCT * pHeader_X) {
+	return Crc16((unsigned char *)pHeader_X, offsetof(KC_JOURNAL_HEADER_STRUCT, Checksum_UL));
+}
+
+static void SealRecord(KC_JOURNAL_RECORD_STRUCT * pRecord_X) {
+	unsigned int Crc_UI = Crc16((unsigned char *)pRecord_X, offsetof(KC_JOURNAL_RECORD_STRUCT, pCrc_UB));
+
+	pRecord_X->pCrc_UB[0] = (unsigned char)(Crc_UI);
+	pRecord_X->pCrc_UB[1] = (unsigned char)(Crc_UI >> 8);
+}
+
+static boolean IsRecordSealed(KC_JOURNAL_RECORD_STRUCT * pRecord_X) {
+	unsigned int Crc_UI = Crc16((unsigned char *)pRecord_X, offsetof(KC_JOURNAL_RECORD_STRUCT, pCrc_UB));
+
+	return ((pRecord_X->pCrc_UB[0] == (unsigned char)(Crc_UI)) && (pRecord_X->pCrc_UB[1] == (unsigned char)(Crc_UI >> 8)));
+}
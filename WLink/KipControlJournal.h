@@ -0,0 +1,77 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* KipControlJournal.h												                */
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Header file for KipControlJournal.cpp				            	        */
+/*		Persistent ring journal of the weights not yet sent to the portal.			*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __KIPCONTROL_JOURNAL_H__
+#define __KIPCONTROL_JOURNAL_H__
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+#include <Arduino.h>
+
+#include "MemoryCard.h"
+#include "EepromWire.h"
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+#define KC_JOURNAL_MAGIC                    0x4B4A0002  // 'KJ' + layout version (records sealed by a CRC-16)
+#define KC_JOURNAL_HEADER_SIZE              16
+#define KC_JOURNAL_TIMESTAMP_SIZE           20          // YYYY/MM/DD hh:mm:ss + NULL
+
+// Memory Card storage
+#define KC_JOURNAL_FILE_NAME                "KCJOURN.DAT"
+#define KC_JOURNAL_MEMORY_CARD_CAPACITY     4096        // Number of records
+
+// EEPROM storage (fallback) -> upper 8[kB] of the EEPROM (after the 88 first Reference Data tables)
+#define KC_JOURNAL_EEPROM_START_ADDR        0x6000
+#define KC_JOURNAL_EEPROM_SIZE              0x2000
+#define KC_JOURNAL_EEPROM_CAPACITY          ((KC_JOURNAL_EEPROM_SIZE - KC_JOURNAL_HEADER_SIZE) / sizeof(KC_JOURNAL_RECORD_STRUCT))
+
+/* ******************************************************************************** */
+/* Structure & Enumeration
+/* ******************************************************************************** */
+typedef enum {
+    KC_JOURNAL_STORAGE_NONE,
+    KC_JOURNAL_STORAGE_MEMORY_CARD,
+    KC_JOURNAL_STORAGE_EEPROM
+} KC_JOURNAL_STORAGE_ENUM;
+
+// Pending record (36 bytes)
+typedef struct {
+    signed int Weight_SI;                               // Weight [g]
+    unsigned long BatchId_UL;                           // ID of the batch
+    unsigned char Tolerance_UB;                         // Tolerance [%]
+    unsigned char Age_UB;                               // Day of the recording (starting at 1)
+    boolean IsValid_B;                                  // Weight within tolerance
+    char pTimeStamp_UB[KC_JOURNAL_TIMESTAMP_SIZE];      // Timestamp of the weighing
+    unsigned char pCrc_UB[2];                           // CRC-16 of the fields above (LSB first)
+} KC_JOURNAL_RECORD_STRUCT;
+
+/* ******************************************************************************** */
+/* Functions Prototypes
+/* ******************************************************************************** */
+void KipControlJournal_Init(MemoryCard * pMemCard_H, EepromWire * pEeprom_H);
+boolean KipControlJournal_IsAvailable(void);
+KC_JOURNAL_STORAGE_ENUM KipControlJournal_GetStorage(void);
+
+boolean KipControlJournal_Append(KC_JOURNAL_RECORD_STRUCT * pRecord_X);
+boolean KipControlJournal_Peek(KC_JOURNAL_RECORD_STRUCT * pRecord_X);
+boolean KipControlJournal_PeekAt(unsigned long Position_UL, KC_JOURNAL_RECORD_STRUCT * pRecord_X);
+boolean KipControlJournal_Pop(unsigned long RecordNb_UL = 1);
+void KipControlJournal_Clear(void);
+
+unsigned long KipControlJournal_GetCount(void);
+boolean KipControlJournal_IsEmpty(void);
+
+#endif // __KIPCONTROL_JOURNAL_H__
+
@@ -6,6 +6,8 @@
 /*		Describes the state machine to manage the KipControl application   			*/
 /*                                                                                  */
 /* History :  	17/04/2017  (RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Wait for the weights from the Event Bus			*/
+/*				18/10/2026	(RW)	Write back the shadow of the working area		*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -17,11 +19,13 @@
 
 #include "KipControlManager.h"
 #include "KipControlMedium.h"
+#include "KipControlJournal.h"
 #include "EepromWire.h"
 
 #include "Utilz.h"
 
 #include "Debug.h"
+#include "LoopProfiler.h"
 
 
 /* ******************************************************************************** */
@@ -38,6 +42,11 @@ extern GLOBAL_CONFIG_STRUCT GL_GlobalConfig_X;
 
 #define KC_MANAGER_CHECK_DATE_POLLING_TIME_MS		10000
 #define KC_MANAGER_SERVER_RESPONSE_TIMEOUT_MS		10000
+#define KC_MANAGER_RECONNECT_PERIOD_MS				300000		// Period to try to reconnect to the portal in offline mode
+#define KC_MANAGER_JOURNAL_RETRY_PERIOD_MS			60000		// Period before re-sending a journal record refused by the portal
+
+#define KC_MANAGER_IMPORT_PATH						"/kipcontrol/import"
+#define KC_MANAGER_RECORD_STR_SIZE					256			// Parameters of one record (data[i][...])
 
 
 /* ******************************************************************************** */
@@ -53,6 +62,7 @@ enum KC_STATE {
 	KC_WAIT_INDICATOR,
 	KC_CHECK_WEIGHT,
 	KC_SEND_PACKET,
+	KC_WAIT_TRANSACTION,
 	KC_SERVER_RESPONSE,
     KC_OFF_INDICATOR,
     KC_ASK_INDICATOR,
@@ -79,6 +89,15 @@ typedef struct {
 
 KC_MANAGER_SERVER_PARAM GL_ServerParam_X;
 
+static KC_JOURNAL_RECORD_STRUCT GL_pBatchRecord_X[KC_BATCH_MAX_RECORD_NB];	// Records being sent to the portal
+static unsigned char GL_BatchRecordNb_UB = 0;
+static boolean GL_RecordFromJournal_B = false;					// Current records come from the journal (drain)
+static boolean GL_JournalRetryPending_B = false;				// Wait before re-sending the oldest journal record
+static unsigned long GL_JournalRetryAbsoluteTime_UL = 0;
+static boolean GL_Reconnecting_B = false;						// Connecting again after an offline period
+static unsigned long GL_ReconnectAbsoluteTime_UL = 0;
+static boolean GL_WeightPending_B = false;						// New weight published for the KipControl indicator
+
 
 /* ******************************************************************************** */
 /* Prototypes for Internal Functions
@@ -92,6 +111,7 @@ static void ProcessWaitEnableRecording(void);
 static void ProcessWaitIndicator(void);
 static void ProcessCheckWeight(void);
 static void ProcessSendPacket(void);
+static void ProcessWaitTransaction(void);
 static void ProcessServerResponse(void);
 static void ProcessOffIndicator(void);
 static void ProcessAskIndicator(void);
@@ -107,12 +127,19 @@ static void TransitionToWaitEnableRecording(void);
 static void TransitionToWaitIndicator(void);
 static void TransitionToCheckWeight(void);
 static void TransitionToSendPacket(void);
+static void TransitionToWaitTransaction(void);
 static void TransitionToServerResponse(void);
 static void TransitionToOffIndicator(void);
 static void TransitionToAskIndicator(void);
 static void TransitionToEnd(void);
 static void TransitionToError(void);
 
+static void BuildCurrentRecord(void);
+static unsigned char LoadBatchFromJournal(void);
+static int FormatRecord(unsigned char Idx_UB, KC_JOURNAL_RECORD_STRUCT * pRecord_X, char * pBuffer_UB, unsigned int Size_UI);
+static void JournalCurrentRecord(void);
+static void TurnToOfflineMode(void);
+
 /* ******************************************************************************** */
 /* Prototypes for Getters & Setters
 /* ******************************************************************************** */
@@ -132,6 +159,9 @@ void KipControlManager_Init(void * pHanlde_H) {
 
     GL_WorkingData_X.RelaunchProcess_B = false;
 
+    // Journal of the weights not sent to the portal (Memory Card or EEPROM)
+    KipControlJournal_Init((GL_GlobalConfig_X.HasMemoryCard_B) ? &(GL_GlobalData_X.MemCard_H) : NULL, &(GL_GlobalData_X.Eeprom_H));
+
     DBG_PRINTLN(DEBUG_SEVERITY_INFO, "KipControl Manager Initialized");
 }
 
@@ -141,6 +171,7 @@ void KipControlManager_Enable() {
 
 void KipControlManager_Disable() {
     GL_KipControlManagerEnabled_B = false;
+    GL_pKipControl_H->flush();
 }
 
 void KipControlManager_Process() {
@@ -152,10 +183,45 @@ void KipControlManager_Process() {
 
     /* Error condition */
     if ((GL_KipControlManager_CurrentState_E != KC_IDLE) && GL_KipControlManagerEnabled_B && !KipControlMedium_IsReady()) {
-        TransitionToError();
+        if ((GL_KipControlManager_CurrentState_E >= KC_CONNECTING) && (GL_KipControlManager_CurrentState_E < KC_END)) {
+            // Medium lost while recording -> keep weighing in offline mode
+            if (!(GL_WorkingData_X.OfflineMode_B)) {
+                DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "Medium lost");
+                TurnToOfflineMode();
+
+                switch (GL_KipControlManager_CurrentState_E) {
+                case KC_CONNECTING:
+                    if (GL_Reconnecting_B) {
+                        GL_Reconnecting_B = false;
+                        TransitionToWaitIndicator();
+                    }
+                    else {
+                        TransitionToWaitEnableRecording();
+                    }
+                    break;
+
+                case KC_SEND_PACKET:
+                case KC_WAIT_TRANSACTION:
+                case KC_SERVER_RESPONSE:
+                    JournalCurrentRecord();
+                    TransitionToWaitIndicator();
+                    break;
+
+                default:
+                    break;
+                }
+            }
+        }
+        else {
+            TransitionToError();
+        }
     }
 
+    /* Write-back of the running counters - idle = no weight being processed */
+    GL_pKipControl_H->process((GL_KipControlManager_CurrentState_E != KC_CHECK_WEIGHT) && !GL_WeightPending_B);
+
 	/* State Machine */
+    LOOP_PROFILER_SET_STATE(LOOP_PROFILER_ID_APPLICATION, GL_KipControlManager_CurrentState_E);
     switch (GL_KipControlManager_CurrentState_E) {
     case KC_IDLE:				    ProcessIdle();				    break;
 	case KC_WAIT_USER:			    ProcessWaitUser();			    break;
@@ -166,6 +232,7 @@ void KipControlManager_Process() {
     case KC_WAIT_INDICATOR:         ProcessWaitIndicator();		    break;
     case KC_CHECK_WEIGHT:           ProcessCheckWeight();           break;
 	case KC_SEND_PACKET:		    ProcessSendPacket();		    break;
+	case KC_WAIT_TRANSACTION:	    ProcessWaitTransaction();	    break;
 	case KC_SERVER_RESPONSE:	    ProcessServerResponse();	    break;
     case KC_OFF_INDICATOR:          ProcessOffIndicator();          break;
     case KC_ASK_INDICATOR:          ProcessAskIndicator();          break;
@@ -215,7 +282,13 @@ void KipControlManager_EnableRecording(boolean Enable_B) {
 }
 
 void KipControlManager_SetZeroIndicator() {
-    IndicatorManager_SetZeroIndicator();
+    IndicatorManager_SetZeroIndicator(KC_INDICATOR_IDX);
+}
+
+// FIFO of the indicator only looked at when a new weight has been published
+void KipControlManager_OnEvent(const EVENT_BUS_EVENT_STRUCT * pEvent_X) {
+    if ((pEvent_X->Id_E == EVENT_BUS_ID_NEW_WEIGHT) && (pEvent_X->Source_UB == KC_INDICATOR_IDX))
+        GL_WeightPending_B = true;
 }
 
 /* ******************************************************************************** */
@@ -411,29 +484,46 @@ void ProcessRecoverData(void) {
 }
 
 void ProcessConnecting(void) {
+	// Wait for the end of the connection (GSM)
+	if (KipControlMedium_IsBusy())
+		return;
+
 	if (KipControlMedium_IsConnected()) {
 		DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Turn to online mode -> recording to portal allowed");
 		GL_WorkingData_X.OfflineMode_B = false;
+		GL_JournalRetryPending_B = false;
 
 		DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Setup connectivity environment");
 		KipControlMedium_SetupEnvironment();
+
+		if (!KipControlJournal_IsEmpty()) {
+			DBG_PRINT(DEBUG_SEVERITY_INFO, "Records pending in journal = ");
+			DBG_PRINTDATA(KipControlJournal_GetCount());
+			DBG_ENDSTR();
+		}
 	}
 	else {
 		DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "Cannot connect to portal");
-		DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "Turn to offline mode -> recording to portal disabled");
-		GL_WorkingData_X.OfflineMode_B = true;
+		TurnToOfflineMode();
 	}
 
-    TransitionToWaitEnableRecording();
+	// Reconnection while recording -> do not flush the pending weights
+	if (GL_Reconnecting_B) {
+		GL_Reconnecting_B = false;
+		TransitionToWaitIndicator();
+	}
+	else {
+		TransitionToWaitEnableRecording();
+	}
 }
 
 void ProcessWaitEnableRecording(void) {
     if (GL_WorkingData_X.EnableRecording_B) {
         // Flush Indicator Serial and FIFO
         DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Flush Indicator Serial and FIFO");
-        GL_GlobalData_X.Indicator_H.flushIndicator();
-        while (!(GL_GlobalData_X.Indicator_H.isFifoEmpty()))
-            GL_GlobalData_X.Indicator_H.fifoPop();
+        GL_GlobalData_X.pIndicator_H[KC_INDICATOR_IDX].flushIndicator();
+        while (!(GL_GlobalData_X.pIndicator_H[KC_INDICATOR_IDX].isFifoEmpty()))
+            GL_GlobalData_X.pIndicator_H[KC_INDICATOR_IDX].fifoPop();
 
         // Go to Wait Indicator (real process)
         TransitionToWaitIndicator();
@@ -448,11 +538,14 @@ void ProcessWaitIndicator(void) {
     }
     else {
 
-        // Wait for new Weight
-        if (!(GL_GlobalData_X.Indicator_H.isFifoEmpty())) {
+        // Wait for new Weight - several weights may be waiting in the FIFO for one event
+        if (GL_WeightPending_B && GL_GlobalData_X.pIndicator_H[KC_INDICATOR_IDX].isFifoEmpty())
+            GL_WeightPending_B = false;
+
+        if (GL_WeightPending_B) {
 
             DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Get Weight from Indicator");
-            GL_WorkingData_X.Weight_SI = GL_GlobalData_X.Indicator_H.fifoPop();
+            GL_WorkingData_X.Weight_SI = GL_GlobalData_X.pIndicator_H[KC_INDICATOR_IDX].fifoPop();
             
             GL_WorkingData_X.TimeStamp_Str = GL_GlobalData_X.Rtc_H.getTimestamp();
             GL_WorkingData_X.CurrentDate_X = GL_GlobalData_X.Rtc_H.getLastDate();
@@ -484,6 +577,35 @@ void ProcessWaitIndicator(void) {
                 TransitionToCheckWeight();
             }
         }
+        // Replay the journal to the portal (oldest first)
+        else if (!(GL_WorkingData_X.OfflineMode_B) && !KipControlJournal_IsEmpty()) {
+            if (!GL_JournalRetryPending_B || ((millis() - GL_JournalRetryAbsoluteTime_UL) >= KC_MANAGER_JOURNAL_RETRY_PERIOD_MS)) {
+                GL_JournalRetryPending_B = false;
+                if (LoadBatchFromJournal() > 0) {
+                    DBG_PRINT(DEBUG_SEVERITY_INFO, "Send ");
+                    DBG_PRINTDATA(GL_BatchRecordNb_UB);
+                    DBG_PRINTDATA(" record(s) from journal (pending = ");
+                    DBG_PRINTDATA(KipControlJournal_GetCount());
+                    DBG_PRINTDATA(")");
+                    DBG_ENDSTR();
+                    GL_RecordFromJournal_B = true;
+                    TransitionToSendPacket();
+                }
+                else {
+                    // Journal not readable -> try again later
+                    GL_JournalRetryPending_B = true;
+                    GL_JournalRetryAbsoluteTime_UL = millis();
+                }
+            }
+        }
+        // Try to reconnect to the portal
+        else if (GL_WorkingData_X.OfflineMode_B && KipControlMedium_IsReady()) {
+            if ((millis() - GL_ReconnectAbsoluteTime_UL) >= KC_MANAGER_RECONNECT_PERIOD_MS) {
+                DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Offline mode -> Try to reconnect to portal");
+                GL_Reconnecting_B = true;
+                TransitionToConnecting();
+            }
+        }
     }
 
 	// Check if reached the end of recording
@@ -550,8 +672,22 @@ void ProcessCheckWeight(void) {
 		}
 
 
+		BuildCurrentRecord();
+
 		//  Manage Transition
-		if (GL_WorkingData_X.OfflineMode_B) {
+		if ((GL_WorkingData_X.OfflineMode_B || !KipControlJournal_IsEmpty()) && KipControlJournal_Append(&GL_pBatchRecord_X[0])) {
+			// Keep the order of the records : sent when the journal is drained
+			DBG_PRINT(DEBUG_SEVERITY_INFO, "Weight stored in journal (pending = ");
+			DBG_PRINTDATA(KipControlJournal_GetCount());
+			DBG_PRINTDATA(")");
+			DBG_ENDSTR();
+
+			// Wait or new Weight
+			TransitionToWaitIndicator();
+		}
+		else if (GL_WorkingData_X.OfflineMode_B) {
+			DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "Offline mode and no journal -> Value not sent to portal..");
+
 			// Wait or new Weight
 			TransitionToWaitIndicator();
 		}
@@ -576,31 +712,43 @@ void ProcessCheckWeight(void) {
 
 void ProcessSendPacket(void) {
 
-	KipControlMedium_BeginTransaction();
-	KipControlMedium_Print("/kipcontrol/import?");
-	KipControlMedium_Print("data[0][Weight]=");
-	KipControlMedium_Print(GL_WorkingData_X.Weight_SI);
-	KipControlMedium_Print("&data[0][BalanceSerial]=");
-	KipControlMedium_Print((char *)(GL_WorkingData_X.MacAddr_Str).c_str());
-	KipControlMedium_Print("&data[0][Batch]=");
-	KipControlMedium_Print(GL_WorkingData_X.BatchId_UL);
-	KipControlMedium_Print("&data[0][Tolerance]=");
-	KipControlMedium_Print(GL_WorkingData_X.Tolerance_UB);
-	KipControlMedium_Print("&data[0][Age]=");
-	KipControlMedium_Print(GL_WorkingData_X.CurrentIdx_UB + 1);
-	KipControlMedium_Print("&data[0][DateTime]=");
-	KipControlMedium_Print((char *)(GL_WorkingData_X.TimeStamp_Str).c_str());
-	KipControlMedium_Print("&data[0][Valid]=");
-	KipControlMedium_Print(((GL_WorkingData_X.IsValid_B) ? 1 : 0));
+	char pRecord_UB[KC_MANAGER_RECORD_STR_SIZE];
+
+	if (KC_BATCH_METHOD == KC_MEDIUM_METHOD_POST) {
+		KipControlMedium_BeginPostTransaction(KC_MANAGER_IMPORT_PATH);
+	}
+	else {
+		KipControlMedium_BeginTransaction();
+		KipControlMedium_Print(KC_MANAGER_IMPORT_PATH "?");
+	}
+
+	// One set of data[i][...] parameters per record
+	for (unsigned char i = 0; i < GL_BatchRecordNb_UB; i++) {
+		FormatRecord(i, &GL_pBatchRecord_X[i], pRecord_UB, sizeof(pRecord_UB));
+		KipControlMedium_Print(pRecord_UB);
+	}
+
 	KipControlMedium_EndTransaction();
 
+	TransitionToWaitTransaction();
+}
+
+void ProcessWaitTransaction(void) {
+	// Wait for the end of the transaction (GSM)
+	if (KipControlMedium_IsBusy())
+		return;
+
     if (KipControlMedium_IsTransactionOk()) {
         DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transaction succeeded !");
         TransitionToServerResponse();
     }
     else {
         DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "Error in Transaction !");
-        TransitionToError();
+
+        // Keep the weight and wait for the portal to come back
+        JournalCurrentRecord();
+        TurnToOfflineMode();
+        TransitionToWaitIndicator();
     }
 }
 
@@ -658,12 +806,25 @@ void ProcessServerResponse(void) {
 		// Reset Access Counter
 		GL_ServerParam_X.AccessCounter_SI = 0;
 
+		// Records sent -> remove them from the journal
+		if (GL_RecordFromJournal_B)
+			KipControlJournal_Pop(GL_BatchRecordNb_UB);
+
 		// Wait for new Weight
 		TransitionToWaitIndicator();
 
 	} else if (GL_ServerParam_X.AccessCounter_SI >= 2) {
 		DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "Maximum number of try reached -> Value not sent to portal..");
 
+		if (GL_RecordFromJournal_B) {
+			// Keep the record in the journal and try again later
+			GL_JournalRetryPending_B = true;
+			GL_JournalRetryAbsoluteTime_UL = millis();
+		}
+		else {
+			JournalCurrentRecord();
+		}
+
 		// Reset Access Counter
 		GL_ServerParam_X.AccessCounter_SI = 0;
 
@@ -684,15 +845,15 @@ void ProcessServerResponse(void) {
 
 
 void ProcessOffIndicator(void) {
-    if (!IndicatorManager_IsRunning()) {
+    if (!IndicatorManager_IsRunning(KC_INDICATOR_IDX)) {
         if (GL_WorkingData_X.EnableRecording_B) {
             // Re-launch Indicator with Interrupt
-            IndicatorManager_Enable(INDICATOR_INTERFACE_FRAME_ASK_WEIGHT, true);
+            IndicatorManager_Enable(KC_INDICATOR_IDX, INDICATOR_INTERFACE_FRAME_ASK_WEIGHT, true);
             TransitionToWaitIndicator();
         }
         else {
             // Re-launch Indicator with cyclic asking
-            IndicatorManager_Enable(INDICATOR_INTERFACE_FRAME_ASK_WEIGHT, false, true);
+            IndicatorManager_Enable(KC_INDICATOR_IDX, INDICATOR_INTERFACE_FRAME_ASK_WEIGHT, false, true);
             TransitionToAskIndicator();
         }
     }
@@ -704,7 +865,7 @@ void ProcessAskIndicator(void) {
         TransitionToOffIndicator();
     }
     else {
-        GL_WorkingData_X.Weight_SI = GL_GlobalData_X.Indicator_H.getWeightValue();
+        GL_WorkingData_X.Weight_SI = GL_GlobalData_X.pIndicator_H[KC_INDICATOR_IDX].getWeightValue();
     }
 }
 
@@ -755,6 +916,7 @@ void TransitionToWaitEnableRecording(void) {
 void TransitionToWaitIndicator(void) {
 	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To WAIT INDICATOR");
 	GL_KipControlManagerAbsoluteTime_UL = millis();
+	GL_WeightPending_B = true;	// Weights may have been pushed while in another state
     GL_KipControlManager_CurrentState_E = KC_STATE::KC_WAIT_INDICATOR;
 }
 
@@ -768,6 +930,11 @@ void TransitionToSendPacket(void) {
     GL_KipControlManager_CurrentState_E = KC_STATE::KC_SEND_PACKET;
 }
 
+void TransitionToWaitTransaction(void) {
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To WAIT TRANSACTION");
+	GL_KipControlManager_CurrentState_E = KC_STATE::KC_WAIT_TRANSACTION;
+}
+
 void TransitionToServerResponse(void) {
 	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To SERVER RESPONSE");
 	GL_KipControlManagerAbsoluteTime_UL = millis();
@@ -776,10 +943,10 @@ void TransitionToServerResponse(void) {
 
 void TransitionToOffIndicator(void) {
     DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To OFF INDICATOR");
-    IndicatorManager_Disable();
-    GL_GlobalData_X.Indicator_H.flushIndicator();
-    while (!(GL_GlobalData_X.Indicator_H.isFifoEmpty()))
-        GL_GlobalData_X.Indicator_H.fifoPop();
+    IndicatorManager_Disable(KC_INDICATOR_IDX);
+    GL_GlobalData_X.pIndicator_H[KC_INDICATOR_IDX].flushIndicator();
+    while (!(GL_GlobalData_X.pIndicator_H[KC_INDICATOR_IDX].isFifoEmpty()))
+        GL_GlobalData_X.pIndicator_H[KC_INDICATOR_IDX].fifoPop();
     GL_KipControlManager_CurrentState_E = KC_STATE::KC_OFF_INDICATOR;
 }
 void TransitionToAskIndicator(void) {
@@ -798,3 +965,78 @@ void TransitionToError(void) {
 	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To ERROR");
 	GL_KipControlManager_CurrentState_E = KC_STATE::KC_ERROR;
 }
+
+
+void BuildCurrentRecord(void) {
+	memset(&GL_pBatchRecord_X[0], 0, sizeof(KC_JOURNAL_RECORD_STRUCT));
+	GL_pBatchRecord_X[0].Weight_SI = GL_WorkingData_X.Weight_SI;
+	GL_pBatchRecord_X[0].BatchId_UL = GL_WorkingData_X.BatchId_UL;
+	GL_pBatchRecord_X[0].Tolerance_UB = GL_WorkingData_X.Tolerance_UB;
+	GL_pBatchRecord_X[0].Age_UB = GL_WorkingData_X.CurrentIdx_UB + 1;		// Day starting at 1 -> index starting at 0
+	GL_pBatchRecord_X[0].IsValid_B = GL_WorkingData_X.IsValid_B;
+	GL_WorkingData_X.TimeStamp_Str.toCharArray(GL_pBatchRecord_X[0].pTimeStamp_UB, KC_JOURNAL_TIMESTAMP_SIZE);
+
+	GL_BatchRecordNb_UB = 1;
+	GL_RecordFromJournal_B = false;
+}
+
+unsigned char LoadBatchFromJournal(void) {
+	unsigned int BatchSize_UI = 0;
+	unsigned int RecordSize_UI = 0;
+
+	GL_BatchRecordNb_UB = 0;
+
+	// Oldest record (corrupted records are dropped)
+	if (!KipControlJournal_Peek(&GL_pBatchRecord_X[0]))
+		return 0;
+
+	BatchSize_UI = FormatRecord(0, &GL_pBatchRecord_X[0], NULL, 0);
+	GL_BatchRecordNb_UB = 1;
+
+	// Following records as long as the batch size allows it
+	while (GL_BatchRecordNb_UB < KC_BATCH_MAX_RECORD_NB) {
+		if (!KipControlJournal_PeekAt(GL_BatchRecordNb_UB, &GL_pBatchRecord_X[GL_BatchRecordNb_UB]))
+			break;
+
+		RecordSize_UI = FormatRecord(GL_BatchRecordNb_UB, &GL_pBatchRecord_X[GL_BatchRecordNb_UB], NULL, 0);
+		if ((BatchSize_UI + RecordSize_UI) > KC_BATCH_MAX_SIZE)
+			break;
+
+		BatchSize_UI += RecordSize_UI;
+		GL_BatchRecordNb_UB++;
+	}
+
+	return GL_BatchRecordNb_UB;
+}
+
+int FormatRecord(unsigned char Idx_UB, KC_JOURNAL_RECORD_STRUCT * pRecord_X, char * pBuffer_UB, unsigned int Size_UI) {
+	// Returns the length of the parameters (even if pBuffer_UB is NULL)
+	return snprintf(pBuffer_UB, Size_UI, "%sdata[%u][Weight]=%d&data[%u][BalanceSerial]=%s&data[%u][Batch]=%lu&data[%u][Tolerance]=%u&data[%u][Age]=%u&data[%u][DateTime]=%s&data[%u][Valid]=%d",
+		(Idx_UB == 0) ? "" : "&",
+		Idx_UB, pRecord_X->Weight_SI,
+		Idx_UB, GL_WorkingData_X.MacAddr_Str.c_str(),
+		Idx_UB, pRecord_X->BatchId_UL,
+		Idx_UB, pRecord_X->Tolerance_UB,
+		Idx_UB, pRecord_X->Age_UB,
+		Idx_UB, pRecord_X->pTimeStamp_UB,
+		Idx_UB, (pRecord_X->IsValid_B) ? 1 : 0);
+}
+
+void JournalCurrentRecord(void) {
+	// Records from the journal are still in it
+	if (GL_RecordFromJournal_B)
+		return;
+
+	if (KipControlJournal_Append(&GL_pBatchRecord_X[0])) {
+		DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Value stored in journal -> will be sent later");
+	}
+	else {
+		DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "Cannot store value in journal -> Value lost..");
+	}
+}
+
+void TurnToOfflineMode(void) {
+	DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "Turn to offline mode -> weights stored in journal");
+	GL_WorkingData_X.OfflineMode_B = true;
+	GL_ReconnectAbsoluteTime_UL = millis();
+}
@@ -7,6 +7,7 @@
 /*		Process functions to manage the KipControl application  					*/
 /*                                                                                  */
 /* History :	17/04/2017	(RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Wait for the weights from the Event Bus			*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -19,6 +20,7 @@
 #include "WLink.h"
 #include "KipControl.h"
 #include "RealTimeClock.h"
+#include "EventBus.h"
 
 /* ******************************************************************************** */
 /* Define
@@ -27,6 +29,12 @@
 #define KC_REFERENCE_TABLE_OFFSET       0x0100
 
 #define KC_MAX_DATA_NB					120
+#define KC_INDICATOR_IDX				0						// KipControl works with the first Indicator
+
+// Batched upload of the pending records (data[0..N-1])
+#define KC_BATCH_MAX_RECORD_NB			16						// Maximum number of records sent in one transaction
+#define KC_BATCH_MAX_SIZE				768						// Maximum size of the records parameters (URL for GET, body for POST)
+#define KC_BATCH_METHOD					KC_MEDIUM_METHOD_GET	// KC_MEDIUM_METHOD_POST to send the records in the body
 
 /* ******************************************************************************** */
 /* Structure & Enumeration
@@ -81,6 +89,7 @@ void KipControlManager_ResetConfiguredFlag();
 void KipControlManager_RelaunchProcess();
 void KipControlManager_EnableRecording(boolean Enable_B);
 void KipControlManager_SetZeroIndicator();
+void KipControlManager_OnEvent(const EVENT_BUS_EVENT_STRUCT * pEvent_X);
 
 #endif // __KIPCONTROL_MANAGER_H__
 
@@ -36,6 +36,30 @@
 /* Local Variables
 /* ******************************************************************************** */
 
+// GSM operations are driven one AT request at a time : each step is requested on completion of the previous one
+typedef enum {
+	KC_MEDIUM_GSM_STEP_NONE,
+	KC_MEDIUM_GSM_STEP_HTTP_TERM,		// Connection
+	KC_MEDIUM_GSM_STEP_HTTP_INIT,
+	KC_MEDIUM_GSM_STEP_PARAM_CID,
+	KC_MEDIUM_GSM_STEP_PARAM_REDIR,
+	KC_MEDIUM_GSM_STEP_PARAM_UA,
+	KC_MEDIUM_GSM_STEP_GET_URL,			// GET transaction (staged URL)
+	KC_MEDIUM_GSM_STEP_POST_CONTENT,	// POST transaction
+	KC_MEDIUM_GSM_STEP_POST_URL,
+	KC_MEDIUM_GSM_STEP_POST_DATA_SIZE,
+	KC_MEDIUM_GSM_STEP_POST_DATA,
+	KC_MEDIUM_GSM_STEP_ACTION
+} KC_MEDIUM_GSM_STEP_ENUM;
+
+// Ethernet response parsed as it is received (see KipControlMedium_IsBusy())
+typedef enum {
+	KC_MEDIUM_ETH_RESPONSE_NONE,		// No transaction in progress
+	KC_MEDIUM_ETH_RESPONSE_STATUS,		// Waiting for the status line
+	KC_MEDIUM_ETH_RESPONSE_HEADER,
+	KC_MEDIUM_ETH_RESPONSE_BODY
+} KC_MEDIUM_ETH_RESPONSE_ENUM;
+
 static EthernetClient * GL_pMediumEthernet_H;
 static FonaModule * GL_pMediumGsm_H;
 
@@ -48,6 +72,42 @@ static int GL_ServerResponse_SI = 0;
 static int GL_ServerData_SI = 0;
 static boolean GL_TransactionStatus_B = false;
 
+static unsigned long GL_GsmTicket_UL = 0;		// Ticket of the last AT request of the current GSM operation
+static KC_MEDIUM_GSM_STEP_ENUM GL_GsmStep_E = KC_MEDIUM_GSM_STEP_NONE;
+static char * GL_pGsmReadData_UB = NULL;
+
+static KC_MEDIUM_METHOD_ENUM GL_Method_E = KC_MEDIUM_METHOD_GET;
+static const char * GL_pPostPath_UB = NULL;
+static char GL_pPostBody_UB[KC_MEDIUM_POST_BODY_SIZE];	// Body of the POST transaction (Ethernet)
+static unsigned int GL_PostBodyLength_UI = 0;
+static boolean GL_PostBodyOverflow_B = false;
+static boolean GL_GsmPostReady_B = false;
+
+static KC_MEDIUM_ETH_RESPONSE_ENUM GL_EthResponse_E = KC_MEDIUM_ETH_RESPONSE_NONE;
+static unsigned long GL_EthResponseTime_UL = 0;
+static char GL_pEthLine_UB[KC_MEDIUM_RESPONSE_LINE_SIZE];
+static unsigned int GL_EthLineLength_UI = 0;
+static int GL_EthContentLength_SI = -1;				// -1 = no Content-Length header (body ends with the connection)
+static char GL_pEthData_UB[KC_MEDIUM_RESPONSE_DATA_SIZE];
+static unsigned int GL_EthDataLength_UI = 0;
+static unsigned long GL_EthBodyNb_UL = 0;			// Bytes of the body received (including the ones not kept)
+
+
+/* ******************************************************************************** */
+/* Prototypes for Internal Functions
+/* ******************************************************************************** */
+static boolean RequestGsmStep(KC_MEDIUM_GSM_STEP_ENUM Step_E);
+static KC_MEDIUM_GSM_STEP_ENUM GetNextGsmStep(KC_MEDIUM_GSM_STEP_ENUM Step_E);
+static void OnGsmStep(FONA_MODULE_AT_STS_ENUM Status_E, const char * pResponse_UB);
+static void OnGsmHttpRead(FONA_MODULE_AT_STS_ENUM Status_E, const char * pResponse_UB);
+static void AppendPostBody(const char * pData_UB);
+static void EndPostTransaction(void);
+static boolean ConnectEthernet(void);
+static void BeginEthernetResponse(void);
+static boolean ProcessEthernetResponse(void);
+static void ParseEthernetLine(void);
+static void EndEthernetResponse(void);
+
 
 /* ******************************************************************************** */
 /* Functions
@@ -88,6 +148,10 @@ boolean KipControlMedium_IsReady(void) {
 	case KC_MEDIUM_GSM:
 		return (FonaModuleManager_IsRunning() && FonaModuleManager_GetCurrentGprsState());
 		break;
+
+	default:
+		return false;
+		break;
 	}
 }
 
@@ -100,6 +164,10 @@ boolean KipControlMedium_IsError(void) {
 	case KC_MEDIUM_GSM:
 		return FonaModuleManager_IsError();
 		break;
+
+	default:
+		return false;
+		break;
 	}
 }
 
@@ -111,8 +179,12 @@ boolean KipControlMedium_Connect(void) {
 		break;
 
 	case KC_MEDIUM_GSM:
-		GL_pMediumGsm_H->httpTerm();	// Make sure all HTTP transactions are terminated
-		return (GL_pMediumGsm_H->httpInit());
+		// Terminate any HTTP session, then initialize and set up the new one (see OnGsmStep())
+		return RequestGsmStep(KC_MEDIUM_GSM_STEP_HTTP_TERM);
+		break;
+
+	default:
+		return false;
 		break;
 	}
 }
@@ -124,8 +196,28 @@ boolean KipControlMedium_IsConnected(void) {
 		break;
 
 	case KC_MEDIUM_GSM:
-		// No status available for GSM
-		return true;
+		// Status of the last step of the connection (ticket of the failed step otherwise - see OnGsmStep())
+		return ((GL_GsmStep_E == KC_MEDIUM_GSM_STEP_NONE) && (GL_pMediumGsm_H->getAtStatus(GL_GsmTicket_UL) == FONA_MODULE_AT_STS_OK));
+		break;
+
+	default:
+		return false;
+		break;
+	}
+}
+
+boolean KipControlMedium_IsBusy(void) {
+	switch (GL_Medium_E) {
+	case KC_MEDIUM_ETHERNET:
+		return ProcessEthernetResponse();
+		break;
+
+	case KC_MEDIUM_GSM:
+		return GL_pMediumGsm_H->isAtPending(GL_GsmTicket_UL);
+		break;
+
+	default:
+		return false;
 		break;
 	}
 }
@@ -138,25 +230,46 @@ void KipControlMedium_SetupEnvironment(void) {
 		break;
 
 	case KC_MEDIUM_GSM:
-		GL_pMediumGsm_H->httpParam(FONA_MODULE_HTTP_PARAM_CID, 1);
-		GL_pMediumGsm_H->httpParam(FONA_MODULE_HTTP_PARAM_REDIR, 1);
-		GL_pMediumGsm_H->httpParam(FONA_MODULE_HTTP_PARAM_UA, "WLINK");
+		// Done by the connection (see KipControlMedium_Connect())
 		break;
 	}
 }
 
 
 void KipControlMedium_BeginTransaction(void) {
+	GL_Method_E = KC_MEDIUM_METHOD_GET;
+
 	switch (GL_Medium_E) {
 	case KC_MEDIUM_ETHERNET:
+		ConnectEthernet();
 		GL_pMediumEthernet_H->print("GET http://");
 		GL_pMediumEthernet_H->print(GL_ServerName_Str);
 		break;
 
 	case KC_MEDIUM_GSM:
-		GL_pMediumGsm_H->httpParamStart(FONA_MODULE_HTTP_PARAM_URL);
-		GL_pMediumGsm_H->httpParamAdd("http://");
-		GL_pMediumGsm_H->httpParamAdd((char *)(GL_ServerName_Str.c_str()));
+		GL_pMediumGsm_H->stageHttpParam(FONA_MODULE_HTTP_PARAM_URL);
+		GL_pMediumGsm_H->stageAtData("http://");
+		GL_pMediumGsm_H->stageAtData(GL_ServerName_Str);
+		break;
+	}
+}
+
+void KipControlMedium_BeginPostTransaction(const char * pPath_UB) {
+	GL_Method_E = KC_MEDIUM_METHOD_POST;
+	GL_pPostPath_UB = pPath_UB;
+
+	switch (GL_Medium_E) {
+	case KC_MEDIUM_ETHERNET:
+		// Body is buffered to send the Content-Length header first
+		ConnectEthernet();
+		GL_PostBodyLength_UI = 0;
+		GL_PostBodyOverflow_B = false;
+		GL_pPostBody_UB[0] = 0;
+		break;
+
+	case KC_MEDIUM_GSM:
+		// Body is staged, parameters are set by the transaction steps (see EndPostTransaction())
+		GL_GsmPostReady_B = GL_pMediumGsm_H->stageHttpData();
 		break;
 	}
 }
@@ -165,11 +278,14 @@ void KipControlMedium_BeginTransaction(void) {
 void KipControlMedium_Print(unsigned char Data_UB) {
 	switch (GL_Medium_E) {
 	case KC_MEDIUM_ETHERNET:
-		GL_pMediumEthernet_H->print(Data_UB);
+		if (GL_Method_E == KC_MEDIUM_METHOD_POST)
+			AppendPostBody(String((int)(Data_UB)).c_str());
+		else
+			GL_pMediumEthernet_H->print(Data_UB);
 		break;
 
 	case KC_MEDIUM_GSM:
-		GL_pMediumGsm_H->httpParamAdd(Data_UB);
+		GL_pMediumGsm_H->stageAtData((int)(Data_UB));		// Printed as a number (as for Ethernet)
 		break;
 	}
 }
@@ -177,11 +293,14 @@ void KipControlMedium_Print(unsigned char Data_UB) {
 void KipControlMedium_Print(int Data_SI) {
 	switch (GL_Medium_E) {
 	case KC_MEDIUM_ETHERNET:
-		GL_pMediumEthernet_H->print(Data_SI);
+		if (GL_Method_E == KC_MEDIUM_METHOD_POST)
+			AppendPostBody(String(Data_SI).c_str());
+		else
+			GL_pMediumEthernet_H->print(Data_SI);
 		break;
 
 	case KC_MEDIUM_GSM:
-		GL_pMediumGsm_H->httpParamAdd(Data_SI);
+		GL_pMediumGsm_H->stageAtData(Data_SI);
 		break;
 	}
 }
@@ -189,23 +308,29 @@ void KipControlMedium_Print(int Data_SI) {
 void KipControlMedium_Print(unsigned long Data_UL) {
 	switch (GL_Medium_E) {
 	case KC_MEDIUM_ETHERNET:
-		GL_pMediumEthernet_H->print(Data_UL);
+		if (GL_Method_E == KC_MEDIUM_METHOD_POST)
+			AppendPostBody(String(Data_UL).c_str());
+		else
+			GL_pMediumEthernet_H->print(Data_UL);
 		break;
 
 	case KC_MEDIUM_GSM:
-		GL_pMediumGsm_H->httpParamAdd(Data_UL);
+		GL_pMediumGsm_H->stageAtData(Data_UL);
 		break;
 	}
 }
 
-void KipControlMedium_Print(char * pData_UB) {
+void KipControlMedium_Print(const char * pData_UB) {
 	switch (GL_Medium_E) {
 	case KC_MEDIUM_ETHERNET:
-		GL_pMediumEthernet_H->print(pData_UB);
+		if (GL_Method_E == KC_MEDIUM_METHOD_POST)
+			AppendPostBody(pData_UB);
+		else
+			GL_pMediumEthernet_H->print(pData_UB);
 		break;
 
 	case KC_MEDIUM_GSM:
-		GL_pMediumGsm_H->httpParamAdd(pData_UB);
+		GL_pMediumGsm_H->stageAtData(pData_UB);
 		break;
 	}
 }
@@ -213,16 +338,25 @@ void KipControlMedium_Print(char * pData_UB) {
 void KipControlMedium_Print(String Data_Str) {
 	switch (GL_Medium_E) {
 	case KC_MEDIUM_ETHERNET:
-		GL_pMediumEthernet_H->print(Data_Str);
+		if (GL_Method_E == KC_MEDIUM_METHOD_POST)
+			AppendPostBody(Data_Str.c_str());
+		else
+			GL_pMediumEthernet_H->print(Data_Str);
 		break;
 
 	case KC_MEDIUM_GSM:
-		GL_pMediumGsm_H->httpParamAdd(Data_Str);
+		GL_pMediumGsm_H->stageAtData(Data_Str);
 		break;
 	}
 }
 
 void KipControlMedium_EndTransaction(void) {
+
+	if (GL_Method_E == KC_MEDIUM_METHOD_POST) {
+		EndPostTransaction();
+		return;
+	}
+
 	switch (GL_Medium_E) {
 	case KC_MEDIUM_ETHERNET:
 		GL_pMediumEthernet_H->println("&submitted=1&action=validate HTTP/1.1");
@@ -230,28 +364,23 @@ void KipControlMedium_EndTransaction(void) {
 		GL_pMediumEthernet_H->println(GL_ServerName_Str);
 		GL_pMediumEthernet_H->println("Connection: close");
 		GL_pMediumEthernet_H->println();
-		delay(1);
 		GL_pMediumEthernet_H->flush();
+		BeginEthernetResponse();
 		break;
 
 	case KC_MEDIUM_GSM:
-		GL_pMediumGsm_H->httpParamAdd("&submitted=1&action=validate");
-		GL_pMediumGsm_H->httpParamEnd();
-        GL_TransactionStatus_B = GL_pMediumGsm_H->httpAction(FONA_MODULE_HTTP_ACTION_METHOD_GET, &GL_ServerResponse_SI, &GL_ServerData_SI);
+		GL_pMediumGsm_H->stageAtData("&submitted=1&action=validate");
+		GL_TransactionStatus_B = false;
+		GL_ServerResponse_SI = 0;
+		GL_ServerData_SI = 0;
+		RequestGsmStep(KC_MEDIUM_GSM_STEP_GET_URL);
 		break;
 	}
 }
 
+// Status line received (Ethernet) or HTTP action completed (GSM)
 boolean KipControlMedium_IsTransactionOk(void) {
-    switch (GL_Medium_E) {
-    case KC_MEDIUM_ETHERNET:
-        return true;
-        break;
-
-    case KC_MEDIUM_GSM:
-        return GL_TransactionStatus_B;
-        break;
-    }
+	return GL_TransactionStatus_B;
 }
 
 void KipControlMedium_Flush(void) {
@@ -264,59 +393,308 @@ void KipControlMedium_Flush(void) {
 		break;
 
 	case KC_MEDIUM_GSM:
-		GL_pMediumGsm_H->flush();
+		// Nothing to do : unsolicited lines are discarded by the AT engine
 		break;
 	}
 }
 
+// Response of the last transaction (Ethernet : parsed by KipControlMedium_IsBusy(), GSM : result of AT+HTTPACTION)
 int KipControlMedium_DataAvailable(void) {
+	return GL_ServerData_SI;
+}
+
+int KipControlMedium_GetServerResponse(void) {
+	return GL_ServerResponse_SI;
+}
+
+int KipControlMedium_GetDataSize(void) {
+	return GL_ServerData_SI;
+}
+
+void KipControlMedium_Read(char * pData_UB) {
 	switch (GL_Medium_E) {
 	case KC_MEDIUM_ETHERNET:
-		return GL_pMediumEthernet_H->available();
+		// Body already received (truncated to KC_MEDIUM_RESPONSE_DATA_SIZE - 1 characters)
+		memcpy(pData_UB, GL_pEthData_UB, GL_EthDataLength_UI + 1);
 		break;
 
 	case KC_MEDIUM_GSM:
-		return GL_ServerData_SI;
+		// Data is copied once the response is received (see KipControlMedium_IsBusy())
+		GL_pGsmReadData_UB = pData_UB;
+		GL_GsmTicket_UL = GL_pMediumGsm_H->requestHttpRead(OnGsmHttpRead);
 		break;
 	}
 }
 
-int KipControlMedium_GetServerResponse(void) {
-	switch (GL_Medium_E) {
-	case KC_MEDIUM_ETHERNET:
-		DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "To be implemented !");
-		return -1;
+
+/* ******************************************************************************** */
+/* Internal Functions
+/* ******************************************************************************** */
+
+// A ticket of 0 (AT queue full) ends the operation : not busy, not connected and transaction failed
+boolean RequestGsmStep(KC_MEDIUM_GSM_STEP_ENUM Step_E) {
+	char pUrl_UB[FONA_MODULE_AT_COMMAND_SIZE];
+
+	GL_GsmStep_E = Step_E;
+
+	switch (Step_E) {
+	case KC_MEDIUM_GSM_STEP_HTTP_TERM:		GL_GsmTicket_UL = GL_pMediumGsm_H->requestAt("AT+HTTPTERM", FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, NULL, "OK", OnGsmStep);	break;
+	case KC_MEDIUM_GSM_STEP_HTTP_INIT:		GL_GsmTicket_UL = GL_pMediumGsm_H->requestAt("AT+HTTPINIT", FONA_MODULE_AT_DEFAULT_TIMEOUT_MS, NULL, "OK", OnGsmStep);	break;
+	case KC_MEDIUM_GSM_STEP_PARAM_CID:		GL_GsmTicket_UL = GL_pMediumGsm_H->requestHttpParam(FONA_MODULE_HTTP_PARAM_CID, 1, OnGsmStep);							break;
+	case KC_MEDIUM_GSM_STEP_PARAM_REDIR:	GL_GsmTicket_UL = GL_pMediumGsm_H->requestHttpParam(FONA_MODULE_HTTP_PARAM_REDIR, 1, OnGsmStep);							break;
+	case KC_MEDIUM_GSM_STEP_PARAM_UA:		GL_GsmTicket_UL = GL_pMediumGsm_H->requestHttpParam(FONA_MODULE_HTTP_PARAM_UA, "WLINK", OnGsmStep);						break;
+	case KC_MEDIUM_GSM_STEP_GET_URL:		GL_GsmTicket_UL = GL_pMediumGsm_H->requestStagedHttpParam(OnGsmStep);														break;
+	case KC_MEDIUM_GSM_STEP_POST_CONTENT:	GL_GsmTicket_UL = GL_pMediumGsm_H->requestHttpParam(FONA_MODULE_HTTP_PARAM_CONTENT, KC_MEDIUM_POST_CONTENT_TYPE, OnGsmStep);	break;
+	case KC_MEDIUM_GSM_STEP_POST_DATA_SIZE:	GL_GsmTicket_UL = GL_pMediumGsm_H->requestHttpData(OnGsmStep);																break;
+	case KC_MEDIUM_GSM_STEP_POST_DATA:		GL_GsmTicket_UL = GL_pMediumGsm_H->requestStagedHttpData(OnGsmStep);														break;
+
+	case KC_MEDIUM_GSM_STEP_POST_URL:
+		// URL is short -> not staged (staging buffer holds the body)
+		snprintf(pUrl_UB, sizeof(pUrl_UB), "http://%s%s", GL_ServerName_Str.c_str(), GL_pPostPath_UB);
+		GL_GsmTicket_UL = GL_pMediumGsm_H->requestHttpParam(FONA_MODULE_HTTP_PARAM_URL, pUrl_UB, OnGsmStep);
 		break;
 
-	case KC_MEDIUM_GSM:
-		return GL_ServerResponse_SI;
+	case KC_MEDIUM_GSM_STEP_ACTION:
+		GL_GsmTicket_UL = GL_pMediumGsm_H->requestHttpAction(((GL_Method_E == KC_MEDIUM_METHOD_POST) ? FONA_MODULE_HTTP_ACTION_METHOD_POST : FONA_MODULE_HTTP_ACTION_METHOD_GET), OnGsmStep, false);
+		break;
+
+	default:
+		GL_GsmTicket_UL = 0;
 		break;
 	}
+
+	if (GL_GsmTicket_UL == 0) {
+		DBG_PRINT(DEBUG_SEVERITY_ERROR, "GSM step could not be requested : ");
+		DBG_PRINTDATA(Step_E);
+		DBG_ENDSTR();
+		GL_GsmStep_E = KC_MEDIUM_GSM_STEP_NONE;
+		return false;
+	}
+
+	return true;
 }
 
-int KipControlMedium_GetDataSize(void) {
-	switch (GL_Medium_E) {
-	case KC_MEDIUM_ETHERNET:
-		DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "To be implemented !");
-		return -1;
+KC_MEDIUM_GSM_STEP_ENUM GetNextGsmStep(KC_MEDIUM_GSM_STEP_ENUM Step_E) {
+	switch (Step_E) {
+	case KC_MEDIUM_GSM_STEP_HTTP_TERM:			return KC_MEDIUM_GSM_STEP_HTTP_INIT;
+	case KC_MEDIUM_GSM_STEP_HTTP_INIT:			return KC_MEDIUM_GSM_STEP_PARAM_CID;
+	case KC_MEDIUM_GSM_STEP_PARAM_CID:			return KC_MEDIUM_GSM_STEP_PARAM_REDIR;
+	case KC_MEDIUM_GSM_STEP_PARAM_REDIR:		return KC_MEDIUM_GSM_STEP_PARAM_UA;
+	case KC_MEDIUM_GSM_STEP_GET_URL:			return KC_MEDIUM_GSM_STEP_ACTION;
+	case KC_MEDIUM_GSM_STEP_POST_CONTENT:		return KC_MEDIUM_GSM_STEP_POST_URL;
+	case KC_MEDIUM_GSM_STEP_POST_URL:			return KC_MEDIUM_GSM_STEP_POST_DATA_SIZE;
+	case KC_MEDIUM_GSM_STEP_POST_DATA_SIZE:		return KC_MEDIUM_GSM_STEP_POST_DATA;
+	case KC_MEDIUM_GSM_STEP_POST_DATA:			return KC_MEDIUM_GSM_STEP_ACTION;
+	default:									return KC_MEDIUM_GSM_STEP_NONE;
+	}
+}
+
+// Called by the AT engine on completion of the current step : the failed step keeps its ticket (see KipControlMedium_IsConnected())
+void OnGsmStep(FONA_MODULE_AT_STS_ENUM Status_E, const char * pResponse_UB) {
+	KC_MEDIUM_GSM_STEP_ENUM NextStep_E;
+
+	switch (GL_GsmStep_E) {
+	case KC_MEDIUM_GSM_STEP_HTTP_TERM:
+		// ERROR only means that no HTTP session was opened -> any other failure means the module does not answer
+		if (Status_E == FONA_MODULE_AT_STS_ERROR)
+			Status_E = FONA_MODULE_AT_STS_OK;
 		break;
 
-	case KC_MEDIUM_GSM:
-		return GL_ServerData_SI;
+	case KC_MEDIUM_GSM_STEP_ACTION:
+		if (Status_E == FONA_MODULE_AT_STS_OK)
+			GL_TransactionStatus_B = GL_pMediumGsm_H->parseHttpAction(pResponse_UB, &GL_ServerResponse_SI, &GL_ServerData_SI);
+		else
+			GL_TransactionStatus_B = false;
+
+		DBG_PRINT(DEBUG_SEVERITY_INFO, "Server Response = ");
+		DBG_PRINTDATA(GL_ServerResponse_SI);
+		DBG_PRINTDATA(" - Data Size = ");
+		DBG_PRINTDATA(GL_ServerData_SI);
+		DBG_ENDSTR();
+		break;
+
+	default:
 		break;
 	}
+
+	if (Status_E != FONA_MODULE_AT_STS_OK) {
+		DBG_PRINT(DEBUG_SEVERITY_ERROR, "GSM step failed : ");
+		DBG_PRINTDATA(GL_GsmStep_E);
+		DBG_ENDSTR();
+		GL_GsmStep_E = KC_MEDIUM_GSM_STEP_NONE;
+		return;
+	}
+
+	NextStep_E = GetNextGsmStep(GL_GsmStep_E);
+	if (NextStep_E != KC_MEDIUM_GSM_STEP_NONE)
+		RequestGsmStep(NextStep_E);
+	else
+		GL_GsmStep_E = KC_MEDIUM_GSM_STEP_NONE;
 }
 
-void KipControlMedium_Read(char * pData_UB) {
+void OnGsmHttpRead(FONA_MODULE_AT_STS_ENUM Status_E, const char * pResponse_UB) {
+	if ((Status_E == FONA_MODULE_AT_STS_OK) && (GL_pGsmReadData_UB != NULL))
+		GL_pMediumGsm_H->parseHttpRead(pResponse_UB, GL_pGsmReadData_UB);
+}
+
+void AppendPostBody(const char * pData_UB) {
+	unsigned int Length_UI = strlen(pData_UB);
+
+	if ((GL_PostBodyLength_UI + Length_UI) >= KC_MEDIUM_POST_BODY_SIZE) {
+		GL_PostBodyOverflow_B = true;
+		return;
+	}
+
+	memcpy(&(GL_pPostBody_UB[GL_PostBodyLength_UI]), pData_UB, Length_UI);
+	GL_PostBodyLength_UI += Length_UI;
+	GL_pPostBody_UB[GL_PostBodyLength_UI] = 0;
+}
+
+void EndPostTransaction(void) {
 	switch (GL_Medium_E) {
 	case KC_MEDIUM_ETHERNET:
-		pData_UB[0] = 0x00;
-		DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "To be implemented !");
+		AppendPostBody("&submitted=1&action=validate");
+
+		// A truncated batch is not sent : transaction failed, the records stay in the journal
+		if (GL_PostBodyOverflow_B) {
+			DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "POST body too long -> not sent !");
+			GL_pMediumEthernet_H->stop();
+			GL_TransactionStatus_B = false;
+			GL_ServerResponse_SI = 0;
+			GL_ServerData_SI = 0;
+			GL_EthResponse_E = KC_MEDIUM_ETH_RESPONSE_NONE;
+			break;
+		}
+
+		GL_pMediumEthernet_H->print("POST http://");
+		GL_pMediumEthernet_H->print(GL_ServerName_Str);
+		GL_pMediumEthernet_H->print(GL_pPostPath_UB);
+		GL_pMediumEthernet_H->println(" HTTP/1.1");
+		GL_pMediumEthernet_H->print("Host: ");
+		GL_pMediumEthernet_H->println(GL_ServerName_Str);
+		GL_pMediumEthernet_H->print("Content-Type: ");
+		GL_pMediumEthernet_H->println(KC_MEDIUM_POST_CONTENT_TYPE);
+		GL_pMediumEthernet_H->print("Content-Length: ");
+		GL_pMediumEthernet_H->println(GL_PostBodyLength_UI);
+		GL_pMediumEthernet_H->println("Connection: close");
+		GL_pMediumEthernet_H->println();
+		GL_pMediumEthernet_H->print(GL_pPostBody_UB);
+		GL_pMediumEthernet_H->flush();
+		BeginEthernetResponse();
 		break;
 
 	case KC_MEDIUM_GSM:
-		GL_pMediumGsm_H->httpRead(pData_UB);
+		GL_pMediumGsm_H->stageAtData("&submitted=1&action=validate");
+		GL_TransactionStatus_B = false;
+		GL_ServerResponse_SI = 0;
+		GL_ServerData_SI = 0;
+		if (GL_GsmPostReady_B)
+			RequestGsmStep(KC_MEDIUM_GSM_STEP_POST_CONTENT);
+		else
+			GL_GsmTicket_UL = 0;
 		break;
 	}
 }
 
+// The server closes the connection after each response ("Connection: close") : opened again for the next transaction
+boolean ConnectEthernet(void) {
+	if (GL_pMediumEthernet_H->connected())
+		return true;
+
+	GL_pMediumEthernet_H->stop();
+	return (((GL_pMediumEthernet_H->connect(GL_ServerName_Str.c_str(), (int)GL_ServerPort_UL)) == 1) ? true : false);
+}
+
+void BeginEthernetResponse(void) {
+	GL_TransactionStatus_B = false;
+	GL_ServerResponse_SI = 0;
+	GL_ServerData_SI = 0;
+	GL_EthContentLength_SI = -1;
+	GL_EthLineLength_UI = 0;
+	GL_EthDataLength_UI = 0;
+	GL_EthBodyNb_UL = 0;
+	GL_pEthData_UB[0] = 0;
+	GL_EthResponseTime_UL = millis();
+	GL_EthResponse_E = KC_MEDIUM_ETH_RESPONSE_STATUS;
+}
+
+// Read what has been received so far - returns true while the response is not complete
+boolean ProcessEthernetResponse(void) {
+	int Data_SI;
+
+	if (GL_EthResponse_E == KC_MEDIUM_ETH_RESPONSE_NONE)
+		return false;
+
+	while ((GL_EthResponse_E != KC_MEDIUM_ETH_RESPONSE_NONE) && ((Data_SI = GL_pMediumEthernet_H->read()) >= 0)) {
+		if (GL_EthResponse_E == KC_MEDIUM_ETH_RESPONSE_BODY) {
+			if (GL_EthDataLength_UI < (KC_MEDIUM_RESPONSE_DATA_SIZE - 1)) {
+				GL_pEthData_UB[GL_EthDataLength_UI++] = (char)Data_SI;
+				GL_pEthData_UB[GL_EthDataLength_UI] = 0;
+			}
+			GL_EthBodyNb_UL++;
+			if ((GL_EthContentLength_SI >= 0) && (GL_EthBodyNb_UL >= (unsigned long)GL_EthContentLength_SI))
+				EndEthernetResponse();
+		}
+		else if (Data_SI == '\n') {
+			GL_pEthLine_UB[GL_EthLineLength_UI] = 0;
+			ParseEthernetLine();
+			GL_EthLineLength_UI = 0;
+		}
+		else if ((Data_SI != '\r') && (GL_EthLineLength_UI < (KC_MEDIUM_RESPONSE_LINE_SIZE - 1))) {
+			GL_pEthLine_UB[GL_EthLineLength_UI++] = (char)Data_SI;
+		}
+	}
+
+	if (GL_EthResponse_E == KC_MEDIUM_ETH_RESPONSE_NONE)
+		return false;
+
+	// Connection closed by the server (end of a body without Content-Length) or no response
+	if (!(GL_pMediumEthernet_H->connected()) || ((millis() - GL_EthResponseTime_UL) >= KC_MEDIUM_RESPONSE_TIMEOUT_MS)) {
+		if (GL_EthResponse_E != KC_MEDIUM_ETH_RESPONSE_BODY) {
+			DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "Incomplete response from server");
+			GL_ServerResponse_SI = 0;
+		}
+		EndEthernetResponse();
+		return false;
+	}
+
+	return true;
+}
+
+// Status line "HTTP/1.x <code> <reason>", then the headers up to an empty line
+void ParseEthernetLine(void) {
+	switch (GL_EthResponse_E) {
+	case KC_MEDIUM_ETH_RESPONSE_STATUS:
+		if ((strncmp(GL_pEthLine_UB, "HTTP/", 5) == 0) && (strchr(GL_pEthLine_UB, ' ') != NULL)) {
+			GL_ServerResponse_SI = atoi(strchr(GL_pEthLine_UB, ' ') + 1);
+			GL_EthResponse_E = KC_MEDIUM_ETH_RESPONSE_HEADER;
+		}
+		break;
+
+	case KC_MEDIUM_ETH_RESPONSE_HEADER:
+		if (GL_EthLineLength_UI == 0) {
+			GL_EthResponse_E = KC_MEDIUM_ETH_RESPONSE_BODY;
+			if (GL_EthContentLength_SI == 0)
+				EndEthernetResponse();
+		}
+		else if (strncasecmp(GL_pEthLine_UB, "Content-Length:", 15) == 0) {
+			GL_EthContentLength_SI = atoi(&(GL_pEthLine_UB[15]));
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+void EndEthernetResponse(void) {
+	GL_ServerData_SI = (GL_EthContentLength_SI >= 0) ? GL_EthContentLength_SI : (int)GL_EthBodyNb_UL;
+	GL_TransactionStatus_B = (GL_ServerResponse_SI > 0) ? true : false;
+	GL_EthResponse_E = KC_MEDIUM_ETH_RESPONSE_NONE;
+
+	DBG_PRINT(DEBUG_SEVERITY_INFO, "Server Response = ");
+	DBG_PRINTDATA(GL_ServerResponse_SI);
+	DBG_PRINTDATA(" - Data Size = ");
+	DBG_PRINTDATA(GL_ServerData_SI);
+	DBG_ENDSTR();
+}
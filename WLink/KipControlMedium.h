@@ -21,6 +21,12 @@
 /* ******************************************************************************** */
 /* Define
 /* ******************************************************************************** */
+#define KC_MEDIUM_POST_BODY_SIZE        1024        // Maximum size of the body of a POST transaction
+#define KC_MEDIUM_POST_CONTENT_TYPE     "application/x-www-form-urlencoded"
+
+#define KC_MEDIUM_RESPONSE_TIMEOUT_MS   10000       // Ethernet : transaction failed if the response is not complete after this time
+#define KC_MEDIUM_RESPONSE_LINE_SIZE    128         // Ethernet : status line and headers (longer lines are truncated)
+#define KC_MEDIUM_RESPONSE_DATA_SIZE    256         // Ethernet : body kept for KipControlMedium_Read() (terminating 0 included)
 
 /* ******************************************************************************** */
 /* Structure & Enumeration
@@ -31,6 +37,11 @@ typedef enum {
     KC_MEDIUM_GSM
 } KC_MEDIUM_ENUM;
 
+typedef enum {
+    KC_MEDIUM_METHOD_GET,       // Parameters in the URL
+    KC_MEDIUM_METHOD_POST       // Parameters in the body (url-encoded form)
+} KC_MEDIUM_METHOD_ENUM;
+
 /* ******************************************************************************** */
 /* Functions Prototypes
 /* ******************************************************************************** */
@@ -42,14 +53,16 @@ boolean KipControlMedium_IsError(void);
 
 boolean KipControlMedium_Connect(void);
 boolean KipControlMedium_IsConnected(void);
+boolean KipControlMedium_IsBusy(void);
 
 void KipControlMedium_SetupEnvironment(void);
 
 void KipControlMedium_BeginTransaction(void);
+void KipControlMedium_BeginPostTransaction(const char * pPath_UB);
 void KipControlMedium_Print(unsigned char Data_UB);
 void KipControlMedium_Print(int Data_SI);
 void KipControlMedium_Print(unsigned long Data_UL);
-void KipControlMedium_Print(char * pData_UB);
+void KipControlMedium_Print(const char * pData_UB);
 void KipControlMedium_Print(String Data_Str);
 void KipControlMedium_EndTransaction(void);
 boolean KipControlMedium_IsTransactionOk(void);
@@ -6,6 +6,7 @@
 /*		LD5218 Indicator specific functions							                */
 /*                                                                                  */
 /* History :  	07/06/2016  (RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Add frame validation							*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -50,6 +51,14 @@ static INDICATOR_WEIGHT_SIGN_ENUM LD5218_GetWeightSign(unsigned char * pBuffer_U
 	return Sign_E;
 }
 
+static boolean LD5218_IsDigits(const unsigned char * pBuffer_UB, unsigned char Size_UB) {
+	for (int i = 0; i < Size_UB; i++) {
+		if ((pBuffer_UB[i] < '0') || (pBuffer_UB[i] > '9'))
+			return false;
+	}
+	return true;
+}
+
 static unsigned int LD5218_GetWeightValue(unsigned char * pBuffer_UB) {
 	unsigned int Value_UI = 0;
 	Value_UI =	(pBuffer_UB[5] - 0x30) * 1 +
@@ -122,3 +131,20 @@ void LD5218_ProcessFrame(unsigned char * pBuffer_UB, INDICATOR_INTERFACE_FRAME_E
 	DBG_PRINTDATA(pWeight_X->Value_UI);
 	DBG_ENDSTR();
 }
+
+boolean LD5218_IsFrameValid(const unsigned char * pBuffer_UB, INDICATOR_INTERFACE_FRAME_ENUM Frame_E) {
+	switch (Frame_E) {
+		case INDICATOR_INTERFACE_FRAME_ASK_WEIGHT:
+			return (((pBuffer_UB[1] == '+') || (pBuffer_UB[1] == '-')) && LD5218_IsDigits(&(pBuffer_UB[2]), 6));
+
+		case INDICATOR_INTERFACE_FRAME_ASK_WEIGHT_ALIBI:
+		case INDICATOR_INTERFACE_FRAME_ASK_LAST_ALIBI:
+			return (LD5218_IsDigits(&(pBuffer_UB[0]), 4) && LD5218_IsDigits(&(pBuffer_UB[6]), 6));
+
+		case INDICATOR_INTERFACE_FRAME_ASK_WEIGHT_MSA:
+			return (((pBuffer_UB[5] == '+') || (pBuffer_UB[5] == '-')) && LD5218_IsDigits(&(pBuffer_UB[21]), 6));
+
+		default:
+			return true;
+	}
+}
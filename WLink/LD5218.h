@@ -6,6 +6,7 @@
 /*		Header file for LD5218.cpp													*/
 /*                                                                                  */
 /* History :  	07/06/2015  (RW)	Creation of this file							*/
+/*				18/10/2026	(RW)	Add response delimiter and validation			*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -24,16 +25,17 @@
 /* ******************************************************************************** */
 /* Structure & Enumeration
 /* ******************************************************************************** */
-const INDICATOR_INTERFACE_FRAME_STRUCT GL_pLD5218Frames_X[] = {	{ 1, { '?' }, 9 },									// ASK_WEIGHT
-																{ 7, { 0x02,'A','?','0','4','C',0x03 }, 17 },		// ASK_WEIGHT_ALIBI
-																{ 7, { 0x02,'a','?','0','6','C',0x03 }, 17 },		// ASK_LAST_ALIBI
-																{ 7, { 0x02,'A','=','0','>','4',0x03 }, 31 },		// ASK_WEIGHT_MSA
-																{ 3, { 0x02,'0',0x03 }, 0 }							// SET_TO_ZERO
+const INDICATOR_INTERFACE_FRAME_STRUCT GL_pLD5218Frames_X[] = {	{ 1, { '?' }, 9, 0x0D },								// ASK_WEIGHT
+																{ 7, { 0x02,'A','?','0','4','C',0x03 }, 17, 0x00 },		// ASK_WEIGHT_ALIBI
+																{ 7, { 0x02,'a','?','0','6','C',0x03 }, 17, 0x00 },		// ASK_LAST_ALIBI
+																{ 7, { 0x02,'A','=','0','>','4',0x03 }, 31, 0x00 },		// ASK_WEIGHT_MSA
+																{ 3, { 0x02,'0',0x03 }, 0, 0x00 }						// SET_TO_ZERO
 																};
 
 /* ******************************************************************************** */
 /* Functions
 /* ******************************************************************************** */
 void LD5218_ProcessFrame(unsigned char * pBuffer_UB, INDICATOR_INTERFACE_FRAME_ENUM Frame_E, INDICATOR_WEIGHT_STRUCT * pWeight_X);
+boolean LD5218_IsFrameValid(const unsigned char * pBuffer_UB, INDICATOR_INTERFACE_FRAME_ENUM Frame_E);
 
 #endif // __LD5218_H__
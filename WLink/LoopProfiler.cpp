@@ -0,0 +1,182 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* LoopProfiler.cpp																	*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Describes the functions to profile the managers of the main loop			*/
+/*		Each probe keeps min/avg/max, a log2 histogram for the 99th percentile		*/
+/*		and the state of the manager when the worst time occurred					*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#define MODULE_NAME		"LoopProfiler"
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "LoopProfiler.h"
+
+#include "Debug.h"
+
+#ifdef APP_USE_LOOP_PROFILER
+
+/* ******************************************************************************** */
+/* Local Structures
+/* ******************************************************************************** */
+typedef struct {
+	unsigned long StartTime_UL;
+	unsigned char CurrentState_UB;
+	unsigned long Count_UL;
+	unsigned long long TotalTime_UL;
+	unsigned long MinTime_UL;
+	unsigned long MaxTime_UL;
+	unsigned char WorstState_UB;
+	unsigned long pHisto_UL[LOOP_PROFILER_HISTO_BUCKET_NB];
+} LOOP_PROFILER_PROBE_STRUCT;
+
+/* ******************************************************************************** */
+/* Local Variables
+/* ******************************************************************************** */
+static LOOP_PROFILER_PROBE_STRUCT GL_pLoopProfilerProbe_X[LOOP_PROFILER_ID_NB];
+static unsigned long GL_LoopProfilerLastReport_UL = 0;
+
+static const char * GL_pLoopProfilerName_Str[LOOP_PROFILER_ID_NB] = {
+	"Loop", "BlinkingLed", "Serial", "NetworkAdapter", "TCPServer", "UDPServer",
+	"FonaModule", "WCmdInterpreter", "Indicator", "FlatPanel", "WMenu", "Application", "WeightStream",
+	"GSMServer", "SerialBridge", "EventBus", "Eeprom"
+};
+
+/* ******************************************************************************** */
+/* Prototypes for Internal Functions
+/* ******************************************************************************** */
+static unsigned char GetBucketIdx(unsigned long Time_UL);
+static unsigned long GetP99Time(const LOOP_PROFILER_PROBE_STRUCT * pProbe_X);
+
+/* ******************************************************************************** */
+/* Functions
+/* ******************************************************************************** */
+void LoopProfiler_Init(void) {
+	LoopProfiler_Reset();
+	GL_LoopProfilerLastReport_UL = millis();
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Loop Profiler Initialized");
+}
+
+void LoopProfiler_Reset(void) {
+	for (int i = 0; i < LOOP_PROFILER_ID_NB; i++) {
+		memset(&GL_pLoopProfilerProbe_X[i], 0x00, sizeof(LOOP_PROFILER_PROBE_STRUCT));
+		GL_pLoopProfilerProbe_X[i].MinTime_UL = 0xFFFFFFFF;
+		GL_pLoopProfilerProbe_X[i].CurrentState_UB = LOOP_PROFILER_NO_STATE;
+		GL_pLoopProfilerProbe_X[i].WorstState_UB = LOOP_PROFILER_NO_STATE;
+	}
+}
+
+void LoopProfiler_Start(LOOP_PROFILER_ID_ENUM Id_E) {
+	GL_pLoopProfilerProbe_X[Id_E].CurrentState_UB = LOOP_PROFILER_NO_STATE;
+	GL_pLoopProfilerProbe_X[Id_E].StartTime_UL = micros();
+}
+
+void LoopProfiler_Stop(LOOP_PROFILER_ID_ENUM Id_E) {
+	LOOP_PROFILER_PROBE_STRUCT * pProbe_X = &GL_pLoopProfilerProbe_X[Id_E];
+	unsigned long Time_UL = micros() - pProbe_X->StartTime_UL;
+
+	pProbe_X->Count_UL++;
+	pProbe_X->TotalTime_UL += Time_UL;
+	pProbe_X->pHisto_UL[GetBucketIdx(Time_UL)]++;
+
+	if (Time_UL < pProbe_X->MinTime_UL)
+		pProbe_X->MinTime_UL = Time_UL;
+
+	if (Time_UL > pProbe_X->MaxTime_UL) {
+		pProbe_X->MaxTime_UL = Time_UL;
+		pProbe_X->WorstState_UB = pProbe_X->CurrentState_UB;
+	}
+}
+
+void LoopProfiler_SetState(LOOP_PROFILER_ID_ENUM Id_E, unsigned char State_UB) {
+	GL_pLoopProfilerProbe_X[Id_E].CurrentState_UB = State_UB;
+}
+
+boolean LoopProfiler_GetStats(LOOP_PROFILER_ID_ENUM Id_E, LOOP_PROFILER_STATS_STRUCT * pStats_X) {
+	if (Id_E >= LOOP_PROFILER_ID_NB)
+		return false;
+
+	LOOP_PROFILER_PROBE_STRUCT * pProbe_X = &GL_pLoopProfilerProbe_X[Id_E];
+
+	pStats_X->Count_UL = pProbe_X->Count_UL;
+	pStats_X->WorstState_UB = pProbe_X->WorstState_UB;
+
+	if (pProbe_X->Count_UL == 0) {
+		pStats_X->MinTime_UL = 0;
+		pStats_X->MaxTime_UL = 0;
+		pStats_X->AvgTime_UL = 0;
+		pStats_X->P99Time_UL = 0;
+	}
+	else {
+		pStats_X->MinTime_UL = pProbe_X->MinTime_UL;
+		pStats_X->MaxTime_UL = pProbe_X->MaxTime_UL;
+		pStats_X->AvgTime_UL = (unsigned long)(pProbe_X->TotalTime_UL / pProbe_X->Count_UL);
+		pStats_X->P99Time_UL = GetP99Time(pProbe_X);
+	}
+
+	return true;
+}
+
+void LoopProfiler_Report(void) {
+	LOOP_PROFILER_STATS_STRUCT Stats_X;
+
+	if ((millis() - GL_LoopProfilerLastReport_UL) < LOOP_PROFILER_REPORT_PERIOD_MS)
+		return;
+
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Loop Profiler [us] : Name - Count - Min - Avg - Max - P99 - Worst State");
+	for (int i = 0; i < LOOP_PROFILER_ID_NB; i++) {
+		LoopProfiler_GetStats((LOOP_PROFILER_ID_ENUM)(i), &Stats_X);
+		if (Stats_X.Count_UL == 0)
+			continue;
+
+		DBG_PRINT(DEBUG_SEVERITY_INFO, GL_pLoopProfilerName_Str[i]);
+		DBG_PRINTDATA(" - ");
+		DBG_PRINTDATA(Stats_X.Count_UL);
+		DBG_PRINTDATA(" - ");
+		DBG_PRINTDATA(Stats_X.MinTime_UL);
+		DBG_PRINTDATA(" - ");
+		DBG_PRINTDATA(Stats_X.AvgTime_UL);
+		DBG_PRINTDATA(" - ");
+		DBG_PRINTDATA(Stats_X.MaxTime_UL);
+		DBG_PRINTDATA(" - ");
+		DBG_PRINTDATA(Stats_X.P99Time_UL);
+		DBG_PRINTDATA(" - ");
+		DBG_PRINTDATA(Stats_X.WorstState_UB);
+		DBG_ENDSTR();
+	}
+
+	GL_LoopProfilerLastReport_UL = millis();
+}
+
+
+/* ******************************************************************************** */
+/* Internal Functions
+/* ******************************************************************************** */
+unsigned char GetBucketIdx(unsigned long Time_UL) {
+	unsigned char Idx_UB = (Time_UL == 0) ? 0 : (unsigned char)(32 - __builtin_clz(Time_UL));	// Number of significant bits
+	return ((Idx_UB < LOOP_PROFILER_HISTO_BUCKET_NB) ? Idx_UB : (LOOP_PROFILER_HISTO_BUCKET_NB - 1));
+}
+
+unsigned long GetP99Time(const LOOP_PROFILER_PROBE_STRUCT * pProbe_X) {
+	unsigned long Threshold_UL = pProbe_X->Count_UL - (pProbe_X->Count_UL / 100);	// 99% of the samples
+	unsigned long Sum_UL = 0;
+
+	for (int i = 0; i < LOOP_PROFILER_HISTO_BUCKET_NB; i++) {
+		Sum_UL += pProbe_X->pHisto_UL[i];
+		if (Sum_UL >= Threshold_UL) {
+			unsigned long UpperBound_UL = (1UL << i) - 1;
+			return ((UpperBound_UL < pProbe_X->MaxTime_UL) ? UpperBound_UL : pProbe_X->MaxTime_UL);
+		}
+	}
+
+	return pProbe_X->MaxTime_UL;
+}
+
+#endif // APP_USE_LOOP_PROFILER
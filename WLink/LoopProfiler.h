@@ -0,0 +1,95 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* LoopProfiler.h																	*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Header file for LoopProfiler.cpp											*/
+/*		Measures the execution time of each manager called from the main loop		*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __LOOP_PROFILER_H__
+#define __LOOP_PROFILER_H__
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include <Arduino.h>
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+
+//#define APP_USE_LOOP_PROFILER	// Uncomment line to enable Loop Profiler functionality
+
+#define LOOP_PROFILER_HISTO_BUCKET_NB		24		// Bucket i gathers times in [2^(i-1) ; 2^i[ us - last bucket gathers everything above
+#define LOOP_PROFILER_REPORT_PERIOD_MS		60000	// Period to print out the statistics on Debug port
+#define LOOP_PROFILER_NO_STATE				0xFF
+
+/* ******************************************************************************** */
+/* Macro Mapping
+/* ******************************************************************************** */
+#ifdef APP_USE_LOOP_PROFILER
+#define LOOP_PROFILER_START(Id)				LoopProfiler_Start(Id)
+#define LOOP_PROFILER_STOP(Id)				LoopProfiler_Stop(Id)
+#define LOOP_PROFILER_CALL(Id, Call)		do { LoopProfiler_Start(Id); Call; LoopProfiler_Stop(Id); } while (0)
+#define LOOP_PROFILER_SET_STATE(Id, State)	LoopProfiler_SetState(Id, (unsigned char)(State))
+#define LOOP_PROFILER_REPORT()				LoopProfiler_Report()
+#else
+#define LOOP_PROFILER_START(Id)				/* Do Nothing */
+#define LOOP_PROFILER_STOP(Id)				/* Do Nothing */
+#define LOOP_PROFILER_CALL(Id, Call)		Call
+#define LOOP_PROFILER_SET_STATE(Id, State)	/* Do Nothing */
+#define LOOP_PROFILER_REPORT()				/* Do Nothing */
+#endif
+
+/* ******************************************************************************** */
+/* Structure & Enumeration
+/* ******************************************************************************** */
+typedef enum {
+	LOOP_PROFILER_ID_LOOP = 0,
+	LOOP_PROFILER_ID_BLINKING_LED,
+	LOOP_PROFILER_ID_SERIAL,
+	LOOP_PROFILER_ID_NETWORK_ADAPTER,
+	LOOP_PROFILER_ID_TCP_SERVER,
+	LOOP_PROFILER_ID_UDP_SERVER,
+	LOOP_PROFILER_ID_FONA_MODULE,
+	LOOP_PROFILER_ID_WCMD_INTERPRETER,
+	LOOP_PROFILER_ID_INDICATOR,
+	LOOP_PROFILER_ID_FLAT_PANEL,
+	LOOP_PROFILER_ID_WMENU,
+	LOOP_PROFILER_ID_APPLICATION,
+	LOOP_PROFILER_ID_WEIGHT_STREAM,
+	LOOP_PROFILER_ID_GSM_SERVER,
+	LOOP_PROFILER_ID_SERIAL_BRIDGE,
+	LOOP_PROFILER_ID_EVENT_BUS,
+	LOOP_PROFILER_ID_EEPROM,
+	LOOP_PROFILER_ID_NB
+} LOOP_PROFILER_ID_ENUM;
+
+typedef struct {
+	unsigned long Count_UL;
+	unsigned long MinTime_UL;					// [us]
+	unsigned long MaxTime_UL;					// [us]
+	unsigned long AvgTime_UL;					// [us]
+	unsigned long P99Time_UL;					// [us] - Upper bound of the histogram bucket
+	unsigned char WorstState_UB;				// State of the manager when MaxTime_UL occurred
+} LOOP_PROFILER_STATS_STRUCT;
+
+/* ******************************************************************************** */
+/* Functions Prototypes
+/* ******************************************************************************** */
+void LoopProfiler_Init(void);
+void LoopProfiler_Reset(void);
+
+void LoopProfiler_Start(LOOP_PROFILER_ID_ENUM Id_E);
+void LoopProfiler_Stop(LOOP_PROFILER_ID_ENUM Id_E);
+void LoopProfiler_SetState(LOOP_PROFILER_ID_ENUM Id_E, unsigned char State_UB);
+
+boolean LoopProfiler_GetStats(LOOP_PROFILER_ID_ENUM Id_E, LOOP_PROFILER_STATS_STRUCT * pStats_X);
+void LoopProfiler_Report(void);
+
+#endif // __LOOP_PROFILER_H__
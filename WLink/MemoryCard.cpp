@@ -137,10 +137,18 @@ FILE_HANDLING_STS_ENUM MemoryCard::openFile(File * pFile_H, char * pFileName_UB,
 
     // Open file
     GL_FileData_X.pFileName_UB = pFileName_UB;
-    GL_FileData_X.file_H = (Mode_E == FILE_HANDLING_OPEN_MODE_READ) ? GL_pCard_H->open(pFileName_UB, FILE_READ) : GL_pCard_H->open(pFileName_UB, FILE_WRITE);
+    switch (Mode_E) {
+    case FILE_HANDLING_OPEN_MODE_READ:          GL_FileData_X.file_H = GL_pCard_H->open(pFileName_UB, FILE_READ);                   break;
+    case FILE_HANDLING_OPEN_MODE_WRITE:         GL_FileData_X.file_H = GL_pCard_H->open(pFileName_UB, FILE_WRITE);                  break;
+    case FILE_HANDLING_OPEN_MODE_READ_WRITE:    GL_FileData_X.file_H = GL_pCard_H->open(pFileName_UB, O_READ | O_WRITE | O_CREAT);  break;
+    }
+
+    if (!(GL_FileData_X.file_H))
+        return FILE_HANDLING_STS_CANNOT_OPEN;
+
     GL_FileData_X.isOpened = true;
 
-    pFile_H = &(GL_FileData_X.file_H);
+    *pFile_H = GL_FileData_X.file_H;    // Give the handle to the caller
 
     return FILE_HANDLING_STS_OK;
 }
@@ -168,6 +176,47 @@ FILE_HANDLING_STS_ENUM MemoryCard::writeFile(File * pFile_H, char * pWriteDate_U
 
 FILE_HANDLING_STS_ENUM MemoryCard::writeFile(File * pFile_H, String pWriteDate_Str) { return (writeFile(pFile_H, pWriteDate_Str.c_str())); }
 
+FILE_HANDLING_STS_ENUM MemoryCard::writeFile(File * pFile_H, unsigned char * pWriteData_UB, unsigned long Size_UL) {
+
+    if (!(GL_FileData_X.isOpened))
+        return FILE_HANDLING_STS_IS_NOT_OPENED;
+
+    if (pFile_H->write(pWriteData_UB, Size_UL) != Size_UL)
+        return FILE_HANDLING_STS_CANNOT_WRITE;
+
+    return FILE_HANDLING_STS_OK;
+}
+
+FILE_HANDLING_STS_ENUM MemoryCard::readFile(File * pFile_H, unsigned char * pReadData_UB, unsigned long Size_UL) {
+
+    if (!(GL_FileData_X.isOpened))
+        return FILE_HANDLING_STS_IS_NOT_OPENED;
+
+    if (pFile_H->read(pReadData_UB, Size_UL) != (int)(Size_UL))
+        return FILE_HANDLING_STS_ERROR;
+
+    return FILE_HANDLING_STS_OK;
+}
+
+FILE_HANDLING_STS_ENUM MemoryCard::seekFile(File * pFile_H, unsigned long Position_UL) {
+
+    if (!(GL_FileData_X.isOpened))
+        return FILE_HANDLING_STS_IS_NOT_OPENED;
+
+    if (!(pFile_H->seek(Position_UL)))
+        return FILE_HANDLING_STS_ERROR;
+
+    return FILE_HANDLING_STS_OK;
+}
+
+unsigned long MemoryCard::getFileSize(File * pFile_H) {
+
+    if (!(GL_FileData_X.isOpened))
+        return 0;
+
+    return pFile_H->size();
+}
+
 
 /* ******************************************************************************** */
 /* Internal Functions
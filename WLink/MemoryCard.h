@@ -40,7 +40,8 @@ typedef enum {
 
 typedef enum {
     FILE_HANDLING_OPEN_MODE_READ,
-    FILE_HANDLING_OPEN_MODE_WRITE
+    FILE_HANDLING_OPEN_MODE_WRITE,
+    FILE_HANDLING_OPEN_MODE_READ_WRITE     // Random access (no automatic append)
 } FILE_HANDLING_OPEN_MODE_ENUM;
 
 
@@ -71,6 +72,10 @@ public:
 
     FILE_HANDLING_STS_ENUM writeFile(File * pFile_H, char * pWriteDate_UB);
     FILE_HANDLING_STS_ENUM writeFile(File * pFile_H, String pWriteDate_Str);
+    FILE_HANDLING_STS_ENUM writeFile(File * pFile_H, unsigned char * pWriteData_UB, unsigned long Size_UL);
+    FILE_HANDLING_STS_ENUM readFile(File * pFile_H, unsigned char * pReadData_UB, unsigned long Size_UL);
+    FILE_HANDLING_STS_ENUM seekFile(File * pFile_H, unsigned long Position_UL);
+    unsigned long getFileSize(File * pFile_H);
 
     MEMORY_CARD_PARAM GL_MemoryCardParam_X;
 };
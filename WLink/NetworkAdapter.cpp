@@ -6,6 +6,7 @@
 /*		Defines the utility functions that manage the Network Adapter object        */
 /*                                                                                  */
 /* History :  	16/02/2017  (RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Non-blocking DHCP with fallback to a static IP	*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -16,6 +17,7 @@
 /* ******************************************************************************** */
 
 #include "NetworkAdapter.h"
+#include "utility/w5100.h"
 
 #include "Debug.h"
 
@@ -23,6 +25,7 @@
 /* ******************************************************************************** */
 /* Internal Functions Prototypes
 /* ******************************************************************************** */
+static void SetChipAddresses(IPAddress IpAddr_X, IPAddress SubnetMaskAddr_X, IPAddress GatewayAddr_X);
 
 
 /* ******************************************************************************** */
@@ -31,6 +34,8 @@
 NetworkAdapter::NetworkAdapter() {
     GL_NetworkAdapterParam_X.IsInitialized_B = false;
     GL_NetworkAdapterParam_X.IsConnected_B = false;
+    GL_NetworkAdapterParam_X.HasFallback_B = false;
+    GL_NetworkAdapterParam_X.IsFallback_B = false;
 }
 
 
@@ -177,17 +182,36 @@ void NetworkAdapter::enableDhcp(void) {
     GL_NetworkAdapterParam_X.IsDhcp_B = true;
 }
 
+void NetworkAdapter::setDhcpFallback(IPAddress IpAddr_X, IPAddress SubnetMaskAddr_X, IPAddress GatewayAddr_X, IPAddress DnsIpAddr_X) {
+    GL_NetworkAdapterParam_X.FallbackIpAddr_X = IpAddr_X;
+    GL_NetworkAdapterParam_X.FallbackSubnetMaskAddr_X = SubnetMaskAddr_X;
+    GL_NetworkAdapterParam_X.FallbackGatewayAddr_X = GatewayAddr_X;
+    GL_NetworkAdapterParam_X.FallbackDnsIpAddr_X = DnsIpAddr_X;
+    GL_NetworkAdapterParam_X.HasFallback_B = true;
+}
+
+boolean NetworkAdapter::isDhcp(void) {
+    return GL_NetworkAdapterParam_X.IsDhcp_B;
+}
+
+boolean NetworkAdapter::isFallback(void) {
+    return GL_NetworkAdapterParam_X.IsFallback_B;
+}
+
 
 void NetworkAdapter::begin(void) {
     if (GL_NetworkAdapterParam_X.AdvancedConfig_B) {
         Ethernet.begin(GL_NetworkAdapterParam_X.pMacAddr_UB, GL_NetworkAdapterParam_X.IpAddr_X, GL_NetworkAdapterParam_X.DnsIpAddr_X, GL_NetworkAdapterParam_X.GatewayAddr_X, GL_NetworkAdapterParam_X.SubnetMaskAddr_X);
     }
     else if (GL_NetworkAdapterParam_X.IsDhcp_B) {
-        Ethernet.begin(GL_NetworkAdapterParam_X.pMacAddr_UB);
-        GL_NetworkAdapterParam_X.IpAddr_X = Ethernet.localIP();
-        DBG_PRINT(DEBUG_SEVERITY_INFO, "IP Address = ");
-        DBG_PRINTDATA(GL_NetworkAdapterParam_X.IpAddr_X);
-        DBG_ENDSTR();
+        // Chip started without address - the lease is obtained in process() (Ethernet.begin(mac) blocks up to 60 s)
+        GL_NetworkAdapterParam_X.IpAddr_X = IPAddress(0, 0, 0, 0);
+        Ethernet.begin(GL_NetworkAdapterParam_X.pMacAddr_UB, GL_NetworkAdapterParam_X.IpAddr_X);
+        GL_NetworkAdapterParam_X.IsFallback_B = false;
+        GL_NetworkAdapterParam_X.DhcpStartTime_UL = millis();
+        GL_NetworkAdapterParam_X.Dhcp_H.begin(GL_NetworkAdapterParam_X.pMacAddr_UB);
+        GL_NetworkAdapterParam_X.IsConnected_B = false;
+        return;
     }
     else {
         Ethernet.begin(GL_NetworkAdapterParam_X.pMacAddr_UB, GL_NetworkAdapterParam_X.IpAddr_X);
@@ -201,8 +225,78 @@ void NetworkAdapter::renew(void) {
     begin();
 }
 
+// Stop using the address (cable unplugged) - the users are warned by NetworkAdapterManager events
 void NetworkAdapter::flush(void) {
-    // TODO : Call stop/flush functions. Callback ?
+    GL_NetworkAdapterParam_X.Dhcp_H.end();
+    GL_NetworkAdapterParam_X.IsFallback_B = false;
+    GL_NetworkAdapterParam_X.IsConnected_B = false;
+}
+
+// Keep the DHCP lease - to be called while the cable is linked
+NETWORK_ADAPTER_EVENT_ENUM NetworkAdapter::process(void) {
+    DHCP_CLIENT_STS DhcpSts_E;
+
+    // Static configuration : nothing to maintain
+    if (!(GL_NetworkAdapterParam_X.IsDhcp_B) || GL_NetworkAdapterParam_X.AdvancedConfig_B)
+        return NETWORK_ADAPTER_EVENT_NONE;
+
+    DhcpSts_E = GL_NetworkAdapterParam_X.Dhcp_H.process();
+
+    // Discovery goes on behind the fallback address : the lease replaces it as soon as it is obtained
+    if (GL_NetworkAdapterParam_X.IsFallback_B) {
+        if (DhcpSts_E != DHCP_CLIENT_STS_BOUND)
+            return NETWORK_ADAPTER_EVENT_NONE;
+
+        // Released first, the lease is applied on next call once the users have closed their sockets
+        DBG_PRINTLN(DEBUG_SEVERITY_INFO, "DHCP lease obtained - Fallback IP Address released");
+        GL_NetworkAdapterParam_X.IsFallback_B = false;
+        GL_NetworkAdapterParam_X.IsConnected_B = false;
+        return NETWORK_ADAPTER_EVENT_ADDRESS_LOST;
+    }
+
+    if (DhcpSts_E == DHCP_CLIENT_STS_BOUND) {
+        if (!(GL_NetworkAdapterParam_X.IsConnected_B)) {
+            GL_NetworkAdapterParam_X.IpAddr_X = GL_NetworkAdapterParam_X.Dhcp_H.getLocalIpAddr();
+            GL_NetworkAdapterParam_X.SubnetMaskAddr_X = GL_NetworkAdapterParam_X.Dhcp_H.getSubnetMaskAddr();
+            GL_NetworkAdapterParam_X.GatewayAddr_X = GL_NetworkAdapterParam_X.Dhcp_H.getGatewayAddr();
+            GL_NetworkAdapterParam_X.DnsIpAddr_X = GL_NetworkAdapterParam_X.Dhcp_H.getDnsIpAddr();
+            SetChipAddresses(GL_NetworkAdapterParam_X.IpAddr_X, GL_NetworkAdapterParam_X.SubnetMaskAddr_X, GL_NetworkAdapterParam_X.GatewayAddr_X);
+            GL_NetworkAdapterParam_X.IsConnected_B = true;
+
+            DBG_PRINT(DEBUG_SEVERITY_INFO, "IP Address = ");
+            DBG_PRINTDATA(GL_NetworkAdapterParam_X.IpAddr_X);
+            DBG_ENDSTR();
+            return NETWORK_ADAPTER_EVENT_ADDRESS_BOUND;
+        }
+
+        // New address after a renewal : applied on next call, once the users have released their sockets
+        if (!(GL_NetworkAdapterParam_X.Dhcp_H.getLocalIpAddr() == GL_NetworkAdapterParam_X.IpAddr_X)) {
+            GL_NetworkAdapterParam_X.IsConnected_B = false;
+            return NETWORK_ADAPTER_EVENT_ADDRESS_LOST;
+        }
+    }
+    else if (GL_NetworkAdapterParam_X.IsConnected_B) {
+        // Lease expired or refused : a new one is being requested
+        GL_NetworkAdapterParam_X.IsConnected_B = false;
+        GL_NetworkAdapterParam_X.DhcpStartTime_UL = millis();
+        return NETWORK_ADAPTER_EVENT_ADDRESS_LOST;
+    }
+    else if (GL_NetworkAdapterParam_X.HasFallback_B && ((millis() - GL_NetworkAdapterParam_X.DhcpStartTime_UL) >= NETWORK_ADAPTER_DHCP_FALLBACK_TIMEOUT_MS)) {
+        GL_NetworkAdapterParam_X.IsFallback_B = true;
+        GL_NetworkAdapterParam_X.IpAddr_X = GL_NetworkAdapterParam_X.FallbackIpAddr_X;
+        GL_NetworkAdapterParam_X.SubnetMaskAddr_X = GL_NetworkAdapterParam_X.FallbackSubnetMaskAddr_X;
+        GL_NetworkAdapterParam_X.GatewayAddr_X = GL_NetworkAdapterParam_X.FallbackGatewayAddr_X;
+        GL_NetworkAdapterParam_X.DnsIpAddr_X = GL_NetworkAdapterParam_X.FallbackDnsIpAddr_X;
+        SetChipAddresses(GL_NetworkAdapterParam_X.IpAddr_X, GL_NetworkAdapterParam_X.SubnetMaskAddr_X, GL_NetworkAdapterParam_X.GatewayAddr_X);
+        GL_NetworkAdapterParam_X.IsConnected_B = true;
+
+        DBG_PRINT(DEBUG_SEVERITY_WARNING, "No DHCP lease - Fallback IP Address = ");
+        DBG_PRINTDATA(GL_NetworkAdapterParam_X.IpAddr_X);
+        DBG_ENDSTR();
+        return NETWORK_ADAPTER_EVENT_ADDRESS_BOUND;
+    }
+
+    return NETWORK_ADAPTER_EVENT_NONE;
 }
 
 boolean NetworkAdapter::isConnected() {
@@ -217,3 +311,19 @@ boolean NetworkAdapter::isEthernetLinked() {
 /* ******************************************************************************** */
 /* Internal Functions
 /* ******************************************************************************** */
+// Change the addresses of the chip without resetting it (open sockets are kept)
+void SetChipAddresses(IPAddress IpAddr_X, IPAddress SubnetMaskAddr_X, IPAddress GatewayAddr_X) {
+    unsigned char pAddr_UB[4];
+
+    SPI.beginTransaction(SPI_ETHERNET_SETTINGS);
+    for (int i = 0; i < 4; i++)
+        pAddr_UB[i] = IpAddr_X[i];
+    W5100.setIPAddress(pAddr_UB);
+    for (int i = 0; i < 4; i++)
+        pAddr_UB[i] = SubnetMaskAddr_X[i];
+    W5100.setSubnetMask(pAddr_UB);
+    for (int i = 0; i < 4; i++)
+        pAddr_UB[i] = GatewayAddr_X[i];
+    W5100.setGatewayIp(pAddr_UB);
+    SPI.endTransaction();
+}
@@ -8,6 +8,7 @@
 /*      the external SPI chip 	                                                    */
 /*                                                                                  */
 /* History :	15/02/2017	(RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Non-blocking DHCP with fallback to a static IP	*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -22,6 +23,7 @@
 #include "SPI.h"
 #include "Ethernet.h"
 
+#include "DhcpClient.h"
 #include "Utilz.h"
 
 /* ******************************************************************************** */
@@ -30,6 +32,7 @@
 
 #define NETWORK_ADAPTER_IS_ETHERNET_LINKED_TRY_NB    3
 #define NETWORK_ADAPTER_IS_ETHERNET_LINKED_DELAY_MS  400
+#define NETWORK_ADAPTER_DHCP_FALLBACK_TIMEOUT_MS     15000   // Static IP used when no lease is obtained within this time
 
 #define NETWORK_ADAPTER_DEFAULT_MAC_ADDR0	0x02  // Unicast - Locally Administered
 #define NETWORK_ADAPTER_DEFAULT_MAC_ADDR1	0x00  // 0x00
@@ -41,6 +44,14 @@
 /* ******************************************************************************** */
 /* Structure & Enumeration
 /* ******************************************************************************** */
+typedef enum {
+    NETWORK_ADAPTER_EVENT_NONE = 0,
+    NETWORK_ADAPTER_EVENT_LINK_UP,
+    NETWORK_ADAPTER_EVENT_LINK_DOWN,
+    NETWORK_ADAPTER_EVENT_ADDRESS_BOUND,    // IP address usable (static, DHCP lease or fallback)
+    NETWORK_ADAPTER_EVENT_ADDRESS_LOST      // DHCP lease lost or new address after a renewal
+} NETWORK_ADAPTER_EVENT_ENUM;
+
 typedef struct {
     boolean IsInitialized_B;
     boolean IsConnected_B;
@@ -52,6 +63,14 @@ typedef struct {
     IPAddress SubnetMaskAddr_X;
     IPAddress GatewayAddr_X;
     IPAddress DnsIpAddr_X;
+    boolean HasFallback_B;                  // Static configuration available when DHCP fails
+    boolean IsFallback_B;                   // Static configuration in use
+    IPAddress FallbackIpAddr_X;
+    IPAddress FallbackSubnetMaskAddr_X;
+    IPAddress FallbackGatewayAddr_X;
+    IPAddress FallbackDnsIpAddr_X;
+    unsigned long DhcpStartTime_UL;
+    DhcpClient Dhcp_H;
 } NETWORK_ADAPTER_PARAM;
 
 /* ******************************************************************************** */
@@ -81,10 +100,14 @@ public:
     IPAddress getDnsIpAddr(void);
 
     void enableDhcp(void);
+    void setDhcpFallback(IPAddress IpAddr_X, IPAddress SubnetMaskAddr_X, IPAddress GatewayAddr_X, IPAddress DnsIpAddr_X);
+    boolean isDhcp(void);
+    boolean isFallback(void);
 
     void begin(void);
     void flush(void);
     void renew(void);
+    NETWORK_ADAPTER_EVENT_ENUM process(void);
     boolean isConnected(void);
     boolean isEthernetLinked(void);
 
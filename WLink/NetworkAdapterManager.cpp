@@ -6,6 +6,8 @@
 /*		Describes the state machine to manage the Network Adapter object			*/
 /*                                                                                  */
 /* History :  	22/02/2017  (RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Maintain the DHCP lease and push link events	*/
+/*				18/10/2026	(RW)	Publish link events on the Event Bus			*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -16,8 +18,10 @@
 /* ******************************************************************************** */
 
 #include "NetworkAdapterManager.h"
+#include "EventBus.h"
 
 #include "Debug.h"
+#include "LoopProfiler.h"
 
 
 /* ******************************************************************************** */
@@ -33,7 +37,8 @@
 enum NETWORK_ADAPTER_STATE {
     NETWORK_ADAPTER_IDLE,
     NETWORK_ADAPTER_CONNECTING,
-    NETWORK_ADAPTER_RUNNING
+    NETWORK_ADAPTER_RUNNING,
+    NETWORK_ADAPTER_WAIT_ADDRESS        // DHCP lease lost while linked : chip not restarted
 };
 
 static NETWORK_ADAPTER_STATE GL_NetworkAdapterManager_CurrentState_E = NETWORK_ADAPTER_STATE::NETWORK_ADAPTER_IDLE;
@@ -55,6 +60,7 @@ static void ProcessRunning(void);
 static void TransitionToIdle(void);
 static void TransitionToConnecting(void);
 static void TransitionToRunning(void);
+static void TransitionToWaitAddress(void);
 
 static boolean IsEthernetStillLinked(void);
 
@@ -78,12 +84,14 @@ void NetworkAdapterManager_Disable() {
 }
 
 void NetworkAdapterManager_Process() {
+    LOOP_PROFILER_SET_STATE(LOOP_PROFILER_ID_NETWORK_ADAPTER, GL_NetworkAdapterManager_CurrentState_E);
     switch (GL_NetworkAdapterManager_CurrentState_E) {
     case NETWORK_ADAPTER_IDLE:
         ProcessIdle();
         break;
 
     case NETWORK_ADAPTER_CONNECTING:
+    case NETWORK_ADAPTER_WAIT_ADDRESS:
         ProcessConnecting();
         break;
 
@@ -92,6 +100,7 @@ void NetworkAdapterManager_Process() {
         break;
     }
 }
+
 boolean NetworkAdapterManager_IsRunning() {
 	return ((GL_NetworkAdapterManager_CurrentState_E == NETWORK_ADAPTER_RUNNING) ? true : false);
 }
@@ -103,27 +112,44 @@ boolean NetworkAdapterManager_IsRunning() {
 /* ******************************************************************************** */
 
 void ProcessIdle(void) {
-    if (GL_pNetworkAdapter_H->isInitialized() && GL_pNetworkAdapter_H->isEthernetLinked() && GL_NetworkAdapterManagerEnabled_B)
+    if (GL_pNetworkAdapter_H->isInitialized() && GL_pNetworkAdapter_H->isEthernetLinked() && GL_NetworkAdapterManagerEnabled_B) {
+        EventBus_Publish(EVENT_BUS_ID_LINK_UP, 0, 0);
         TransitionToConnecting();
+    }
 }
 
+// Wait for the IP address (DHCP lease or fallback) without blocking
 void ProcessConnecting(void) {
-    if (!GL_NetworkAdapterManagerEnabled_B)
+    if (!IsEthernetStillLinked() || !GL_NetworkAdapterManagerEnabled_B) {
         TransitionToIdle();
+        return;
+    }
 
-    if (GL_pNetworkAdapter_H->isConnected())
+    GL_pNetworkAdapter_H->process();
+    if (GL_pNetworkAdapter_H->isConnected()) {
+        EventBus_Publish(EVENT_BUS_ID_ADDRESS_BOUND, 0, 0);
         TransitionToRunning();
+    }
 }
 
 void ProcessRunning(void) {
-    if (!IsEthernetStillLinked() || !GL_NetworkAdapterManagerEnabled_B)
+    if (!IsEthernetStillLinked() || !GL_NetworkAdapterManagerEnabled_B) {
         TransitionToIdle();
+        return;
+    }
+
+    // Lease renewal
+    if (GL_pNetworkAdapter_H->process() == NETWORK_ADAPTER_EVENT_ADDRESS_LOST) {
+        EventBus_Publish(EVENT_BUS_ID_ADDRESS_LOST, 0, 0);
+        TransitionToWaitAddress();
+    }
 }
 
 
 void TransitionToIdle(void) {
     DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To IDLE");
     GL_pNetworkAdapter_H->flush();
+    EventBus_Publish(EVENT_BUS_ID_LINK_DOWN, 0, 0);
     GL_NetworkAdapterManager_CurrentState_E = NETWORK_ADAPTER_STATE::NETWORK_ADAPTER_IDLE;
 }
 
@@ -139,6 +165,11 @@ void TransitionToRunning(void) {
     GL_NetworkAdapterManager_CurrentState_E = NETWORK_ADAPTER_STATE::NETWORK_ADAPTER_RUNNING;
 }
 
+void TransitionToWaitAddress(void) {
+    DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To WAIT ADDRESS");
+    GL_NetworkAdapterManager_CurrentState_E = NETWORK_ADAPTER_STATE::NETWORK_ADAPTER_WAIT_ADDRESS;
+}
+
 
 boolean IsEthernetStillLinked(void) {
     if (!GL_pNetworkAdapter_H->isEthernetLinked()) {
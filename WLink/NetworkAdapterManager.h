@@ -7,6 +7,8 @@
 /*		Process functions to manage the Network Adapter object						*/
 /*                                                                                  */
 /* History :	22/02/2017	(RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Maintain the DHCP lease and push link events	*/
+/*				18/10/2026	(RW)	Publish link events on the Event Bus			*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
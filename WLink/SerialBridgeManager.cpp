@@ -0,0 +1,383 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* SerialBridgeManager.cpp															*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Describes the state machine to bridge a COM port to the network				*/
+/*		Bytes from the COM port are gathered in packets (idle time, size or			*/
+/*		delimiter) and bytes from the network are written back to the COM port		*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#define MODULE_NAME		"SerialBridgeManager"
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "SerialBridgeManager.h"
+#include "SerialHandler.h"
+
+#include "Debug.h"
+#include "LoopProfiler.h"
+
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+#define SERIAL_BRIDGE_COM_PORT_NB		4
+
+/* ******************************************************************************** */
+/* Local Variables
+/* ******************************************************************************** */
+enum SERIAL_BRIDGE_MANAGER_STATE {
+	SERIAL_BRIDGE_MANAGER_IDLE,
+	SERIAL_BRIDGE_MANAGER_WAIT_CLIENT,
+	SERIAL_BRIDGE_MANAGER_RUNNING
+};
+
+static SERIAL_BRIDGE_MANAGER_STATE GL_SerialBridgeManager_CurrentState_E = SERIAL_BRIDGE_MANAGER_STATE::SERIAL_BRIDGE_MANAGER_IDLE;
+
+typedef struct {
+	boolean IsEnabled_B;
+	SERIAL_BRIDGE_CONFIG_STRUCT Config_X;
+	HardwareSerial * pSerial_H;
+	boolean IsServerStarted_B;
+	unsigned int ServerPort_UI;				// Port of the listening socket
+	EthernetServer Server_H = EthernetServer(SERIAL_BRIDGE_DEFAULT_PORT);
+	EthernetClient Client_H;
+	EthernetUDP Udp_H;
+	IPAddress PeerIp_X;						// UDP destination
+	unsigned int PeerPort_UI;
+	STREAM_BUFFER_STRUCT pStream_X[2];
+	unsigned char pBuffer_UB[2][SERIAL_BRIDGE_BUFFER_SIZE];
+	unsigned int DelimiterNb_UI;			// Bytes waiting up to the last delimiter (included)
+	unsigned long LastRxTime_UL;			// Last byte received from the COM port
+	SERIAL_BRIDGE_STATS_STRUCT Stats_X;
+} SERIAL_BRIDGE_MANAGER_PARAM;
+
+static NetworkAdapter * GL_pNetworkAdapter_H = NULL;
+static SERIAL_BRIDGE_MANAGER_PARAM GL_SerialBridgeParam_X;
+
+
+/* ******************************************************************************** */
+/* Prototypes for Internal Functions
+/* ******************************************************************************** */
+static void ProcessIdle(void);
+static void ProcessWaitClient(void);
+static void ProcessRunning(void);
+
+static void TransitionToIdle(void);
+static void TransitionToWaitClient(void);
+static void TransitionToRunning(void);
+
+static void FillFromComPort(void);
+static unsigned int GetPacketSize(void);
+static void SendPacket(unsigned int Nb_UI);
+static void ReceiveFromNetwork(void);
+static void FlushComPort(void);
+
+
+/* ******************************************************************************** */
+/* Functions
+/* ******************************************************************************** */
+void SerialBridgeManager_Init(NetworkAdapter * pNetworkAdapter_H) {
+	GL_pNetworkAdapter_H = pNetworkAdapter_H;
+	GL_SerialBridgeParam_X.IsEnabled_B = false;
+	GL_SerialBridgeParam_X.IsServerStarted_B = false;
+	GL_SerialBridgeManager_CurrentState_E = SERIAL_BRIDGE_MANAGER_STATE::SERIAL_BRIDGE_MANAGER_IDLE;
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Serial Bridge Manager Initialized");
+}
+
+boolean SerialBridgeManager_Start(const SERIAL_BRIDGE_CONFIG_STRUCT * pConfig_X) {
+	// Ethernet not configured
+	if (GL_pNetworkAdapter_H == NULL)
+		return false;
+
+	if ((GL_SerialBridgeParam_X.IsEnabled_B) || (pConfig_X->ComPort_UL >= SERIAL_BRIDGE_COM_PORT_NB))
+		return false;
+
+	GL_SerialBridgeParam_X.Config_X = *pConfig_X;
+	if (GL_SerialBridgeParam_X.Config_X.LocalPort_UI == 0)
+		GL_SerialBridgeParam_X.Config_X.LocalPort_UI = SERIAL_BRIDGE_DEFAULT_PORT;
+	if ((GL_SerialBridgeParam_X.Config_X.SizeThreshold_UI == 0) || (GL_SerialBridgeParam_X.Config_X.SizeThreshold_UI > SERIAL_BRIDGE_BUFFER_SIZE))
+		GL_SerialBridgeParam_X.Config_X.SizeThreshold_UI = SERIAL_BRIDGE_BUFFER_SIZE;
+
+	GL_SerialBridgeParam_X.pSerial_H = GetSerialHandle(pConfig_X->ComPort_UL);
+	memset(&(GL_SerialBridgeParam_X.Stats_X), 0x00, sizeof(SERIAL_BRIDGE_STATS_STRUCT));
+	StreamBuffer_Init(&(GL_SerialBridgeParam_X.pStream_X[0]), GL_SerialBridgeParam_X.pBuffer_UB[0], SERIAL_BRIDGE_BUFFER_SIZE);
+	StreamBuffer_Init(&(GL_SerialBridgeParam_X.pStream_X[1]), GL_SerialBridgeParam_X.pBuffer_UB[1], SERIAL_BRIDGE_BUFFER_SIZE);
+	GL_SerialBridgeParam_X.DelimiterNb_UI = 0;
+
+	GL_SerialBridgeParam_X.IsEnabled_B = true;
+	return true;
+}
+
+void SerialBridgeManager_Stop(void) {
+	GL_SerialBridgeParam_X.IsEnabled_B = false;
+}
+
+void SerialBridgeManager_Process(void) {
+
+	/* Reset Condition */
+	if ((GL_SerialBridgeManager_CurrentState_E != SERIAL_BRIDGE_MANAGER_IDLE) && (!(GL_pNetworkAdapter_H->isConnected() && GL_SerialBridgeParam_X.IsEnabled_B))) {
+		TransitionToIdle();
+	}
+
+	/* State Machine */
+	LOOP_PROFILER_SET_STATE(LOOP_PROFILER_ID_SERIAL_BRIDGE, GL_SerialBridgeManager_CurrentState_E);
+	switch (GL_SerialBridgeManager_CurrentState_E) {
+	case SERIAL_BRIDGE_MANAGER_IDLE:
+		ProcessIdle();
+		break;
+
+	case SERIAL_BRIDGE_MANAGER_WAIT_CLIENT:
+		ProcessWaitClient();
+		break;
+
+	case SERIAL_BRIDGE_MANAGER_RUNNING:
+		ProcessRunning();
+		break;
+	}
+}
+
+boolean SerialBridgeManager_IsBridgePort(unsigned long ComPort_UL) {
+	return ((GL_SerialBridgeParam_X.IsEnabled_B && (GL_SerialBridgeParam_X.Config_X.ComPort_UL == ComPort_UL)) ? true : false);
+}
+
+boolean SerialBridgeManager_GetStats(SERIAL_BRIDGE_STATS_STRUCT * pStats_X) {
+	if (!(GL_SerialBridgeParam_X.IsEnabled_B))
+		return false;
+
+	*pStats_X = GL_SerialBridgeParam_X.Stats_X;
+	return true;
+}
+
+
+/* ******************************************************************************** */
+/* Internal Functions
+/* ******************************************************************************** */
+void ProcessIdle(void) {
+	if ((GL_pNetworkAdapter_H != NULL) && GL_pNetworkAdapter_H->isConnected() && GL_SerialBridgeParam_X.IsEnabled_B) {
+		if (GL_SerialBridgeParam_X.Config_X.Mode_E == SERIAL_BRIDGE_MODE_UDP) {
+			GL_SerialBridgeParam_X.Udp_H.begin(GL_SerialBridgeParam_X.Config_X.LocalPort_UI);
+			GL_SerialBridgeParam_X.PeerIp_X = GL_SerialBridgeParam_X.Config_X.RemoteIp_X;
+			GL_SerialBridgeParam_X.PeerPort_UI = GL_SerialBridgeParam_X.Config_X.RemotePort_UI;
+			TransitionToRunning();
+		}
+		else {
+			// The listening socket cannot be closed : only open a new one when the port changes
+			if (!(GL_SerialBridgeParam_X.IsServerStarted_B) || (GL_SerialBridgeParam_X.ServerPort_UI != GL_SerialBridgeParam_X.Config_X.LocalPort_UI)) {
+				GL_SerialBridgeParam_X.Server_H = EthernetServer(GL_SerialBridgeParam_X.Config_X.LocalPort_UI);
+				GL_SerialBridgeParam_X.Server_H.begin();
+				GL_SerialBridgeParam_X.ServerPort_UI = GL_SerialBridgeParam_X.Config_X.LocalPort_UI;
+				GL_SerialBridgeParam_X.IsServerStarted_B = true;
+			}
+			TransitionToWaitClient();
+		}
+
+		DBG_PRINT(DEBUG_SEVERITY_INFO, "Serial Bridge Started @ ");
+		DBG_PRINTDATA(GL_pNetworkAdapter_H->getIpAddr());
+		DBG_PRINTDATA(":");
+		DBG_PRINTDATA(GL_SerialBridgeParam_X.Config_X.LocalPort_UI);
+		DBG_ENDSTR();
+	}
+}
+
+void ProcessWaitClient(void) {
+	// Nobody to talk to : drop what the COM port receives
+	FlushComPort();
+
+	// Client known once it has sent its first bytes (EthernetServer::available)
+	EthernetClient Client_H = GL_SerialBridgeParam_X.Server_H.available();
+	if (Client_H) {
+		GL_SerialBridgeParam_X.Client_H = Client_H;
+		DBG_PRINT(DEBUG_SEVERITY_INFO, "Bridge client from ");
+		DBG_PRINTDATA(Client_H.remoteIP());
+		DBG_ENDSTR();
+		TransitionToRunning();
+	}
+}
+
+void ProcessRunning(void) {
+	unsigned int Nb_UI;
+
+	if ((GL_SerialBridgeParam_X.Config_X.Mode_E == SERIAL_BRIDGE_MODE_TCP) && !(GL_SerialBridgeParam_X.Client_H.connected())) {
+		GL_SerialBridgeParam_X.Client_H.stop();
+		TransitionToWaitClient();
+		return;
+	}
+
+	// COM port to network
+	FillFromComPort();
+	Nb_UI = GetPacketSize();
+	if (Nb_UI > 0)
+		SendPacket(Nb_UI);
+
+	// Network to COM port (never blocks on the UART)
+	ReceiveFromNetwork();
+	GL_SerialBridgeParam_X.Stats_X.pByteNb_UL[1] += StreamBuffer_DrainToSerial(&(GL_SerialBridgeParam_X.pStream_X[1]), GL_SerialBridgeParam_X.pSerial_H);
+}
+
+
+void TransitionToIdle(void) {
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To IDLE");
+	if (GL_SerialBridgeParam_X.Config_X.Mode_E == SERIAL_BRIDGE_MODE_UDP) {
+		GL_SerialBridgeParam_X.Udp_H.stop();
+	}
+	else {
+		GL_SerialBridgeParam_X.Client_H.flush();
+		GL_SerialBridgeParam_X.Client_H.stop();
+	}
+	StreamBuffer_Reset(&(GL_SerialBridgeParam_X.pStream_X[0]));
+	StreamBuffer_Reset(&(GL_SerialBridgeParam_X.pStream_X[1]));
+	GL_SerialBridgeParam_X.DelimiterNb_UI = 0;
+	GL_SerialBridgeManager_CurrentState_E = SERIAL_BRIDGE_MANAGER_STATE::SERIAL_BRIDGE_MANAGER_IDLE;
+}
+
+void TransitionToWaitClient(void) {
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To WAIT CLIENT");
+	StreamBuffer_Reset(&(GL_SerialBridgeParam_X.pStream_X[0]));
+	StreamBuffer_Reset(&(GL_SerialBridgeParam_X.pStream_X[1]));
+	GL_SerialBridgeParam_X.DelimiterNb_UI = 0;
+	GL_SerialBridgeManager_CurrentState_E = SERIAL_BRIDGE_MANAGER_STATE::SERIAL_BRIDGE_MANAGER_WAIT_CLIENT;
+}
+
+void TransitionToRunning(void) {
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To RUNNING");
+	GL_SerialBridgeParam_X.LastRxTime_UL = millis();
+	GL_SerialBridgeManager_CurrentState_E = SERIAL_BRIDGE_MANAGER_STATE::SERIAL_BRIDGE_MANAGER_RUNNING;
+}
+
+
+// Same as StreamBuffer_FillFromSerial() but keeps track of the last delimiter received
+void FillFromComPort(void) {
+	STREAM_BUFFER_STRUCT * pStream_X = &(GL_SerialBridgeParam_X.pStream_X[0]);
+	HardwareSerial * pSerial_H = GL_SerialBridgeParam_X.pSerial_H;
+	unsigned char * pSpan_UB;
+	unsigned int Span_UI = 0;
+	int Available_SI = pSerial_H->available();
+
+	if (Available_SI > 0)
+		GL_SerialBridgeParam_X.LastRxTime_UL = millis();
+
+	while ((Available_SI > 0) && ((Span_UI = StreamBuffer_GetWriteSpan(pStream_X, &pSpan_UB)) > 0)) {
+		unsigned int Count_UI = StreamBuffer_GetCount(pStream_X);
+
+		if (Span_UI > (unsigned int)Available_SI)
+			Span_UI = (unsigned int)Available_SI;
+
+		for (unsigned int i = 0; i < Span_UI; i++) {
+			pSpan_UB[i] = (unsigned char)pSerial_H->read();
+			if ((GL_SerialBridgeParam_X.Config_X.UseDelimiter_B) && (pSpan_UB[i] == GL_SerialBridgeParam_X.Config_X.Delimiter_UB))
+				GL_SerialBridgeParam_X.DelimiterNb_UI = Count_UI + i + 1;
+		}
+
+		StreamBuffer_Commit(pStream_X, Span_UI);
+		Available_SI -= Span_UI;
+	}
+
+	if (Available_SI > 0)
+		GL_SerialBridgeParam_X.Stats_X.pOverrunNb_UL[0]++;
+}
+
+// Number of bytes to send now (0 = keep gathering)
+unsigned int GetPacketSize(void) {
+	unsigned int Count_UI = StreamBuffer_GetCount(&(GL_SerialBridgeParam_X.pStream_X[0]));
+
+	if (Count_UI == 0)
+		return 0;
+
+	if (GL_SerialBridgeParam_X.DelimiterNb_UI > 0)
+		return GL_SerialBridgeParam_X.DelimiterNb_UI;
+
+	if (Count_UI >= GL_SerialBridgeParam_X.Config_X.SizeThreshold_UI)
+		return Count_UI;
+
+	if ((millis() - GL_SerialBridgeParam_X.LastRxTime_UL) >= GL_SerialBridgeParam_X.Config_X.IdleTime_UL)
+		return Count_UI;
+
+	return 0;
+}
+
+void SendPacket(unsigned int Nb_UI) {
+	STREAM_BUFFER_STRUCT * pStream_X = &(GL_SerialBridgeParam_X.pStream_X[0]);
+	const unsigned char * pSpan_UB;
+	unsigned int Span_UI = 0;
+	unsigned int Remaining_UI = Nb_UI;
+	boolean IsUdp_B = (GL_SerialBridgeParam_X.Config_X.Mode_E == SERIAL_BRIDGE_MODE_UDP) ? true : false;
+
+	// UDP peer not known yet (no fixed peer and nothing received) : data is lost
+	if (IsUdp_B && ((GL_SerialBridgeParam_X.PeerIp_X == IPAddress(0, 0, 0, 0)) || (GL_SerialBridgeParam_X.PeerPort_UI == 0))) {
+		StreamBuffer_Consume(pStream_X, Nb_UI);
+		GL_SerialBridgeParam_X.DelimiterNb_UI = 0;
+		return;
+	}
+
+	if (IsUdp_B)
+		GL_SerialBridgeParam_X.Udp_H.beginPacket(GL_SerialBridgeParam_X.PeerIp_X, GL_SerialBridgeParam_X.PeerPort_UI);
+
+	// At most two spans (wrap-around of the buffer)
+	while ((Remaining_UI > 0) && ((Span_UI = StreamBuffer_GetReadSpan(pStream_X, &pSpan_UB)) > 0)) {
+		if (Span_UI > Remaining_UI)
+			Span_UI = Remaining_UI;
+
+		if (IsUdp_B)
+			GL_SerialBridgeParam_X.Udp_H.write(pSpan_UB, Span_UI);
+		else
+			GL_SerialBridgeParam_X.Client_H.write(pSpan_UB, Span_UI);
+
+		StreamBuffer_Consume(pStream_X, Span_UI);
+		Remaining_UI -= Span_UI;
+	}
+
+	if (IsUdp_B)
+		GL_SerialBridgeParam_X.Udp_H.endPacket();
+
+	GL_SerialBridgeParam_X.DelimiterNb_UI = (GL_SerialBridgeParam_X.DelimiterNb_UI > Nb_UI) ? (GL_SerialBridgeParam_X.DelimiterNb_UI - Nb_UI) : 0;
+	GL_SerialBridgeParam_X.Stats_X.pByteNb_UL[0] += Nb_UI;
+	GL_SerialBridgeParam_X.Stats_X.PacketNb_UL++;
+}
+
+void ReceiveFromNetwork(void) {
+	STREAM_BUFFER_STRUCT * pStream_X = &(GL_SerialBridgeParam_X.pStream_X[1]);
+	unsigned char * pSpan_UB;
+	unsigned int Span_UI = 0;
+	int Read_SI = 0;
+
+	if (GL_SerialBridgeParam_X.Config_X.Mode_E == SERIAL_BRIDGE_MODE_TCP) {
+		StreamBuffer_FillFromClient(pStream_X, &(GL_SerialBridgeParam_X.Client_H));
+		if ((StreamBuffer_GetFree(pStream_X) == 0) && (GL_SerialBridgeParam_X.Client_H.available() > 0))
+			GL_SerialBridgeParam_X.Stats_X.pOverrunNb_UL[1]++;
+		return;
+	}
+
+	// Next datagram only once the current one has been read entirely
+	if (GL_SerialBridgeParam_X.Udp_H.available() <= 0) {
+		if (GL_SerialBridgeParam_X.Udp_H.parsePacket() <= 0)
+			return;
+
+		// No fixed peer : answer to the last sender
+		if (GL_SerialBridgeParam_X.Config_X.RemoteIp_X == IPAddress(0, 0, 0, 0)) {
+			GL_SerialBridgeParam_X.PeerIp_X = GL_SerialBridgeParam_X.Udp_H.remoteIP();
+			GL_SerialBridgeParam_X.PeerPort_UI = GL_SerialBridgeParam_X.Udp_H.remotePort();
+		}
+	}
+
+	while ((GL_SerialBridgeParam_X.Udp_H.available() > 0) && ((Span_UI = StreamBuffer_GetWriteSpan(pStream_X, &pSpan_UB)) > 0)) {
+		Read_SI = GL_SerialBridgeParam_X.Udp_H.read(pSpan_UB, Span_UI);
+		if (Read_SI <= 0)
+			break;
+		StreamBuffer_Commit(pStream_X, (unsigned int)Read_SI);
+	}
+
+	if (GL_SerialBridgeParam_X.Udp_H.available() > 0)
+		GL_SerialBridgeParam_X.Stats_X.pOverrunNb_UL[1]++;
+}
+
+void FlushComPort(void) {
+	while (GL_SerialBridgeParam_X.pSerial_H->available())
+		GL_SerialBridgeParam_X.pSerial_H->read();
+}
@@ -0,0 +1,72 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* SerialBridgeManager.h															*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Header file for SerialBridgeManager.cpp										*/
+/*		Process functions to bridge a COM port to a TCP client or a UDP peer		*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __SERIAL_BRIDGE_MANAGER_H__
+#define __SERIAL_BRIDGE_MANAGER_H__
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+#include <Arduino.h>
+#include "Ethernet.h"
+#include "EthernetUdp.h"
+#include "NetworkAdapter.h"
+#include "StreamBuffer.h"
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+#define SERIAL_BRIDGE_DEFAULT_PORT			4001
+#define SERIAL_BRIDGE_BUFFER_SIZE			1024	// Per direction (power of 2) - also the largest packet sent
+
+/* ******************************************************************************** */
+/* Structure & Enumeration
+/* ******************************************************************************** */
+typedef enum {
+	SERIAL_BRIDGE_MODE_TCP = 0,				// Raw TCP : listen on LocalPort_UI, one client at a time
+	SERIAL_BRIDGE_MODE_UDP = 1				// Datagrams to/from RemoteIp_X:RemotePort_UI
+} SERIAL_BRIDGE_MODE_ENUM;
+
+// A packet is sent to the network as soon as one of the conditions is met
+typedef struct {
+	unsigned long ComPort_UL;
+	SERIAL_BRIDGE_MODE_ENUM Mode_E;
+	unsigned int LocalPort_UI;
+	IPAddress RemoteIp_X;					// UDP only - 0.0.0.0 = answer to the last sender
+	unsigned int RemotePort_UI;				// UDP only
+	unsigned long IdleTime_UL;				// [ms] Silence on the COM port - 0 = send at once
+	unsigned int SizeThreshold_UI;			// Bytes waiting - 0 or above SERIAL_BRIDGE_BUFFER_SIZE = buffer size
+	boolean UseDelimiter_B;
+	unsigned char Delimiter_UB;				// Sent with the packet it ends
+} SERIAL_BRIDGE_CONFIG_STRUCT;
+
+// Direction 0 = COM port to network, direction 1 = network to COM port
+typedef struct {
+	unsigned long pByteNb_UL[2];
+	unsigned long pOverrunNb_UL[2];			// Passes where the bridge buffer was full with data still waiting
+	unsigned long PacketNb_UL;				// Packets sent to the network
+} SERIAL_BRIDGE_STATS_STRUCT;
+
+/* ******************************************************************************** */
+/* Functions Prototypes
+/* ******************************************************************************** */
+void SerialBridgeManager_Init(NetworkAdapter * pNetworkAdapter_H);
+boolean SerialBridgeManager_Start(const SERIAL_BRIDGE_CONFIG_STRUCT * pConfig_X);
+void SerialBridgeManager_Stop(void);
+void SerialBridgeManager_Process(void);
+
+boolean SerialBridgeManager_IsBridgePort(unsigned long ComPort_UL);
+boolean SerialBridgeManager_GetStats(SERIAL_BRIDGE_STATS_STRUCT * pStats_X);
+
+
+#endif // __SERIAL_BRIDGE_MANAGER_H__
+
@@ -6,6 +6,7 @@
 /*		Implements the specific functions for the Serial communication.				*/
 /*                                                                                  */
 /* History :  	04/06/2017  (RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Several tunnels, block forwarding, XON/XOFF		*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -19,11 +20,13 @@
 #include "SerialManager.h"
 
 #include "Debug.h"
+#include "LoopProfiler.h"
 
 
 /* ******************************************************************************** */
 /* Define
 /* ******************************************************************************** */
+#define SERIAL_MANAGER_COM_PORT_NB		4
 
 /* ******************************************************************************** */
 /* Local Variables
@@ -35,10 +38,23 @@ enum SERIAL_MANAGER_STATE {
 
 static SERIAL_MANAGER_STATE GL_SerialManager_CurrentState_E = SERIAL_MANAGER_STATE::SERIAL_MANAGER_IDLE;
 
+// Index 0 = port A, index 1 = port B - pStream_X[i] holds the bytes received from port i
 typedef struct {
-    boolean IsTunnelEnabled_B;
-    HardwareSerial * pSerialA_H;
-    HardwareSerial * pSerialB_H;
+    boolean IsEnabled_B;
+    boolean IsStopRequested_B;
+    SERIAL_MANAGER_FLOW_ENUM Flow_E;
+    unsigned long pComPort_UL[2];
+    HardwareSerial * pSerial_H[2];
+    STREAM_BUFFER_STRUCT pStream_X[2];
+    unsigned char pBuffer_UB[2][SERIAL_MANAGER_TUNNEL_BUFFER_SIZE];
+    boolean pXoffSent_B[2];                 // XOFF sent to port i
+    boolean pXoffReceived_B[2];             // XOFF received from port i
+    unsigned long pByteNb_UL[2];
+    unsigned long pOverrunNb_UL[2];
+} SERIAL_MANAGER_TUNNEL_STRUCT;
+
+typedef struct {
+    SERIAL_MANAGER_TUNNEL_STRUCT pTunnel_X[SERIAL_MANAGER_MAX_TUNNEL_NB];
 } SERIAL_MANAGER_PARAM;
 
 static SERIAL_MANAGER_PARAM GL_SerialManagerParam_X;
@@ -52,34 +68,103 @@ static void ProcessTunnel(void);
 static void TransitionToIdle(void);
 static void TransitionToProcessTunnel(void);
 
+static boolean IsAnyTunnelEnabled(void);
+static SERIAL_MANAGER_TUNNEL_STRUCT * FindTunnel(unsigned long ComPort_UL);
+static void ForwardTunnel(SERIAL_MANAGER_TUNNEL_STRUCT * pTunnel_X);
+static unsigned int FillWithFlowControl(SERIAL_MANAGER_TUNNEL_STRUCT * pTunnel_X, unsigned char Idx_UB);
+static void CloseTunnel(SERIAL_MANAGER_TUNNEL_STRUCT * pTunnel_X);
+
 /* ******************************************************************************** */
 /* Functions
 /* ******************************************************************************** */
 void SerialManager_Init() {
+    memset(&GL_SerialManagerParam_X, 0x00, sizeof(SERIAL_MANAGER_PARAM));
     GL_SerialManager_CurrentState_E = SERIAL_MANAGER_STATE::SERIAL_MANAGER_IDLE;
-    DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Flat Panel Manager Initialized");
+    DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Serial Manager Initialized");
 }
 
 
 
-void SerialManager_SetTunnel(unsigned long ComPortA_UL, unsigned long ComPortB_UL) {
+boolean SerialManager_SetTunnel(unsigned long ComPortA_UL, unsigned long ComPortB_UL, SERIAL_MANAGER_FLOW_ENUM Flow_E) {
+    SERIAL_MANAGER_TUNNEL_STRUCT * pTunnel_X = NULL;
+
+    if ((ComPortA_UL >= SERIAL_MANAGER_COM_PORT_NB) || (ComPortB_UL >= SERIAL_MANAGER_COM_PORT_NB) || (ComPortA_UL == ComPortB_UL))
+        return false;
+
+    // A port belongs to one tunnel only
+    if ((FindTunnel(ComPortA_UL) != NULL) || (FindTunnel(ComPortB_UL) != NULL)) {
+        DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "COM port already used by a tunnel");
+        return false;
+    }
+
+    // Get a free slot (a tunnel being stopped is not free yet)
+    for (int i = 0; i < SERIAL_MANAGER_MAX_TUNNEL_NB; i++) {
+        if (!(GL_SerialManagerParam_X.pTunnel_X[i].IsEnabled_B)) {
+            pTunnel_X = &GL_SerialManagerParam_X.pTunnel_X[i];
+            break;
+        }
+    }
+
+    if (pTunnel_X == NULL) {
+        DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "No more tunnel available");
+        return false;
+    }
 
     // Assign COM port
-    GL_SerialManagerParam_X.pSerialA_H = GetSerialHandle(ComPortA_UL);
-    GL_SerialManagerParam_X.pSerialB_H = GetSerialHandle(ComPortB_UL);
+    memset(pTunnel_X, 0x00, sizeof(SERIAL_MANAGER_TUNNEL_STRUCT));
+    pTunnel_X->Flow_E = Flow_E;
+    pTunnel_X->pComPort_UL[0] = ComPortA_UL;
+    pTunnel_X->pComPort_UL[1] = ComPortB_UL;
+    pTunnel_X->pSerial_H[0] = GetSerialHandle(ComPortA_UL);
+    pTunnel_X->pSerial_H[1] = GetSerialHandle(ComPortB_UL);
+    StreamBuffer_Init(&(pTunnel_X->pStream_X[0]), pTunnel_X->pBuffer_UB[0], SERIAL_MANAGER_TUNNEL_BUFFER_SIZE);
+    StreamBuffer_Init(&(pTunnel_X->pStream_X[1]), pTunnel_X->pBuffer_UB[1], SERIAL_MANAGER_TUNNEL_BUFFER_SIZE);
 
     // Set Flag
-    GL_SerialManagerParam_X.IsTunnelEnabled_B = true;
+    pTunnel_X->IsEnabled_B = true;
+    return true;
 }
 
 void SerialManager_StopTunnel(void) {
-    GL_SerialManagerParam_X.IsTunnelEnabled_B = false;
+    for (int i = 0; i < SERIAL_MANAGER_MAX_TUNNEL_NB; i++) {
+        if (GL_SerialManagerParam_X.pTunnel_X[i].IsEnabled_B)
+            GL_SerialManagerParam_X.pTunnel_X[i].IsStopRequested_B = true;
+    }
+}
+
+boolean SerialManager_StopTunnel(unsigned long ComPort_UL) {
+    SERIAL_MANAGER_TUNNEL_STRUCT * pTunnel_X = FindTunnel(ComPort_UL);
+
+    if (pTunnel_X == NULL)
+        return false;
+
+    pTunnel_X->IsStopRequested_B = true;
+    return true;
+}
+
+boolean SerialManager_IsTunnelPort(unsigned long ComPort_UL) {
+    return ((FindTunnel(ComPort_UL) != NULL) ? true : false);
+}
+
+boolean SerialManager_GetTunnelStats(unsigned long ComPort_UL, SERIAL_MANAGER_TUNNEL_STATS_STRUCT * pStats_X) {
+    SERIAL_MANAGER_TUNNEL_STRUCT * pTunnel_X = FindTunnel(ComPort_UL);
+
+    if (pTunnel_X == NULL)
+        return false;
+
+    for (int i = 0; i < 2; i++) {
+        pStats_X->pByteNb_UL[i] = pTunnel_X->pByteNb_UL[i];
+        pStats_X->pOverrunNb_UL[i] = pTunnel_X->pOverrunNb_UL[i];
+    }
+
+    return true;
 }
 
 
 void SerialManager_Process() {
 
     /* State Machine */
+    LOOP_PROFILER_SET_STATE(LOOP_PROFILER_ID_SERIAL, GL_SerialManager_CurrentState_E);
     switch (GL_SerialManager_CurrentState_E) {
     case SERIAL_MANAGER_IDLE:
         ProcessIdle();
@@ -97,42 +182,26 @@ void SerialManager_Process() {
 /* Internal Functions
 /* ******************************************************************************** */
 static void ProcessIdle(void) {
-    if (GL_SerialManagerParam_X.IsTunnelEnabled_B)
+    if (IsAnyTunnelEnabled())
         TransitionToProcessTunnel();
 }
 
 static void ProcessTunnel(void) {
-    if (GL_SerialManagerParam_X.IsTunnelEnabled_B) {
+    for (int i = 0; i < SERIAL_MANAGER_MAX_TUNNEL_NB; i++) {
+        SERIAL_MANAGER_TUNNEL_STRUCT * pTunnel_X = &GL_SerialManagerParam_X.pTunnel_X[i];
 
-        // Forward A to B
-        while (GL_SerialManagerParam_X.pSerialA_H->available()) {
-            //DBG_PRINTDATA("A = ");
-            //DBG_PRINTDATA((char)GL_SerialManagerParam_X.pSerialA_H->read());
-            GL_SerialManagerParam_X.pSerialB_H->write(GL_SerialManagerParam_X.pSerialA_H->read());
-        }
-
-        // Forward B to A
-        while (GL_SerialManagerParam_X.pSerialB_H->available()) {
-            //DBG_PRINTDATA("B = ");
-            //DBG_PRINTDATA((char)GL_SerialManagerParam_X.pSerialB_H->read());
-            GL_SerialManagerParam_X.pSerialA_H->write(GL_SerialManagerParam_X.pSerialB_H->read());
-        }
+        if (!(pTunnel_X->IsEnabled_B))
+            continue;
 
+        if (pTunnel_X->IsStopRequested_B)
+            CloseTunnel(pTunnel_X);
+        else
+            ForwardTunnel(pTunnel_X);
     }
-    else {
-        // Flush A
-        GL_SerialManagerParam_X.pSerialA_H->flush();
-        while (GL_SerialManagerParam_X.pSerialA_H->available())
-            GL_SerialManagerParam_X.pSerialA_H->read();
-
-        // Flush B
-        GL_SerialManagerParam_X.pSerialB_H->flush();
-        while (GL_SerialManagerParam_X.pSerialB_H->available())
-            GL_SerialManagerParam_X.pSerialB_H->read();
-
-        // Go to IDLE
+
+    // Go to IDLE
+    if (!IsAnyTunnelEnabled())
         TransitionToIdle();
-    }
 }
 
 void TransitionToIdle() {
@@ -145,3 +214,105 @@ static void TransitionToProcessTunnel() {
     DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To PROCESS TUNNEL");
     GL_SerialManager_CurrentState_E = SERIAL_MANAGER_STATE::SERIAL_MANAGER_PROCESS_TUNNEL;
 }
+
+
+boolean IsAnyTunnelEnabled(void) {
+    for (int i = 0; i < SERIAL_MANAGER_MAX_TUNNEL_NB; i++) {
+        if (GL_SerialManagerParam_X.pTunnel_X[i].IsEnabled_B)
+            return true;
+    }
+    return false;
+}
+
+SERIAL_MANAGER_TUNNEL_STRUCT * FindTunnel(unsigned long ComPort_UL) {
+    for (int i = 0; i < SERIAL_MANAGER_MAX_TUNNEL_NB; i++) {
+        SERIAL_MANAGER_TUNNEL_STRUCT * pTunnel_X = &GL_SerialManagerParam_X.pTunnel_X[i];
+        if ((pTunnel_X->IsEnabled_B) && ((pTunnel_X->pComPort_UL[0] == ComPort_UL) || (pTunnel_X->pComPort_UL[1] == ComPort_UL)))
+            return pTunnel_X;
+    }
+    return NULL;
+}
+
+void ForwardTunnel(SERIAL_MANAGER_TUNNEL_STRUCT * pTunnel_X) {
+    for (unsigned char i = 0; i < 2; i++) {
+        STREAM_BUFFER_STRUCT * pStream_X = &(pTunnel_X->pStream_X[i]);
+        HardwareSerial * pSource_H = pTunnel_X->pSerial_H[i];
+        HardwareSerial * pDest_H = pTunnel_X->pSerial_H[1 - i];
+
+        // Receive from port i as much as the buffer can take
+        if (pTunnel_X->Flow_E == SERIAL_MANAGER_FLOW_XON_XOFF)
+            FillWithFlowControl(pTunnel_X, i);
+        else
+            StreamBuffer_FillFromSerial(pStream_X, pSource_H);
+
+        if ((StreamBuffer_GetFree(pStream_X) == 0) && (pSource_H->available() > 0))
+            pTunnel_X->pOverrunNb_UL[i]++;
+
+        // Send to the other port in blocks bounded by its TX buffer (never blocks)
+        if (!(pTunnel_X->pXoffReceived_B[1 - i]))
+            pTunnel_X->pByteNb_UL[i] += StreamBuffer_DrainToSerial(pStream_X, pDest_H);
+
+        // Resume the source once the buffer has drained
+        if ((pTunnel_X->pXoffSent_B[i]) && (StreamBuffer_GetCount(pStream_X) <= SERIAL_MANAGER_XON_THRESHOLD)) {
+            pSource_H->write(SERIAL_MANAGER_XON);
+            pTunnel_X->pXoffSent_B[i] = false;
+        }
+    }
+}
+
+unsigned int FillWithFlowControl(SERIAL_MANAGER_TUNNEL_STRUCT * pTunnel_X, unsigned char Idx_UB) {
+    STREAM_BUFFER_STRUCT * pStream_X = &(pTunnel_X->pStream_X[Idx_UB]);
+    HardwareSerial * pSource_H = pTunnel_X->pSerial_H[Idx_UB];
+    unsigned char * pSpan_UB;
+    unsigned int Span_UI = 0;
+    unsigned int Nb_UI = 0;
+    int Available_SI = pSource_H->available();
+    int Data_SI;
+
+    // XON/XOFF from port i are consumed here and gate the direction towards port i
+    while ((Available_SI > 0) && ((Span_UI = StreamBuffer_GetWriteSpan(pStream_X, &pSpan_UB)) > 0)) {
+        unsigned int Idx_UI = 0;
+
+        while ((Idx_UI < Span_UI) && (Available_SI > 0)) {
+            Data_SI = pSource_H->read();
+            Available_SI--;
+
+            if (Data_SI == SERIAL_MANAGER_XOFF)
+                pTunnel_X->pXoffReceived_B[Idx_UB] = true;
+            else if (Data_SI == SERIAL_MANAGER_XON)
+                pTunnel_X->pXoffReceived_B[Idx_UB] = false;
+            else
+                pSpan_UB[Idx_UI++] = (unsigned char)Data_SI;
+        }
+
+        StreamBuffer_Commit(pStream_X, Idx_UI);
+        Nb_UI += Idx_UI;
+    }
+
+    // Pause the source before the buffer overflows
+    if ((!(pTunnel_X->pXoffSent_B[Idx_UB])) && (StreamBuffer_GetCount(pStream_X) >= SERIAL_MANAGER_XOFF_THRESHOLD)) {
+        pSource_H->write(SERIAL_MANAGER_XOFF);
+        pTunnel_X->pXoffSent_B[Idx_UB] = true;
+    }
+
+    return Nb_UI;
+}
+
+void CloseTunnel(SERIAL_MANAGER_TUNNEL_STRUCT * pTunnel_X) {
+    for (int i = 0; i < 2; i++) {
+        // Do not leave the peer paused
+        if (pTunnel_X->pXoffSent_B[i])
+            pTunnel_X->pSerial_H[i]->write(SERIAL_MANAGER_XON);
+
+        // Flush
+        pTunnel_X->pSerial_H[i]->flush();
+        while (pTunnel_X->pSerial_H[i]->available())
+            pTunnel_X->pSerial_H[i]->read();
+
+        StreamBuffer_Reset(&(pTunnel_X->pStream_X[i]));
+    }
+
+    pTunnel_X->IsStopRequested_B = false;
+    pTunnel_X->IsEnabled_B = false;
+    DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Tunnel closed");
+}
@@ -7,6 +7,7 @@
 /*		Process specific functions to manage the Serial communication               */
 /*                                                                                  */
 /* History :	04/06/2017	(RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Several tunnels, block forwarding, XON/XOFF		*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -16,21 +17,43 @@
 /* ******************************************************************************** */
 /* Include
 /* ******************************************************************************** */
+#include <Arduino.h>
+#include "StreamBuffer.h"
 
 /* ******************************************************************************** */
 /* Define
 /* ******************************************************************************** */
+#define SERIAL_MANAGER_MAX_TUNNEL_NB		2		// 4 COM ports -> 2 tunnels at most
+#define SERIAL_MANAGER_TUNNEL_BUFFER_SIZE	512		// Per direction (power of 2)
+#define SERIAL_MANAGER_XOFF_THRESHOLD		384		// XOFF sent to the source above this level (XON/XOFF only)
+#define SERIAL_MANAGER_XON_THRESHOLD		128		// XON sent to the source below this level (XON/XOFF only)
+
+#define SERIAL_MANAGER_XON					0x11
+#define SERIAL_MANAGER_XOFF					0x13
 
 /* ******************************************************************************** */
 /* Structure & Enumeration
 /* ******************************************************************************** */
+typedef enum {
+	SERIAL_MANAGER_FLOW_NONE = 0,
+	SERIAL_MANAGER_FLOW_XON_XOFF = 1
+} SERIAL_MANAGER_FLOW_ENUM;
+
+// Direction 0 = A to B, direction 1 = B to A
+typedef struct {
+	unsigned long pByteNb_UL[2];			// Bytes forwarded
+	unsigned long pOverrunNb_UL[2];			// Passes where the tunnel buffer was full with data still waiting in the UART
+} SERIAL_MANAGER_TUNNEL_STATS_STRUCT;
 
 /* ******************************************************************************** */
 /* Functions Prototypes
 /* ******************************************************************************** */
 void SerialManager_Init();
-void SerialManager_SetTunnel(unsigned long ComPortA_UL, unsigned long ComPortB_UL);
+boolean SerialManager_SetTunnel(unsigned long ComPortA_UL, unsigned long ComPortB_UL, SERIAL_MANAGER_FLOW_ENUM Flow_E = SERIAL_MANAGER_FLOW_NONE);
 void SerialManager_StopTunnel(void);
+boolean SerialManager_StopTunnel(unsigned long ComPort_UL);
+boolean SerialManager_IsTunnelPort(unsigned long ComPort_UL);
+boolean SerialManager_GetTunnelStats(unsigned long ComPort_UL, SERIAL_MANAGER_TUNNEL_STATS_STRUCT * pStats_X);
 void SerialManager_Process();
 
 
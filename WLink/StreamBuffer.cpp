@@ -0,0 +1,209 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* StreamBuffer.cpp																	*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Describes the single producer / single consumer ring buffer of bytes		*/
+/*		The producer may run in an interrupt : no lock, each side only writes its	*/
+/*		own index, after (producer) or before (consumer) touching the data			*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#define MODULE_NAME		"StreamBuffer"
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "StreamBuffer.h"
+
+#include "Debug.h"
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+
+// Data must be visible before the index is published (DMB on Cortex-M3)
+#define STREAM_BUFFER_BARRIER()		__sync_synchronize()
+
+/* ******************************************************************************** */
+/* Functions
+/* ******************************************************************************** */
+
+void StreamBuffer_Init(STREAM_BUFFER_STRUCT * pStream_X, unsigned char * pBuffer_UB, unsigned int Size_UI) {
+	if ((Size_UI == 0) || ((Size_UI & (Size_UI - 1)) != 0))
+		DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "Size of stream buffer is not a power of 2 !");
+
+	pStream_X->pBuffer_UB = pBuffer_UB;
+	pStream_X->Mask_UI = Size_UI - 1;
+	StreamBuffer_Reset(pStream_X);
+}
+
+// Both sides must be idle
+void StreamBuffer_Reset(STREAM_BUFFER_STRUCT * pStream_X) {
+	pStream_X->Head_UI = 0;
+	pStream_X->Tail_UI = 0;
+	pStream_X->OverrunNb_UL = 0;
+}
+
+unsigned int StreamBuffer_GetCount(const STREAM_BUFFER_STRUCT * pStream_X) {
+	return (pStream_X->Head_UI - pStream_X->Tail_UI);
+}
+
+unsigned int StreamBuffer_GetFree(const STREAM_BUFFER_STRUCT * pStream_X) {
+	return (pStream_X->Mask_UI + 1 - StreamBuffer_GetCount(pStream_X));
+}
+
+
+/* ******************************************************************************** */
+/* Functions - Consumer side
+/* ******************************************************************************** */
+
+// Contiguous bytes available from the tail (a second span may follow after Consume)
+unsigned int StreamBuffer_GetReadSpan(const STREAM_BUFFER_STRUCT * pStream_X, const unsigned char ** ppData_UB) {
+	unsigned int Tail_UI = pStream_X->Tail_UI;
+	unsigned int Count_UI = pStream_X->Head_UI - Tail_UI;
+	unsigned int ToEnd_UI = pStream_X->Mask_UI + 1 - (Tail_UI & pStream_X->Mask_UI);
+
+	STREAM_BUFFER_BARRIER();
+	*ppData_UB = &(pStream_X->pBuffer_UB[Tail_UI & pStream_X->Mask_UI]);
+	return ((Count_UI < ToEnd_UI) ? Count_UI : ToEnd_UI);
+}
+
+void StreamBuffer_Consume(STREAM_BUFFER_STRUCT * pStream_X, unsigned int Nb_UI) {
+	STREAM_BUFFER_BARRIER();
+	pStream_X->Tail_UI += Nb_UI;
+}
+
+unsigned int StreamBuffer_Read(STREAM_BUFFER_STRUCT * pStream_X, unsigned char * pData_UB, unsigned int MaxNb_UI) {
+	const unsigned char * pSpan_UB;
+	unsigned int Span_UI = 0;
+	unsigned int Nb_UI = 0;
+
+	while ((Nb_UI < MaxNb_UI) && ((Span_UI = StreamBuffer_GetReadSpan(pStream_X, &pSpan_UB)) > 0)) {
+		if (Span_UI > (MaxNb_UI - Nb_UI))
+			Span_UI = MaxNb_UI - Nb_UI;
+		memcpy(&(pData_UB[Nb_UI]), pSpan_UB, Span_UI);
+		StreamBuffer_Consume(pStream_X, Span_UI);
+		Nb_UI += Span_UI;
+	}
+
+	return Nb_UI;
+}
+
+
+/* ******************************************************************************** */
+/* Functions - Producer side
+/* ******************************************************************************** */
+
+// Contiguous free bytes from the head (a second span may follow after Commit)
+unsigned int StreamBuffer_GetWriteSpan(const STREAM_BUFFER_STRUCT * pStream_X, unsigned char ** ppData_UB) {
+	unsigned int Head_UI = pStream_X->Head_UI;
+	unsigned int Free_UI = pStream_X->Mask_UI + 1 - (Head_UI - pStream_X->Tail_UI);
+	unsigned int ToEnd_UI = pStream_X->Mask_UI + 1 - (Head_UI & pStream_X->Mask_UI);
+
+	STREAM_BUFFER_BARRIER();
+	*ppData_UB = &(pStream_X->pBuffer_UB[Head_UI & pStream_X->Mask_UI]);
+	return ((Free_UI < ToEnd_UI) ? Free_UI : ToEnd_UI);
+}
+
+void StreamBuffer_Commit(STREAM_BUFFER_STRUCT * pStream_X, unsigned int Nb_UI) {
+	STREAM_BUFFER_BARRIER();
+	pStream_X->Head_UI += Nb_UI;
+}
+
+unsigned int StreamBuffer_Write(STREAM_BUFFER_STRUCT * pStream_X, const unsigned char * pData_UB, unsigned int Nb_UI) {
+	unsigned char * pSpan_UB;
+	unsigned int Span_UI = 0;
+	unsigned int Done_UI = 0;
+
+	while ((Done_UI < Nb_UI) && ((Span_UI = StreamBuffer_GetWriteSpan(pStream_X, &pSpan_UB)) > 0)) {
+		if (Span_UI > (Nb_UI - Done_UI))
+			Span_UI = Nb_UI - Done_UI;
+		memcpy(pSpan_UB, &(pData_UB[Done_UI]), Span_UI);
+		StreamBuffer_Commit(pStream_X, Span_UI);
+		Done_UI += Span_UI;
+	}
+
+	pStream_X->OverrunNb_UL += (Nb_UI - Done_UI);
+	return Done_UI;
+}
+
+
+/* ******************************************************************************** */
+/* Functions - Medium adapters
+/* ******************************************************************************** */
+
+// HardwareSerial has no block read : bytes are taken one by one from the core RX buffer but committed per span
+unsigned int StreamBuffer_FillFromSerial(STREAM_BUFFER_STRUCT * pStream_X, HardwareSerial * pSerial_H) {
+	unsigned char * pSpan_UB;
+	unsigned int Span_UI = 0;
+	unsigned int Nb_UI = 0;
+	int Available_SI = pSerial_H->available();
+
+	while ((Available_SI > 0) && ((Span_UI = StreamBuffer_GetWriteSpan(pStream_X, &pSpan_UB)) > 0)) {
+		if (Span_UI > (unsigned int)Available_SI)
+			Span_UI = (unsigned int)Available_SI;
+		for (unsigned int i = 0; i < Span_UI; i++)
+			pSpan_UB[i] = (unsigned char)pSerial_H->read();
+		StreamBuffer_Commit(pStream_X, Span_UI);
+		Available_SI -= Span_UI;
+		Nb_UI += Span_UI;
+	}
+
+	return Nb_UI;
+}
+
+unsigned int StreamBuffer_FillFromClient(STREAM_BUFFER_STRUCT * pStream_X, Client * pClient_H) {
+	unsigned char * pSpan_UB;
+	unsigned int Span_UI = 0;
+	unsigned int Nb_UI = 0;
+	int Read_SI = 0;
+
+	while ((pClient_H->available() > 0) && ((Span_UI = StreamBuffer_GetWriteSpan(pStream_X, &pSpan_UB)) > 0)) {
+		Read_SI = pClient_H->read(pSpan_UB, Span_UI);
+		if (Read_SI <= 0)
+			break;
+		StreamBuffer_Commit(pStream_X, (unsigned int)Read_SI);
+		Nb_UI += (unsigned int)Read_SI;
+	}
+
+	return Nb_UI;
+}
+
+// Never blocks : limited by the room in the TX buffer of the serial
+unsigned int StreamBuffer_DrainToSerial(STREAM_BUFFER_STRUCT * pStream_X, HardwareSerial * pSerial_H) {
+	const unsigned char * pSpan_UB;
+	unsigned int Span_UI = 0;
+	unsigned int Nb_UI = 0;
+	int Space_SI = pSerial_H->availableForWrite();
+
+	while ((Space_SI > 0) && ((Span_UI = StreamBuffer_GetReadSpan(pStream_X, &pSpan_UB)) > 0)) {
+		if (Span_UI > (unsigned int)Space_SI)
+			Span_UI = (unsigned int)Space_SI;
+		pSerial_H->write(pSpan_UB, Span_UI);
+		StreamBuffer_Consume(pStream_X, Span_UI);
+		Space_SI -= Span_UI;
+		Nb_UI += Span_UI;
+	}
+
+	return Nb_UI;
+}
+
+unsigned int StreamBuffer_DrainToClient(STREAM_BUFFER_STRUCT * pStream_X, Client * pClient_H) {
+	const unsigned char * pSpan_UB;
+	unsigned int Span_UI = 0;
+	unsigned int Nb_UI = 0;
+
+	while ((Span_UI = StreamBuffer_GetReadSpan(pStream_X, &pSpan_UB)) > 0) {
+		Span_UI = pClient_H->write(pSpan_UB, Span_UI);
+		if (Span_UI == 0)
+			break;
+		StreamBuffer_Consume(pStream_X, Span_UI);
+		Nb_UI += Span_UI;
+	}
+
+	return Nb_UI;
+}
@@ -0,0 +1,66 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* StreamBuffer.h																	*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Header file for StreamBuffer.cpp											*/
+/*		Lock-free single producer / single consumer ring buffer of bytes, accessed	*/
+/*		by contiguous spans, with adapters to fill/drain it from the byte media		*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __STREAM_BUFFER_H__
+#define __STREAM_BUFFER_H__
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include <Arduino.h>
+#include <Client.h>
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+
+/* ******************************************************************************** */
+/* Structure & Enumeration
+/* ******************************************************************************** */
+
+// Indexes are free-running (masked on access) : Head_UI written by the producer only, Tail_UI by the consumer only
+typedef struct {
+	unsigned char * pBuffer_UB;
+	unsigned int Mask_UI;				// Size - 1 (size must be a power of 2)
+	volatile unsigned int Head_UI;		// Next byte to write
+	volatile unsigned int Tail_UI;		// Next byte to read
+	unsigned long OverrunNb_UL;			// Bytes left in the medium because the buffer was full
+} STREAM_BUFFER_STRUCT;
+
+/* ******************************************************************************** */
+/* Functions Prototypes
+/* ******************************************************************************** */
+void StreamBuffer_Init(STREAM_BUFFER_STRUCT * pStream_X, unsigned char * pBuffer_UB, unsigned int Size_UI);
+void StreamBuffer_Reset(STREAM_BUFFER_STRUCT * pStream_X);
+unsigned int StreamBuffer_GetCount(const STREAM_BUFFER_STRUCT * pStream_X);
+unsigned int StreamBuffer_GetFree(const STREAM_BUFFER_STRUCT * pStream_X);
+
+// Consumer side
+unsigned int StreamBuffer_GetReadSpan(const STREAM_BUFFER_STRUCT * pStream_X, const unsigned char ** ppData_UB);
+void StreamBuffer_Consume(STREAM_BUFFER_STRUCT * pStream_X, unsigned int Nb_UI);
+unsigned int StreamBuffer_Read(STREAM_BUFFER_STRUCT * pStream_X, unsigned char * pData_UB, unsigned int MaxNb_UI);
+
+// Producer side
+unsigned int StreamBuffer_GetWriteSpan(const STREAM_BUFFER_STRUCT * pStream_X, unsigned char ** ppData_UB);
+void StreamBuffer_Commit(STREAM_BUFFER_STRUCT * pStream_X, unsigned int Nb_UI);
+unsigned int StreamBuffer_Write(STREAM_BUFFER_STRUCT * pStream_X, const unsigned char * pData_UB, unsigned int Nb_UI);
+
+// Medium adapters - return the number of bytes moved
+unsigned int StreamBuffer_FillFromSerial(STREAM_BUFFER_STRUCT * pStream_X, HardwareSerial * pSerial_H);
+unsigned int StreamBuffer_FillFromClient(STREAM_BUFFER_STRUCT * pStream_X, Client * pClient_H);
+unsigned int StreamBuffer_DrainToSerial(STREAM_BUFFER_STRUCT * pStream_X, HardwareSerial * pSerial_H);
+unsigned int StreamBuffer_DrainToClient(STREAM_BUFFER_STRUCT * pStream_X, Client * pClient_H);
+
+
+#endif // __STREAM_BUFFER_H__
@@ -8,6 +8,7 @@
 /* History :  	31/05/2015  (RW)	Creation of this file                           */
 /*				23/01/2017	(RW)	Add setup of subnet, gateway and DNS			*/
 /*              04/03/2017  (RW)    Re-mastered version with Network Adapter        */
+/*              18/10/2026  (RW)    Manage several clients at the same time         */
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -34,6 +35,11 @@ static NetworkAdapter * GL_pNetworkAdapter_H;
 TCPServer::TCPServer() {
 	GL_TcpServerParam_X.IsInitialized_B = false;
 	GL_TcpServerParam_X.IsConnected_B = false;
+	GL_TcpServerParam_X.NextClientId_UL = 1;
+	for (int i = 0; i < TCP_SERVER_MAX_CLIENT_NB; i++) {
+		GL_TcpServerParam_X.pHasClient_B[i] = false;
+		GL_TcpServerParam_X.pClientId_UL[i] = 0;
+	}
 }
 
 
@@ -80,44 +86,119 @@ void TCPServer::begin() {
 
 void TCPServer::renew() {
 	GL_TcpServerParam_X.IsConnected_B = false;
-    flushClient();
-    stopClient();
+    stopAllClients();
 	begin();
 }
 
-void TCPServer::flushClient(void) {
-    GL_TcpServerParam_X.Client_H.flush();   // Flush buffer
+void TCPServer::flushClient(unsigned char Idx_UB) {
+    if (hasClient(Idx_UB))
+        GL_TcpServerParam_X.pClient_H[Idx_UB].flush();   // Flush buffer
 }
 
-void TCPServer::stopClient(void) {
-    GL_TcpServerParam_X.Client_H.stop();    // Close connection if any
+void TCPServer::stopClient(unsigned char Idx_UB) {
+    if (!hasClient(Idx_UB))
+        return;
+
+    GL_TcpServerParam_X.pClient_H[Idx_UB].stop();    // Close connection if any
+    GL_TcpServerParam_X.pHasClient_B[Idx_UB] = false;
+
+    DBG_PRINT(DEBUG_SEVERITY_INFO, "Client ");
+    DBG_PRINTDATA(Idx_UB);
+    DBG_PRINTDATA(" released");
+    DBG_ENDSTR();
+}
+
+void TCPServer::stopAllClients(void) {
+    for (unsigned char i = 0; i < TCP_SERVER_MAX_CLIENT_NB; i++) {
+        flushClient(i);
+        stopClient(i);
+    }
 }
 
 boolean TCPServer::isConnected(void) {
     return (GL_TcpServerParam_X.IsConnected_B);
 }
 
-boolean TCPServer::isClientAvailable(void) {
-    GL_TcpServerParam_X.Client_H = GL_TcpServerParam_X.Server_H.available();
-    if (GL_TcpServerParam_X.Client_H)
-        return true;
-    else
+// Store a new client in a free slot - return true if a new client has been accepted
+// available() re-arms the listening socket : it is not called once all the slots are taken
+boolean TCPServer::acceptClient(void) {
+    if (getClientNb() >= TCP_SERVER_MAX_CLIENT_NB)
         return false;
+
+    EthernetClient Client_H = GL_TcpServerParam_X.Server_H.available();    // Any client with data available
+    int FreeIdx_SI = -1;
+
+    if (!Client_H)
+        return false;
+
+    for (int i = 0; i < TCP_SERVER_MAX_CLIENT_NB; i++) {
+        if (GL_TcpServerParam_X.pHasClient_B[i]) {
+            if (GL_TcpServerParam_X.pClient_H[i] == Client_H)
+                return false;   // Already known
+        }
+        else if (FreeIdx_SI < 0) {
+            FreeIdx_SI = i;
+        }
+    }
+
+    if (FreeIdx_SI < 0) {
+        DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "No more slot for a new client");
+        return false;
+    }
+
+    GL_TcpServerParam_X.pClient_H[FreeIdx_SI] = Client_H;
+    GL_TcpServerParam_X.pHasClient_B[FreeIdx_SI] = true;
+    GL_TcpServerParam_X.pClientId_UL[FreeIdx_SI] = GL_TcpServerParam_X.NextClientId_UL++;
+
+    DBG_PRINT(DEBUG_SEVERITY_INFO, "New client ");
+    DBG_PRINTDATA(FreeIdx_SI);
+    DBG_PRINTDATA(" from ");
+    DBG_PRINTDATA(Client_H.remoteIP());
+    DBG_ENDSTR();
+
+    return true;
+}
+
+// Free the slots of the disconnected clients
+void TCPServer::releaseClients(void) {
+    for (unsigned char i = 0; i < TCP_SERVER_MAX_CLIENT_NB; i++) {
+        if (hasClient(i) && !isClientConnected(i))
+            stopClient(i);
+    }
+}
+
+boolean TCPServer::hasClient(unsigned char Idx_UB) {
+    return ((Idx_UB < TCP_SERVER_MAX_CLIENT_NB) && GL_TcpServerParam_X.pHasClient_B[Idx_UB]);
 }
 
-boolean TCPServer::isClientConnected(void) {
-    if (GL_TcpServerParam_X.Client_H.connected())
+boolean TCPServer::isClientConnected(unsigned char Idx_UB) {
+    if (hasClient(Idx_UB) && GL_TcpServerParam_X.pClient_H[Idx_UB].connected())
         return true;
     else
         return false;
 }
 
+unsigned char TCPServer::getClientNb(void) {
+    unsigned char Nb_UB = 0;
+
+    for (int i = 0; i < TCP_SERVER_MAX_CLIENT_NB; i++) {
+        if (GL_TcpServerParam_X.pHasClient_B[i])
+            Nb_UB++;
+    }
+
+    return Nb_UB;
+}
+
+unsigned long TCPServer::getClientId(unsigned char Idx_UB) {
+    return (hasClient(Idx_UB) ? GL_TcpServerParam_X.pClientId_UL[Idx_UB] : 0);
+}
+
 
 EthernetServer * TCPServer::getServer(void) {
     return (&(GL_TcpServerParam_X.Server_H));
 }
 
-EthernetClient * TCPServer::getClient(void) {
-    return (&(GL_TcpServerParam_X.Client_H));
+EthernetClient * TCPServer::getClient(unsigned char Idx_UB) {
+    return (&(GL_TcpServerParam_X.pClient_H[Idx_UB]));
 }
 
@@ -9,6 +9,7 @@
 /*                                                                                  */
 /* History :	31/05/2016	(RW)	Creation of this file                           */
 /*              04/03/2017  (RW)    Re-mastered version with Network Adapter        */
+/*              18/10/2026  (RW)    Manage several clients at the same time         */
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -29,6 +30,26 @@
 /* ******************************************************************************** */
 #define TCP_SERVER_DEFAULT_PORT			23
 
+// Budget of the 4 sockets of the W5100 :
+//  - TCP server           : TCP_SERVER_MAX_CLIENT_NB, what the others leave. The listening socket becomes the client socket
+//                           on accept and is not re-armed while all the client slots are taken.
+//  - UDP server           : 1 (W-Command over UDP)
+//  - SerialBridge         : 1 (TCP listener or UDP socket)
+//  - DHCP client          : 1 while a lease is requested or renewed  } Shared in time : both
+//  - KipControl HTTP      : 1 during a POST                          } release it at the end
+// Each client also costs a W-Command channel (about 2 KB of RAM, see WCMD_MEDIUM_MAX_CHANNEL_NB)
+#define TCP_SERVER_RESERVED_SOCKET_NB	3
+
+#if defined(MAX_SOCK_NUM) && (MAX_SOCK_NUM > TCP_SERVER_RESERVED_SOCKET_NB)
+#define TCP_SERVER_MAX_CLIENT_NB		(MAX_SOCK_NUM - TCP_SERVER_RESERVED_SOCKET_NB)
+#else
+#define TCP_SERVER_MAX_CLIENT_NB		1			// Always at least one client
+#endif
+
+#ifdef MAX_SOCK_NUM
+static_assert((TCP_SERVER_MAX_CLIENT_NB + TCP_SERVER_RESERVED_SOCKET_NB) <= MAX_SOCK_NUM, "TCP clients exceed the socket budget");
+#endif
+
 
 /* ******************************************************************************** */
 /* Structure & Enumeration
@@ -38,7 +59,10 @@ typedef struct {
     boolean IsConnected_B;
 	unsigned int LocalPort_UI;
 	EthernetServer Server_H = EthernetServer(TCP_SERVER_DEFAULT_PORT);
-	EthernetClient Client_H;
+	EthernetClient pClient_H[TCP_SERVER_MAX_CLIENT_NB];
+	boolean pHasClient_B[TCP_SERVER_MAX_CLIENT_NB];
+	unsigned long pClientId_UL[TCP_SERVER_MAX_CLIENT_NB];	// Changes for each new connection on the slot
+	unsigned long NextClientId_UL;
 } TCP_SERVER_PARAM;
 
 /* ******************************************************************************** */
@@ -59,14 +83,19 @@ public:
 
 	void begin();
 	void renew();
-    void flushClient(void);
-    void stopClient(void);
+    void flushClient(unsigned char Idx_UB);
+    void stopClient(unsigned char Idx_UB);
+    void stopAllClients(void);
     boolean isConnected(void);
-    boolean isClientAvailable(void);
-    boolean isClientConnected(void);
+    boolean acceptClient(void);
+    void releaseClients(void);
+    boolean hasClient(unsigned char Idx_UB);
+    boolean isClientConnected(unsigned char Idx_UB);
+    unsigned char getClientNb(void);
+    unsigned long getClientId(unsigned char Idx_UB);
 
     EthernetServer * getServer(void);
-    EthernetClient * getClient(void);
+    EthernetClient * getClient(unsigned char Idx_UB);
 
 	TCP_SERVER_PARAM GL_TcpServerParam_X;
 };
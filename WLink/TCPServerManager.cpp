@@ -7,6 +7,9 @@
 /*                                                                                  */
 /* History :  	02/06/2015  (RW)	Creation of this file                           */
 /*				15/07/2016	(RW)	Add and manage Enable and Disable functions		*/
+/*				18/10/2026	(RW)	Keep accepting clients while running			*/
+/*				18/10/2026	(RW)	Restart on Network Adapter events				*/
+/*				18/10/2026	(RW)	Network events received from the Event Bus		*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -20,6 +23,7 @@
 #include "WCommandInterpreter.h"
 
 #include "Debug.h"
+#include "LoopProfiler.h"
 
 
 /* ******************************************************************************** */
@@ -81,11 +85,12 @@ void TCPServerManager_Disable() {
 void TCPServerManager_Process() {
 
     /* Reset Condition */
-    if ((GL_TCPServerManager_CurrentState_E != TCP_SERVER_MANAGER_IDLE) && (!(GL_pNetworkAdapter_H->isConnected() && GL_TcpServerManagerEnabled_B))) {
+    if ((GL_TCPServerManager_CurrentState_E != TCP_SERVER_MANAGER_IDLE) && !(GL_TcpServerManagerEnabled_B)) {
         TransitionToIdle();
     }
 
     /* State Machine */
+    LOOP_PROFILER_SET_STATE(LOOP_PROFILER_ID_TCP_SERVER, GL_TCPServerManager_CurrentState_E);
 	switch (GL_TCPServerManager_CurrentState_E) {
 	case TCP_SERVER_MANAGER_IDLE:
 		ProcessIdle();
@@ -109,6 +114,12 @@ boolean TCPServerManager_IsRunning(void) {
     return ((GL_TCPServerManager_CurrentState_E != TCP_SERVER_MANAGER_IDLE) ? true : false);
 }
 
+// Client connections do not survive a link or address loss : drop them at once
+void TCPServerManager_OnEvent(const EVENT_BUS_EVENT_STRUCT * pEvent_X) {
+	if (((pEvent_X->Id_E == EVENT_BUS_ID_LINK_DOWN) || (pEvent_X->Id_E == EVENT_BUS_ID_ADDRESS_LOST)) && (GL_TCPServerManager_CurrentState_E != TCP_SERVER_MANAGER_IDLE))
+		TransitionToIdle();
+}
+
 
 /* ******************************************************************************** */
 /* Internal Functions
@@ -128,13 +139,17 @@ void ProcessWaitClient(void) {
     if (!(GL_pTcpServer_H->isConnected())) {
         TransitionToIdle();
     }
-    else if (GL_pTcpServer_H->isClientAvailable()) {
+    else if (GL_pTcpServer_H->acceptClient()) {
         TransitionToRunning();
     }
 }
 
 void ProcessRunning(void) {
-    if (!(GL_pTcpServer_H->isClientConnected())) {
+    // Up to TCP_SERVER_MAX_CLIENT_NB clients served at the same time
+    GL_pTcpServer_H->releaseClients();
+    GL_pTcpServer_H->acceptClient();
+
+    if (GL_pTcpServer_H->getClientNb() == 0) {
         TransitionToWaitClient();
     }
 }
@@ -142,8 +157,7 @@ void ProcessRunning(void) {
 
 void TransitionToIdle(void) {
 	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To IDLE");
-    GL_pTcpServer_H->flushClient();
-    GL_pTcpServer_H->stopClient();
+    GL_pTcpServer_H->stopAllClients();
 	GL_TCPServerManager_CurrentState_E = TCP_SERVER_MANAGER_STATE::TCP_SERVER_MANAGER_IDLE;
 }
 
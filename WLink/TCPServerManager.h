@@ -8,6 +8,7 @@
 /*                                                                                  */
 /* History :	02/06/2016	(RW)	Creation of this file                           */
 /*				15/07/2016	(RW)	Add Enable and Disable functions				*/
+/*				18/10/2026	(RW)	Add Event Bus handler							*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -18,6 +19,7 @@
 /* Include
 /* ******************************************************************************** */
 #include "TCPServer.h"
+#include "EventBus.h"
 
 /* ******************************************************************************** */
 /* Define
@@ -36,6 +38,7 @@ void TCPServerManager_Disable();
 void TCPServerManager_Process();
 
 boolean TCPServerManager_IsRunning();
+void TCPServerManager_OnEvent(const EVENT_BUS_EVENT_STRUCT * pEvent_X);
 
 
 #endif // __TCP_SERVER_MANAGER_H__
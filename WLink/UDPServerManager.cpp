@@ -6,6 +6,8 @@
 /*		Describes the state machine to manage the UDP Server object					*/
 /*                                                                                  */
 /* History :  	21/06/2015  (RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Restart on Network Adapter events				*/
+/*				18/10/2026	(RW)	Network events received from the Event Bus		*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -19,6 +21,7 @@
 #include "WCommandInterpreter.h"
 
 #include "Debug.h"
+#include "LoopProfiler.h"
 
 
 /* ******************************************************************************** */
@@ -76,11 +79,12 @@ void UDPServerManager_Disable() {
 
 void UDPServerManager_Process() {
     /* Reset Condition */
-    if (!(GL_pNetworkAdapter_H->isConnected() && GL_UdpServerManagerEnabled_B)) {
+    if ((GL_UDPServerManager_CurrentState_E != UDP_SERVER_MANAGER_IDLE) && !(GL_UdpServerManagerEnabled_B)) {
         TransitionToIdle();
     }
 
     /* State Machine */
+    LOOP_PROFILER_SET_STATE(LOOP_PROFILER_ID_UDP_SERVER, GL_UDPServerManager_CurrentState_E);
 	switch (GL_UDPServerManager_CurrentState_E) {
 	case UDP_SERVER_MANAGER_IDLE:
 		ProcessIdle();
@@ -100,6 +104,12 @@ boolean UDPServerManager_IsRunning(void) {
     return ((GL_UDPServerManager_CurrentState_E != UDP_SERVER_MANAGER_IDLE) ? true : false);
 }
 
+// Socket closed as soon as the link or the address goes away
+void UDPServerManager_OnEvent(const EVENT_BUS_EVENT_STRUCT * pEvent_X) {
+	if (((pEvent_X->Id_E == EVENT_BUS_ID_LINK_DOWN) || (pEvent_X->Id_E == EVENT_BUS_ID_ADDRESS_LOST)) && (GL_UDPServerManager_CurrentState_E != UDP_SERVER_MANAGER_IDLE))
+		TransitionToIdle();
+}
+
 
 /* ******************************************************************************** */
 /* Internal Functions
@@ -7,6 +7,7 @@
 /*		Process functions to manage the UDP Server object							*/
 /*                                                                                  */
 /* History :	21/06/2016	(RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Add Event Bus handler							*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -17,6 +18,7 @@
 /* Include
 /* ******************************************************************************** */
 #include "UDPServer.h"
+#include "EventBus.h"
 
 /* ******************************************************************************** */
 /* Define
@@ -35,6 +37,7 @@ void UDPServerManager_Disable();
 void UDPServerManager_Process();
 
 boolean UDPServerManager_IsRunning();
+void UDPServerManager_OnEvent(const EVENT_BUS_EVENT_STRUCT * pEvent_X);
 
 
 #endif // __UDP_SERVER_MANAGER_H__
@@ -6,6 +6,7 @@
 /*		Describes some utility functions                                  			*/
 /*                                                                                  */
 /* History :  	28/02/2017  (RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Add Crc16										*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -97,6 +98,20 @@ int GetIndexOfChar(const char * pCharArray_UB, char CharToSearch_UB, int FromInd
 }
 
 
+// CRC-16/MODBUS (polynomial 0xA001 reflected, initial value 0xFFFF)
+unsigned int Crc16(const unsigned char * pData_UB, unsigned long DataNb_UL) {
+	unsigned int Crc_UI = 0xFFFF;
+
+	for (unsigned long i = 0; i < DataNb_UL; i++) {
+		Crc_UI ^= pData_UB[i];
+		for (int j = 0; j < 8; j++)
+			Crc_UI = (Crc_UI & 0x0001) ? ((Crc_UI >> 1) ^ 0xA001) : (Crc_UI >> 1);
+	}
+
+	return Crc_UI;
+}
+
+
 void DefaultKeyEvents(char * Key_UB) {
     DBG_PRINT(DEBUG_SEVERITY_WARNING, "[");
     DBG_PRINTDATA((*Key_UB));
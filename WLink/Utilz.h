@@ -7,6 +7,7 @@
 /*		Utility functions.                                                          */
 /*                                                                                  */
 /* History :	28/02/2017	(RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Add Crc16										*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -38,6 +39,7 @@ char LowNybbleToAscii(byte b);
 
 String HexArrayToString(unsigned char * pHexArray, unsigned long ItemNb_UL, String Separator_Str);
 int GetIndexOfChar(const char * pCharArray_UB, char CharToSearch_UB, int FromIndex_SI = 0);
+unsigned int Crc16(const unsigned char * pData_UB, unsigned long DataNb_UL);
 
 void DefaultKeyEvents(char * Key_UB);
 boolean DefaultGetCondition(void * Handler_H);
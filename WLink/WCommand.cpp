@@ -11,6 +11,16 @@
 /*									Add EEPROM functions							*/
 /*              25/01/2017  (RW)    Add RTC functions                               */
 /*              04/06/2017  (RW)    Add COM port tunnel functions                   */
+/*              18/10/2026  (RW)    Address indicator by index                      */
+/*              18/10/2026  (RW)    Add Loop Profiler functions                     */
+/*              18/10/2026  (RW)    Add Indicator timing functions                  */
+/*              18/10/2026  (RW)    Add weight stream subscription                  */
+/*              18/10/2026  (RW)    Add framing negotiation                         */
+/*              18/10/2026  (RW)    Flush KipControl shadow around EEPROM access    */
+/*              18/10/2026  (RW)    Queue the EEPROM writes                         */
+/*              18/10/2026  (RW)    Add Boot Report function                        */
+/*              18/10/2026  (RW)    KipControl counters served from their log       */
+/*              18/10/2026  (RW)    Seal the configuration image after a write      */
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -24,6 +34,7 @@
 #include "WCommand.h"
 
 #include "SerialHandler.h"
+#include "WConfigManager.h"
 
 #include "Debug.h"
 
@@ -32,6 +43,12 @@
 /* ******************************************************************************** */
 
 extern GLOBAL_PARAM_STRUCT GL_GlobalData_X;
+extern GLOBAL_CONFIG_STRUCT GL_GlobalConfig_X;
+
+/* ******************************************************************************** */
+/* Prototypes for Internal Functions
+/* ******************************************************************************** */
+static Indicator * GetIndicator(const unsigned char * pParam_UB, unsigned long ParamNb_UL);
 
 /* ******************************************************************************** */
 /* Functions
@@ -50,6 +67,20 @@ WCMD_FCT_STS WCmdProcess_GetRevisionId(const unsigned char * pParam_UB, unsigned
 	return WCMD_FCT_STS_OK;
 }
 
+WCMD_FCT_STS WCmdProcess_SetFraming(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL) {
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "WCmdProcess_SetFraming");
+	*pAnsNb_UL = 0;
+
+	// Must have 1 parameter: Framing (1 or 2) - applied after this response
+	if (ParamNb_UL != 1)
+		return WCMD_FCT_STS_BAD_PARAM_NB;
+
+	if (!WCommandInterpreter_SetFraming(pParam_UB[0]))
+		return WCMD_FCT_STS_BAD_DATA;
+
+	return WCMD_FCT_STS_OK;
+}
+
 /* GPIO *************************************************************************** */
 /* ******************************************************************************** */
 
@@ -145,12 +176,17 @@ WCMD_FCT_STS WCmdProcess_GpioClrBit(const unsigned char * pParam_UB, unsigned lo
 /* ******************************************************************************** */
 WCMD_FCT_STS WCmdProcess_IndicatorGetWeight(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL) {
 	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "WCmdProcess_IndicatorGetWeight");
-	*pAnsNb_UL = 4;
+	*pAnsNb_UL = 0;
 
-	pAns_UB[0] = (unsigned char)(GL_GlobalData_X.Indicator_H.getWeightStatus());
-	pAns_UB[1] = (unsigned char)(GL_GlobalData_X.Indicator_H.getWeightSign());
-	pAns_UB[2] = (unsigned char)(GL_GlobalData_X.Indicator_H.getWeightUnsignedValue());
-	pAns_UB[3] = (unsigned char)(GL_GlobalData_X.Indicator_H.getWeightUnsignedValue() >> 8);
+	Indicator * pIndicator_H = GetIndicator(pParam_UB, ParamNb_UL);
+	if (pIndicator_H == NULL)
+		return WCMD_FCT_STS_BAD_DATA;
+
+	*pAnsNb_UL = 4;
+	pAns_UB[0] = (unsigned char)(pIndicator_H->getWeightStatus());
+	pAns_UB[1] = (unsigned char)(pIndicator_H->getWeightSign());
+	pAns_UB[2] = (unsigned char)(pIndicator_H->getWeightUnsignedValue());
+	pAns_UB[3] = (unsigned char)(pIndicator_H->getWeightUnsignedValue() >> 8);
 
 	return WCMD_FCT_STS_OK;
 }
@@ -166,20 +202,29 @@ WCMD_FCT_STS WCmdProcess_IndicatorSetZero(const unsigned char * pParam_UB, unsig
 	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "WCmdProcess_IndicatorSetZero");
 	*pAnsNb_UL = 0;
 
-	IndicatorManager_SetZeroIndicator();
+	if (GetIndicator(pParam_UB, ParamNb_UL) == NULL)
+		return WCMD_FCT_STS_BAD_DATA;
+
+	IndicatorManager_SetZeroIndicator((ParamNb_UL == 0) ? 0 : pParam_UB[0]);
 
 	return WCMD_FCT_STS_OK;
 }
 
 WCMD_FCT_STS WCmdProcess_IndicatorGetWeightAscii(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL) {
 	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "WCmdProcess_IndicatorGetWeightAscii");
+	*pAnsNb_UL = 0;
+
+	Indicator * pIndicator_H = GetIndicator(pParam_UB, ParamNb_UL);
+	if (pIndicator_H == NULL)
+		return WCMD_FCT_STS_BAD_DATA;
+
 	*pAnsNb_UL = 8;
 
-	unsigned long Remaining1_UL = GL_GlobalData_X.Indicator_H.getWeightUnsignedValue();  // 987.654
+	unsigned long Remaining1_UL = pIndicator_H->getWeightUnsignedValue();  // 987.654
 	unsigned long Remaining2_UL = 0;
 
-	pAns_UB[0] = (unsigned char)(GL_GlobalData_X.Indicator_H.getWeightStatus());
-	pAns_UB[1] = (unsigned char)(GL_GlobalData_X.Indicator_H.getWeightSign());
+	pAns_UB[0] = (unsigned char)(pIndicator_H->getWeightStatus());
+	pAns_UB[1] = (unsigned char)(pIndicator_H->getWeightSign());
 
 	Remaining2_UL = (Remaining1_UL - Remaining1_UL % 100000);       // 900.000 = 987.654 - 87.654
 	pAns_UB[2] = (unsigned char)(0x30 + (Remaining2_UL / 100000));  // 0x30 + 9
@@ -320,6 +365,89 @@ WCMD_FCT_STS WCmdProcess_LcdGetExternalWriteData(const unsigned char * pParam_UB
 	return WCMD_FCT_STS_OK;
 }
 
+WCMD_FCT_STS WCmdProcess_IndicatorSetTiming(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL) {
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "WCmdProcess_IndicatorSetTiming");
+	*pAnsNb_UL = 0;
+
+	// Must have 9 parameters: Index of the Indicator, Scan Period (2 bytes), Response Delay (2 bytes), Reset Delay (2 bytes), Max Try, Flags
+	// Delays in [ms] LSB first - 0 for default value - Flags : bit0 = Adaptive mode
+	if (ParamNb_UL != 9)
+		return WCMD_FCT_STS_BAD_PARAM_NB;
+
+	if (GetIndicator(pParam_UB, 1) == NULL)
+		return WCMD_FCT_STS_BAD_DATA;
+
+	WConfig_SetIndicatorTiming(pParam_UB[0], &pParam_UB[1]);
+
+	return WCMD_FCT_STS_OK;
+}
+
+WCMD_FCT_STS WCmdProcess_IndicatorGetTiming(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL) {
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "WCmdProcess_IndicatorGetTiming");
+	*pAnsNb_UL = 0;
+
+	INDICATOR_MANAGER_LATENCY_STRUCT Latency_X;
+	unsigned char Idx_UB = (ParamNb_UL == 0) ? 0 : pParam_UB[0];
+
+	if ((GetIndicator(pParam_UB, ParamNb_UL) == NULL) || !IndicatorManager_GetLatency(Idx_UB, &Latency_X))
+		return WCMD_FCT_STS_BAD_DATA;
+
+	// Answer = Configured : Scan Period - Response Delay - Reset Delay [ms] (LSB first) - Max Try - Flags
+	//			Effective : Scan Period - Response Delay - Latency P99 [ms] - Sample Number (LSB first)
+	INDICATOR_CONFIG_STRUCT * pConfig_X = &(GL_GlobalConfig_X.pIndicatorConfig_X[Idx_UB]);
+	unsigned long pValue_UL[6] = { pConfig_X->ScanPeriod_UL, pConfig_X->ResponseDelay_UL, pConfig_X->ResetDelay_UL,
+								   Latency_X.ScanPeriod_UL, Latency_X.ResponseDelay_UL, Latency_X.LatencyP99_UL };
+
+	for (int i = 0; i < 3; i++) {
+		pAns_UB[(i * 2)] = (unsigned char)(pValue_UL[i]);
+		pAns_UB[(i * 2) + 1] = (unsigned char)(pValue_UL[i] >> 8);
+	}
+	pAns_UB[6] = pConfig_X->MaxTryNumber_UB;
+	pAns_UB[7] = (pConfig_X->IsAdaptive_B ? 0x01 : 0x00);
+	for (int i = 3; i < 6; i++) {
+		pAns_UB[(i * 2) + 2] = (unsigned char)(pValue_UL[i]);
+		pAns_UB[(i * 2) + 3] = (unsigned char)(pValue_UL[i] >> 8);
+	}
+	pAns_UB[14] = (unsigned char)(Latency_X.SampleNb_UL);
+	pAns_UB[15] = (unsigned char)(Latency_X.SampleNb_UL >> 8);
+	*pAnsNb_UL = 16;
+
+	return WCMD_FCT_STS_OK;
+}
+
+WCMD_FCT_STS WCmdProcess_IndicatorSubscribe(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL) {
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "WCmdProcess_IndicatorSubscribe");
+	*pAnsNb_UL = 0;
+
+	// Must have 4 parameters: Index of the Indicator, Flags, Deadband (2 bytes LSB first - 0 = every new weight)
+	// Flags : bit0 = Stable weights only
+	if (ParamNb_UL != 4)
+		return WCMD_FCT_STS_BAD_PARAM_NB;
+
+	if (GetIndicator(pParam_UB, 1) == NULL)
+		return WCMD_FCT_STS_BAD_DATA;
+
+	// Fails if no more subscription or if the medium cannot push (UDP/TCP not in mono-client mode)
+	if (!WeightStream_Subscribe(pParam_UB[0], pParam_UB[1], (unsigned int)((pParam_UB[3] << 8) + pParam_UB[2])))
+		return WCMD_FCT_STS_ERROR;
+
+	return WCMD_FCT_STS_OK;
+}
+
+WCMD_FCT_STS WCmdProcess_IndicatorUnsubscribe(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL) {
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "WCmdProcess_IndicatorUnsubscribe");
+	*pAnsNb_UL = 0;
+
+	// Optional parameter : index of the Indicator (first Indicator if omitted)
+	if (ParamNb_UL > 1)
+		return WCMD_FCT_STS_BAD_PARAM_NB;
+
+	if (!WeightStream_Unsubscribe((ParamNb_UL == 0) ? 0 : pParam_UB[0]))
+		return WCMD_FCT_STS_BAD_DATA;
+
+	return WCMD_FCT_STS_OK;
+}
+
 
 /* EEPROM ************************************************************************* */
 /* ******************************************************************************** */
@@ -331,7 +459,15 @@ WCMD_FCT_STS WCmdProcess_EepromWrite(const unsigned char * pParam_UB, unsigned l
 	if (ParamNb_UL < 4)
 		return WCMD_FCT_STS_BAD_PARAM_NB;
 
-	GL_GlobalData_X.Eeprom_H.write(((pParam_UB[0] << 8) + pParam_UB[1]), (unsigned char *)&pParam_UB[3], (unsigned long)pParam_UB[2]);
+	// KipControl working area may be shadowed in RAM
+	GL_GlobalData_X.KipControl_H.flush();
+
+	// Answer without waiting for the write cycles - the queue is full only during large updates
+	if (GL_GlobalData_X.Eeprom_H.writeAsync(((pParam_UB[0] << 8) + pParam_UB[1]), &pParam_UB[3], (unsigned long)pParam_UB[2]) == 0)
+		GL_GlobalData_X.Eeprom_H.write(((pParam_UB[0] << 8) + pParam_UB[1]), (unsigned char *)&pParam_UB[3], (unsigned long)pParam_UB[2]);
+	GL_GlobalData_X.KipControl_H.invalidate();
+	GL_GlobalData_X.KipControl_H.importCounters(((pParam_UB[0] << 8) + pParam_UB[1]), (unsigned long)pParam_UB[2]);
+	WConfig_SealImage(((pParam_UB[0] << 8) + pParam_UB[1]), (unsigned long)pParam_UB[2]);
 
 	return WCMD_FCT_STS_OK;
 }
@@ -344,7 +480,9 @@ WCMD_FCT_STS WCmdProcess_EepromRead(const unsigned char * pParam_UB, unsigned lo
 	if (ParamNb_UL != 3)
 		return WCMD_FCT_STS_BAD_PARAM_NB;
 
+	GL_GlobalData_X.KipControl_H.flush();
 	*pAnsNb_UL = GL_GlobalData_X.Eeprom_H.read(((pParam_UB[0] << 8) + pParam_UB[1]), pAns_UB, (unsigned long)pParam_UB[2]);
+	GL_GlobalData_X.KipControl_H.exportCounters(((pParam_UB[0] << 8) + pParam_UB[1]), pAns_UB, *pAnsNb_UL);
 
 	return WCMD_FCT_STS_OK;
 }
@@ -489,8 +627,21 @@ WCMD_FCT_STS WCmdProcess_ComPortEnableTunnel(const unsigned char * pParam_UB, un
     if (pParam_UB[1] >= 4)
         return WCMD_FCT_STS_BAD_DATA;
 
+    // A bridged port cannot be tunneled
+    if (SerialBridgeManager_IsBridgePort((unsigned long)pParam_UB[0]) || SerialBridgeManager_IsBridgePort((unsigned long)pParam_UB[1]))
+        return WCMD_FCT_STS_ERROR;
+
+    // Optional 3rd parameter: Flow control (SERIAL_MANAGER_FLOW_ENUM)
+    SERIAL_MANAGER_FLOW_ENUM Flow_E = SERIAL_MANAGER_FLOW_NONE;
+    if (ParamNb_UL >= 3) {
+        if (pParam_UB[2] > SERIAL_MANAGER_FLOW_XON_XOFF)
+            return WCMD_FCT_STS_BAD_DATA;
+        Flow_E = (SERIAL_MANAGER_FLOW_ENUM)(pParam_UB[2]);
+    }
+
     // Call low-level function
-    SerialManager_SetTunnel((unsigned long)pParam_UB[0], (unsigned long)pParam_UB[1]);
+    if (!SerialManager_SetTunnel((unsigned long)pParam_UB[0], (unsigned long)pParam_UB[1], Flow_E))
+        return WCMD_FCT_STS_ERROR;
 
     return WCMD_FCT_STS_OK;
 }
@@ -500,13 +651,178 @@ WCMD_FCT_STS WCmdProcess_ComPortDisableTunnel(const unsigned char * pParam_UB, u
     DBG_PRINTLN(DEBUG_SEVERITY_INFO, "WCmdProcess_ComPortDisableTunnel");
     *pAnsNb_UL = 0;
 
+    // No parameter: stop every tunnel - 1 parameter: stop the tunnel of this port
+    if (ParamNb_UL == 0) {
+        SerialManager_StopTunnel();
+    }
+    else {
+        if (!SerialManager_StopTunnel((unsigned long)pParam_UB[0]))
+            return WCMD_FCT_STS_BAD_DATA;
+    }
+
+    return WCMD_FCT_STS_OK;
+}
+
+
+WCMD_FCT_STS WCmdProcess_ComPortGetTunnelStats(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL) {
+    DBG_PRINTLN(DEBUG_SEVERITY_INFO, "WCmdProcess_ComPortGetTunnelStats");
+    *pAnsNb_UL = 0;
+    SERIAL_MANAGER_TUNNEL_STATS_STRUCT Stats_X;
+
+    if (ParamNb_UL != 1)
+        return WCMD_FCT_STS_BAD_PARAM_NB;
+
+    // Param[0] = One of the COM ports of the tunnel
+    if (!SerialManager_GetTunnelStats((unsigned long)pParam_UB[0], &Stats_X))
+        return WCMD_FCT_STS_BAD_DATA;
+
+    // Answer = Bytes A->B - Bytes B->A - Overruns A->B - Overruns B->A (LSB first)
+    unsigned long pValue_UL[4] = { Stats_X.pByteNb_UL[0], Stats_X.pByteNb_UL[1], Stats_X.pOverrunNb_UL[0], Stats_X.pOverrunNb_UL[1] };
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++)
+            pAns_UB[(i * 4) + j] = (unsigned char)(pValue_UL[i] >> (j * 8));
+    }
+    *pAnsNb_UL = 16;
+
+    return WCMD_FCT_STS_OK;
+}
+
+
+WCMD_FCT_STS WCmdProcess_ComPortEnableBridge(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL) {
+    DBG_PRINTLN(DEBUG_SEVERITY_INFO, "WCmdProcess_ComPortEnableBridge");
+    *pAnsNb_UL = 0;
+    SERIAL_BRIDGE_CONFIG_STRUCT Config_X;
+
+    // Param = Port COM - Mode - Local port (2) - Idle time [ms] (2) - Size threshold (2) - Use delimiter - Delimiter
+    //         [- Remote IP (4) - Remote port (2)] for UDP - multi-byte values LSB first
+    if ((ParamNb_UL != 10) && (ParamNb_UL != 16))
+        return WCMD_FCT_STS_BAD_PARAM_NB;
+
+    if ((pParam_UB[0] >= 4) || (pParam_UB[1] > SERIAL_BRIDGE_MODE_UDP))
+        return WCMD_FCT_STS_BAD_DATA;
+
+    // A tunneled port cannot be bridged
+    if (SerialManager_IsTunnelPort((unsigned long)pParam_UB[0]))
+        return WCMD_FCT_STS_ERROR;
+
+    Config_X.ComPort_UL = (unsigned long)pParam_UB[0];
+    Config_X.Mode_E = (SERIAL_BRIDGE_MODE_ENUM)(pParam_UB[1]);
+    Config_X.LocalPort_UI = (pParam_UB[3] << 8) + pParam_UB[2];
+    Config_X.IdleTime_UL = (pParam_UB[5] << 8) + pParam_UB[4];
+    Config_X.SizeThreshold_UI = (pParam_UB[7] << 8) + pParam_UB[6];
+    Config_X.UseDelimiter_B = (pParam_UB[8] != 0) ? true : false;
+    Config_X.Delimiter_UB = pParam_UB[9];
+
+    if (ParamNb_UL == 16) {
+        Config_X.RemoteIp_X = IPAddress(pParam_UB[10], pParam_UB[11], pParam_UB[12], pParam_UB[13]);
+        Config_X.RemotePort_UI = (pParam_UB[15] << 8) + pParam_UB[14];
+    }
+    else {
+        Config_X.RemoteIp_X = IPAddress(0, 0, 0, 0);
+        Config_X.RemotePort_UI = 0;
+    }
+
+    // Call low-level function
+    if (!SerialBridgeManager_Start(&Config_X))
+        return WCMD_FCT_STS_ERROR;
+
+    return WCMD_FCT_STS_OK;
+}
+
+
+WCMD_FCT_STS WCmdProcess_ComPortDisableBridge(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL) {
+    DBG_PRINTLN(DEBUG_SEVERITY_INFO, "WCmdProcess_ComPortDisableBridge");
+    *pAnsNb_UL = 0;
+
     // Call low-level function
-    SerialManager_StopTunnel();    
+    SerialBridgeManager_Stop();
+
+    return WCMD_FCT_STS_OK;
+}
+
+
+WCMD_FCT_STS WCmdProcess_ComPortGetBridgeStats(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL) {
+    DBG_PRINTLN(DEBUG_SEVERITY_INFO, "WCmdProcess_ComPortGetBridgeStats");
+    *pAnsNb_UL = 0;
+    SERIAL_BRIDGE_STATS_STRUCT Stats_X;
+
+    if (!SerialBridgeManager_GetStats(&Stats_X))
+        return WCMD_FCT_STS_ERROR;
+
+    // Answer = Bytes COM->Net - Bytes Net->COM - Overruns COM->Net - Overruns Net->COM - Packets sent (LSB first)
+    unsigned long pValue_UL[5] = { Stats_X.pByteNb_UL[0], Stats_X.pByteNb_UL[1], Stats_X.pOverrunNb_UL[0], Stats_X.pOverrunNb_UL[1], Stats_X.PacketNb_UL };
+    for (int i = 0; i < 5; i++) {
+        for (int j = 0; j < 4; j++)
+            pAns_UB[(i * 4) + j] = (unsigned char)(pValue_UL[i] >> (j * 8));
+    }
+    *pAnsNb_UL = 20;
 
     return WCMD_FCT_STS_OK;
 }
 
 
+/* Loop Profiler ****************************************************************** */
+/* ******************************************************************************** */
+WCMD_FCT_STS WCmdProcess_LoopProfilerGetStats(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL) {
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "WCmdProcess_LoopProfilerGetStats");
+	*pAnsNb_UL = 0;
+
+#ifdef APP_USE_LOOP_PROFILER
+	LOOP_PROFILER_STATS_STRUCT Stats_X;
+
+	if (ParamNb_UL != 1)
+		return WCMD_FCT_STS_BAD_PARAM_NB;
+
+	// Param[0] = Probe ID (LOOP_PROFILER_ID_ENUM)
+	if (!LoopProfiler_GetStats((LOOP_PROFILER_ID_ENUM)(pParam_UB[0]), &Stats_X))
+		return WCMD_FCT_STS_BAD_DATA;
+
+	// Answer = Count - Min - Avg - Max - P99 [us] (LSB first) - Worst State
+	unsigned long pValue_UL[5] = { Stats_X.Count_UL, Stats_X.MinTime_UL, Stats_X.AvgTime_UL, Stats_X.MaxTime_UL, Stats_X.P99Time_UL };
+	for (int i = 0; i < 5; i++) {
+		for (int j = 0; j < 4; j++)
+			pAns_UB[(i * 4) + j] = (unsigned char)(pValue_UL[i] >> (j * 8));
+	}
+	pAns_UB[20] = Stats_X.WorstState_UB;
+	*pAnsNb_UL = 21;
+
+	return WCMD_FCT_STS_OK;
+#else
+	return WCMD_FCT_STS_ERROR;	// Loop Profiler compiled out
+#endif
+}
+
+WCMD_FCT_STS WCmdProcess_LoopProfilerReset(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL) {
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "WCmdProcess_LoopProfilerReset");
+	*pAnsNb_UL = 0;
+
+#ifdef APP_USE_LOOP_PROFILER
+	LoopProfiler_Reset();
+	return WCMD_FCT_STS_OK;
+#else
+	return WCMD_FCT_STS_ERROR;	// Loop Profiler compiled out
+#endif
+}
+
+
+/* Boot Report ******************************************************************** */
+/* ******************************************************************************** */
+WCMD_FCT_STS WCmdProcess_BootReportGet(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL) {
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "WCmdProcess_BootReportGet");
+	unsigned long Time_UL;
+
+	// Answer = Time of each stage [ms since reset] (LSB first) - BOOT_REPORT_NOT_REACHED if not reached yet
+	for (int i = 0; i < BOOT_REPORT_STAGE_NB; i++) {
+		Time_UL = BootReport_GetTime((BOOT_REPORT_STAGE_ENUM)(i));
+		for (int j = 0; j < 4; j++)
+			pAns_UB[(i * 4) + j] = (unsigned char)(Time_UL >> (j * 8));
+	}
+	*pAnsNb_UL = BOOT_REPORT_STAGE_NB * 4;
+
+	return WCMD_FCT_STS_OK;
+}
+
+
 /* Test *************************************************************************** */
 /* ******************************************************************************** */
 WCMD_FCT_STS WCmdProcess_TestCommand(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL) {
@@ -561,3 +877,23 @@ WCMD_FCT_STS WCmdProcess_TestCommand(const unsigned char * pParam_UB, unsigned l
 	return WCMD_FCT_STS_OK;
 }
 
+
+/* ******************************************************************************** */
+/* Internal Functions
+/* ******************************************************************************** */
+
+// Optional parameter : index of the Indicator (first Indicator if omitted)
+Indicator * GetIndicator(const unsigned char * pParam_UB, unsigned long ParamNb_UL) {
+	unsigned char Idx_UB = 0;
+
+	if (ParamNb_UL > 1)
+		return NULL;
+
+	if (ParamNb_UL == 1)
+		Idx_UB = pParam_UB[0];
+
+	if ((Idx_UB >= INDICATOR_MANAGER_MAX_NB) || !(GL_GlobalData_X.pIndicator_H[Idx_UB].isInitialized()))
+		return NULL;
+
+	return &(GL_GlobalData_X.pIndicator_H[Idx_UB]);
+}
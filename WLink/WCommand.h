@@ -8,6 +8,10 @@
 /*                                                                                  */
 /* History :	14/05/2016	(RW)	Creation of this file                           */
 /*				08/10/2016	(RW)	Update WCMD_FCT_STS enumeration					*/
+/*				18/10/2026	(RW)	Add Loop Profiler commands						*/
+/*				18/10/2026	(RW)	Add metadata to the function descriptors		*/
+/*				18/10/2026	(RW)	Add WCMD_SET_FRAMING							*/
+/*				18/10/2026	(RW)	Add WCMD_BOOT_REPORT_GET						*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -18,12 +22,15 @@
 /* Include
 /* ******************************************************************************** */
 
+#include <Arduino.h>
+
 /* ******************************************************************************** */
 /* Define
 /* ******************************************************************************** */
 
 #define WCMD_UNKNOWN						0x7F
 #define WCMD_GET_REVISION_ID				0x00
+#define WCMD_SET_FRAMING					0x0F
 #define WCMD_GPIO_READ						0x01
 #define WCMD_GPIO_WRITE						0x02
 #define WCMD_GPIO_SET_BIT					0x03
@@ -32,6 +39,11 @@
 #define WCMD_INDICATOR_GET_WEIGHT_ALIBI		0x12
 #define WCMD_INDICATOR_SET_ZERO				0x13
 #define WCMD_INDICATOR_GET_WEIGHT_ASCII		0x14
+#define WCMD_INDICATOR_SET_TIMING			0x15
+#define WCMD_INDICATOR_GET_TIMING			0x16
+#define WCMD_INDICATOR_SUBSCRIBE			0x17
+#define WCMD_INDICATOR_UNSUBSCRIBE			0x18
+#define WCMD_INDICATOR_WEIGHT_EVENT			0x19	// Pushed by W-Link (see WeightStream.h)
 #define WCMD_BADGE_READER_GET_ID			0x21
 #define WCMD_LCD_WRITE						0x30
 #define WCMD_LCD_READ						0x31
@@ -50,8 +62,27 @@
 #define WCMD_COMPORT_WRITE					0x52
 #define WCMD_COMPORT_ENABLE_TUNNEL          0x55
 #define WCMD_COMPORT_DISABLE_TUNNEL         0x56
+#define WCMD_COMPORT_GET_TUNNEL_STATS		0x57
+#define WCMD_COMPORT_ENABLE_BRIDGE			0x58
+#define WCMD_COMPORT_DISABLE_BRIDGE			0x59
+#define WCMD_COMPORT_GET_BRIDGE_STATS		0x5A
+#define WCMD_LOOP_PROFILER_GET_STATS		0x60
+#define WCMD_LOOP_PROFILER_RESET			0x61
+#define WCMD_BOOT_REPORT_GET				0x62
 #define WCMD_TEST_CMD						0x70
 
+#define WCMD_CMD_NB							128		// Command IDs on 7 bits
+
+#define WCMD_PARAM_NB_ANY					0xFF	// No upper limit on the number of parameters
+#define WCMD_ANS_NB_ANY						0xFF	// Answer up to the size of the frame (255 bytes)
+
+// Mediums allowed for a command (bit = WCMD_MEDIUM_ENUM)
+#define WCMD_MEDIUM_MASK_SERIAL				0x01
+#define WCMD_MEDIUM_MASK_UDP				0x02
+#define WCMD_MEDIUM_MASK_TCP				0x04
+#define WCMD_MEDIUM_MASK_GSM				0x08
+#define WCMD_MEDIUM_MASK_ALL				0x0F
+
 /* ******************************************************************************** */
 /* Structure & Enumeration
 /* ******************************************************************************** */
@@ -68,14 +99,37 @@ typedef enum {
 typedef struct {
 	unsigned char CmdID_UB;
 	WCMD_FCT_STS(*FctHandler)(const unsigned char*, unsigned long, unsigned char*, unsigned long*);
+	unsigned char ParamNbMin_UB;		// Packets out of [Min..Max] are rejected before the call
+	unsigned char ParamNbMax_UB;
+	unsigned char AnsNbMax_UB;			// Larger answer from the handler is reported as error
+	unsigned char MediumMask_UB;		// WCMD_MEDIUM_MASK_xxx
 } WCMD_FCT_DESCR;
 
 
+/* ******************************************************************************** */
+/* Compile-time Checks
+/* ******************************************************************************** */
+
+// True if CmdId_UB is not used by the NbFct_UL first descriptors
+constexpr bool WCmdFctDescr_IsIdFree(const WCMD_FCT_DESCR * pFctDescr_X, unsigned long NbFct_UL, unsigned char CmdId_UB) {
+	return (NbFct_UL == 0) ? true : ((pFctDescr_X[0].CmdID_UB != CmdId_UB) && WCmdFctDescr_IsIdFree(pFctDescr_X + 1, NbFct_UL - 1, CmdId_UB));
+}
+
+// True if every ID is on 7 bits and unique, and every parameter range is valid
+constexpr bool WCmdFctDescr_IsValid(const WCMD_FCT_DESCR * pFctDescr_X, unsigned long NbFct_UL) {
+	return (NbFct_UL == 0) ? true : ((pFctDescr_X[0].CmdID_UB < WCMD_CMD_NB) && (pFctDescr_X[0].FctHandler != NULL) &&
+									 (pFctDescr_X[0].ParamNbMin_UB <= pFctDescr_X[0].ParamNbMax_UB) &&
+									 WCmdFctDescr_IsIdFree(pFctDescr_X + 1, NbFct_UL - 1, pFctDescr_X[0].CmdID_UB) &&
+									 WCmdFctDescr_IsValid(pFctDescr_X + 1, NbFct_UL - 1));
+}
+
+
 /* ******************************************************************************** */
 /* Functions Prototypes
 /* ******************************************************************************** */
 
 WCMD_FCT_STS WCmdProcess_GetRevisionId(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL);
+WCMD_FCT_STS WCmdProcess_SetFraming(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL);
 
 WCMD_FCT_STS WCmdProcess_GpioRead(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL);
 WCMD_FCT_STS WCmdProcess_GpioWrite(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL);
@@ -86,6 +140,10 @@ WCMD_FCT_STS WCmdProcess_IndicatorGetWeight(const unsigned char * pParam_UB, uns
 WCMD_FCT_STS WCmdProcess_IndicatorGetWeightAlibi(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL);
 WCMD_FCT_STS WCmdProcess_IndicatorSetZero(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL);
 WCMD_FCT_STS WCmdProcess_IndicatorGetWeightAscii(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL);
+WCMD_FCT_STS WCmdProcess_IndicatorSetTiming(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL);
+WCMD_FCT_STS WCmdProcess_IndicatorGetTiming(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL);
+WCMD_FCT_STS WCmdProcess_IndicatorSubscribe(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL);
+WCMD_FCT_STS WCmdProcess_IndicatorUnsubscribe(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL);
 
 WCMD_FCT_STS WCmdProcess_BadgeReaderGetBadgeId(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL);
 
@@ -109,6 +167,14 @@ WCMD_FCT_STS WCmdProcess_ComPortClose(const unsigned char * pParam_UB, unsigned
 WCMD_FCT_STS WCmdProcess_ComPortWrite(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL);
 WCMD_FCT_STS WCmdProcess_ComPortEnableTunnel(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL);
 WCMD_FCT_STS WCmdProcess_ComPortDisableTunnel(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL);
+WCMD_FCT_STS WCmdProcess_ComPortGetTunnelStats(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL);
+WCMD_FCT_STS WCmdProcess_ComPortEnableBridge(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL);
+WCMD_FCT_STS WCmdProcess_ComPortDisableBridge(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL);
+WCMD_FCT_STS WCmdProcess_ComPortGetBridgeStats(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL);
+
+WCMD_FCT_STS WCmdProcess_LoopProfilerGetStats(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL);
+WCMD_FCT_STS WCmdProcess_LoopProfilerReset(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL);
+WCMD_FCT_STS WCmdProcess_BootReportGet(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL);
 
 WCMD_FCT_STS WCmdProcess_TestCommand(const unsigned char * pParam_UB, unsigned long ParamNb_UL, unsigned char * pAns_UB, unsigned long * pAnsNb_UL);
 
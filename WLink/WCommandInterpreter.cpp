@@ -11,6 +11,13 @@
 /*									Manage only SendResp and add status byte		*/
 /*				01/01/2016	(RW)	Fix bug : number of bytes in response was not	*/
 /*									sent											*/
+/*				18/10/2026	(RW)	One context per channel (TCP client) served		*/
+/*									in turn - frames gathered in a receive buffer	*/
+/*				18/10/2026	(RW)	Process every complete frame in one pass and	*/
+/*									coalesce the responses - remove delay(1)		*/
+/*				18/10/2026	(RW)	O(1) dispatch - check parameter number, answer	*/
+/*									size and medium from the descriptor				*/
+/*				18/10/2026	(RW)	Add v2 framing negotiated per channel			*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -24,7 +31,9 @@
 #include "WCommandMedium.h"
 #include "WCommandInterpreter.h"
 
+#include "Utilz.h"
 #include "Debug.h"
+#include "LoopProfiler.h"
 
 /* ******************************************************************************** */
 /* Local Variables
@@ -37,12 +46,12 @@ enum WCMD_INTERPRETER_STATE {
 	WCMD_INTERPRETER_STATE_SEND_RESP
 };
 
-static WCMD_INTERPRETER_STATE GL_WCommandInterpreter_CurrentState_E = WCMD_INTERPRETER_STATE::WCMD_INTERPRETER_STATE_IDLE;
-
 static const WCMD_FCT_DESCR * GL_pWCmdFctDescr_X;
 static unsigned long GL_WCmdFctNb_UL;
+static unsigned char GL_pWCmdFctIndex_UB[WCMD_CMD_NB];		// Command ID -> index in GL_pWCmdFctDescr_X
 
 typedef struct {
+	unsigned char Seq_UB;									// V2 only - echoed in the response
 	unsigned char CmdId_UB;
 	boolean HasParam_B;
 	unsigned long ParamNb_UL;
@@ -52,22 +61,49 @@ typedef struct {
 	WCMD_FCT_STS FctSts_E;
 } WCMD_PARAM_STRUCT;
 
-static WCMD_PARAM_STRUCT GL_WCmdParam_X;
+// Parser context of one channel (TCP client)
+typedef struct {
+	WCMD_INTERPRETER_STATE CurrentState_E;
+	unsigned char Channel_UB;
+	unsigned char Framing_UB;								// WCMD_FRAMING_xx
+	unsigned char NextFraming_UB;							// Applied once the response of WCMD_SET_FRAMING is built
+	unsigned long RxNb_UL;
+	unsigned long RxTimer_UL;								// Time of the last received byte
+	unsigned char pRxBuffer_UB[WCMD_RX_BUFFER_SIZE];
+	unsigned long TxNb_UL;
+	unsigned char pTxBuffer_UB[WCMD_TX_BUFFER_SIZE];		// Pending responses
+	WCMD_PARAM_STRUCT Param_X;
+} WCMD_CHANNEL_STRUCT;
+
+static WCMD_CHANNEL_STRUCT GL_pWCmdChannel_X[WCMD_MEDIUM_MAX_CHANNEL_NB];
+static unsigned char GL_WCmdNextChannel_UB = 0;			// First channel served in the next pass (round-robin)
+static WCMD_CHANNEL_STRUCT * GL_pWCmdCurrentChannel_X = NULL;	// Channel being processed
 
 /* ******************************************************************************** */
 /* Prototypes for Internal Functions
 /* ******************************************************************************** */
-static void ProcessIdle(void);
-static void ProcessWaitPacket(void);
-static void ProcessCheckCmd(void);
-static void ProcessProcessCmd(void);
-static void ProcessSendResp(void);
+static void ProcessChannel(WCMD_CHANNEL_STRUCT * pChannel_X);
+
+static void ProcessIdle(WCMD_CHANNEL_STRUCT * pChannel_X);
+static void ProcessWaitPacket(WCMD_CHANNEL_STRUCT * pChannel_X);
+static void ProcessCheckCmd(WCMD_CHANNEL_STRUCT * pChannel_X);
+static void ProcessProcessCmd(WCMD_CHANNEL_STRUCT * pChannel_X);
+static void ProcessSendResp(WCMD_CHANNEL_STRUCT * pChannel_X);
+
+static void TransitionToIdle(WCMD_CHANNEL_STRUCT * pChannel_X);
+static void TransitionToWaitPacket(WCMD_CHANNEL_STRUCT * pChannel_X);
+static void TransitionToCheckCmd(WCMD_CHANNEL_STRUCT * pChannel_X);
+static void TransitionToProcessCmd(WCMD_CHANNEL_STRUCT * pChannel_X);
+static void TransitionToSendResp(WCMD_CHANNEL_STRUCT * pChannel_X);
+
+static unsigned long CheckCmdV1(WCMD_CHANNEL_STRUCT * pChannel_X, unsigned long FrameSize_UL);
+static unsigned long CheckCmdV2(WCMD_CHANNEL_STRUCT * pChannel_X, unsigned long FrameSize_UL);
 
-static void TransitionToIdle(void);
-static void TransitionToWaitPacket(void);
-static void TransitionToCheckCmd(void);
-static void TransitionToProcessCmd(void);
-static void TransitionToSendResp(void);
+static unsigned long GetFrameSize(WCMD_CHANNEL_STRUCT * pChannel_X);
+static void DropUntil(WCMD_CHANNEL_STRUCT * pChannel_X, unsigned char Byte_UB);
+static void ConsumeRxBuffer(WCMD_CHANNEL_STRUCT * pChannel_X, unsigned long Nb_UL);
+static void SendTxBuffer(WCMD_CHANNEL_STRUCT * pChannel_X);
+static void EndOfBatch(WCMD_CHANNEL_STRUCT * pChannel_X);
 
 
 /* ******************************************************************************** */
@@ -77,227 +113,479 @@ static void TransitionToSendResp(void);
 void WCommandInterpreter_Init(const WCMD_FCT_DESCR *pFctDescr_X, unsigned long NbFct_UL) {
 	GL_pWCmdFctDescr_X = pFctDescr_X;
 	GL_WCmdFctNb_UL = NbFct_UL;
+
+	// Build the dispatch table (IDs already checked at compile time for the table of the application)
+	memset(GL_pWCmdFctIndex_UB, WCMD_FCT_INDEX_NONE, WCMD_CMD_NB);
+	for (unsigned long i = 0; (i < NbFct_UL) && (i < WCMD_FCT_INDEX_NONE); i++) {
+		if ((pFctDescr_X[i].CmdID_UB < WCMD_CMD_NB) && (GL_pWCmdFctIndex_UB[pFctDescr_X[i].CmdID_UB] == WCMD_FCT_INDEX_NONE))
+			GL_pWCmdFctIndex_UB[pFctDescr_X[i].CmdID_UB] = (unsigned char)i;
+		else
+			DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "W-Command descriptor ignored (ID duplicated or above 0x7F)");
+	}
+
+	for (unsigned char i = 0; i < WCMD_MEDIUM_MAX_CHANNEL_NB; i++) {
+		GL_pWCmdChannel_X[i].CurrentState_E = WCMD_INTERPRETER_STATE::WCMD_INTERPRETER_STATE_IDLE;
+		GL_pWCmdChannel_X[i].Channel_UB = i;
+		GL_pWCmdChannel_X[i].Framing_UB = WCMD_FRAMING_V1;
+		GL_pWCmdChannel_X[i].NextFraming_UB = WCMD_FRAMING_V1;
+		GL_pWCmdChannel_X[i].RxNb_UL = 0;
+		GL_pWCmdChannel_X[i].TxNb_UL = 0;
+	}
+	GL_WCmdNextChannel_UB = 0;
+
 	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "W-Command Interpreter Initialized");
 }
 
 void WCommandInterpreter_Process() {
-    
-    /* Reset Condition */
-    if (!WCmdMedium_IsRunning() && (GL_WCommandInterpreter_CurrentState_E != WCMD_INTERPRETER_STATE_IDLE))
-        TransitionToIdle();
+	unsigned char ChannelNb_UB = WCmdMedium_GetChannelNb();
 
-    /* State Machine */ 
-	switch (GL_WCommandInterpreter_CurrentState_E) {
-		case WCMD_INTERPRETER_STATE_IDLE :
-			ProcessIdle();
-			break;
+	// Every channel is served once per pass -> a slow client cannot starve the others
+	for (unsigned char i = 0; i < ChannelNb_UB; i++)
+		ProcessChannel(&GL_pWCmdChannel_X[(GL_WCmdNextChannel_UB + i) % ChannelNb_UB]);
+
+	GL_WCmdNextChannel_UB = (GL_WCmdNextChannel_UB + 1) % ChannelNb_UB;
+	GL_pWCmdCurrentChannel_X = NULL;
+}
+
+// Change the framing of the channel being processed - the response of the current command keeps the old one
+boolean WCommandInterpreter_SetFraming(unsigned char Framing_UB) {
+	if ((GL_pWCmdCurrentChannel_X == NULL) || ((Framing_UB != WCMD_FRAMING_V1) && (Framing_UB != WCMD_FRAMING_V2)))
+		return false;
+
+	GL_pWCmdCurrentChannel_X->NextFraming_UB = Framing_UB;
+	return true;
+}
+
+unsigned char WCommandInterpreter_GetFraming(unsigned char Channel_UB) {
+	return ((Channel_UB < WCMD_MEDIUM_MAX_CHANNEL_NB) ? GL_pWCmdChannel_X[Channel_UB].Framing_UB : WCMD_FRAMING_V1);
+}
 
-        case WCMD_INTERPRETER_STATE_WAIT_PACKET :
-            ProcessWaitPacket();
-            break;
+// Build a response frame in pFrame_UB (DataNb_UL + WCMD_MAX_FRAME_OVERHEAD bytes) - return its size
+unsigned long WCommandInterpreter_BuildFrame(unsigned char Framing_UB, unsigned char Seq_UB, unsigned char CmdId_UB, WCMD_FCT_STS FctSts_E, const unsigned char * pData_UB, unsigned long DataNb_UL, unsigned char * pFrame_UB) {
+	unsigned long Offset_UL = 0;
+	unsigned int Crc_UI = 0;
+
+	// Data sent only with a successful status
+	if (FctSts_E != WCMD_FCT_STS_OK)
+		DataNb_UL = 0;
+
+	if (Framing_UB == WCMD_FRAMING_V2) {
+		// SOH - LEN - SEQ - ID - STS - DATA - CRC
+		pFrame_UB[Offset_UL++] = WCMD_V2_SOH;
+		pFrame_UB[Offset_UL++] = (unsigned char)(DataNb_UL + 3);
+		pFrame_UB[Offset_UL++] = (unsigned char)((DataNb_UL + 3) >> 8);
+		pFrame_UB[Offset_UL++] = Seq_UB;
+		pFrame_UB[Offset_UL++] = CmdId_UB;
+		pFrame_UB[Offset_UL++] = FctSts_E;
+		for (unsigned long i = 0; i < DataNb_UL; i++)
+			pFrame_UB[Offset_UL++] = pData_UB[i];
+
+		Crc_UI = Crc16(&(pFrame_UB[1]), Offset_UL - 1);
+		pFrame_UB[Offset_UL++] = (unsigned char)Crc_UI;
+		pFrame_UB[Offset_UL++] = (unsigned char)(Crc_UI >> 8);
+
+		return Offset_UL;
+	}
 
-		case WCMD_INTERPRETER_STATE_CHECK_CMD :
-			ProcessCheckCmd();
-			break;
+	// Start Of Transmit
+	pFrame_UB[Offset_UL++] = WCMD_STX;
 
-		case WCMD_INTERPRETER_STATE_PROCESS_CMD :
-			ProcessProcessCmd();
-			break;
+	if (FctSts_E == WCMD_FCT_STS_OK) {
 
-		case WCMD_INTERPRETER_STATE_SEND_RESP :
-			ProcessSendResp();
-			break;
+		if (DataNb_UL == 0) {
+			// Command ID
+			pFrame_UB[Offset_UL++] = CmdId_UB;
+			// Status Byte
+			pFrame_UB[Offset_UL++] = FctSts_E;
+		}
+		else {
+			// Command ID
+			pFrame_UB[Offset_UL++] = CmdId_UB | WCMD_PARAM_BIT_MASK;
+			// Status Byte
+			pFrame_UB[Offset_UL++] = FctSts_E;
+			// Data
+			pFrame_UB[Offset_UL++] = (unsigned char)DataNb_UL;
+			for (unsigned long i = 0; i < DataNb_UL; i++)
+				pFrame_UB[Offset_UL++] = pData_UB[i];
+		}
+
+		// Acknowledge
+		pFrame_UB[Offset_UL++] = WCMD_ACK;
+	}
+	else {
+
+		// Command ID
+		pFrame_UB[Offset_UL++] = CmdId_UB;
+
+		// Status Byte
+		pFrame_UB[Offset_UL++] = FctSts_E;
 
+		// Not Acknowledge
+		pFrame_UB[Offset_UL++] = WCMD_NACK;
 	}
+
+	// End Of Transmit
+	pFrame_UB[Offset_UL++] = WCMD_ETX;
+
+	return Offset_UL;
 }
 
 /* ******************************************************************************** */
 /* Internal Functions
 /* ******************************************************************************** */
 
-void ProcessIdle(void) {
-	if (WCmdMedium_IsRunning())
-		TransitionToWaitPacket();
+void ProcessChannel(WCMD_CHANNEL_STRUCT * pChannel_X) {
+	WCmdMedium_SelectChannel(pChannel_X->Channel_UB);
+	GL_pWCmdCurrentChannel_X = pChannel_X;
+
+    /* Reset Condition */
+    if (!WCmdMedium_IsChannelConnected() && (pChannel_X->CurrentState_E != WCMD_INTERPRETER_STATE_IDLE))
+        TransitionToIdle(pChannel_X);
+
+    /* State Machine */ 
+	// Frames already received are processed in the same pass (until back to IDLE or WAIT PACKET)
+	do {
+	    LOOP_PROFILER_SET_STATE(LOOP_PROFILER_ID_WCMD_INTERPRETER, pChannel_X->CurrentState_E);
+		switch (pChannel_X->CurrentState_E) {
+			case WCMD_INTERPRETER_STATE_IDLE :
+				ProcessIdle(pChannel_X);
+				break;
+
+	        case WCMD_INTERPRETER_STATE_WAIT_PACKET :
+	            ProcessWaitPacket(pChannel_X);
+	            break;
+
+			case WCMD_INTERPRETER_STATE_CHECK_CMD :
+				ProcessCheckCmd(pChannel_X);
+				break;
+
+			case WCMD_INTERPRETER_STATE_PROCESS_CMD :
+				ProcessProcessCmd(pChannel_X);
+				break;
+
+			case WCMD_INTERPRETER_STATE_SEND_RESP :
+				ProcessSendResp(pChannel_X);
+				break;
+
+		}
+	} while ((pChannel_X->CurrentState_E != WCMD_INTERPRETER_STATE_IDLE) && (pChannel_X->CurrentState_E != WCMD_INTERPRETER_STATE_WAIT_PACKET));
 }
 
-void ProcessWaitPacket(void) {
-    if (WCmdMedium_IsPacketReceived())
-        TransitionToCheckCmd();
+void ProcessIdle(WCMD_CHANNEL_STRUCT * pChannel_X) {
+	if (WCmdMedium_IsChannelConnected())
+		TransitionToWaitPacket(pChannel_X);
 }
 
-void ProcessCheckCmd(void) {
-	boolean FoundStx_B = false;
-	unsigned char Temp_UB = 0x00;
+void ProcessWaitPacket(WCMD_CHANNEL_STRUCT * pChannel_X) {
+	unsigned long Nb_UL = 0;
+
+	// Gather the bytes of the channel until a complete frame is received
+	Nb_UL = WCmdMedium_Receive(&(pChannel_X->pRxBuffer_UB[pChannel_X->RxNb_UL]), WCMD_RX_BUFFER_SIZE - pChannel_X->RxNb_UL);
+	if (Nb_UL != 0) {
+		pChannel_X->RxNb_UL += Nb_UL;
+		pChannel_X->RxTimer_UL = millis();
+	}
 
-	while (WCmdMedium_DataAvailable()) {
-		// Look for the Start Of Transmit byte
-		if (WCmdMedium_ReadByte() == WCMD_STX) {
-			FoundStx_B = true;
-			DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Found STX");
-			break;
+	if (GetFrameSize(pChannel_X) != 0) {
+		TransitionToCheckCmd(pChannel_X);
+	}
+	else if (pChannel_X->RxNb_UL != 0) {
+		// The end of a frame never comes within a new packet or after the timeout
+		if ((WCmdMedium_IsPacketBased() && (WCmdMedium_DataAvailable() == 0)) || ((millis() - pChannel_X->RxTimer_UL) >= WCMD_FRAME_TIMEOUT)) {
+			DBG_PRINT(DEBUG_SEVERITY_WARNING, "Incomplete frame dropped [");
+			DBG_PRINTDATA(pChannel_X->RxNb_UL);
+			DBG_PRINTDATA(" byte(s)]");
+			DBG_ENDSTR();
+			pChannel_X->RxNb_UL = 0;
 		}
 	}
+}
+
+void ProcessCheckCmd(WCMD_CHANNEL_STRUCT * pChannel_X) {
+	unsigned long FrameSize_UL = GetFrameSize(pChannel_X);	// Frame starts with STX (V1) or SOH (V2)
+
+	if (FrameSize_UL == 0) {
+		EndOfBatch(pChannel_X);
+		return;
+	}
 
-	if (FoundStx_B && (WCmdMedium_DataAvailable() > 0)) {
+	if (pChannel_X->Framing_UB == WCMD_FRAMING_V2)
+		ConsumeRxBuffer(pChannel_X, CheckCmdV2(pChannel_X, FrameSize_UL));
+	else
+		ConsumeRxBuffer(pChannel_X, CheckCmdV1(pChannel_X, FrameSize_UL));
+}
+
+void ProcessProcessCmd(WCMD_CHANNEL_STRUCT * pChannel_X) {
+	WCMD_PARAM_STRUCT * pParam_X = &(pChannel_X->Param_X);
+	const WCMD_FCT_DESCR * pFctDescr_X = NULL;
+	unsigned char Index_UB = GL_pWCmdFctIndex_UB[pParam_X->CmdId_UB];
+	pParam_X->FctSts_E = WCMD_FCT_STS_ERROR;
+	pParam_X->AnsNb_UL = 0;
 
-		// Get Command ID and Parameters bit
-		Temp_UB = WCmdMedium_ReadByte();
-		GL_WCmdParam_X.CmdId_UB = Temp_UB & WCMD_CMD_ID_MASK;
-		GL_WCmdParam_X.HasParam_B = ((Temp_UB & WCMD_PARAM_BIT_MASK) == WCMD_PARAM_BIT_MASK) ? true : false;
+	if (Index_UB != WCMD_FCT_INDEX_NONE)
+		pFctDescr_X = &(GL_pWCmdFctDescr_X[Index_UB]);
 
-		DBG_PRINT(DEBUG_SEVERITY_INFO, "Command ID = 0x");
-		DBG_PRINTDATABASE(GL_WCmdParam_X.CmdId_UB, HEX);
+	// Check the command against its descriptor before calling the handler
+	if ((pFctDescr_X == NULL) || ((pFctDescr_X->MediumMask_UB & (0x01 << WCmdMedium_GetMedium())) == 0)) {
+		pParam_X->FctSts_E = WCMD_FCT_STS_UNKNOWN;
+		DBG_PRINT(DEBUG_SEVERITY_WARNING, "Command ID Unknown [0x");
+		DBG_PRINTDATABASE(pParam_X->CmdId_UB, HEX);
+		DBG_PRINTDATA("]");
+		DBG_ENDSTR();
+	}
+	else if ((pParam_X->ParamNb_UL < pFctDescr_X->ParamNbMin_UB) || (pParam_X->ParamNb_UL > pFctDescr_X->ParamNbMax_UB)) {
+		pParam_X->FctSts_E = WCMD_FCT_STS_BAD_PARAM_NB;
+		DBG_PRINT(DEBUG_SEVERITY_WARNING, "Bad Param Number [");
+		DBG_PRINTDATA(pParam_X->ParamNb_UL);
+		DBG_PRINTDATA("]");
 		DBG_ENDSTR();
-		DBG_PRINT(DEBUG_SEVERITY_INFO, "Has Param ? = ");
-		DBG_PRINTDATABASE(GL_WCmdParam_X.HasParam_B, BIN);
+	}
+	else {
+		DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Found Command ID. Call Function...");
+		pParam_X->FctSts_E = pFctDescr_X->FctHandler(pParam_X->pParamBuffer_UB, pParam_X->ParamNb_UL, pParam_X->pAnsBuffer_UB, &(pParam_X->AnsNb_UL));
+		DBG_PRINT(DEBUG_SEVERITY_INFO, "Status = ");
+		DBG_PRINTDATA(pParam_X->FctSts_E);
+		DBG_PRINTDATA(" - Number of Bytes in Answer = ");
+		DBG_PRINTDATA(pParam_X->AnsNb_UL);
 		DBG_ENDSTR();
 
-		// Get Parameters if any
-		if (GL_WCmdParam_X.HasParam_B) {
-			GL_WCmdParam_X.ParamNb_UL = WCmdMedium_ReadByte();
+		// Answer must fit in the frame
+		if ((pParam_X->FctSts_E == WCMD_FCT_STS_OK) && (pParam_X->AnsNb_UL > pFctDescr_X->AnsNbMax_UB)) {
+			DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "Answer larger than declared in descriptor");
+			pParam_X->FctSts_E = WCMD_FCT_STS_ERROR;
+			pParam_X->AnsNb_UL = 0;
+		}
+	}
 
-			DBG_PRINT(DEBUG_SEVERITY_INFO, "Param Number = ");
-			DBG_PRINTDATA(GL_WCmdParam_X.ParamNb_UL);
-			DBG_ENDSTR();
+	// Go to Send Response state
+	TransitionToSendResp(pChannel_X);
+}
 
-            //DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Param List = ");
-            for (int i = 0; i < GL_WCmdParam_X.ParamNb_UL; i++) {
-                //DBG_PRINTDATA(i);
-                //DBG_PRINTDATA(" - ");
-                GL_WCmdParam_X.pParamBuffer_UB[i] = WCmdMedium_ReadByte();
-                //DBG_PRINTDATABASE(GL_WCmdParam_X.pParamBuffer_UB[i], HEX);
-                //DBG_ENDSTR();
-            }
-		}
+void ProcessSendResp(WCMD_CHANNEL_STRUCT * pChannel_X) {
+	WCMD_PARAM_STRUCT * pParam_X = &(pChannel_X->Param_X);
 
-		// Check for End Of Transmit byte
-		if (WCmdMedium_ReadByte() == WCMD_ETX) {
-			DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Found ETX");
-			TransitionToProcessCmd();
-		}
-		else {
-			DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "Do NOT Found ETX");
-			GL_WCmdParam_X.FctSts_E = WCMD_FCT_STS_BAD_PACKET;
-			TransitionToSendResp();
-		}
+	// Response must fit behind the pending responses
+	if ((pChannel_X->TxNb_UL + pParam_X->AnsNb_UL + WCMD_MAX_FRAME_OVERHEAD) > WCMD_TX_BUFFER_SIZE)
+		SendTxBuffer(pChannel_X);
+
+	pChannel_X->TxNb_UL += WCommandInterpreter_BuildFrame(pChannel_X->Framing_UB, pParam_X->Seq_UB, pParam_X->CmdId_UB, pParam_X->FctSts_E, pParam_X->pAnsBuffer_UB, pParam_X->AnsNb_UL, &(pChannel_X->pTxBuffer_UB[pChannel_X->TxNb_UL]));
 
+	// Framing changed by the command
+	if (pChannel_X->NextFraming_UB != pChannel_X->Framing_UB) {
+		pChannel_X->Framing_UB = pChannel_X->NextFraming_UB;
+		DBG_PRINT(DEBUG_SEVERITY_INFO, "Framing V");
+		DBG_PRINTDATA(pChannel_X->Framing_UB);
+		DBG_ENDSTR();
 	}
 
+	// Next frame of the batch or send all the responses
+	if (GetFrameSize(pChannel_X) != 0)
+		TransitionToCheckCmd(pChannel_X);
+	else
+		EndOfBatch(pChannel_X);
 }
 
-void ProcessProcessCmd(void) {
 
-	int i = 0;
-	GL_WCmdParam_X.FctSts_E = WCMD_FCT_STS_ERROR;
+void TransitionToIdle(WCMD_CHANNEL_STRUCT * pChannel_X) {
+	DBG_PRINT(DEBUG_SEVERITY_INFO, "Transition To IDLE [");
+	DBG_PRINTDATA(pChannel_X->Channel_UB);
+	DBG_PRINTDATA("]");
+	DBG_ENDSTR();
+    WCmdMedium_Flush();
+    WCmdMedium_Stop();
+	pChannel_X->RxNb_UL = 0;
+	pChannel_X->TxNb_UL = 0;
 
-	// Look for the command ID in the table of fonction handler
-	for (i = 0; i < GL_WCmdFctNb_UL; i++) {
-		if (GL_pWCmdFctDescr_X[i].CmdID_UB == GL_WCmdParam_X.CmdId_UB) {
-			DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Found Command ID. Call Function...");
-			GL_WCmdParam_X.FctSts_E = GL_pWCmdFctDescr_X[i].FctHandler(GL_WCmdParam_X.pParamBuffer_UB, GL_WCmdParam_X.ParamNb_UL, GL_WCmdParam_X.pAnsBuffer_UB, &(GL_WCmdParam_X.AnsNb_UL));
-			DBG_PRINT(DEBUG_SEVERITY_INFO, "Status = ");
-			DBG_PRINTDATA(GL_WCmdParam_X.FctSts_E);
-			DBG_PRINTDATA(" - Number of Bytes in Answer = ");
-			DBG_PRINTDATA(GL_WCmdParam_X.AnsNb_UL);
-			DBG_ENDSTR();
-			break;
-		}
+	// New client starts with V1 framing
+	if (!WCmdMedium_IsChannelConnected()) {
+		pChannel_X->Framing_UB = WCMD_FRAMING_V1;
+		pChannel_X->NextFraming_UB = WCMD_FRAMING_V1;
 	}
+	pChannel_X->CurrentState_E = WCMD_INTERPRETER_STATE::WCMD_INTERPRETER_STATE_IDLE;
+}
 
-	// Check if the ID has been found and call the appropriate function
-	if (i == GL_WCmdFctNb_UL) {
-		GL_WCmdParam_X.FctSts_E = WCMD_FCT_STS_UNKNOWN;
-		DBG_PRINT(DEBUG_SEVERITY_WARNING, "Command ID Unknown [0x");
-		DBG_PRINTDATABASE(GL_WCmdParam_X.CmdId_UB, HEX);
-		DBG_PRINTDATA("]");
-		DBG_ENDSTR();
-	}
+void TransitionToWaitPacket(WCMD_CHANNEL_STRUCT * pChannel_X) {
+	DBG_PRINT(DEBUG_SEVERITY_INFO, "Transition To WAIT PACKET [");
+	DBG_PRINTDATA(pChannel_X->Channel_UB);
+	DBG_PRINTDATA("]");
+	DBG_ENDSTR();
+    pChannel_X->CurrentState_E = WCMD_INTERPRETER_STATE::WCMD_INTERPRETER_STATE_WAIT_PACKET;
+}
 
-	// Go to Send Response state
-	TransitionToSendResp();
+void TransitionToCheckCmd(WCMD_CHANNEL_STRUCT * pChannel_X) {
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To CHECK CMD");
+	pChannel_X->CurrentState_E = WCMD_INTERPRETER_STATE::WCMD_INTERPRETER_STATE_CHECK_CMD;
 }
 
-void ProcessSendResp(void) {
-	unsigned char pBuffer_UB[WCMD_MAX_ANS_NB];
-	unsigned long Offset_UL = 0;
+void TransitionToProcessCmd(WCMD_CHANNEL_STRUCT * pChannel_X) {
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To PROCESS CMD");
+	pChannel_X->CurrentState_E = WCMD_INTERPRETER_STATE::WCMD_INTERPRETER_STATE_PROCESS_CMD;
+}
 
-	// Start Of Transmit
-	pBuffer_UB[Offset_UL++] = WCMD_STX;
+void TransitionToSendResp(WCMD_CHANNEL_STRUCT * pChannel_X) {
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To SEND RESP");
+	pChannel_X->CurrentState_E = WCMD_INTERPRETER_STATE::WCMD_INTERPRETER_STATE_SEND_RESP;
+}
 
-	if (GL_WCmdParam_X.FctSts_E == WCMD_FCT_STS_OK) {
 
-		if (GL_WCmdParam_X.AnsNb_UL == 0) {
-			// Command ID
-			pBuffer_UB[Offset_UL++] = GL_WCmdParam_X.CmdId_UB;
-			// Status Byte
-			pBuffer_UB[Offset_UL++] = GL_WCmdParam_X.FctSts_E;
-		}
-		else {
-			// Command ID
-			pBuffer_UB[Offset_UL++] = GL_WCmdParam_X.CmdId_UB | WCMD_PARAM_BIT_MASK;
-			// Status Byte
-			pBuffer_UB[Offset_UL++] = GL_WCmdParam_X.FctSts_E;
-			// Data
-			pBuffer_UB[Offset_UL++] = (unsigned char)GL_WCmdParam_X.AnsNb_UL;
-			for (int i = 0; i < GL_WCmdParam_X.AnsNb_UL; i++)
-				pBuffer_UB[Offset_UL++] = GL_WCmdParam_X.pAnsBuffer_UB[i];
-		}
+unsigned long CheckCmdV1(WCMD_CHANNEL_STRUCT * pChannel_X, unsigned long FrameSize_UL) {
+	WCMD_PARAM_STRUCT * pParam_X = &(pChannel_X->Param_X);
+	unsigned char Temp_UB = 0x00;
 
-		// Acknowledge
-		pBuffer_UB[Offset_UL++] = WCMD_ACK;
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Found STX");
+
+	// Get Command ID and Parameters bit
+	Temp_UB = pChannel_X->pRxBuffer_UB[1];
+	pParam_X->CmdId_UB = Temp_UB & WCMD_CMD_ID_MASK;
+	pParam_X->HasParam_B = ((Temp_UB & WCMD_PARAM_BIT_MASK) == WCMD_PARAM_BIT_MASK) ? true : false;
+	pParam_X->ParamNb_UL = 0;
+	pParam_X->Seq_UB = 0;
+
+	DBG_PRINT(DEBUG_SEVERITY_INFO, "Command ID = 0x");
+	DBG_PRINTDATABASE(pParam_X->CmdId_UB, HEX);
+	DBG_ENDSTR();
+	DBG_PRINT(DEBUG_SEVERITY_INFO, "Has Param ? = ");
+	DBG_PRINTDATABASE(pParam_X->HasParam_B, BIN);
+	DBG_ENDSTR();
+
+	// Get Parameters if any
+	if (pParam_X->HasParam_B) {
+		pParam_X->ParamNb_UL = pChannel_X->pRxBuffer_UB[2];
+
+		DBG_PRINT(DEBUG_SEVERITY_INFO, "Param Number = ");
+		DBG_PRINTDATA(pParam_X->ParamNb_UL);
+		DBG_ENDSTR();
+
+		memcpy(pParam_X->pParamBuffer_UB, &(pChannel_X->pRxBuffer_UB[3]), pParam_X->ParamNb_UL);
+	}
+
+	// Check for End Of Transmit byte
+	if (pChannel_X->pRxBuffer_UB[FrameSize_UL - 1] == WCMD_ETX) {
+		DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Found ETX");
+		TransitionToProcessCmd(pChannel_X);
 	}
 	else {
+		DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "Do NOT Found ETX");
+		pParam_X->FctSts_E = WCMD_FCT_STS_BAD_PACKET;
+		TransitionToSendResp(pChannel_X);
+	}
 
-		// Command ID
-		pBuffer_UB[Offset_UL++] = GL_WCmdParam_X.CmdId_UB;
+	return FrameSize_UL;
+}
 
-		// Status Byte
-		pBuffer_UB[Offset_UL++] = GL_WCmdParam_X.FctSts_E;
+unsigned long CheckCmdV2(WCMD_CHANNEL_STRUCT * pChannel_X, unsigned long FrameSize_UL) {
+	WCMD_PARAM_STRUCT * pParam_X = &(pChannel_X->Param_X);
+	unsigned char * pFrame_UB = pChannel_X->pRxBuffer_UB;
+	unsigned int Crc_UI = pFrame_UB[FrameSize_UL - 2] + (pFrame_UB[FrameSize_UL - 1] << 8);
 
-		// Not Acknowledge
-		pBuffer_UB[Offset_UL++] = WCMD_NACK;
-	}
+	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Found SOH");
 
-	// End Of Transmit
-	pBuffer_UB[Offset_UL++] = WCMD_ETX;
+	pParam_X->Seq_UB = pFrame_UB[3];
 
-	// Send Response
-	WCmdMedium_BeginPacket();
-	WCmdMedium_Write(pBuffer_UB, Offset_UL);
-	WCmdMedium_EndPacket();
-	delay(1);
+	// Corrupted frame : answer at once so that the master can retry, and resynchronize on the next SOH
+	if (Crc16(&(pFrame_UB[1]), FrameSize_UL - WCMD_V2_CRC_SIZE - 1) != Crc_UI) {
+		DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "Bad CRC");
+		pParam_X->CmdId_UB = WCMD_UNKNOWN;
+		pParam_X->FctSts_E = WCMD_FCT_STS_BAD_PACKET;
+		TransitionToSendResp(pChannel_X);
+		return 1;
+	}
 
-    // Manage Transition
-    if (WCmdMedium_IsMonoClient())
-        TransitionToWaitPacket();       // Wait for next command
-    else
-        TransitionToIdle();             // Restart medium to close current connection
+	// Get Command ID and Parameters
+	pParam_X->CmdId_UB = pFrame_UB[4] & WCMD_CMD_ID_MASK;
+	pParam_X->ParamNb_UL = FrameSize_UL - WCMD_V2_HEADER_SIZE - WCMD_V2_MIN_LEN - WCMD_V2_CRC_SIZE;
+	pParam_X->HasParam_B = (pParam_X->ParamNb_UL != 0);
+	memcpy(pParam_X->pParamBuffer_UB, &(pFrame_UB[5]), pParam_X->ParamNb_UL);
+
+	DBG_PRINT(DEBUG_SEVERITY_INFO, "Command ID = 0x");
+	DBG_PRINTDATABASE(pParam_X->CmdId_UB, HEX);
+	DBG_PRINTDATA(" - Seq = ");
+	DBG_PRINTDATA(pParam_X->Seq_UB);
+	DBG_PRINTDATA(" - Param Number = ");
+	DBG_PRINTDATA(pParam_X->ParamNb_UL);
+	DBG_ENDSTR();
+
+	TransitionToProcessCmd(pChannel_X);
+	return FrameSize_UL;
 }
 
+// Drop the bytes before the start of frame - return the size of the complete frame at the start of the buffer (0 if incomplete)
+unsigned long GetFrameSize(WCMD_CHANNEL_STRUCT * pChannel_X) {
+	unsigned long Size_UL = 0;
 
-void TransitionToIdle(void) {
-	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To IDLE");
-    WCmdMedium_Flush();
-    WCmdMedium_Stop();
-	GL_WCommandInterpreter_CurrentState_E = WCMD_INTERPRETER_STATE::WCMD_INTERPRETER_STATE_IDLE;
+	if (pChannel_X->Framing_UB == WCMD_FRAMING_V2) {
+		while (true) {
+			DropUntil(pChannel_X, WCMD_V2_SOH);
+
+			if (pChannel_X->RxNb_UL < WCMD_V2_HEADER_SIZE)
+				return 0;
+
+			// SOH - LEN - SEQ - ID - PARAM(S) - CRC
+			Size_UL = pChannel_X->pRxBuffer_UB[1] + (pChannel_X->pRxBuffer_UB[2] << 8);
+			if ((Size_UL >= WCMD_V2_MIN_LEN) && (Size_UL <= WCMD_V2_MAX_LEN)) {
+				Size_UL += WCMD_V2_HEADER_SIZE + WCMD_V2_CRC_SIZE;
+				return ((pChannel_X->RxNb_UL >= Size_UL) ? Size_UL : 0);
+			}
+
+			// Not a valid length -> resynchronize on the next SOH
+			ConsumeRxBuffer(pChannel_X, 1);
+		}
+	}
+
+	// Look for the Start Of Transmit byte
+	DropUntil(pChannel_X, WCMD_STX);
+
+	// STX - ID - ETX at least
+	if (pChannel_X->RxNb_UL < 3)
+		return 0;
+
+	// STX - ID - NB - PARAM(S) - ETX
+	if ((pChannel_X->pRxBuffer_UB[1] & WCMD_PARAM_BIT_MASK) == WCMD_PARAM_BIT_MASK)
+		Size_UL = 4 + pChannel_X->pRxBuffer_UB[2];
+	else
+		Size_UL = 3;
+
+	return ((pChannel_X->RxNb_UL >= Size_UL) ? Size_UL : 0);
 }
 
-void TransitionToWaitPacket(void) {
-    DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To WAIT PACKET");
-    GL_WCommandInterpreter_CurrentState_E = WCMD_INTERPRETER_STATE::WCMD_INTERPRETER_STATE_WAIT_PACKET;
+void DropUntil(WCMD_CHANNEL_STRUCT * pChannel_X, unsigned char Byte_UB) {
+	unsigned long Idx_UL = 0;
+
+	while ((Idx_UL < pChannel_X->RxNb_UL) && (pChannel_X->pRxBuffer_UB[Idx_UL] != Byte_UB))
+		Idx_UL++;
+	ConsumeRxBuffer(pChannel_X, Idx_UL);
 }
 
-void TransitionToCheckCmd(void) {
-	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To CHECK CMD");
-	GL_WCommandInterpreter_CurrentState_E = WCMD_INTERPRETER_STATE::WCMD_INTERPRETER_STATE_CHECK_CMD;
+void ConsumeRxBuffer(WCMD_CHANNEL_STRUCT * pChannel_X, unsigned long Nb_UL) {
+	if (Nb_UL == 0)
+		return;
+
+	if (Nb_UL >= pChannel_X->RxNb_UL) {
+		pChannel_X->RxNb_UL = 0;
+	}
+	else {
+		memmove(pChannel_X->pRxBuffer_UB, &(pChannel_X->pRxBuffer_UB[Nb_UL]), pChannel_X->RxNb_UL - Nb_UL);
+		pChannel_X->RxNb_UL -= Nb_UL;
+	}
 }
 
-void TransitionToProcessCmd(void) {
-	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To PROCESS CMD");
-	GL_WCommandInterpreter_CurrentState_E = WCMD_INTERPRETER_STATE::WCMD_INTERPRETER_STATE_PROCESS_CMD;
+void SendTxBuffer(WCMD_CHANNEL_STRUCT * pChannel_X) {
+	if (pChannel_X->TxNb_UL == 0)
+		return;
+
+	WCmdMedium_BeginPacket();
+	WCmdMedium_Write(pChannel_X->pTxBuffer_UB, pChannel_X->TxNb_UL);
+	WCmdMedium_EndPacket();
+	pChannel_X->TxNb_UL = 0;
 }
 
-void TransitionToSendResp(void) {
-	DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To SEND RESP");
-	GL_WCommandInterpreter_CurrentState_E = WCMD_INTERPRETER_STATE::WCMD_INTERPRETER_STATE_SEND_RESP;
+void EndOfBatch(WCMD_CHANNEL_STRUCT * pChannel_X) {
+	// Send Responses
+	SendTxBuffer(pChannel_X);
+
+    // Manage Transition
+    if (WCmdMedium_IsMonoClient())
+        TransitionToWaitPacket(pChannel_X);       // Wait for next command
+    else
+        TransitionToIdle(pChannel_X);             // Restart medium to close current connection
 }
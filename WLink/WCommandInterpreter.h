@@ -8,6 +8,10 @@
 /*                                                                                  */
 /* History :  	16/02/2015  (RW)	Creation of this file							*/
 /*				14/05/2016	(RW)	Re-mastered version	(medium independant)		*/
+/*				18/10/2026	(RW)	One context per channel of the medium			*/
+/*				18/10/2026	(RW)	Responses of a batch gathered in one write		*/
+/*				18/10/2026	(RW)	Dispatch through a table indexed by command ID	*/
+/*				18/10/2026	(RW)	Add v2 framing (length, sequence ID, CRC-16)	*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -19,6 +23,7 @@
 /* ******************************************************************************** */
 
 #include "WCommand.h"
+#include "WCommandMedium.h"
 
 /* ******************************************************************************** */
 /* Define
@@ -35,6 +40,24 @@
 #define WCMD_MAX_PARAM_NB	256
 #define WCMD_MAX_ANS_NB		256
 
+// Framing of the commands - V2 negotiated with WCMD_SET_FRAMING
+#define WCMD_FRAMING_V1		1		// STX - ID|PARAM BIT - [NB - PARAM(S)] - ETX
+#define WCMD_FRAMING_V2		2		// SOH - LEN (2 bytes) - SEQ - ID - PARAM(S) - CRC-16 (2 bytes)
+
+#define WCMD_V2_SOH			0x01
+#define WCMD_V2_HEADER_SIZE	3		// SOH - LEN (LSB first)
+#define WCMD_V2_CRC_SIZE	2		// CRC-16/MODBUS of LEN to the last parameter (LSB first)
+#define WCMD_V2_MIN_LEN		2		// SEQ - ID
+#define WCMD_V2_MAX_LEN		257		// SEQ - ID - 255 parameters
+
+#define WCMD_MAX_FRAME_OVERHEAD	8	// Size of a response frame without its data (V2 : SOH - LEN - SEQ - ID - STS - CRC)
+
+#define WCMD_RX_BUFFER_SIZE	512		// Receive buffer of each channel - holds at least one frame of 255 parameters
+#define WCMD_FRAME_TIMEOUT	500		// [ms] Incomplete frame dropped after this delay without new byte
+#define WCMD_TX_BUFFER_SIZE	1024	// Responses of the frames received together, sent in one write/datagram
+
+#define WCMD_FCT_INDEX_NONE	0xFF	// No descriptor for this command ID
+
 /* ******************************************************************************** */
 /* Structure & Enumeration
 /* ******************************************************************************** */
@@ -45,5 +68,9 @@
 void WCommandInterpreter_Init(const WCMD_FCT_DESCR *pFctDescr_X, unsigned long NbFct_UL);
 void WCommandInterpreter_Process();
 
+boolean WCommandInterpreter_SetFraming(unsigned char Framing_UB);
+unsigned char WCommandInterpreter_GetFraming(unsigned char Channel_UB);
+unsigned long WCommandInterpreter_BuildFrame(unsigned char Framing_UB, unsigned char Seq_UB, unsigned char CmdId_UB, WCMD_FCT_STS FctSts_E, const unsigned char * pData_UB, unsigned long DataNb_UL, unsigned char * pFrame_UB);
+
 
 #endif // __WCOMMAND_INTERPRETER_H__
\ No newline at end of file
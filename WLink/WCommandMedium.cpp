@@ -8,6 +8,10 @@
 /*                                                                                  */
 /* History :  	26/05/2015  (RW)	Creation of this file                           */
 /*              01/03/2017  (RW)    Add GSM as possible medium                      */
+/*              18/10/2026  (RW)    Add endpoint functions to push data             */
+/*              18/10/2026  (RW)    One channel per TCP client                      */
+/*              18/10/2026  (RW)    Add WCmdMedium_GetMedium                        */
+/*              18/10/2026  (RW)    Implement GSM medium (GSM Server)               */
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -25,6 +29,8 @@
 #include "UDPServerManager.h"
 #include "TCPServer.h"
 #include "TCPServerManager.h"
+#include "GSMServer.h"
+#include "GSMServerManager.h"
 
 #include "Debug.h"
 
@@ -36,10 +42,12 @@ static WCMD_MEDIUM_ENUM GL_Medium_E;
 static HardwareSerial * GL_pMediumSerial_H;
 static UDPServer * GL_pMediumUdpServer_H;
 static TCPServer * GL_pMediumTcpServer_H;
+static GSMServer * GL_pMediumGsmServer_H;
 
 static const String GL_pMediumLut_cstr[] = {"Serial", "UDP", "TCP", "GSM"};
 
 static boolean GL_IsMonoClient_B = false;
+static unsigned char GL_Channel_UB = 0;		// Channel used by the functions below (TCP client)
 
 /* ******************************************************************************** */
 /* Functions
@@ -61,7 +69,7 @@ void WCmdMedium_Init(WCMD_MEDIUM_ENUM WCmdMedium_E, void * pMedium_H, boolean is
 			break;
 
         case WCMD_MEDIUM_GSM:
-            // TODO : not yet implemented
+            GL_pMediumGsmServer_H = (GSMServer *)pMedium_H;
             break;
 	}
 
@@ -75,6 +83,10 @@ void WCmdMedium_Init(WCMD_MEDIUM_ENUM WCmdMedium_E, void * pMedium_H, boolean is
 /* ******************************************************************************** */
 /* Functions - Exported
 /* ******************************************************************************** */
+WCMD_MEDIUM_ENUM WCmdMedium_GetMedium(void) {
+    return GL_Medium_E;
+}
+
 boolean WCmdMedium_IsMonoClient(void) {
     return GL_IsMonoClient_B;
 }
@@ -96,13 +108,76 @@ boolean WCmdMedium_IsRunning(void) {
 		break;
 
     case WCMD_MEDIUM_GSM:
-        // TODO : not yet implemented
+        RetVal_B = GSMServerManager_IsRunning();
         break;
 	}
 
 	return RetVal_B;
 }
 
+// Frames cannot span several packets
+boolean WCmdMedium_IsPacketBased(void) {
+	return ((GL_Medium_E == WCMD_MEDIUM_UDP) ? true : false);
+}
+
+unsigned char WCmdMedium_GetChannelNb(void) {
+	return ((GL_Medium_E == WCMD_MEDIUM_TCP) ? TCP_SERVER_MAX_CLIENT_NB : 1);
+}
+
+void WCmdMedium_SelectChannel(unsigned char Channel_UB) {
+	GL_Channel_UB = (Channel_UB < WCmdMedium_GetChannelNb()) ? Channel_UB : 0;
+}
+
+boolean WCmdMedium_IsChannelConnected(void) {
+	if (!WCmdMedium_IsRunning())
+		return false;
+
+	if (GL_Medium_E == WCMD_MEDIUM_TCP)
+		return GL_pMediumTcpServer_H->isClientConnected(GL_Channel_UB);
+
+	if (GL_Medium_E == WCMD_MEDIUM_GSM)
+		return GL_pMediumGsmServer_H->isClientConnected();
+
+	return true;
+}
+
+// Read all the data available on the channel (up to MaxNb_UL) - return the number of bytes read
+unsigned long WCmdMedium_Receive(unsigned char * pBuffer_UB, unsigned long MaxNb_UL) {
+	unsigned long Nb_UL = 0;
+	int Read_SI = 0;
+
+	if (MaxNb_UL == 0)
+		return 0;
+
+	switch (GL_Medium_E) {
+	case WCMD_MEDIUM_SERIAL:
+		while ((Nb_UL < MaxNb_UL) && GL_pMediumSerial_H->available())
+			pBuffer_UB[Nb_UL++] = GL_pMediumSerial_H->read();
+		break;
+
+	case WCMD_MEDIUM_UDP:
+		if (GL_pMediumUdpServer_H->getServer()->available() == 0)
+			GL_pMediumUdpServer_H->getServer()->parsePacket();		// Next datagram
+		if (GL_pMediumUdpServer_H->getServer()->available() > 0)
+			Read_SI = GL_pMediumUdpServer_H->getServer()->read(pBuffer_UB, MaxNb_UL);
+		break;
+
+	case WCMD_MEDIUM_TCP:
+		if (GL_pMediumTcpServer_H->hasClient(GL_Channel_UB) && (GL_pMediumTcpServer_H->getClient(GL_Channel_UB)->available() > 0))
+			Read_SI = GL_pMediumTcpServer_H->getClient(GL_Channel_UB)->read(pBuffer_UB, MaxNb_UL);
+		break;
+
+	case WCMD_MEDIUM_GSM:
+		Read_SI = GL_pMediumGsmServer_H->read(pBuffer_UB, MaxNb_UL);
+		break;
+	}
+
+	if (Read_SI > 0)
+		Nb_UL = (unsigned long)(Read_SI);
+
+	return Nb_UL;
+}
+
 boolean WCmdMedium_IsPacketReceived(void) {
     boolean RetVal_B = false;
 
@@ -118,12 +193,13 @@ boolean WCmdMedium_IsPacketReceived(void) {
         break;
 
     case WCMD_MEDIUM_TCP:
-        if (GL_pMediumTcpServer_H->getClient()->available())
+        if (GL_pMediumTcpServer_H->getClient(GL_Channel_UB)->available())
             RetVal_B = true;
         break;
 
     case WCMD_MEDIUM_GSM:
-        // TODO : not yet implemented
+        if (GL_pMediumGsmServer_H->available())
+            RetVal_B = true;
         break;
     }
 
@@ -143,11 +219,11 @@ int WCmdMedium_DataAvailable(void) {
 		break;
 
 	case WCMD_MEDIUM_TCP:
-        RetVal_SI = GL_pMediumTcpServer_H->getClient()->available();
+        RetVal_SI = GL_pMediumTcpServer_H->getClient(GL_Channel_UB)->available();
 		break;
 
     case WCMD_MEDIUM_GSM:
-        // TODO : not yet implemented
+        RetVal_SI = GL_pMediumGsmServer_H->available();
         break;
 	}
 
@@ -167,11 +243,11 @@ unsigned char WCmdMedium_ReadByte(void) {
 		break;
 
 	case WCMD_MEDIUM_TCP:
-        RetVal_UB = GL_pMediumTcpServer_H->getClient()->read();
+        RetVal_UB = GL_pMediumTcpServer_H->getClient(GL_Channel_UB)->read();
 		break;
 
     case WCMD_MEDIUM_GSM:
-        // TODO : not yet implemented
+        RetVal_UB = GL_pMediumGsmServer_H->read();
         break;
 	}
 
@@ -189,11 +265,11 @@ void WCmdMedium_WriteByte(unsigned char Byte_UB) {
 		break;
 
 	case WCMD_MEDIUM_TCP:
-        GL_pMediumTcpServer_H->getClient()->write(Byte_UB);
+        GL_pMediumTcpServer_H->getClient(GL_Channel_UB)->write(Byte_UB);
 		break;
 
     case WCMD_MEDIUM_GSM:
-        // TODO : not yet implemented
+        GL_pMediumGsmServer_H->write(Byte_UB);
         break;
 	}
 }
@@ -209,11 +285,11 @@ void WCmdMedium_Write(unsigned char * pBuffer_UB, unsigned long NbData_UL) {
 		break;
 
 	case WCMD_MEDIUM_TCP:
-        GL_pMediumTcpServer_H->getClient()->write(pBuffer_UB, NbData_UL);
+        GL_pMediumTcpServer_H->getClient(GL_Channel_UB)->write(pBuffer_UB, NbData_UL);
 		break;
 
     case WCMD_MEDIUM_GSM:
-        // TODO : not yet implemented
+        GL_pMediumGsmServer_H->write(pBuffer_UB, NbData_UL);
         break;
 	}
 }
@@ -229,11 +305,11 @@ void WCmdMedium_Flush(void) {
 		break;
 
 	case WCMD_MEDIUM_TCP:
-        GL_pMediumTcpServer_H->flushClient();
+        GL_pMediumTcpServer_H->flushClient(GL_Channel_UB);
 		break;
 
     case WCMD_MEDIUM_GSM:
-        // TODO : not yet implemented
+        GL_pMediumGsmServer_H->flushClient();
         break;
 	}
 }
@@ -248,11 +324,11 @@ void WCmdMedium_Stop(void) {
 		break;
 
 	case WCMD_MEDIUM_TCP:
-        GL_pMediumTcpServer_H->stopClient();
+        GL_pMediumTcpServer_H->stopClient(GL_Channel_UB);
 		break;
 
-    case WCMD_MEDIUM_GSM:
-        // TODO : not yet implemented
+    case WCMD_MEDIUM_GSM:       // Connection closed once the responses are sent
+        GL_pMediumGsmServer_H->stopClient();
         break;
 	}
 }
@@ -269,8 +345,7 @@ void WCmdMedium_BeginPacket(void) {
 	case WCMD_MEDIUM_TCP:		// Do nothing for TCP
 		break;
 
-    case WCMD_MEDIUM_GSM:
-        // TODO : not yet implemented
+    case WCMD_MEDIUM_GSM:       // Do nothing for GSM
         break;
 	}
 }
@@ -288,8 +363,113 @@ void WCmdMedium_EndPacket(void) {
 	case WCMD_MEDIUM_TCP:		// Do nothing for TCP
 		break;
 
-    case WCMD_MEDIUM_GSM:
-        // TODO : not yet implemented
+    case WCMD_MEDIUM_GSM:       // Data written since the last call sent in one AT+CIPSEND
+        GL_pMediumGsmServer_H->send();
         break;
 	}
 }
+
+
+/* ******************************************************************************** */
+/* Functions - Endpoint
+/* ******************************************************************************** */
+
+// Must be called while the command is processed (remote IP and port of the current UDP packet)
+boolean WCmdMedium_GetEndpoint(WCMD_MEDIUM_ENDPOINT_STRUCT * pEndpoint_X) {
+	boolean RetVal_B = false;
+
+	pEndpoint_X->Medium_E = GL_Medium_E;
+	pEndpoint_X->RemotePort_UI = 0;
+	pEndpoint_X->Channel_UB = GL_Channel_UB;
+	pEndpoint_X->ClientId_UL = 0;
+
+	switch (GL_Medium_E) {
+	case WCMD_MEDIUM_SERIAL:
+		RetVal_B = true;
+		break;
+
+	case WCMD_MEDIUM_UDP:
+		pEndpoint_X->RemoteIp_X = GL_pMediumUdpServer_H->getServer()->remoteIP();
+		pEndpoint_X->RemotePort_UI = GL_pMediumUdpServer_H->getServer()->remotePort();
+		RetVal_B = GL_IsMonoClient_B;	// Socket is closed after each command otherwise
+		break;
+
+	case WCMD_MEDIUM_TCP:
+		pEndpoint_X->ClientId_UL = GL_pMediumTcpServer_H->getClientId(GL_Channel_UB);
+		RetVal_B = GL_IsMonoClient_B;	// Connection is closed after each command otherwise
+		break;
+
+	case WCMD_MEDIUM_GSM:
+		pEndpoint_X->ClientId_UL = GL_pMediumGsmServer_H->getClientId();
+		RetVal_B = GL_IsMonoClient_B;	// Connection is closed after each command otherwise
+		break;
+	}
+
+	return RetVal_B;
+}
+
+boolean WCmdMedium_IsSameEndpoint(const WCMD_MEDIUM_ENDPOINT_STRUCT * pEndpoint1_X, const WCMD_MEDIUM_ENDPOINT_STRUCT * pEndpoint2_X) {
+	if (pEndpoint1_X->Medium_E != pEndpoint2_X->Medium_E)
+		return false;
+
+	if (pEndpoint1_X->Medium_E == WCMD_MEDIUM_UDP)
+		return ((pEndpoint1_X->RemoteIp_X == pEndpoint2_X->RemoteIp_X) && (pEndpoint1_X->RemotePort_UI == pEndpoint2_X->RemotePort_UI));
+
+	if ((pEndpoint1_X->Medium_E == WCMD_MEDIUM_TCP) || (pEndpoint1_X->Medium_E == WCMD_MEDIUM_GSM))
+		return ((pEndpoint1_X->ClientId_UL == pEndpoint2_X->ClientId_UL) ? true : false);
+
+	return true;	// Only one client for Serial
+}
+
+boolean WCmdMedium_IsEndpointConnected(const WCMD_MEDIUM_ENDPOINT_STRUCT * pEndpoint_X) {
+	boolean RetVal_B = false;
+
+	if ((pEndpoint_X->Medium_E != GL_Medium_E) || !WCmdMedium_IsRunning())
+		return false;
+
+	switch (GL_Medium_E) {
+	case WCMD_MEDIUM_SERIAL:
+	case WCMD_MEDIUM_UDP:
+		RetVal_B = true;
+		break;
+
+	case WCMD_MEDIUM_TCP:
+		// Same connection still on the slot ?
+		RetVal_B = (GL_pMediumTcpServer_H->isClientConnected(pEndpoint_X->Channel_UB) && (GL_pMediumTcpServer_H->getClientId(pEndpoint_X->Channel_UB) == pEndpoint_X->ClientId_UL));
+		break;
+
+	case WCMD_MEDIUM_GSM:
+		// Same connection still open ?
+		RetVal_B = (GL_pMediumGsmServer_H->isClientConnected() && (GL_pMediumGsmServer_H->getClientId() == pEndpoint_X->ClientId_UL));
+		break;
+	}
+
+	return RetVal_B;
+}
+
+void WCmdMedium_WriteEndpoint(const WCMD_MEDIUM_ENDPOINT_STRUCT * pEndpoint_X, unsigned char * pBuffer_UB, unsigned long NbData_UL) {
+	if (!WCmdMedium_IsEndpointConnected(pEndpoint_X))
+		return;
+
+	switch (GL_Medium_E) {
+	case WCMD_MEDIUM_SERIAL:
+		GL_pMediumSerial_H->write(pBuffer_UB, NbData_UL);
+		GL_pMediumSerial_H->println();
+		break;
+
+	case WCMD_MEDIUM_UDP:
+		GL_pMediumUdpServer_H->getServer()->beginPacket(pEndpoint_X->RemoteIp_X, pEndpoint_X->RemotePort_UI);
+		GL_pMediumUdpServer_H->getServer()->write(pBuffer_UB, NbData_UL);
+		GL_pMediumUdpServer_H->getServer()->endPacket();
+		break;
+
+	case WCMD_MEDIUM_TCP:
+		GL_pMediumTcpServer_H->getClient(pEndpoint_X->Channel_UB)->write(pBuffer_UB, NbData_UL);
+		break;
+
+	case WCMD_MEDIUM_GSM:
+		GL_pMediumGsmServer_H->write(pBuffer_UB, NbData_UL);
+		GL_pMediumGsmServer_H->send();
+		break;
+	}
+}
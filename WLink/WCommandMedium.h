@@ -8,6 +8,9 @@
 /*                                                                                  */
 /* History :	14/05/2016	(RW)	Creation of this file                           */
 /*              01/03/2017  (RW)    Add GSM as possible medium                      */
+/*              18/10/2026  (RW)    Add endpoint functions to push data             */
+/*              18/10/2026  (RW)    One channel per TCP client                      */
+/*              18/10/2026  (RW)    Implement GSM medium (GSM Server)               */
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -19,10 +22,13 @@
 /* ******************************************************************************** */
 
 #include <Arduino.h>
+#include "Ethernet.h"
+#include "TCPServer.h"
 
 /* ******************************************************************************** */
 /* Define
 /* ******************************************************************************** */
+#define WCMD_MEDIUM_MAX_CHANNEL_NB		TCP_SERVER_MAX_CLIENT_NB	// One channel (RX + TX buffers, about 2 KB) per TCP client - only one for the other media
 
 /* ******************************************************************************** */
 /* Structure & Enumeration
@@ -35,6 +41,15 @@ typedef enum {
     WCMD_MEDIUM_GSM
 } WCMD_MEDIUM_ENUM;
 
+// Remote side of the command being processed - used to push data without request
+typedef struct {
+	WCMD_MEDIUM_ENUM Medium_E;
+	IPAddress RemoteIp_X;			// UDP only
+	unsigned int RemotePort_UI;		// UDP only
+	unsigned char Channel_UB;		// TCP only
+	unsigned long ClientId_UL;		// TCP and GSM only
+} WCMD_MEDIUM_ENDPOINT_STRUCT;
+
 
 /* ******************************************************************************** */
 /* Functions Prototypes - Configuration
@@ -45,8 +60,16 @@ void WCmdMedium_Init(WCMD_MEDIUM_ENUM WCmdMedium_E, void * pMedium_H, boolean is
 /* ******************************************************************************** */
 /* Functions Prototypes - Exported
 /* ******************************************************************************** */
+WCMD_MEDIUM_ENUM WCmdMedium_GetMedium(void);
 boolean WCmdMedium_IsMonoClient(void);
 boolean WCmdMedium_IsRunning(void);
+boolean WCmdMedium_IsPacketBased(void);
+
+unsigned char WCmdMedium_GetChannelNb(void);
+void WCmdMedium_SelectChannel(unsigned char Channel_UB);
+boolean WCmdMedium_IsChannelConnected(void);
+unsigned long WCmdMedium_Receive(unsigned char * pBuffer_UB, unsigned long MaxNb_UL);
+
 boolean WCmdMedium_IsPacketReceived(void);
 int WCmdMedium_DataAvailable(void);
 unsigned char WCmdMedium_ReadByte(void);
@@ -57,5 +80,10 @@ void WCmdMedium_Stop(void);
 void WCmdMedium_BeginPacket(void);
 void WCmdMedium_EndPacket(void);
 
+boolean WCmdMedium_GetEndpoint(WCMD_MEDIUM_ENDPOINT_STRUCT * pEndpoint_X);
+boolean WCmdMedium_IsSameEndpoint(const WCMD_MEDIUM_ENDPOINT_STRUCT * pEndpoint1_X, const WCMD_MEDIUM_ENDPOINT_STRUCT * pEndpoint2_X);
+boolean WCmdMedium_IsEndpointConnected(const WCMD_MEDIUM_ENDPOINT_STRUCT * pEndpoint_X);
+void WCmdMedium_WriteEndpoint(const WCMD_MEDIUM_ENDPOINT_STRUCT * pEndpoint_X, unsigned char * pBuffer_UB, unsigned long NbData_UL);
+
 
 #endif // __WCOMMAND_MEDIUM_H__
\ No newline at end of file
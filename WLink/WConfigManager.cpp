@@ -6,6 +6,13 @@
 /*		Describes the state machine to manage the W-Link configuration    			*/
 /*                                                                                  */
 /* History :  	25/02/2017  (RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Add timings of the Indicators					*/
+/*				18/10/2026	(RW)	Add GSM Server as W-Command medium				*/
+/*				18/10/2026	(RW)	Init the Serial Bridge with Ethernet			*/
+/*				18/10/2026	(RW)	Static IP as DHCP fallback						*/
+/*				18/10/2026	(RW)	Publish the end of configuration				*/
+/*				18/10/2026	(RW)	Single read of a versioned configuration image	*/
+/*				18/10/2026	(RW)	Non-blocking forcing input - Indicators first	*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -28,6 +35,7 @@
 #include "CommEvent.h"
 
 #include "WConfigManager.h"
+#include "BootReport.h"
 #include "SerialHandler.h"
 
 #include "WCommand.h"
@@ -45,6 +53,9 @@
 #define WCONFIG_CONFIG_TAG0             0xAA
 #define WCONFIG_CONFIG_TAG1             0x55
 
+#define WCONFIG_CHECK_PIN_SAMPLE_NB         5
+#define WCONFIG_CHECK_PIN_SAMPLE_PERIOD_MS  10          // Forcing input sampled without blocking the main loop
+
     
 #define WCONFIG_ADDR_CONFIG_TAG         0x0000
 #define WCONFIG_ADDR_BOARD_REV          0x0002
@@ -60,6 +71,62 @@
 #define WCONFIG_ADDR_TCP_CLIENT         0x003C
 #define WCONFIG_ADDR_FONA_MODULE        0x0040
 #define WCONFIG_ADDR_INDICATOR          0x0050
+#define WCONFIG_ADDR_INDICATOR_TIMING   0x0060      // 8 bytes per Indicator (see WConfig_SetIndicatorTiming)
+#define WCONFIG_ADDR_IMAGE_VERSION      0x0080
+#define WCONFIG_ADDR_IMAGE_CRC          0x0082      // CRC16 (LSB first) of the image up to this field
+
+#define WCONFIG_IMAGE_VERSION           1           // Version 0 = same blocks without version nor CRC
+#define WCONFIG_IMAGE_VERSION_NONE      0xFF        // Erased EEPROM -> version 0
+
+
+/* ******************************************************************************** */
+/* Configuration Image
+/* ******************************************************************************** */
+// EEPROM content from WCONFIG_ADDR_CONFIG_TAG, read at once
+typedef struct __attribute__((packed)) {
+    unsigned char pTag_UB[2];
+    unsigned char pBoardRev_UB[2];
+    unsigned char Language_UB;
+    unsigned char App_UB;
+    unsigned char Gen_UB;
+    unsigned char WCmdMedium_UB;
+    unsigned char pIo_UB[8];
+    unsigned char pCom_UB[12];
+    unsigned char pEth_UB[24];
+    unsigned char pTcpServer_UB[4];
+    unsigned char pUdpServer_UB[4];
+    unsigned char pTcpClient_UB[4];
+    unsigned char pFonaModule_UB[16];
+    unsigned char pIndicator_UB[16];
+    unsigned char pIndicatorTiming_UB[32];
+    unsigned char Version_UB;
+    unsigned char Reserved_UB;
+    unsigned char pCrc_UB[2];
+} WCONFIG_IMAGE_STRUCT;
+
+#define WCONFIG_CHECK_IMAGE_FIELD(Field, Addr)  static_assert((WCONFIG_ADDR_CONFIG_TAG + offsetof(WCONFIG_IMAGE_STRUCT, Field)) == (Addr), "Configuration image : " #Field " is not at " #Addr)
+
+WCONFIG_CHECK_IMAGE_FIELD(pTag_UB, WCONFIG_ADDR_CONFIG_TAG);
+WCONFIG_CHECK_IMAGE_FIELD(pBoardRev_UB, WCONFIG_ADDR_BOARD_REV);
+WCONFIG_CHECK_IMAGE_FIELD(Language_UB, WCONFIG_ADDR_LANGUAGE);
+WCONFIG_CHECK_IMAGE_FIELD(App_UB, WCONFIG_ADDR_APP);
+WCONFIG_CHECK_IMAGE_FIELD(Gen_UB, WCONFIG_ADDR_GEN);
+WCONFIG_CHECK_IMAGE_FIELD(WCmdMedium_UB, WCONFIG_ADDR_WCMD_MEDIUM);
+WCONFIG_CHECK_IMAGE_FIELD(pIo_UB, WCONFIG_ADDR_IO);
+WCONFIG_CHECK_IMAGE_FIELD(pCom_UB, WCONFIG_ADDR_COM);
+WCONFIG_CHECK_IMAGE_FIELD(pEth_UB, WCONFIG_ADDR_ETH);
+WCONFIG_CHECK_IMAGE_FIELD(pTcpServer_UB, WCONFIG_ADDR_TCP_SERVER);
+WCONFIG_CHECK_IMAGE_FIELD(pUdpServer_UB, WCONFIG_ADDR_UDP_SERVER);
+WCONFIG_CHECK_IMAGE_FIELD(pTcpClient_UB, WCONFIG_ADDR_TCP_CLIENT);
+WCONFIG_CHECK_IMAGE_FIELD(pFonaModule_UB, WCONFIG_ADDR_FONA_MODULE);
+WCONFIG_CHECK_IMAGE_FIELD(pIndicator_UB, WCONFIG_ADDR_INDICATOR);
+WCONFIG_CHECK_IMAGE_FIELD(pIndicatorTiming_UB, WCONFIG_ADDR_INDICATOR_TIMING);
+WCONFIG_CHECK_IMAGE_FIELD(Version_UB, WCONFIG_ADDR_IMAGE_VERSION);
+WCONFIG_CHECK_IMAGE_FIELD(pCrc_UB, WCONFIG_ADDR_IMAGE_CRC);
+static_assert(sizeof(((WCONFIG_IMAGE_STRUCT *)0)->pIndicatorTiming_UB) == (INDICATOR_MANAGER_MAX_NB * 8), "Configuration image : 8 timing bytes per Indicator");
+static_assert((WCONFIG_ADDR_CONFIG_TAG + sizeof(WCONFIG_IMAGE_STRUCT)) <= KC_WORKING_AREA_OFFSET, "Configuration image : overlaps the KipControl working area");
+
+typedef void(*WCONFIG_MIGRATION_FCT)(WCONFIG_IMAGE_STRUCT * pImage_X);
 
 
 /* ******************************************************************************** */
@@ -169,19 +236,19 @@ enum WCFG_STATE {
     WCFG_INIT_EEPROM,
     WCFG_INIT_RTC,
     WCFG_CHECK_PIN,
-    WCFG_CHECK_TAG,
+    WCFG_LOAD_IMAGE,
     WCFG_GET_BOARD_REVISION,
     WCFG_GET_LANGUAGE,
     WCFG_GET_GEN_CONFIG,
     WCFG_GET_WCMD_MEDIUM,
     WCFG_GET_IO_CONFIG,
     WCFG_GET_COM_CONFIG,
+    WCFG_GET_INDICATOR_CONFIG,
     WCFG_GET_ETH_CONFIG,
     WCFG_GET_TCP_SERVER_CONFIG,
     WCFG_GET_UDP_SERVER_CONFIG,
     WCFG_GET_TCP_CLIENT_CONFIG,
     WCFG_GET_FONA_MODULE_CONFIG,
-    WCFG_GET_INDICATOR_CONFIG,
 	WCFG_GET_APP_CONFIG,
     WCFG_CONFIG_DONE,
     WCFG_ERROR_READING,
@@ -196,6 +263,14 @@ static WCFG_STATUS GL_WConfigStatus_E = WCFG_STS_ERROR;
 
 static unsigned char GL_pWConfigBuffer_UB[WCONFIG_PARAMETER_BUFFER_SIZE];
 
+static unsigned long GL_WConfigPinTime_UL = 0;
+static unsigned char GL_WConfigPinSampleNb_UB = 0;
+static int GL_WConfigPinValue_SI = 0;
+
+static WCONFIG_IMAGE_STRUCT GL_WConfigImage_X;
+static boolean GL_WConfigImageLoaded_B = false;
+static boolean GL_WConfigImageLost_B = false;      // Part of the image not written : left unsealed until it is written again
+
 
 /* ******************************************************************************** */
 /* Prototypes for Internal Functions
@@ -205,6 +280,17 @@ static void TransitionToErrorReading(void);
 static void TransitionToBadParam(void);
 static void TransitionToErrorInit(void);
 
+static void DecodeIndicatorTiming(int Idx_SI, const unsigned char * pTiming_UB);
+
+static boolean CheckImage(void);
+static void SealImage(void);
+static unsigned long ReadImage(unsigned int Addr_UW, unsigned char * pData_UB, unsigned long Size_UL);
+static void WriteImage(unsigned int Addr_UW, const unsigned char * pData_UB, unsigned long Size_UL);
+static void MigrateFromVersion0(WCONFIG_IMAGE_STRUCT * pImage_X);
+
+// Index = version to migrate from
+static const WCONFIG_MIGRATION_FCT GL_pWConfigMigration_X[WCONFIG_IMAGE_VERSION] = { MigrateFromVersion0 };
+
 
 /* ******************************************************************************** */
 /* Functions
@@ -265,6 +351,7 @@ WCFG_STATUS WConfigManager_Process() {
         GL_GlobalData_X.Eeprom_H.init(&Wire1, 0x50);
 
         if (GL_GlobalData_X.Eeprom_H.isInitialized()) {
+            BootReport_Mark(BOOT_REPORT_STAGE_EEPROM);
             DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To INIT RTC");
             GL_WConfigManager_CurrentState_E = WCFG_STATE::WCFG_INIT_RTC;
         }
@@ -289,8 +376,12 @@ WCFG_STATUS WConfigManager_Process() {
 			DBG_PRINT(DEBUG_SEVERITY_INFO, "Actual time : ");
 			DBG_PRINTDATA(GL_GlobalData_X.Rtc_H.getDateTimeString());
 			DBG_ENDSTR();
+            BootReport_Mark(BOOT_REPORT_STAGE_RTC);
 
-            DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To CHECK TAG");
+            DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Get Forcing input status");
+            GL_WConfigPinSampleNb_UB = 0;
+            GL_WConfigPinTime_UL = millis();
+            DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To CHECK PIN");
             GL_WConfigManager_CurrentState_E = WCFG_STATE::WCFG_CHECK_PIN;
         }
         else {
@@ -301,24 +392,26 @@ WCFG_STATUS WConfigManager_Process() {
         break;
 
     /* CHECK PIN */
-    /* > Check if pin is low to enable or not configuration with EEPROM. */
+    /* > Check if pin is low to enable or not configuration with EEPROM. The last sample is kept. */
     case WCFG_CHECK_PIN:
 
-        DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Get Forcing input status");
-        static int ForcingInput_SI = analogRead(PIN_ANALOG_IN0);
-        for (int i = 0; i < 5; i++) {
-            ForcingInput_SI = analogRead(PIN_ANALOG_IN0);
-            delay(500);
-        }
+        if ((millis() - GL_WConfigPinTime_UL) < WCONFIG_CHECK_PIN_SAMPLE_PERIOD_MS)
+            break;
+
+        GL_WConfigPinTime_UL = millis();
+        GL_WConfigPinValue_SI = analogRead(PIN_ANALOG_IN0);
+        if (++GL_WConfigPinSampleNb_UB < WCONFIG_CHECK_PIN_SAMPLE_NB)
+            break;
 
         DBG_PRINT(DEBUG_SEVERITY_INFO, "> Value = ");
-        DBG_PRINTDATA(ForcingInput_SI);
+        DBG_PRINTDATA(GL_WConfigPinValue_SI);
         DBG_ENDSTR();
+        BootReport_Mark(BOOT_REPORT_STAGE_CHECK_PIN);
 
-        if (ForcingInput_SI > 100) {
+        if (GL_WConfigPinValue_SI > 100) {
             DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Configuration enabled by pin");
-            DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To CHECK TAG");
-            GL_WConfigManager_CurrentState_E = WCFG_STATE::WCFG_CHECK_TAG;
+            DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To LOAD IMAGE");
+            GL_WConfigManager_CurrentState_E = WCFG_STATE::WCFG_LOAD_IMAGE;
         }
         else {
             DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Configuration not enabled by pin");
@@ -328,16 +421,25 @@ WCFG_STATUS WConfigManager_Process() {
         break;
 
 
-    /* CHECK TAG */
-    /* > Check if EEPROM has been configured or not thanks to the configuration tag. */
-    case WCFG_CHECK_TAG:
+    /* LOAD IMAGE */
+    /* > Read the whole configuration at once. Check if EEPROM has been configured thanks to the configuration tag, */
+    /*   then check the version and the CRC of the image. The next states decode the image from RAM.             */
+    case WCFG_LOAD_IMAGE:
         
-        DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Retreive configuration tag");
-        if (GL_GlobalData_X.Eeprom_H.read(WCONFIG_ADDR_CONFIG_TAG, GL_pWConfigBuffer_UB, 2) == 2) {
-            if ((GL_pWConfigBuffer_UB[0] == WCONFIG_CONFIG_TAG0) && (GL_pWConfigBuffer_UB[1] == WCONFIG_CONFIG_TAG1)) {
+        DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Retreive configuration image");
+        GL_WConfigImageLoaded_B = false;
+        if (GL_GlobalData_X.Eeprom_H.read(WCONFIG_ADDR_CONFIG_TAG, (unsigned char *)&GL_WConfigImage_X, sizeof(WCONFIG_IMAGE_STRUCT)) == sizeof(WCONFIG_IMAGE_STRUCT)) {
+            if ((GL_WConfigImage_X.pTag_UB[0] == WCONFIG_CONFIG_TAG0) && (GL_WConfigImage_X.pTag_UB[1] == WCONFIG_CONFIG_TAG1)) {
                 DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Configuration tag ok!");
-                DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To GET BOARD REVISION");
-                GL_WConfigManager_CurrentState_E = WCFG_STATE::WCFG_GET_BOARD_REVISION;
+                if (CheckImage()) {
+                    GL_WConfigImageLoaded_B = true;
+                    BootReport_Mark(BOOT_REPORT_STAGE_LOAD_IMAGE);
+                    DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To GET BOARD REVISION");
+                    GL_WConfigManager_CurrentState_E = WCFG_STATE::WCFG_GET_BOARD_REVISION;
+                }
+                else {
+                    TransitionToBadParam();
+                }
             }
             else {
                 DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "Error in configuration tag (no tag or bad tag)");
@@ -356,7 +458,7 @@ WCFG_STATUS WConfigManager_Process() {
     case WCFG_GET_BOARD_REVISION:
 
         DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Retreive board revision");
-        if (GL_GlobalData_X.Eeprom_H.read(WCONFIG_ADDR_BOARD_REV, GL_pWConfigBuffer_UB, 2) == 2) {
+        if (ReadImage(WCONFIG_ADDR_BOARD_REV, GL_pWConfigBuffer_UB, 2) == 2) {
 
             GL_GlobalConfig_X.MajorRev_UB = GL_pWConfigBuffer_UB[0];
             GL_GlobalConfig_X.MinorRev_UB = GL_pWConfigBuffer_UB[1];
@@ -381,7 +483,7 @@ WCFG_STATUS WConfigManager_Process() {
     case WCFG_GET_LANGUAGE:
 
         DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Retreive language settings");
-        if (GL_GlobalData_X.Eeprom_H.read(WCONFIG_ADDR_LANGUAGE, GL_pWConfigBuffer_UB, 1) == 1) {
+        if (ReadImage(WCONFIG_ADDR_LANGUAGE, GL_pWConfigBuffer_UB, 1) == 1) {
 
             if ((GL_pWConfigBuffer_UB[0] & 0x0F) < 3) {
                 GL_GlobalConfig_X.Language_E = (WLINK_LANGUAGE_ENUM)GL_pWConfigBuffer_UB[0];
@@ -415,7 +517,7 @@ WCFG_STATUS WConfigManager_Process() {
     case WCFG_GET_GEN_CONFIG:
 
         DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Retreive general configuration");
-        if (GL_GlobalData_X.Eeprom_H.read(WCONFIG_ADDR_GEN, GL_pWConfigBuffer_UB, 1) == 1) {
+        if (ReadImage(WCONFIG_ADDR_GEN, GL_pWConfigBuffer_UB, 1) == 1) {
 
             DBG_PRINTLN(DEBUG_SEVERITY_INFO, "General configuration :");
 
@@ -509,6 +611,7 @@ WCFG_STATUS WConfigManager_Process() {
             }
             else {
                 DBG_PRINTLN(DEBUG_SEVERITY_INFO, "End of general configuration");
+                BootReport_Mark(BOOT_REPORT_STAGE_GEN_CONFIG);
 
                 DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To GET WCMD MEDIUM");
                 GL_WConfigManager_CurrentState_E = WCFG_STATE::WCFG_GET_WCMD_MEDIUM;
@@ -526,7 +629,7 @@ WCFG_STATUS WConfigManager_Process() {
     case WCFG_GET_WCMD_MEDIUM:
 
         DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Retreive WCommand Medium");
-        if (GL_GlobalData_X.Eeprom_H.read(WCONFIG_ADDR_WCMD_MEDIUM, GL_pWConfigBuffer_UB, 1) == 1) {
+        if (ReadImage(WCONFIG_ADDR_WCMD_MEDIUM, GL_pWConfigBuffer_UB, 1) == 1) {
 
             if ((GL_pWConfigBuffer_UB[0] & 0x0F) < 8) {
                 GL_GlobalConfig_X.WCmdConfig_X.Medium_E = (WLINK_WCMD_MEDIUM_ENUM)(GL_pWConfigBuffer_UB[0] & 0x0F);
@@ -553,7 +656,7 @@ WCFG_STATUS WConfigManager_Process() {
                 case WLINK_WCMD_MEDIUM_COM3:        WCmdMedium_Init(WCMD_MEDIUM_SERIAL, GetSerialHandle(3), GL_GlobalConfig_X.WCmdConfig_X.isMonoClient_B);                    break;
                 case WLINK_WCMD_MEDIUM_UDP_SERVER:  WCmdMedium_Init(WCMD_MEDIUM_UDP, &(GL_GlobalData_X.EthAP_X.UdpServer_H), GL_GlobalConfig_X.WCmdConfig_X.isMonoClient_B);   break;
                 case WLINK_WCMD_MEDIUM_TCP_SERVER:  WCmdMedium_Init(WCMD_MEDIUM_TCP, &(GL_GlobalData_X.EthAP_X.TcpServer_H), GL_GlobalConfig_X.WCmdConfig_X.isMonoClient_B);   break;
-                case WLINK_WCMD_MEDIUM_GSM_SERVER:  WCmdMedium_Init(WCMD_MEDIUM_GSM, &(GL_GlobalData_X.EthAP_X.GsmServer_H), GL_GlobalConfig_X.WCmdConfig_X.isMonoClient_B);   break;      // TODO : to modify once the GSMServer Object will be created
+                case WLINK_WCMD_MEDIUM_GSM_SERVER:  WCmdMedium_Init(WCMD_MEDIUM_GSM, &(GL_GlobalData_X.EthAP_X.GsmServer_H), GL_GlobalConfig_X.WCmdConfig_X.isMonoClient_B);   break;      // GSM Server initialized with the FONA Module
                 }       
 
                 WCommandInterpreter_Init(GL_GlobalConfig_X.WCmdConfig_X.pFctDescr_X, GL_GlobalConfig_X.WCmdConfig_X.NbFct_UL);
@@ -587,7 +690,7 @@ WCFG_STATUS WConfigManager_Process() {
     case WCFG_GET_IO_CONFIG:
 
         DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Retreive digital I/O's configuration");
-        if (GL_GlobalData_X.Eeprom_H.read(WCONFIG_ADDR_IO, GL_pWConfigBuffer_UB, 8) == 8) {
+        if (ReadImage(WCONFIG_ADDR_IO, GL_pWConfigBuffer_UB, 8) == 8) {
 
             int i = 0;
 
@@ -649,7 +752,7 @@ WCFG_STATUS WConfigManager_Process() {
     case WCFG_GET_COM_CONFIG:
 
         DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Retreive serial COM port configuration");
-        if (GL_GlobalData_X.Eeprom_H.read(WCONFIG_ADDR_COM, GL_pWConfigBuffer_UB, 12) == 12) {
+        if (ReadImage(WCONFIG_ADDR_COM, GL_pWConfigBuffer_UB, 12) == 12) {
         
             DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Configure COM Ports:");
             for (int i = 0; i < 4; i++) {
@@ -745,9 +848,11 @@ WCFG_STATUS WConfigManager_Process() {
             }
             else {
                 DBG_PRINTLN(DEBUG_SEVERITY_INFO, "End of COM Ports configuration");
+                BootReport_Mark(BOOT_REPORT_STAGE_COM_CONFIG);
 
-                DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To GET ETH CONFIG");
-                GL_WConfigManager_CurrentState_E = WCFG_STATE::WCFG_GET_ETH_CONFIG;
+                // Indicators first : served by WLinkManager while the other devices are configured
+                DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To GET INDICATOR CONFIG");
+                GL_WConfigManager_CurrentState_E = WCFG_STATE::WCFG_GET_INDICATOR_CONFIG;
             }
         }
         else {
@@ -757,12 +862,179 @@ WCFG_STATUS WConfigManager_Process() {
         break;
 
 
+    /* GET INDICATOR CONFIG */
+    /* > Retreive Indicator configuration */
+    case WCFG_GET_INDICATOR_CONFIG:
+
+        DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Retreive Indicators configuration");
+        if ((ReadImage(WCONFIG_ADDR_INDICATOR, GL_pWConfigBuffer_UB, 16) == 16) &&
+			(ReadImage(WCONFIG_ADDR_INDICATOR_TIMING, &GL_pWConfigBuffer_UB[16], 32) == 32)) {
+
+			// Initialize Interface if at least one Indicator is enabled
+			for (int i = 0; i < 4; i++) {
+				if ((GL_pWConfigBuffer_UB[i * 4] & 0x01) == 0x01) {
+					IndicatorInterface_Init();
+					break;
+				}
+			}
+
+			// Configure the 4 possible Indicators
+			for (int i = 0; i < 4; i++) {
+
+				DBG_PRINT(DEBUG_SEVERITY_INFO, "- Configure Indicator ");
+				DBG_PRINTDATA(i);
+				DBG_PRINTDATA(": ");
+
+				if ((GL_pWConfigBuffer_UB[i * 4] & 0x01) == 0x01) {
+					DBG_PRINTDATA("Enabled");
+					DBG_ENDSTR();
+					GL_GlobalConfig_X.pIndicatorConfig_X[i].IsEnabled_B = true;
+
+					// Get COM Port Index
+					if ((GL_pWConfigBuffer_UB[i * 4 + 3] & 0x03) <= 0x03) {						
+						DBG_PRINT(DEBUG_SEVERITY_INFO, "    > COM Port index = COM");
+						DBG_PRINTDATA((GL_pWConfigBuffer_UB[i * 4 + 3] & 0x03));
+						DBG_ENDSTR();
+						GL_GlobalConfig_X.pIndicatorConfig_X[i].ComPortIdx_UB = (GL_pWConfigBuffer_UB[i * 4 + 3] & 0x03);
+					}
+					else {
+						DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "    > Wrong COM Port index, use COM1 !");
+						GL_GlobalConfig_X.pIndicatorConfig_X[i].ComPortIdx_UB = PORT_COM1;
+					}
+
+					// Get Interface Type
+					if (GL_pWConfigBuffer_UB[i * 4 + 1] < INDICATOR_INTERFACE_DEVICES_NUM) {
+						DBG_PRINT(DEBUG_SEVERITY_INFO, "    > Interface Type = ");
+						DBG_PRINTDATA(pIndicatorInterfaceDeviceLut_Str[GL_pWConfigBuffer_UB[i * 4 + 1]]);
+						DBG_ENDSTR();
+						GL_GlobalConfig_X.pIndicatorConfig_X[i].InterfaceType_E = (INDICATOR_INTERFACE_DEVICES_ENUM)(GL_pWConfigBuffer_UB[i * 4 + 1]);
+					}
+					else {
+						DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "    > Wrong Interface Type, use ");
+						DBG_PRINTDATA(pIndicatorInterfaceDeviceLut_Str[0]);
+						DBG_PRINTDATA(" !");
+						DBG_ENDSTR();
+						GL_GlobalConfig_X.pIndicatorConfig_X[i].InterfaceType_E = INDICATOR_INTERFACE_DEVICES_ENUM::INDICATOR_LD5218;
+					}
+
+                    // Get Frame Type
+                    if (((GL_pWConfigBuffer_UB[i * 4 + 2]) & 0x0F) < INDICATOR_INTERFACE_FRAME_NUM) {
+                        DBG_PRINT(DEBUG_SEVERITY_INFO, "    > Frame Type = ");
+                        DBG_PRINTDATA(pIndicatorInterfaceFrameLut_Str[((GL_pWConfigBuffer_UB[i * 4 + 2]) & 0x0F)]);
+                        DBG_ENDSTR();
+                        GL_GlobalConfig_X.pIndicatorConfig_X[i].InterfaceFrame_E = (INDICATOR_INTERFACE_FRAME_ENUM)((GL_pWConfigBuffer_UB[i * 4 + 2]) & 0x0F);
+                    }
+                    else {
+                        DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "    > Wrong Frame Type, use ");
+                        DBG_PRINTDATA(pIndicatorInterfaceFrameLut_Str[0]);
+                        DBG_PRINTDATA(" !");
+                        DBG_ENDSTR();
+                        GL_GlobalConfig_X.pIndicatorConfig_X[i].InterfaceFrame_E = INDICATOR_INTERFACE_FRAME_ENUM::INDICATOR_INTERFACE_FRAME_ASK_WEIGHT;
+                    }
+
+					// Check IRQ
+					if ((GL_pWConfigBuffer_UB[i * 4] & 0x02) == 0x02) {
+						DBG_PRINTLN(DEBUG_SEVERITY_INFO, "    > Has IRQ");
+						GL_GlobalConfig_X.pIndicatorConfig_X[i].HasIrq_B = true;
+					}
+					else {
+						DBG_PRINTLN(DEBUG_SEVERITY_INFO, "    > No IRQ Handling");
+						GL_GlobalConfig_X.pIndicatorConfig_X[i].HasIrq_B = false;
+					}
+
+					// Check Echo
+					if ((GL_pWConfigBuffer_UB[i * 4] & 0x04) == 0x04) {
+						DBG_PRINTLN(DEBUG_SEVERITY_INFO, "    > Has Echo");
+						GL_GlobalConfig_X.pIndicatorConfig_X[i].HasEcho_B = true;
+
+						// Get Echo COM Port Index
+						if (((GL_pWConfigBuffer_UB[i * 4 + 3] & 0x0C) >> 2) <= 0x03) {
+							DBG_PRINT(DEBUG_SEVERITY_INFO, "    > Echo COM Port index = COM");
+							DBG_PRINTDATA((GL_pWConfigBuffer_UB[i * 4 + 3] & 0x0C) >> 2);
+							DBG_ENDSTR();
+							GL_GlobalConfig_X.pIndicatorConfig_X[i].EchoComPortIx_UB = ((GL_pWConfigBuffer_UB[i * 4 + 3] & 0x0C) >> 2);
+						}
+						else {
+							DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "    > Wrong Echo COM Port index, discard Echo function");
+							GL_GlobalConfig_X.pIndicatorConfig_X[i].HasEcho_B = false;
+						}
+
+					}
+					else {
+						DBG_PRINTLN(DEBUG_SEVERITY_INFO, "    > No Echo (ignore Echo COM Index)");
+						GL_GlobalConfig_X.pIndicatorConfig_X[i].HasEcho_B = false;
+					}
+
+					// Get Timings
+					DecodeIndicatorTiming(i, &GL_pWConfigBuffer_UB[16 + i * 8]);
+
+				}
+				else {
+					DBG_PRINTDATA("Not Enabled");
+					DBG_ENDSTR();
+					GL_GlobalConfig_X.pIndicatorConfig_X[i].IsEnabled_B = false;
+				}
+			}
+
+			// Discard Indicators sharing the COM Port of a previous one
+			for (int i = 0; i < 4; i++) {
+				for (int j = 0; j < i; j++) {
+					if (GL_GlobalConfig_X.pIndicatorConfig_X[i].IsEnabled_B && GL_GlobalConfig_X.pIndicatorConfig_X[j].IsEnabled_B &&
+						(GL_GlobalConfig_X.pIndicatorConfig_X[i].ComPortIdx_UB == GL_GlobalConfig_X.pIndicatorConfig_X[j].ComPortIdx_UB)) {
+						DBG_PRINT(DEBUG_SEVERITY_ERROR, "COM Port already used by Indicator ");
+						DBG_PRINTDATA(j);
+						DBG_PRINTDATA(" -> discard Indicator ");
+						DBG_PRINTDATA(i);
+						DBG_ENDSTR();
+						GL_GlobalConfig_X.pIndicatorConfig_X[i].IsEnabled_B = false;
+					}
+				}
+			}
+
+			DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Call configuration functions for Indicators");
+			// Call Configuration Functions
+			for (int i = 0; i < 4; i++) {
+
+				if (!(GL_GlobalConfig_X.pIndicatorConfig_X[i].IsEnabled_B))
+					continue;
+
+				// Call low-level function on Indicator object
+				GL_GlobalData_X.pIndicator_H[i].init(GetSerialHandle(GL_GlobalConfig_X.pIndicatorConfig_X[i].ComPortIdx_UB), false);
+				GL_GlobalData_X.pIndicator_H[i].setIndicatorDevice(GL_GlobalConfig_X.pIndicatorConfig_X[i].InterfaceType_E);
+
+				// Configure Echo if neeeded
+				if (GL_GlobalConfig_X.pIndicatorConfig_X[i].HasEcho_B)
+					GL_GlobalData_X.pIndicator_H[i].attachEcho(GetSerialHandle(GL_GlobalConfig_X.pIndicatorConfig_X[i].EchoComPortIx_UB), false);
+
+				// Assign Event to feed the frame assembler as soon as data are received (IRQ and polling modes)
+				GL_GlobalConfig_X.pComPortConfig_X[GL_GlobalConfig_X.pIndicatorConfig_X[i].ComPortIdx_UB].pFctCommEvent = GL_pCommEventIndicator[i];
+
+				// Configure Manager
+				IndicatorManager_Init(i, &(GL_GlobalData_X.pIndicator_H[i]));
+				IndicatorManager_Enable(i, GL_GlobalConfig_X.pIndicatorConfig_X[i].InterfaceFrame_E, GL_GlobalConfig_X.pIndicatorConfig_X[i].HasIrq_B);
+				IndicatorManager_SetTiming(i, GL_GlobalConfig_X.pIndicatorConfig_X[i].ScanPeriod_UL, GL_GlobalConfig_X.pIndicatorConfig_X[i].ResponseDelay_UL,
+					GL_GlobalConfig_X.pIndicatorConfig_X[i].ResetDelay_UL, GL_GlobalConfig_X.pIndicatorConfig_X[i].MaxTryNumber_UB, GL_GlobalConfig_X.pIndicatorConfig_X[i].IsAdaptive_B);
+
+			}
+
+            
+			BootReport_Mark(BOOT_REPORT_STAGE_INDICATOR_CONFIG);
+			DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To GET ETH CONFIG");
+			GL_WConfigManager_CurrentState_E = WCFG_STATE::WCFG_GET_ETH_CONFIG;
+        }
+        else {
+            TransitionToErrorReading();
+        }
+
+        break;
+
+
     /* GET ETH CONFIG */
     /* > Retreive Ethernet configuration. */
     case WCFG_GET_ETH_CONFIG:
 
         DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Retreive Ethernet configuration");
-        if (GL_GlobalData_X.Eeprom_H.read(WCONFIG_ADDR_ETH, GL_pWConfigBuffer_UB, 24) == 24) {
+        if (ReadImage(WCONFIG_ADDR_ETH, GL_pWConfigBuffer_UB, 24) == 24) {
 
             if ((GL_pWConfigBuffer_UB[0] & 0x01) == 0x01) {
                 GL_GlobalConfig_X.EthConfig_X.isEnabled_B = true;
@@ -820,6 +1092,22 @@ WCFG_STATUS WConfigManager_Process() {
                 // Initialize Network Adapter
                 if (GL_GlobalConfig_X.EthConfig_X.isDhcp_B) {
                     GL_GlobalData_X.Network_H.init(PIN_ETH_LINKED, GL_GlobalConfig_X.EthConfig_X.pMacAddr_UB);
+
+                    // Static addresses kept in EEPROM are used when no DHCP server answers
+                    IPAddress FallbackIpAddr_X = IPAddress(GL_pWConfigBuffer_UB[8], GL_pWConfigBuffer_UB[9], GL_pWConfigBuffer_UB[10], GL_pWConfigBuffer_UB[11]);
+                    if (!(FallbackIpAddr_X == IPAddress(0, 0, 0, 0)) && !(FallbackIpAddr_X == IPAddress(255, 255, 255, 255))) {
+                        IPAddress SubnetMaskAddr_X = IPAddress(GL_pWConfigBuffer_UB[12], GL_pWConfigBuffer_UB[13], GL_pWConfigBuffer_UB[14], GL_pWConfigBuffer_UB[15]);
+                        if ((SubnetMaskAddr_X == IPAddress(0, 0, 0, 0)) || (SubnetMaskAddr_X == IPAddress(255, 255, 255, 255)))
+                            SubnetMaskAddr_X = IPAddress(255, 255, 255, 0);
+
+                        GL_GlobalData_X.Network_H.setDhcpFallback(FallbackIpAddr_X, SubnetMaskAddr_X,
+                            IPAddress(GL_pWConfigBuffer_UB[16], GL_pWConfigBuffer_UB[17], GL_pWConfigBuffer_UB[18], GL_pWConfigBuffer_UB[19]),
+                            IPAddress(GL_pWConfigBuffer_UB[20], GL_pWConfigBuffer_UB[21], GL_pWConfigBuffer_UB[22], GL_pWConfigBuffer_UB[23]));
+
+                        DBG_PRINT(DEBUG_SEVERITY_INFO, "- DHCP Fallback IP Address = ");
+                        DBG_PRINTDATA(FallbackIpAddr_X);
+                        DBG_ENDSTR();
+                    }
                 }
                 else {
                     if (GL_GlobalConfig_X.EthConfig_X.isAdvancedConfig_B) {
@@ -834,6 +1122,9 @@ WCFG_STATUS WConfigManager_Process() {
                 NetworkAdapterManager_Init(&(GL_GlobalData_X.Network_H));
                 NetworkAdapterManager_Enable(); // GL_GlobalData_X.Network_H.begin() is called in NetworkAdapterManager_Process() when cable is conneted
 
+                // Serial Bridge started on request (W-Command)
+                SerialBridgeManager_Init(&(GL_GlobalData_X.Network_H));
+
                 
                 DBG_PRINTLN(DEBUG_SEVERITY_INFO, "End of Ethernet configuration");
             }
@@ -846,6 +1137,7 @@ WCFG_STATUS WConfigManager_Process() {
             }
 
 
+            BootReport_Mark(BOOT_REPORT_STAGE_ETH_CONFIG);
             DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To GET TCP SERVER CONFIG");
             GL_WConfigManager_CurrentState_E = WCFG_STATE::WCFG_GET_TCP_SERVER_CONFIG;
 
@@ -862,7 +1154,7 @@ WCFG_STATUS WConfigManager_Process() {
     case WCFG_GET_TCP_SERVER_CONFIG:
 
         DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Retreive TCP Server configuration");
-        if (GL_GlobalData_X.Eeprom_H.read(WCONFIG_ADDR_TCP_SERVER, GL_pWConfigBuffer_UB, 4) == 4) {
+        if (ReadImage(WCONFIG_ADDR_TCP_SERVER, GL_pWConfigBuffer_UB, 4) == 4) {
         
             if ((GL_pWConfigBuffer_UB[0] & 0x01) == 0x01) {
                 DBG_PRINTLN(DEBUG_SEVERITY_INFO, "TCP Server enabled");
@@ -904,7 +1196,7 @@ WCFG_STATUS WConfigManager_Process() {
     case WCFG_GET_UDP_SERVER_CONFIG:
 
         DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Retreive UDP Server configuration");
-        if (GL_GlobalData_X.Eeprom_H.read(WCONFIG_ADDR_UDP_SERVER, GL_pWConfigBuffer_UB, 4) == 4) {
+        if (ReadImage(WCONFIG_ADDR_UDP_SERVER, GL_pWConfigBuffer_UB, 4) == 4) {
 
             if ((GL_pWConfigBuffer_UB[0] & 0x01) == 0x01) {
                 DBG_PRINTLN(DEBUG_SEVERITY_INFO, "UDP Server enabled");
@@ -946,7 +1238,7 @@ WCFG_STATUS WConfigManager_Process() {
     case WCFG_GET_TCP_CLIENT_CONFIG:
 
         DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Retreive TCP Client configuration");
-        if (GL_GlobalData_X.Eeprom_H.read(WCONFIG_ADDR_TCP_CLIENT, GL_pWConfigBuffer_UB, 4) == 4) {
+        if (ReadImage(WCONFIG_ADDR_TCP_CLIENT, GL_pWConfigBuffer_UB, 4) == 4) {
 
             DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "NOT YET IMPLEMENTED..");
 
@@ -966,7 +1258,7 @@ WCFG_STATUS WConfigManager_Process() {
     case WCFG_GET_FONA_MODULE_CONFIG:
 
         DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Retreive FONA Module configuration");
-        if (GL_GlobalData_X.Eeprom_H.read(WCONFIG_ADDR_FONA_MODULE, GL_pWConfigBuffer_UB, 16) == 16) {
+        if (ReadImage(WCONFIG_ADDR_FONA_MODULE, GL_pWConfigBuffer_UB, 16) == 16) {
 
             if ((GL_pWConfigBuffer_UB[0] & 0x01) == 0x01) {
                 DBG_PRINTLN(DEBUG_SEVERITY_INFO, "FONA Module enabled");
@@ -1013,15 +1305,36 @@ WCFG_STATUS WConfigManager_Process() {
                 FonaModuleManager_Init(&(GL_GlobalData_X.Fona_H));
                 FonaModuleManager_Enable();
 
+                // GSM Server only needed as W-Command medium
+                if (GL_GlobalConfig_X.WCmdConfig_X.Medium_E == WLINK_WCMD_MEDIUM_GSM_SERVER) {
+                    GL_GlobalConfig_X.GsmConfig_X.ServerConfig_X.LocalPort_UI = (unsigned int)((GL_pWConfigBuffer_UB[8] << 8) + GL_pWConfigBuffer_UB[7]);
+                    if ((GL_GlobalConfig_X.GsmConfig_X.ServerConfig_X.LocalPort_UI == 0x0000) || (GL_GlobalConfig_X.GsmConfig_X.ServerConfig_X.LocalPort_UI == 0xFFFF))
+                        GL_GlobalConfig_X.GsmConfig_X.ServerConfig_X.LocalPort_UI = GSM_SERVER_DEFAULT_PORT;     // Not configured
+                    DBG_PRINT(DEBUG_SEVERITY_INFO, "- GSM Server local port = ");
+                    DBG_PRINTDATA(GL_GlobalConfig_X.GsmConfig_X.ServerConfig_X.LocalPort_UI);
+                    DBG_ENDSTR();
+
+                    /* Initialize GSM Server Modules */
+                    GL_GlobalData_X.EthAP_X.GsmServer_H.init(&(GL_GlobalData_X.Fona_H), GL_GlobalConfig_X.GsmConfig_X.ServerConfig_X.LocalPort_UI);
+                    GSMServerManager_Init(&(GL_GlobalData_X.Fona_H), &(GL_GlobalData_X.EthAP_X.GsmServer_H));
+                    GSMServerManager_Enable();
+                    GL_GlobalConfig_X.GsmConfig_X.ServerConfig_X.isEnabled_B = true;
+                }
+                else {
+                    GL_GlobalConfig_X.GsmConfig_X.ServerConfig_X.isEnabled_B = false;
+                }
+
                 DBG_PRINTLN(DEBUG_SEVERITY_INFO, "End of FONA Module configuration");
             }
             else {
                 DBG_PRINTLN(DEBUG_SEVERITY_INFO, "FONA Module not enabled");
                 GL_GlobalConfig_X.GsmConfig_X.isEnabled_B = false;
+                GL_GlobalConfig_X.GsmConfig_X.ServerConfig_X.isEnabled_B = false;
             }
 
-            DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To GET INDICATOR CONFIG");
-            GL_WConfigManager_CurrentState_E = WCFG_STATE::WCFG_GET_INDICATOR_CONFIG;
+            BootReport_Mark(BOOT_REPORT_STAGE_FONA_CONFIG);
+            DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To GET APP CONFIG");
+            GL_WConfigManager_CurrentState_E = WCFG_STATE::WCFG_GET_APP_CONFIG;
         }
         else {
             TransitionToErrorReading();
@@ -1031,145 +1344,6 @@ WCFG_STATUS WConfigManager_Process() {
 
 
 
-    /* GET INDICATOR CONFIG */
-    /* > Retreive Indicator configuration */
-    case WCFG_GET_INDICATOR_CONFIG:
-
-        DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Retreive Indicators configuration");
-        if (GL_GlobalData_X.Eeprom_H.read(WCONFIG_ADDR_INDICATOR, GL_pWConfigBuffer_UB, 16) == 16) {
-
-			// Initialize Interface if at least one Indicator is enabled
-			for (int i = 0; i < 4; i++) {
-				if ((GL_pWConfigBuffer_UB[i * 4] & 0x01) == 0x01) {
-					IndicatorInterface_Init();
-					break;
-				}
-			}
-
-			// Configure the 4 possible Indicators
-			for (int i = 0; i < 4; i++) {
-
-				DBG_PRINT(DEBUG_SEVERITY_INFO, "- Configure Indicator ");
-				DBG_PRINTDATA(i);
-				DBG_PRINTDATA(": ");
-
-				if ((GL_pWConfigBuffer_UB[i * 4] & 0x01) == 0x01) {
-					DBG_PRINTDATA("Enabled");
-					DBG_ENDSTR();
-
-					// Get COM Port Index
-					if ((GL_pWConfigBuffer_UB[i * 4 + 3] & 0x03) <= 0x03) {						
-						DBG_PRINT(DEBUG_SEVERITY_INFO, "    > COM Port index = COM");
-						DBG_PRINTDATA((GL_pWConfigBuffer_UB[i * 4 + 3] & 0x03));
-						DBG_ENDSTR();
-						GL_GlobalConfig_X.pIndicatorConfig_X[i].ComPortIdx_UB = (GL_pWConfigBuffer_UB[i * 4 + 3] & 0x03);
-					}
-					else {
-						DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "    > Wrong COM Port index, use COM1 !");
-						GL_GlobalConfig_X.pIndicatorConfig_X[i].ComPortIdx_UB = PORT_COM1;
-					}
-
-					// Get Interface Type
-					if (GL_pWConfigBuffer_UB[i * 4 + 1] < INDICATOR_INTERFACE_DEVICES_NUM) {
-						DBG_PRINT(DEBUG_SEVERITY_INFO, "    > Interface Type = ");
-						DBG_PRINTDATA(pIndicatorInterfaceDeviceLut_Str[GL_pWConfigBuffer_UB[i * 4 + 1]]);
-						DBG_ENDSTR();
-						GL_GlobalConfig_X.pIndicatorConfig_X[i].InterfaceType_E = (INDICATOR_INTERFACE_DEVICES_ENUM)(GL_pWConfigBuffer_UB[i * 4 + 1]);
-					}
-					else {
-						DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "    > Wrong Interface Type, use ");
-						DBG_PRINTDATA(pIndicatorInterfaceDeviceLut_Str[0]);
-						DBG_PRINTDATA(" !");
-						DBG_ENDSTR();
-						GL_GlobalConfig_X.pIndicatorConfig_X[i].InterfaceType_E = INDICATOR_INTERFACE_DEVICES_ENUM::INDICATOR_LD5218;
-					}
-
-                    // Get Frame Type
-                    if (((GL_pWConfigBuffer_UB[i * 4 + 2]) & 0x0F) < INDICATOR_INTERFACE_FRAME_NUM) {
-                        DBG_PRINT(DEBUG_SEVERITY_INFO, "    > Frame Type = ");
-                        DBG_PRINTDATA(pIndicatorInterfaceFrameLut_Str[((GL_pWConfigBuffer_UB[i * 4 + 2]) & 0x0F)]);
-                        DBG_ENDSTR();
-                        GL_GlobalConfig_X.pIndicatorConfig_X[i].InterfaceFrame_E = (INDICATOR_INTERFACE_FRAME_ENUM)((GL_pWConfigBuffer_UB[i * 4 + 2]) & 0x0F);
-                    }
-                    else {
-                        DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "    > Wrong Frame Type, use ");
-                        DBG_PRINTDATA(pIndicatorInterfaceFrameLut_Str[0]);
-                        DBG_PRINTDATA(" !");
-                        DBG_ENDSTR();
-                        GL_GlobalConfig_X.pIndicatorConfig_X[i].InterfaceFrame_E = INDICATOR_INTERFACE_FRAME_ENUM::INDICATOR_INTERFACE_FRAME_ASK_WEIGHT;
-                    }
-
-					// Check IRQ
-					if ((GL_pWConfigBuffer_UB[i * 4] & 0x02) == 0x02) {
-						DBG_PRINTLN(DEBUG_SEVERITY_INFO, "    > Has IRQ");
-						GL_GlobalConfig_X.pIndicatorConfig_X[i].HasIrq_B = true;
-						GL_GlobalConfig_X.pComPortConfig_X[GL_GlobalConfig_X.pIndicatorConfig_X[i].ComPortIdx_UB].pFctCommEvent = CommEvent_Indicator;	// Assign Event on IRQ
-					}
-					else {
-						DBG_PRINTLN(DEBUG_SEVERITY_INFO, "    > No IRQ Handling");
-						GL_GlobalConfig_X.pIndicatorConfig_X[i].HasIrq_B = false;
-					}
-
-					// Check Echo
-					if ((GL_pWConfigBuffer_UB[i * 4] & 0x04) == 0x04) {
-						DBG_PRINTLN(DEBUG_SEVERITY_INFO, "    > Has Echo");
-						GL_GlobalConfig_X.pIndicatorConfig_X[i].HasEcho_B = true;
-
-						// Get Echo COM Port Index
-						if (((GL_pWConfigBuffer_UB[i * 4 + 3] & 0x0C) >> 2) <= 0x03) {
-							DBG_PRINT(DEBUG_SEVERITY_INFO, "    > Echo COM Port index = COM");
-							DBG_PRINTDATA((GL_pWConfigBuffer_UB[i * 4 + 3] & 0x0C) >> 2);
-							DBG_ENDSTR();
-							GL_GlobalConfig_X.pIndicatorConfig_X[i].EchoComPortIx_UB = ((GL_pWConfigBuffer_UB[i * 4 + 3] & 0x0C) >> 2);
-						}
-						else {
-							DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "    > Wrong Echo COM Port index, discard Echo function");
-							GL_GlobalConfig_X.pIndicatorConfig_X[i].HasEcho_B = false;
-						}
-
-					}
-					else {
-						DBG_PRINTLN(DEBUG_SEVERITY_INFO, "    > No Echo (ignore Echo COM Index)");
-						GL_GlobalConfig_X.pIndicatorConfig_X[i].HasEcho_B = false;
-					}
-
-				}
-				else {
-					DBG_PRINTDATA("Not Enabled");
-					DBG_ENDSTR();
-				}
-			}
-
-			DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Call configuration functions for Indicators");
-			DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "Only one Indicator managed for now !");
-			// Call Configuration Functions
-			for (int i = 0; i < 1; i++) {																								// TODO : Limited to ONE Indicator
-
-				// Call low-level function on Indicator object
-				GL_GlobalData_X.Indicator_H.init(GetSerialHandle(GL_GlobalConfig_X.pIndicatorConfig_X[i].ComPortIdx_UB), false);
-				GL_GlobalData_X.Indicator_H.setIndicatorDevice(GL_GlobalConfig_X.pIndicatorConfig_X[i].InterfaceType_E);
-
-				// Configure Echo if neeeded
-				if (GL_GlobalConfig_X.pIndicatorConfig_X[i].HasEcho_B)
-					GL_GlobalData_X.Indicator_H.attachEcho(GetSerialHandle(GL_GlobalConfig_X.pIndicatorConfig_X[i].EchoComPortIx_UB), false);
-
-				// Configure Manager
-				IndicatorManager_Init(&(GL_GlobalData_X.Indicator_H));
-				IndicatorManager_Enable(GL_GlobalConfig_X.pIndicatorConfig_X[i].InterfaceFrame_E, GL_GlobalConfig_X.pIndicatorConfig_X[i].HasIrq_B);
-
-			}
-
-            
-			DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To GET APP CONFIG");
-			GL_WConfigManager_CurrentState_E = WCFG_STATE::WCFG_GET_APP_CONFIG;
-        }
-        else {
-            TransitionToErrorReading();
-        }
-
-        break;
-
-
 	/* GET APP CONFIG */
 	/* > Retreive Application configuration. */
 	case WCFG_GET_APP_CONFIG:
@@ -1177,7 +1351,7 @@ WCFG_STATUS WConfigManager_Process() {
 		GL_GlobalConfig_X.App_X.hasApplication_B = false;
 
 		DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Retreive Application configuration");
-		if (GL_GlobalData_X.Eeprom_H.read(WCONFIG_ADDR_APP, GL_pWConfigBuffer_UB, 1) == 1) {
+		if (ReadImage(WCONFIG_ADDR_APP, GL_pWConfigBuffer_UB, 1) == 1) {
 			
 			if ((GL_pWConfigBuffer_UB[0] & 0x01) == 0x01) {
 
@@ -1200,6 +1374,12 @@ WCFG_STATUS WConfigManager_Process() {
 					/* ----------- */
 					case WCFG_APP_KIP_CONTROL:
 
+						// KipControl works with the first indicator : the application is refused without it
+						if (!(GL_GlobalConfig_X.pIndicatorConfig_X[KC_INDICATOR_IDX].IsEnabled_B)) {
+							DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "KipControl needs Indicator 0 enabled -> no Application");
+							break;
+						}
+
 						DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Assign generic functions for Application Process");
 						GL_GlobalConfig_X.App_X.pFctInit = KipControlManager_Init;
 						GL_GlobalConfig_X.App_X.pFctEnable = KipControlManager_Enable;
@@ -1288,7 +1468,7 @@ WCFG_STATUS WConfigManager_Process() {
     //case WCFG_STATE:
 
         //DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Retreive XXX configuration");
-        //if (GL_GlobalData_X.Eeprom_H.read(WCONFIG_ADDR_XXX, GL_pWConfigBuffer_UB, XXX) == XXX) {
+        //if (ReadImage(WCONFIG_ADDR_XXX, GL_pWConfigBuffer_UB, XXX) == XXX) {
 
 
 
@@ -1369,6 +1549,8 @@ void WConfigManager_BuildSerialGateway(void) {
 void TransitionToConfigDone(void) {
     DBG_PRINTLN(DEBUG_SEVERITY_INFO, "End of Configuration from EEPROM..");
     GL_WConfigStatus_E = WCFG_STS_OK;
+    BootReport_Mark(BOOT_REPORT_STAGE_CONFIG_DONE);
+    BootReport_Print();
     DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Transition To CONFIG DONE");
     GL_WConfigManager_CurrentState_E = WCFG_STATE::WCFG_CONFIG_DONE;
 }
@@ -1394,6 +1576,143 @@ void TransitionToErrorInit(void) {
     GL_WConfigManager_CurrentState_E = WCFG_STATE::WCFG_ERROR_INIT;
 }
 
+// Timing bytes : [SCAN PERIOD (LSB first)][RESPONSE DELAY (LSB first)][RESET DELAY (LSB first)][MAX TRY][FLAGS]
+// FLAGS : bit0 = Adaptive mode - Erased EEPROM (0xFF..) gives the default values
+void DecodeIndicatorTiming(int Idx_SI, const unsigned char * pTiming_UB) {
+    INDICATOR_CONFIG_STRUCT * pConfig_X = &(GL_GlobalConfig_X.pIndicatorConfig_X[Idx_SI]);
+    unsigned long Value_UL = 0;
+
+    Value_UL = (unsigned long)((pTiming_UB[1] << 8) + pTiming_UB[0]);
+    pConfig_X->ScanPeriod_UL = (Value_UL != 0xFFFF) ? Value_UL : 0;
+
+    Value_UL = (unsigned long)((pTiming_UB[3] << 8) + pTiming_UB[2]);
+    pConfig_X->ResponseDelay_UL = (Value_UL != 0xFFFF) ? Value_UL : 0;
+
+    Value_UL = (unsigned long)((pTiming_UB[5] << 8) + pTiming_UB[4]);
+    pConfig_X->ResetDelay_UL = (Value_UL != 0xFFFF) ? Value_UL : 0;
+
+    pConfig_X->MaxTryNumber_UB = (pTiming_UB[6] != 0xFF) ? pTiming_UB[6] : 0;
+    pConfig_X->IsAdaptive_B = ((pTiming_UB[7] != 0xFF) && ((pTiming_UB[7] & 0x01) == 0x01)) ? true : false;
+
+    DBG_PRINT(DEBUG_SEVERITY_INFO, "    > Timings = ");
+    DBG_PRINTDATA(pConfig_X->ScanPeriod_UL);
+    DBG_PRINTDATA(" - ");
+    DBG_PRINTDATA(pConfig_X->ResponseDelay_UL);
+    DBG_PRINTDATA(" - ");
+    DBG_PRINTDATA(pConfig_X->ResetDelay_UL);
+    DBG_PRINTDATA("[ms] - ");
+    DBG_PRINTDATA(pConfig_X->MaxTryNumber_UB);
+    DBG_PRINTDATA((pConfig_X->IsAdaptive_B ? " - Adaptive" : " - Fixed"));
+    DBG_ENDSTR();
+}
+
+// Image of an older version migrated and sealed - image of the current version rejected if its CRC is wrong (partially written)
+boolean CheckImage(void) {
+    unsigned char Version_UB = GL_WConfigImage_X.Version_UB;
+    unsigned int Crc_UI = 0;
+
+    if (Version_UB == WCONFIG_IMAGE_VERSION_NONE)
+        Version_UB = 0;
+
+    if (Version_UB > WCONFIG_IMAGE_VERSION) {
+        DBG_PRINT(DEBUG_SEVERITY_ERROR, "Unknown configuration image version : ");
+        DBG_PRINTDATA(Version_UB);
+        DBG_ENDSTR();
+        return false;
+    }
+
+    if (Version_UB > 0) {
+        Crc_UI = Crc16((unsigned char *)&GL_WConfigImage_X, offsetof(WCONFIG_IMAGE_STRUCT, pCrc_UB));
+        if (Crc_UI != (unsigned int)((GL_WConfigImage_X.pCrc_UB[1] << 8) + GL_WConfigImage_X.pCrc_UB[0])) {
+            DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "Bad CRC in configuration image (partially written)");
+            return false;
+        }
+    }
+
+    if (Version_UB < WCONFIG_IMAGE_VERSION) {
+        DBG_PRINT(DEBUG_SEVERITY_WARNING, "Migrate configuration image from version ");
+        DBG_PRINTDATA(Version_UB);
+        DBG_ENDSTR();
+
+        while (Version_UB < WCONFIG_IMAGE_VERSION)
+            GL_pWConfigMigration_X[Version_UB++](&GL_WConfigImage_X);
+
+        if (GL_GlobalData_X.Eeprom_H.write(WCONFIG_ADDR_CONFIG_TAG, (unsigned char *)&GL_WConfigImage_X, offsetof(WCONFIG_IMAGE_STRUCT, Version_UB)))
+            SealImage();
+        else
+            GL_WConfigImageLost_B = true;
+    }
+
+    DBG_PRINT(DEBUG_SEVERITY_INFO, "Configuration image version ");
+    DBG_PRINTDATA(GL_WConfigImage_X.Version_UB);
+    DBG_PRINTDATA(" ok!");
+    DBG_ENDSTR();
+    return true;
+}
+
+// Version and CRC written after the data : an interrupted update is detected at the next start-up
+void SealImage(void) {
+    unsigned int Crc_UI;
+
+    GL_WConfigImage_X.Version_UB = WCONFIG_IMAGE_VERSION;
+    GL_WConfigImage_X.Reserved_UB = 0x00;
+    Crc_UI = Crc16((unsigned char *)&GL_WConfigImage_X, offsetof(WCONFIG_IMAGE_STRUCT, pCrc_UB));
+    GL_WConfigImage_X.pCrc_UB[0] = (unsigned char)(Crc_UI % 256);
+    GL_WConfigImage_X.pCrc_UB[1] = (unsigned char)((Crc_UI >> 8) % 256);
+
+    GL_GlobalData_X.Eeprom_H.write(WCONFIG_ADDR_IMAGE_VERSION, &(GL_WConfigImage_X.Version_UB), sizeof(WCONFIG_IMAGE_STRUCT) - offsetof(WCONFIG_IMAGE_STRUCT, Version_UB));
+}
+
+// Same use as Eeprom_H.read() - served from the image loaded in LOAD IMAGE state
+unsigned long ReadImage(unsigned int Addr_UW, unsigned char * pData_UB, unsigned long Size_UL) {
+    if (!GL_WConfigImageLoaded_B || (Addr_UW < WCONFIG_ADDR_CONFIG_TAG) || ((Addr_UW + Size_UL) > (WCONFIG_ADDR_CONFIG_TAG + sizeof(WCONFIG_IMAGE_STRUCT))))
+        return 0;
+
+    memcpy(pData_UB, ((unsigned char *)&GL_WConfigImage_X) + (Addr_UW - WCONFIG_ADDR_CONFIG_TAG), Size_UL);
+    return Size_UL;
+}
+
+void WriteImage(unsigned int Addr_UW, const unsigned char * pData_UB, unsigned long Size_UL) {
+    boolean IsWritten_B;
+
+    if ((Addr_UW < WCONFIG_ADDR_CONFIG_TAG) || ((Addr_UW + Size_UL) > WCONFIG_ADDR_IMAGE_VERSION))
+        return;
+
+    IsWritten_B = GL_GlobalData_X.Eeprom_H.write(Addr_UW, (unsigned char *)pData_UB, Size_UL);
+
+    // Image not loaded (configuration error) : the other blocks come from EEPROM
+    if (GL_WConfigImageLoaded_B)
+        memcpy(((unsigned char *)&GL_WConfigImage_X) + (Addr_UW - WCONFIG_ADDR_CONFIG_TAG), pData_UB, Size_UL);
+    else
+        GL_GlobalData_X.Eeprom_H.read(WCONFIG_ADDR_CONFIG_TAG, (unsigned char *)&GL_WConfigImage_X, sizeof(WCONFIG_IMAGE_STRUCT));
+
+    // A block has been lost : the whole image is written again before sealing
+    if ((!IsWritten_B || GL_WConfigImageLost_B) && GL_WConfigImageLoaded_B)
+        IsWritten_B = GL_GlobalData_X.Eeprom_H.write(WCONFIG_ADDR_CONFIG_TAG, (unsigned char *)&GL_WConfigImage_X, offsetof(WCONFIG_IMAGE_STRUCT, Version_UB));
+
+    if (!IsWritten_B) {
+        DBG_PRINTLN(DEBUG_SEVERITY_ERROR, "Configuration image not written");
+        GL_WConfigImageLost_B = true;
+        return;
+    }
+
+    GL_WConfigImageLost_B = false;
+    SealImage();
+}
+
+// Version 0 : Indicator timings added afterwards -> erased timings (8 x 0xFF) replaced by the default values
+void MigrateFromVersion0(WCONFIG_IMAGE_STRUCT * pImage_X) {
+    unsigned char * pTiming_UB;
+    int j;
+
+    for (int i = 0; i < INDICATOR_MANAGER_MAX_NB; i++) {
+        pTiming_UB = &(pImage_X->pIndicatorTiming_UB[i * 8]);
+        for (j = 0; (j < 8) && (pTiming_UB[j] == 0xFF); j++);
+        if (j == 8)
+            memset(pTiming_UB, 0x00, 8);
+    }
+}
+
 
 /* ******************************************************************************** */
 /* Configuration Functions
@@ -1401,14 +1720,14 @@ void TransitionToErrorInit(void) {
 void WConfig_SetLanguage(unsigned char * pLanguage_UB) {
 
     DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Set language");
-    if (GL_GlobalData_X.Eeprom_H.read(WCONFIG_ADDR_LANGUAGE, GL_pWConfigBuffer_UB, 1) == 1) {
+    if (ReadImage(WCONFIG_ADDR_LANGUAGE, GL_pWConfigBuffer_UB, 1) == 1) {
 
         // Get Byte and change it
         GL_pWConfigBuffer_UB[0] &= 0xF0;
         GL_pWConfigBuffer_UB[0] |= (*pLanguage_UB);
 
         // Write in EEPROM
-        GL_GlobalData_X.Eeprom_H.write(WCONFIG_ADDR_LANGUAGE, GL_pWConfigBuffer_UB, 1);
+        WriteImage(WCONFIG_ADDR_LANGUAGE, GL_pWConfigBuffer_UB, 1);
 
         // Assign Global Config Data
         GL_GlobalConfig_X.Language_E = *((WLINK_LANGUAGE_ENUM *)(pLanguage_UB));
@@ -1460,4 +1779,30 @@ void WConfig_SetTime(unsigned char * pTime_UB) {
 
     // Call low-level function
     GL_GlobalData_X.Rtc_H.setTime(Time_X);
-}
\ No newline at end of file
+}
+
+
+// Configuration written behind the image (EEPROM W-Command) : image read back and sealed again
+void WConfig_SealImage(unsigned int Addr_UW, unsigned long Size_UL) {
+    if ((Addr_UW >= (WCONFIG_ADDR_CONFIG_TAG + sizeof(WCONFIG_IMAGE_STRUCT))) || ((Addr_UW + Size_UL) <= WCONFIG_ADDR_CONFIG_TAG))
+        return;
+
+    if (GL_GlobalData_X.Eeprom_H.read(WCONFIG_ADDR_CONFIG_TAG, (unsigned char *)&GL_WConfigImage_X, sizeof(WCONFIG_IMAGE_STRUCT)) == sizeof(WCONFIG_IMAGE_STRUCT))
+        SealImage();
+}
+
+
+void WConfig_SetIndicatorTiming(unsigned char Idx_UB, const unsigned char * pTiming_UB) {
+    DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Set indicator timing");
+
+    if (Idx_UB >= INDICATOR_MANAGER_MAX_NB)
+        return;
+
+    // Write in EEPROM
+    WriteImage(WCONFIG_ADDR_INDICATOR_TIMING + (Idx_UB * 8), pTiming_UB, 8);
+
+    // Assign Global Config Data and apply it
+    DecodeIndicatorTiming(Idx_UB, pTiming_UB);
+    IndicatorManager_SetTiming(Idx_UB, GL_GlobalConfig_X.pIndicatorConfig_X[Idx_UB].ScanPeriod_UL, GL_GlobalConfig_X.pIndicatorConfig_X[Idx_UB].ResponseDelay_UL,
+        GL_GlobalConfig_X.pIndicatorConfig_X[Idx_UB].ResetDelay_UL, GL_GlobalConfig_X.pIndicatorConfig_X[Idx_UB].MaxTryNumber_UB, GL_GlobalConfig_X.pIndicatorConfig_X[Idx_UB].IsAdaptive_B);
+}
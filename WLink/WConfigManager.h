@@ -7,6 +7,7 @@
 /*		Process functions to manage the configuration of the W-Link                 */
 /*                                                                                  */
 /* History :	25/02/2017	(RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Seal the configuration image after a write		*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -55,6 +56,8 @@ void WConfigManager_BuildSerialGateway();
 void WConfig_SetLanguage(unsigned char * pLanguage_UB);
 void WConfig_SetDate(unsigned char * pDate_UB);
 void WConfig_SetTime(unsigned char * pTime_UB);
+void WConfig_SetIndicatorTiming(unsigned char Idx_UB, const unsigned char * pTiming_UB);
+void WConfig_SealImage(unsigned int Addr_UW, unsigned long Size_UL);
 
 
 #endif // __WCONFIG_MANAGER_H__
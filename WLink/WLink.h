@@ -21,6 +21,8 @@
 
 #include "Hardware.h"
 #include "Utilz.h"
+#include "EventBus.h"
+#include "BootReport.h"
 
 #include "SerialHandler.h"
 #include "SerialManager.h"
@@ -34,6 +36,7 @@
 
 #include "Indicator.h"
 #include "IndicatorManager.h"
+#include "WeightStream.h"
 #include "BadgeReader.h"
 #include "BadgeReaderManager.h"
 
@@ -51,6 +54,9 @@
 #include "TCPServerManager.h"
 #include "UDPServer.h"
 #include "UDPServerManager.h"
+#include "GSMServer.h"
+#include "GSMServerManager.h"
+#include "SerialBridgeManager.h"
 
 #include "WLinkManager.h"
 #include "WMenuManager.h"
@@ -61,6 +67,7 @@
 #include "KipControlMenu.h"
 
 #include "Debug.h"
+#include "LoopProfiler.h"
 
 /* ******************************************************************************** */
 /* Define
@@ -97,7 +104,7 @@ typedef enum {
 typedef struct {
     TCPServer TcpServer_H;
     UDPServer UdpServer_H;
-    unsigned long GsmServer_H;  // TODO : to modify when GSMServer Object will be created
+    GSMServer GsmServer_H;
 } ETHERNET_ACCESS_POINT_STRUCT;
 
 
@@ -116,7 +123,7 @@ typedef struct {
     NetworkAdapter Network_H;
     FonaModule Fona_H;
     ETHERNET_ACCESS_POINT_STRUCT EthAP_X;
-    Indicator Indicator_H;          // Not yet managed
+    Indicator pIndicator_H[4];      // Up to 4 indicators (see pIndicatorConfig_X)
     BadgeReader BadgeReader_H;      // Not yet managed
 	KipControl KipControl_H;
 } GLOBAL_PARAM_STRUCT;
@@ -162,6 +169,7 @@ typedef struct {
     char PinPower_UB;
     char pPinCode_UB[5];
     unsigned long ApnIndex_UL;
+    SERVER_CONFIG_STRUCT ServerConfig_X;
 } GSM_CONFIG_STRUCT;
 
 // Dedicated Structure for WCommand Configuration
@@ -188,12 +196,18 @@ typedef struct {
 
 // Dedicated Structure for Indicator Configuration
 typedef struct {
+	boolean IsEnabled_B;
 	unsigned char ComPortIdx_UB;
 	INDICATOR_INTERFACE_DEVICES_ENUM InterfaceType_E;
     INDICATOR_INTERFACE_FRAME_ENUM InterfaceFrame_E;
 	boolean HasIrq_B;
 	boolean HasEcho_B;
 	unsigned char EchoComPortIx_UB;
+	unsigned long ScanPeriod_UL;		// [ms] 0 = default value
+	unsigned long ResponseDelay_UL;		// [ms] 0 = default value
+	unsigned long ResetDelay_UL;		// [ms] 0 = default value
+	unsigned char MaxTryNumber_UB;		// 0 = default value
+	boolean IsAdaptive_B;
 } INDICATOR_CONFIG_STRUCT;
 
 // Global Configuration Structure
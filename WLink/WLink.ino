@@ -8,6 +8,12 @@
 /* History :	01/12/2014  (RW)	Creation of this file                           */
 /*				14/05/2016	(RW)	Re-mastered version								*/
 /*              27/02/2017  (RW)    Re-mastered version with WConfigManager         */
+/*              18/10/2026  (RW)    Entry point for host-native build               */
+/*              18/10/2026  (RW)    Add Loop Profiler                               */
+/*              18/10/2026  (RW)    Send buffered Debug messages from loop          */
+/*              18/10/2026  (RW)    Descriptors with metadata checked at compile    */
+/*              18/10/2026  (RW)    Add Event Bus subscribers                       */
+/*              18/10/2026  (RW)    Add Boot Report                                 */
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -51,47 +57,85 @@ void BlinkingLedManager_Process(void);
 /* ******************************************************************************** */
 /* Functions Mapping
 /* ******************************************************************************** */
-const WCMD_FCT_DESCR cGL_pFctDescr_X[] =
+// { ID, Handler, Min Param Nb, Max Param Nb, Max Answer Nb, Allowed Mediums }
+constexpr WCMD_FCT_DESCR cGL_pFctDescr_X[] =
 {
-	{ WCMD_GET_REVISION_ID, WCmdProcess_GetRevisionId },
+	{ WCMD_GET_REVISION_ID, WCmdProcess_GetRevisionId, 0, WCMD_PARAM_NB_ANY, 8, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_SET_FRAMING, WCmdProcess_SetFraming, 1, 1, 0, WCMD_MEDIUM_MASK_ALL },
+
+	{ WCMD_GPIO_READ, WCmdProcess_GpioRead, 0, WCMD_PARAM_NB_ANY, 1, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_GPIO_WRITE, WCmdProcess_GpioWrite, 1, WCMD_PARAM_NB_ANY, 0, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_GPIO_SET_BIT, WCmdProcess_GpioSetBit, 1, WCMD_PARAM_NB_ANY, 0, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_GPIO_CLR_BIT, WCmdProcess_GpioClrBit, 1, WCMD_PARAM_NB_ANY, 0, WCMD_MEDIUM_MASK_ALL },
+
+	{ WCMD_INDICATOR_GET_WEIGHT, WCmdProcess_IndicatorGetWeight, 0, 1, 4, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_INDICATOR_GET_WEIGHT_ALIBI, WCmdProcess_IndicatorGetWeightAlibi, 0, WCMD_PARAM_NB_ANY, 0, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_INDICATOR_SET_ZERO, WCmdProcess_IndicatorSetZero, 0, 1, 0, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_INDICATOR_GET_WEIGHT_ASCII, WCmdProcess_IndicatorGetWeightAscii, 0, 1, 8, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_INDICATOR_SET_TIMING, WCmdProcess_IndicatorSetTiming, 9, 9, 0, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_INDICATOR_GET_TIMING, WCmdProcess_IndicatorGetTiming, 0, 1, 16, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_INDICATOR_SUBSCRIBE, WCmdProcess_IndicatorSubscribe, 4, 4, 0, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_INDICATOR_UNSUBSCRIBE, WCmdProcess_IndicatorUnsubscribe, 0, 1, 0, WCMD_MEDIUM_MASK_ALL },
+
+	{ WCMD_BADGE_READER_GET_ID, WCmdProcess_BadgeReaderGetBadgeId, 0, WCMD_PARAM_NB_ANY, 10, WCMD_MEDIUM_MASK_ALL },
+
+	{ WCMD_LCD_WRITE, WCmdProcess_LcdWrite, 2, WCMD_PARAM_NB_ANY, 0, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_LCD_READ, WCmdProcess_LcdRead, 1, 1, WCMD_ANS_NB_ANY, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_LCD_CLEAR, WCmdProcess_LcdClear, 1, 1, 0, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_LCD_SET_BACKLIGHT, WCmdProcess_LcdSetBacklight, 1, 1, 0, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_LCD_ENABLE_EXT_WRITE, WCmdProcess_LcdEnableExternalWrite, 2, 2, 0, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_LCD_DISABLE_EXT_WRITE, WCmdProcess_LcdDisableExternalWrite, 0, WCMD_PARAM_NB_ANY, 0, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_LCD_GET_EXT_WRITE_STATUS, WCmdProcess_LcdGetExternalWriteStatus, 0, WCMD_PARAM_NB_ANY, 1, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_LCD_GET_EXT_WRITE_DATA, WCmdProcess_LcdGetExternalWriteData, 0, WCMD_PARAM_NB_ANY, WCMD_ANS_NB_ANY, WCMD_MEDIUM_MASK_ALL },
+
+    { WCMD_EEPROM_WRITE, WCmdProcess_EepromWrite, 4, WCMD_PARAM_NB_ANY, 0, WCMD_MEDIUM_MASK_ALL },
+    { WCMD_EEPROM_READ, WCmdProcess_EepromRead, 3, 3, WCMD_ANS_NB_ANY, WCMD_MEDIUM_MASK_ALL },
+
+    { WCMD_RTC_SET_DATETIME, WCmdProcess_RtcSetDateTime, 6, 6, 0, WCMD_MEDIUM_MASK_ALL },
+    { WCMD_RTC_GET_DATETIME, WCmdProcess_RtcGetDateTime, 0, WCMD_PARAM_NB_ANY, 6, WCMD_MEDIUM_MASK_ALL },
+
+	{ WCMD_COMPORT_OPEN, WCmdProcess_ComPortOpen, 3, 3, 0, WCMD_MEDIUM_MASK_ALL },
+    { WCMD_COMPORT_CLOSE, WCmdProcess_ComPortClose, 1, 1, 0, WCMD_MEDIUM_MASK_ALL },
+    { WCMD_COMPORT_WRITE, WCmdProcess_ComPortWrite, 3, WCMD_PARAM_NB_ANY, 0, WCMD_MEDIUM_MASK_ALL },
+    { WCMD_COMPORT_ENABLE_TUNNEL, WCmdProcess_ComPortEnableTunnel, 2, WCMD_PARAM_NB_ANY, 0, WCMD_MEDIUM_MASK_ALL },
+    { WCMD_COMPORT_DISABLE_TUNNEL, WCmdProcess_ComPortDisableTunnel, 0, WCMD_PARAM_NB_ANY, 0, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_COMPORT_GET_TUNNEL_STATS, WCmdProcess_ComPortGetTunnelStats, 1, 1, 16, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_COMPORT_ENABLE_BRIDGE, WCmdProcess_ComPortEnableBridge, 10, 16, 0, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_COMPORT_DISABLE_BRIDGE, WCmdProcess_ComPortDisableBridge, 0, 0, 0, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_COMPORT_GET_BRIDGE_STATS, WCmdProcess_ComPortGetBridgeStats, 0, 0, 20, WCMD_MEDIUM_MASK_ALL },
+
+	{ WCMD_LOOP_PROFILER_GET_STATS, WCmdProcess_LoopProfilerGetStats, 1, 1, 21, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_LOOP_PROFILER_RESET, WCmdProcess_LoopProfilerReset, 0, WCMD_PARAM_NB_ANY, 0, WCMD_MEDIUM_MASK_ALL },
+	{ WCMD_BOOT_REPORT_GET, WCmdProcess_BootReportGet, 0, WCMD_PARAM_NB_ANY, (BOOT_REPORT_STAGE_NB * 4), WCMD_MEDIUM_MASK_ALL },
+
+	{ WCMD_TEST_CMD, WCmdProcess_TestCommand, 1, WCMD_PARAM_NB_ANY, WCMD_ANS_NB_ANY, WCMD_MEDIUM_MASK_SERIAL }
 
-	{ WCMD_GPIO_READ, WCmdProcess_GpioRead },
-	{ WCMD_GPIO_WRITE, WCmdProcess_GpioWrite },
-	{ WCMD_GPIO_SET_BIT, WCmdProcess_GpioSetBit },
-	{ WCMD_GPIO_CLR_BIT, WCmdProcess_GpioClrBit },
-
-	{ WCMD_INDICATOR_GET_WEIGHT, WCmdProcess_IndicatorGetWeight },
-	{ WCMD_INDICATOR_GET_WEIGHT_ALIBI, WCmdProcess_IndicatorGetWeightAlibi },
-	{ WCMD_INDICATOR_SET_ZERO, WCmdProcess_IndicatorSetZero },
-	{ WCMD_INDICATOR_GET_WEIGHT_ASCII, WCmdProcess_IndicatorGetWeightAscii },
-
-	{ WCMD_BADGE_READER_GET_ID, WCmdProcess_BadgeReaderGetBadgeId },
-
-	{ WCMD_LCD_WRITE, WCmdProcess_LcdWrite },
-	{ WCMD_LCD_READ, WCmdProcess_LcdRead },
-	{ WCMD_LCD_CLEAR, WCmdProcess_LcdClear },
-	{ WCMD_LCD_SET_BACKLIGHT, WCmdProcess_LcdSetBacklight },
-	{ WCMD_LCD_ENABLE_EXT_WRITE, WCmdProcess_LcdEnableExternalWrite },
-	{ WCMD_LCD_DISABLE_EXT_WRITE, WCmdProcess_LcdDisableExternalWrite },
-	{ WCMD_LCD_GET_EXT_WRITE_STATUS, WCmdProcess_LcdGetExternalWriteStatus },
-	{ WCMD_LCD_GET_EXT_WRITE_DATA, WCmdProcess_LcdGetExternalWriteData },
+};
 
-    { WCMD_EEPROM_WRITE, WCmdProcess_EepromWrite },
-    { WCMD_EEPROM_READ, WCmdProcess_EepromRead },
+static_assert(WCmdFctDescr_IsValid(cGL_pFctDescr_X, (sizeof(cGL_pFctDescr_X) / sizeof(WCMD_FCT_DESCR))), "W-Command descriptors : ID not unique or above 0x7F, or bad parameter range");
 
-    { WCMD_RTC_SET_DATETIME, WCmdProcess_RtcSetDateTime },
-    { WCMD_RTC_GET_DATETIME, WCmdProcess_RtcGetDateTime },
 
-	{ WCMD_COMPORT_OPEN, WCmdProcess_ComPortOpen },
-    { WCMD_COMPORT_CLOSE, WCmdProcess_ComPortClose },
-    { WCMD_COMPORT_WRITE, WCmdProcess_ComPortWrite },
-    { WCMD_COMPORT_ENABLE_TUNNEL, WCmdProcess_ComPortEnableTunnel },
-    { WCMD_COMPORT_DISABLE_TUNNEL, WCmdProcess_ComPortDisableTunnel },
+/* ******************************************************************************** */
+/* Events Mapping
+/* ******************************************************************************** */
+// { Event ID, Handler } - handlers of the same event are called in table order
+constexpr EVENT_BUS_SUBSCRIBER_STRUCT cGL_pEventSubscriber_X[] =
+{
+	{ EVENT_BUS_ID_LINK_DOWN, TCPServerManager_OnEvent },
+	{ EVENT_BUS_ID_ADDRESS_LOST, TCPServerManager_OnEvent },
+	{ EVENT_BUS_ID_LINK_DOWN, UDPServerManager_OnEvent },
+	{ EVENT_BUS_ID_ADDRESS_LOST, UDPServerManager_OnEvent },
 
-	{ WCMD_TEST_CMD, WCmdProcess_TestCommand }
+	{ EVENT_BUS_ID_NEW_WEIGHT, KipControlManager_OnEvent },
 
+	{ EVENT_BUS_ID_NEW_WEIGHT, BootReport_OnEvent },
+	{ EVENT_BUS_ID_LINK_UP, BootReport_OnEvent },
+	{ EVENT_BUS_ID_ADDRESS_BOUND, BootReport_OnEvent },
+	{ EVENT_BUS_ID_GPRS_STATE, BootReport_OnEvent }
 };
 
+static_assert(EventBusSubscriber_IsValid(cGL_pEventSubscriber_X, (sizeof(cGL_pEventSubscriber_X) / sizeof(EVENT_BUS_SUBSCRIBER_STRUCT))), "Event subscribers : unknown event ID, no handler or too many subscribers");
+
 
 
 /* ******************************************************************************** */
@@ -99,6 +143,9 @@ const WCMD_FCT_DESCR cGL_pFctDescr_X[] =
 /* ******************************************************************************** */
 void setup() {
 
+    /* Boot Report - time origin of the boot stages */
+    BootReport_Init();
+
     /* Assign Static Pinout */
     GL_GlobalData_X.pGpioInputIndex_UB[0] = PIN_GPIO_INPUT0;
     GL_GlobalData_X.pGpioInputIndex_UB[1] = PIN_GPIO_INPUT1;
@@ -132,6 +179,7 @@ void setup() {
 
     /* Print out Global Header */ 
     DBG_PRINTLN(DEBUG_SEVERITY_INFO, "-------------------- W-LINK --------------------");
+    DBG_PRINTLN(DEBUG_SEVERITY_INFO, "Target = " WLINK_TARGET_NAME);
 
     /* Assign Revision ID */
     DBG_PRINT(DEBUG_SEVERITY_INFO, "Revision ID = " + cGL_pWLinkRevisionId_Str);
@@ -148,6 +196,14 @@ void setup() {
     digitalWrite(GL_GlobalData_X.LedPin_UB, HIGH);	// Turn-on by default
 
 
+#ifdef APP_USE_LOOP_PROFILER
+    /* Loop Profiler Initialization */
+    LoopProfiler_Init();
+#endif
+
+    /* Event Bus Initialization - before the managers publish */
+    EventBus_Init(cGL_pEventSubscriber_X, (sizeof(cGL_pEventSubscriber_X) / sizeof(EVENT_BUS_SUBSCRIBER_STRUCT)));
+
     /* W-Link Manager Initialization */
     WLinkManager_Init();
     WLinkManager_Enable();
@@ -162,9 +218,16 @@ void setup() {
 /* ******************************************************************************** */
 void loop() {
 
-    BlinkingLedManager_Process();
+    LOOP_PROFILER_START(LOOP_PROFILER_ID_LOOP);
+
+    LOOP_PROFILER_CALL(LOOP_PROFILER_ID_BLINKING_LED, BlinkingLedManager_Process());
     WLinkManager_Process();
 
+    LOOP_PROFILER_STOP(LOOP_PROFILER_ID_LOOP);
+    LOOP_PROFILER_REPORT();
+
+    Debug_Process();    // Send buffered Debug messages without waiting for the UART
+
 }
 
 
@@ -191,3 +254,31 @@ void serialEvent() { GL_GlobalConfig_X.pComPortConfig_X[PORT_COM0].pFctCommEvent
 void serialEvent1() { GL_GlobalConfig_X.pComPortConfig_X[PORT_COM1].pFctCommEvent(); }
 void serialEvent2() { GL_GlobalConfig_X.pComPortConfig_X[PORT_COM2].pFctCommEvent(); }
 void serialEvent3() { GL_GlobalConfig_X.pComPortConfig_X[PORT_COM3].pFctCommEvent(); }
+
+
+/* ******************************************************************************** */
+/* Host Entry Point
+/* ******************************************************************************** */
+#ifdef WLINK_HOST_BUILD
+/* Mimics the main() of the Arduino Due core so that setup()/loop() can run on a
+ * host against the HAL shim of Host/Hal. The shim provides the Arduino API
+ * (millis(), Serial, Wire, Ethernet, SD, LiquidCrystal...) and the hooks below.
+ * Usage : WLink [Options] [LoopNb]  - LoopNb = 0 (default) runs forever */
+extern void serialEventRun(void);   // Calls serialEventX() when data are available on COM Port X
+extern unsigned long HostHal_Init(int argc, char * argv[]);    // Returns LoopNb
+extern void HostHal_Step(void);     // Called after each loop (clock advance, socket polling...)
+
+int main(int argc, char * argv[]) {
+    unsigned long LoopNb_UL = HostHal_Init(argc, argv);
+
+    setup();
+
+    for (unsigned long i = 0; (LoopNb_UL == 0) || (i < LoopNb_UL); i++) {
+        loop();
+        serialEventRun();
+        HostHal_Step();
+    }
+
+    return 0;
+}
+#endif // WLINK_HOST_BUILD
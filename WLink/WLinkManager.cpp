@@ -6,6 +6,13 @@
 /*		Describes the state machine to manage the whole W-Link          			*/
 /*                                                                                  */
 /* History :  	25/02/2017  (RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Profile each manager with LoopProfiler			*/
+/*				18/10/2026	(RW)	Push the weights to the subscribed clients		*/
+/*				18/10/2026	(RW)	Process the GSM Server							*/
+/*				18/10/2026	(RW)	Process the Serial Bridge						*/
+/*				18/10/2026	(RW)	Dispatch the events of the Event Bus			*/
+/*				18/10/2026	(RW)	Process the EEPROM write queue					*/
+/*				18/10/2026	(RW)	Process the devices already configured			*/
 /*                                                                                  */
 /* ******************************************************************************** */
 
@@ -20,6 +27,7 @@
 #include "WMenuManager.h"
 
 #include "Debug.h"
+#include "LoopProfiler.h"
 
 
 /* ******************************************************************************** */
@@ -56,6 +64,8 @@ static void ProcessConfig(void);
 static void ProcessWLink(void);
 static void ProcessError(void);
 
+static void ProcessDevices(void);
+
 
 static void TransitionToIdle(void);
 static void TransitionToConfig(void);
@@ -85,6 +95,7 @@ void WLinkManager_Disable() {
 
 void WLinkManager_Reset() {
     DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "Reset W-Link Manager");
+    Debug_Flush();
     delay(200);
 
     // RSTC_CR = 0x400E1A00 --> Reset Controller Control Register Address
@@ -128,8 +139,13 @@ void ProcessIdle(void) {
 }
 
 void ProcessConfig(void) {
-    if (WConfigManager_Process() != WCFG_STS_BUSY) {
-        if (WConfigManager_Process() == WCFG_STS_OK) {
+    WCFG_STATUS Status_E = WConfigManager_Process();
+
+    // Devices are started as soon as they are configured -> no need to wait for the whole configuration
+    ProcessDevices();
+
+    if (Status_E != WCFG_STS_BUSY) {
+        if (Status_E == WCFG_STS_OK) {
             WConfigManager_Disable();
             TransitionToProcessWLink();
         }
@@ -141,37 +157,52 @@ void ProcessConfig(void) {
 
 void ProcessWLink(void) {
 
-    // Always run SerialManager
-    SerialManager_Process();
-
+    ProcessDevices();
 
-    // If Interface is enabled -> call process() from Interface Manager
-    if (GL_GlobalConfig_X.EthConfig_X.isEnabled_B)                              NetworkAdapterManager_Process();
-    if (GL_GlobalConfig_X.EthConfig_X.TcpServerConfig_X.isEnabled_B)            TCPServerManager_Process();
-    if (GL_GlobalConfig_X.EthConfig_X.UdpServerConfig_X.isEnabled_B)            UDPServerManager_Process();
-    if (GL_GlobalConfig_X.GsmConfig_X.isEnabled_B)                              FonaModuleManager_Process();
-    
     // W-Link Command Manager
-    if (GL_GlobalConfig_X.WCmdConfig_X.Medium_E != WLINK_WCMD_MEDIUM_NONE)      WCommandInterpreter_Process();
-
-    // High-level devices
-    IndicatorManager_Process();
-
+    if (GL_GlobalConfig_X.WCmdConfig_X.Medium_E != WLINK_WCMD_MEDIUM_NONE)      LOOP_PROFILER_CALL(LOOP_PROFILER_ID_WCMD_INTERPRETER, WCommandInterpreter_Process());
 
     // Menu Management
-    if (GL_GlobalData_X.FlatPanel_H.isInitialized())                            FlatPanelManager_Process(); 
-    if(GL_GlobalConfig_X.HasLcd_B && GL_GlobalConfig_X.HasFlatPanel_B)          WMenuManager_Process();
+    if (GL_GlobalData_X.FlatPanel_H.isInitialized())                            LOOP_PROFILER_CALL(LOOP_PROFILER_ID_FLAT_PANEL, FlatPanelManager_Process());
+    if(GL_GlobalConfig_X.HasLcd_B && GL_GlobalConfig_X.HasFlatPanel_B)          LOOP_PROFILER_CALL(LOOP_PROFILER_ID_WMENU, WMenuManager_Process());
 
     // Call application
     if (GL_GlobalConfig_X.App_X.hasApplication_B) {
-        if (GL_GlobalConfig_X.App_X.pFctIsEnabled())                            GL_GlobalConfig_X.App_X.pFctProcess();
+        if (GL_GlobalConfig_X.App_X.pFctIsEnabled())                            LOOP_PROFILER_CALL(LOOP_PROFILER_ID_APPLICATION, GL_GlobalConfig_X.App_X.pFctProcess());
     }
 
 }
 
+void ProcessDevices(void) {
+
+    // Events published during the previous loop
+    LOOP_PROFILER_CALL(LOOP_PROFILER_ID_EVENT_BUS, EventBus_Process());
+
+    // Always run SerialManager
+    LOOP_PROFILER_CALL(LOOP_PROFILER_ID_SERIAL, SerialManager_Process());
+
+    // Queued EEPROM writes
+    if (GL_GlobalData_X.Eeprom_H.isInitialized())                              LOOP_PROFILER_CALL(LOOP_PROFILER_ID_EEPROM, GL_GlobalData_X.Eeprom_H.process());
+
+
+    // If Interface is enabled -> call process() from Interface Manager
+    if (GL_GlobalConfig_X.EthConfig_X.isEnabled_B)                              LOOP_PROFILER_CALL(LOOP_PROFILER_ID_NETWORK_ADAPTER, NetworkAdapterManager_Process());
+    if (GL_GlobalConfig_X.EthConfig_X.TcpServerConfig_X.isEnabled_B)            LOOP_PROFILER_CALL(LOOP_PROFILER_ID_TCP_SERVER, TCPServerManager_Process());
+    if (GL_GlobalConfig_X.EthConfig_X.UdpServerConfig_X.isEnabled_B)            LOOP_PROFILER_CALL(LOOP_PROFILER_ID_UDP_SERVER, UDPServerManager_Process());
+    if (GL_GlobalConfig_X.EthConfig_X.isEnabled_B)                              LOOP_PROFILER_CALL(LOOP_PROFILER_ID_SERIAL_BRIDGE, SerialBridgeManager_Process());
+    if (GL_GlobalConfig_X.GsmConfig_X.isEnabled_B)                              LOOP_PROFILER_CALL(LOOP_PROFILER_ID_FONA_MODULE, FonaModuleManager_Process());
+    if (GL_GlobalConfig_X.GsmConfig_X.ServerConfig_X.isEnabled_B)               LOOP_PROFILER_CALL(LOOP_PROFILER_ID_GSM_SERVER, GSMServerManager_Process());
+
+    // High-level devices
+    LOOP_PROFILER_CALL(LOOP_PROFILER_ID_INDICATOR, IndicatorManager_Process());
+    if (WeightStream_IsActive())                                                LOOP_PROFILER_CALL(LOOP_PROFILER_ID_WEIGHT_STREAM, WeightStream_Process());
+
+}
+
 void ProcessError(void) {
     // Allow user to configure EEPROM through Debug port -> Need a restart after the configuration parameters are loaded
     if (GL_GlobalConfig_X.WCmdConfig_X.Medium_E != WLINK_WCMD_MEDIUM_NONE)      WCommandInterpreter_Process();
+    if (GL_GlobalData_X.Eeprom_H.isInitialized())                              GL_GlobalData_X.Eeprom_H.process();
 }
 
 
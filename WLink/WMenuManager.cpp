@@ -21,6 +21,7 @@
 #include "WMenuItemFunction.h"
 
 #include "Debug.h"
+#include "LoopProfiler.h"
 
 
 /* ******************************************************************************** */
@@ -152,6 +153,7 @@ void WMenuManager_Disable() {
 }
 
 void WMenuManager_Process() {
+    LOOP_PROFILER_SET_STATE(LOOP_PROFILER_ID_WMENU, GL_WMenuManager_CurrentState_E);
     switch (GL_WMenuManager_CurrentState_E) {
     case WMENU_IDLE:
         ProcessIdle();
@@ -0,0 +1,203 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* WeightStream.cpp																	*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Describes the functions to push the weights to the subscribed clients		*/
+/*		A subscription is bound to the endpoint of the W-Command which created it	*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*				18/10/2026	(RW)	Event framed as negotiated by the subscriber	*/
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#define MODULE_NAME		"WeightStream"
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+
+#include "WeightStream.h"
+
+#include "WLink.h"
+#include "WCommandInterpreter.h"
+
+#include "Debug.h"
+
+/* ******************************************************************************** */
+/* Local Variables
+/* ******************************************************************************** */
+extern GLOBAL_PARAM_STRUCT GL_GlobalData_X;
+
+static WEIGHT_STREAM_SUBSCRIPTION_STRUCT GL_pWeightStreamSubscription_X[WEIGHT_STREAM_MAX_SUBSCRIPTION_NB];
+static unsigned char GL_WeightStreamActiveNb_UB = 0;
+
+/* ******************************************************************************** */
+/* Prototypes for Internal Functions
+/* ******************************************************************************** */
+static WEIGHT_STREAM_SUBSCRIPTION_STRUCT * FindSubscription(unsigned char IndicatorIdx_UB, const WCMD_MEDIUM_ENDPOINT_STRUCT * pEndpoint_X);
+static void CloseSubscription(WEIGHT_STREAM_SUBSCRIPTION_STRUCT * pSubscription_X);
+static void PushWeight(WEIGHT_STREAM_SUBSCRIPTION_STRUCT * pSubscription_X, Indicator * pIndicator_H);
+
+/* ******************************************************************************** */
+/* Functions
+/* ******************************************************************************** */
+
+// Must be called from a W-Command handler -> the subscription is bound to the current endpoint
+boolean WeightStream_Subscribe(unsigned char IndicatorIdx_UB, unsigned char Flags_UB, unsigned int Deadband_UI) {
+	WCMD_MEDIUM_ENDPOINT_STRUCT Endpoint_X;
+	WEIGHT_STREAM_SUBSCRIPTION_STRUCT * pSubscription_X = NULL;
+
+	if ((IndicatorIdx_UB >= INDICATOR_MANAGER_MAX_NB) || !WCmdMedium_GetEndpoint(&Endpoint_X))
+		return false;
+
+	// Same client and Indicator -> update the subscription
+	pSubscription_X = FindSubscription(IndicatorIdx_UB, &Endpoint_X);
+
+	if (pSubscription_X == NULL) {
+		for (int i = 0; i < WEIGHT_STREAM_MAX_SUBSCRIPTION_NB; i++) {
+			if (!(GL_pWeightStreamSubscription_X[i].IsActive_B)) {
+				pSubscription_X = &GL_pWeightStreamSubscription_X[i];
+				GL_WeightStreamActiveNb_UB++;
+				break;
+			}
+		}
+	}
+
+	if (pSubscription_X == NULL) {
+		DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "No more subscription available");
+		return false;
+	}
+
+	pSubscription_X->IsActive_B = true;
+	pSubscription_X->IndicatorIdx_UB = IndicatorIdx_UB;
+	pSubscription_X->Flags_UB = Flags_UB;
+	pSubscription_X->Deadband_UI = Deadband_UI;
+	pSubscription_X->SequenceNb_UL = 0;
+	pSubscription_X->LastFrameNb_UL = GL_GlobalData_X.pIndicator_H[IndicatorIdx_UB].getFrameNumber();
+	pSubscription_X->HasLastValue_B = false;
+	pSubscription_X->LastValue_SI = 0;
+	pSubscription_X->Endpoint_X = Endpoint_X;
+
+	DBG_PRINT(DEBUG_SEVERITY_INFO, "Subscription to Indicator ");
+	DBG_PRINTDATA(IndicatorIdx_UB);
+	DBG_PRINTDATA(" - Flags = 0x");
+	DBG_PRINTDATABASE(Flags_UB, HEX);
+	DBG_PRINTDATA(" - Deadband = ");
+	DBG_PRINTDATA(Deadband_UI);
+	DBG_ENDSTR();
+
+	return true;
+}
+
+boolean WeightStream_Unsubscribe(unsigned char IndicatorIdx_UB) {
+	WCMD_MEDIUM_ENDPOINT_STRUCT Endpoint_X;
+	WEIGHT_STREAM_SUBSCRIPTION_STRUCT * pSubscription_X = NULL;
+
+	if (!WCmdMedium_GetEndpoint(&Endpoint_X))
+		return false;
+
+	pSubscription_X = FindSubscription(IndicatorIdx_UB, &Endpoint_X);
+	if (pSubscription_X == NULL)
+		return false;
+
+	CloseSubscription(pSubscription_X);
+	return true;
+}
+
+boolean WeightStream_IsActive(void) {
+	return ((GL_WeightStreamActiveNb_UB != 0) ? true : false);
+}
+
+void WeightStream_Process(void) {
+	WEIGHT_STREAM_SUBSCRIPTION_STRUCT * pSubscription_X = NULL;
+	Indicator * pIndicator_H = NULL;
+	unsigned long FrameNb_UL = 0;
+	signed int Delta_SI = 0;
+
+	for (int i = 0; i < WEIGHT_STREAM_MAX_SUBSCRIPTION_NB; i++) {
+		pSubscription_X = &GL_pWeightStreamSubscription_X[i];
+		if (!(pSubscription_X->IsActive_B))
+			continue;
+
+		// Client gone -> release the subscription
+		if (!WCmdMedium_IsEndpointConnected(&(pSubscription_X->Endpoint_X))) {
+			DBG_PRINTLN(DEBUG_SEVERITY_WARNING, "Client disconnected");
+			CloseSubscription(pSubscription_X);
+			continue;
+		}
+
+		// New weight ?
+		pIndicator_H = &(GL_GlobalData_X.pIndicator_H[pSubscription_X->IndicatorIdx_UB]);
+		FrameNb_UL = pIndicator_H->getFrameNumber();
+		if (FrameNb_UL == pSubscription_X->LastFrameNb_UL)
+			continue;
+
+		pSubscription_X->LastFrameNb_UL = FrameNb_UL;
+
+		// Filters
+		if (((pSubscription_X->Flags_UB & WEIGHT_STREAM_FLAG_STABLE_ONLY) == WEIGHT_STREAM_FLAG_STABLE_ONLY) &&
+			(pIndicator_H->getWeightStatus() != INDICATOR_WEIGHT_STATUS_STABLE))
+			continue;
+
+		if (pSubscription_X->HasLastValue_B && (pSubscription_X->Deadband_UI != 0)) {
+			Delta_SI = pIndicator_H->getWeightValue() - pSubscription_X->LastValue_SI;
+			if (abs(Delta_SI) < (signed int)(pSubscription_X->Deadband_UI))
+				continue;
+		}
+
+		PushWeight(pSubscription_X, pIndicator_H);
+	}
+}
+
+
+/* ******************************************************************************** */
+/* Internal Functions
+/* ******************************************************************************** */
+WEIGHT_STREAM_SUBSCRIPTION_STRUCT * FindSubscription(unsigned char IndicatorIdx_UB, const WCMD_MEDIUM_ENDPOINT_STRUCT * pEndpoint_X) {
+	for (int i = 0; i < WEIGHT_STREAM_MAX_SUBSCRIPTION_NB; i++) {
+		if (GL_pWeightStreamSubscription_X[i].IsActive_B && (GL_pWeightStreamSubscription_X[i].IndicatorIdx_UB == IndicatorIdx_UB) &&
+			WCmdMedium_IsSameEndpoint(&(GL_pWeightStreamSubscription_X[i].Endpoint_X), pEndpoint_X))
+			return &GL_pWeightStreamSubscription_X[i];
+	}
+
+	return NULL;
+}
+
+void CloseSubscription(WEIGHT_STREAM_SUBSCRIPTION_STRUCT * pSubscription_X) {
+	DBG_PRINT(DEBUG_SEVERITY_INFO, "End of subscription to Indicator ");
+	DBG_PRINTDATA(pSubscription_X->IndicatorIdx_UB);
+	DBG_PRINTDATA(" - Pushed frames = ");
+	DBG_PRINTDATA(pSubscription_X->SequenceNb_UL);
+	DBG_ENDSTR();
+
+	pSubscription_X->IsActive_B = false;
+	GL_WeightStreamActiveNb_UB--;
+}
+
+void PushWeight(WEIGHT_STREAM_SUBSCRIPTION_STRUCT * pSubscription_X, Indicator * pIndicator_H) {
+	unsigned char pData_UB[WEIGHT_STREAM_EVENT_DATA_SIZE];
+	unsigned char pBuffer_UB[WEIGHT_STREAM_EVENT_DATA_SIZE + WCMD_MAX_FRAME_OVERHEAD];
+	unsigned long Offset_UL = 0;
+	unsigned long TimeStamp_UL = pIndicator_H->getFrameTimeStamp();
+	unsigned long Value_UL = pIndicator_H->getWeightUnsignedValue();
+
+	pData_UB[Offset_UL++] = pSubscription_X->IndicatorIdx_UB;
+	for (int i = 0; i < 4; i++)
+		pData_UB[Offset_UL++] = (unsigned char)(pSubscription_X->SequenceNb_UL >> (i * 8));
+	for (int i = 0; i < 4; i++)
+		pData_UB[Offset_UL++] = (unsigned char)(TimeStamp_UL >> (i * 8));
+	pData_UB[Offset_UL++] = (unsigned char)(pIndicator_H->getWeightStatus());
+	pData_UB[Offset_UL++] = (unsigned char)(pIndicator_H->getWeightSign());
+	for (int i = 0; i < 4; i++)
+		pData_UB[Offset_UL++] = (unsigned char)(Value_UL >> (i * 8));
+
+	// Same framing as a W-Command response on the channel of the subscriber (sequence ID 0 in V2)
+	Offset_UL = WCommandInterpreter_BuildFrame(WCommandInterpreter_GetFraming(pSubscription_X->Endpoint_X.Channel_UB), 0, WCMD_INDICATOR_WEIGHT_EVENT, WCMD_FCT_STS_OK, pData_UB, Offset_UL, pBuffer_UB);
+
+	WCmdMedium_WriteEndpoint(&(pSubscription_X->Endpoint_X), pBuffer_UB, Offset_UL);
+
+	pSubscription_X->SequenceNb_UL++;
+	pSubscription_X->HasLastValue_B = true;
+	pSubscription_X->LastValue_SI = pIndicator_H->getWeightValue();
+}
@@ -0,0 +1,58 @@
+/* ******************************************************************************** */
+/*                                                                                  */
+/* WeightStream.h																	*/
+/*                                                                                  */
+/* Description :                                                                    */
+/*		Header file for WeightStream.cpp											*/
+/*		Pushes the new weights of the Indicators to the subscribed W-Command		*/
+/*		clients without request														*/
+/*                                                                                  */
+/* History :	18/10/2026	(RW)	Creation of this file                           */
+/*                                                                                  */
+/* ******************************************************************************** */
+
+#ifndef __WEIGHT_STREAM_H__
+#define __WEIGHT_STREAM_H__
+
+/* ******************************************************************************** */
+/* Include
+/* ******************************************************************************** */
+#include <Arduino.h>
+
+#include "WCommandMedium.h"
+
+/* ******************************************************************************** */
+/* Define
+/* ******************************************************************************** */
+#define WEIGHT_STREAM_MAX_SUBSCRIPTION_NB	4
+
+#define WEIGHT_STREAM_FLAG_STABLE_ONLY		0x01	// Push only the stable weights
+
+// Pushed frame = W-Command response with ID WCMD_INDICATOR_WEIGHT_EVENT and data :
+// [INDICATOR IDX][SEQUENCE NB (4)][TIMESTAMP ms (4)][STATUS][SIGN][VALUE (4)] - LSB first
+#define WEIGHT_STREAM_EVENT_DATA_SIZE		15
+
+/* ******************************************************************************** */
+/* Structure & Enumeration
+/* ******************************************************************************** */
+typedef struct {
+	boolean IsActive_B;
+	unsigned char IndicatorIdx_UB;
+	unsigned char Flags_UB;
+	unsigned int Deadband_UI;				// Minimum change of the weight to push it (0 = every new weight)
+	unsigned long SequenceNb_UL;			// Number of the next pushed frame
+	unsigned long LastFrameNb_UL;			// Last response of the Indicator handled
+	boolean HasLastValue_B;
+	signed int LastValue_SI;				// Last pushed weight (for deadband)
+	WCMD_MEDIUM_ENDPOINT_STRUCT Endpoint_X;
+} WEIGHT_STREAM_SUBSCRIPTION_STRUCT;
+
+/* ******************************************************************************** */
+/* Functions Prototypes
+/* ******************************************************************************** */
+boolean WeightStream_Subscribe(unsigned char IndicatorIdx_UB, unsigned char Flags_UB, unsigned int Deadband_UI);
+boolean WeightStream_Unsubscribe(unsigned char IndicatorIdx_UB);
+boolean WeightStream_IsActive(void);
+void WeightStream_Process(void);
+
+#endif // __WEIGHT_STREAM_H__